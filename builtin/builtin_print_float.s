@@ -1,17 +1,118 @@
 .data
 .SL1:
-	.string	"%f\n"
+	.string	"-nan"
+.SL2:
+	.string	"-inf"
+.C1:
+	.double	1000000
 .text
 .globl	__print_float
 __print_float:
 	push	%ebp
 	mov	%esp, %ebp
-	sub	$8, %esp
-	flds	8(%ebp)
-	fstpl	(%esp)
-	push	$.SL1
-	call	printf
-	add	$12, %esp
+	push	%ebx
+	push	%esi
+	push	%edi
+	sub	$92, %esp
+	# prints what printf("%f\n") does for the value converted to double, as
+	# the integer N = |x| * 10^6 rounded to nearest even, in six 32-bit limbs
+	# at -40(%ebp), with the point before its last six digits
+	mov	8(%ebp), %eax
+	mov	%eax, %edx
+	and	$0x7FFFFFFF, %edx
+	cmp	$0x7F800000, %edx
+	jb	.L1
+	mov	$.SL1, %edi
+	jne	.L0
+	mov	$.SL2, %edi
+.L0:
+	test	%eax, %eax
+	js	.L9
+	inc	%edi
+	jmp	.L9
+.L1:
+	movl	$0, -40(%ebp)
+	movl	$0, -36(%ebp)
+	movl	$0, -32(%ebp)
+	movl	$0, -28(%ebp)
+	movl	$0, -24(%ebp)
+	movl	$0, -20(%ebp)
+	cmp	$0x4F800000, %edx
+	jae	.L2
+	# below 2^32 the product is exact and fistpll rounds it to nearest even
+	mov	%edx, -40(%ebp)
+	flds	-40(%ebp)
+	fmull	.C1
+	fistpll	-40(%ebp)
+	jmp	.L3
+.L2:
+	# larger values are integers m * 2^k, so N = m * 10^6 * 2^k exactly
+	mov	%edx, %ecx
+	shr	$23, %ecx
+	sub	$150, %ecx
+	and	$0x7FFFFF, %edx
+	or	$0x800000, %edx
+	mov	%edx, %eax
+	mov	$1000000, %edx
+	mul	%edx
+	xor	%esi, %esi
+	mov	%ecx, %ebx
+	shr	$5, %ebx
+	and	$31, %ecx
+	shld	%cl, %edx, %esi
+	shld	%cl, %eax, %edx
+	shl	%cl, %eax
+	mov	%eax, -40(%ebp,%ebx,4)
+	mov	%edx, -36(%ebp,%ebx,4)
+	mov	%esi, -32(%ebp,%ebx,4)
+.L3:
+	lea	-41(%ebp), %edi
+	movb	$0, (%edi)
+	mov	$6, %esi
+	mov	$10, %ebx
+.L4:
+	# one digit per division of the limbs in use by 10
+	xor	%edx, %edx
+	mov	%esi, %ecx
+.L5:
+	mov	-44(%ebp,%ecx,4), %eax
+	div	%ebx
+	mov	%eax, -44(%ebp,%ecx,4)
+	dec	%ecx
+	jnz	.L5
+	add	$48, %edx
+	dec	%edi
+	mov	%dl, (%edi)
+	lea	-41(%ebp), %eax
+	sub	%edi, %eax
+	cmp	$6, %eax
+	jne	.L6
+	dec	%edi
+	movb	$46, (%edi)
+.L6:
+	cmpl	$0, -44(%ebp,%esi,4)
+	jne	.L4
+	dec	%esi
+	jnz	.L6
+	# at least one digit before the point
+	lea	-41(%ebp), %eax
+	sub	%edi, %eax
+	cmp	$8, %eax
+	jge	.L7
+	mov	$1, %esi
+	jmp	.L4
+.L7:
+	cmpl	$0, 8(%ebp)
+	jge	.L9
+	dec	%edi
+	movb	$45, (%edi)
+.L9:
+	push	%edi
+	call	puts
+	add	$4, %esp
+	mov	-4(%ebp), %ebx
+	mov	-8(%ebp), %esi
+	mov	-12(%ebp), %edi
 	mov	%ebp, %esp
 	pop	%ebp
 	ret
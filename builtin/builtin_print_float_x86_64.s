@@ -0,0 +1,108 @@
+.data
+.SL1:
+	.string	"-nan"
+.SL2:
+	.string	"-inf"
+.C1:
+	.double	1000000
+.text
+.globl	__print_float
+__print_float:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$96, %rsp
+	# prints what printf("%f\n") does for the value converted to double, as
+	# the integer N = |x| * 10^6 rounded to nearest even, in three 64-bit
+	# limbs at -32(%rbp), with the point before its last six digits
+	movd	%xmm0, %eax
+	mov	%eax, %r11d
+	mov	%eax, %edx
+	and	$0x7FFFFFFF, %edx
+	cmp	$0x7F800000, %edx
+	jb	.L1
+	lea	.SL1(%rip), %rdi
+	jne	.L0
+	lea	.SL2(%rip), %rdi
+.L0:
+	test	%eax, %eax
+	js	.L9
+	inc	%rdi
+	jmp	.L9
+.L1:
+	movq	$0, -32(%rbp)
+	movq	$0, -24(%rbp)
+	movq	$0, -16(%rbp)
+	cmp	$0x4F800000, %edx
+	jae	.L2
+	# below 2^32 the product is exact and cvtsd2si rounds it to nearest even
+	movd	%edx, %xmm0
+	cvtss2sd	%xmm0, %xmm0
+	mulsd	.C1(%rip), %xmm0
+	cvtsd2si	%xmm0, %rcx
+	mov	%rcx, -32(%rbp)
+	jmp	.L3
+.L2:
+	# larger values are integers m * 2^k, so N = m * 10^6 * 2^k exactly
+	mov	%edx, %ecx
+	shr	$23, %ecx
+	sub	$150, %ecx
+	and	$0x7FFFFF, %edx
+	or	$0x800000, %edx
+	imul	$1000000, %rdx, %rdx
+	xor	%r8, %r8
+	mov	%ecx, %r9d
+	shr	$6, %r9d
+	and	$63, %ecx
+	shld	%cl, %rdx, %r8
+	shl	%cl, %rdx
+	mov	%rdx, -32(%rbp,%r9,8)
+	mov	%r8, -24(%rbp,%r9,8)
+.L3:
+	lea	-33(%rbp), %rsi
+	movb	$0, (%rsi)
+	mov	$3, %r9
+	mov	$10, %r10
+.L4:
+	# one digit per division of the limbs in use by 10
+	xor	%edx, %edx
+	mov	%r9, %rcx
+.L5:
+	mov	-40(%rbp,%rcx,8), %rax
+	div	%r10
+	mov	%rax, -40(%rbp,%rcx,8)
+	dec	%rcx
+	jnz	.L5
+	add	$48, %edx
+	dec	%rsi
+	mov	%dl, (%rsi)
+	lea	-33(%rbp), %rax
+	sub	%rsi, %rax
+	cmp	$6, %rax
+	jne	.L6
+	dec	%rsi
+	movb	$46, (%rsi)
+.L6:
+	cmpq	$0, -40(%rbp,%r9,8)
+	jne	.L4
+	dec	%r9
+	jnz	.L6
+	# at least one digit before the point
+	lea	-33(%rbp), %rax
+	sub	%rsi, %rax
+	cmp	$8, %rax
+	jge	.L7
+	mov	$1, %r9
+	jmp	.L4
+.L7:
+	test	%r11d, %r11d
+	jns	.L8
+	dec	%rsi
+	movb	$45, (%rsi)
+.L8:
+	mov	%rsi, %rdi
+.L9:
+	call	puts
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
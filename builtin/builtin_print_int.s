@@ -1,15 +1,43 @@
-.data
-.SL1:
-	.string	"%d\n"
 .text
 .globl	__print_int
 __print_int:
 	push	%ebp
 	mov	%esp, %ebp
-	push	8(%ebp)
-	push	$.SL1
-	call	printf
-	add	$8, %esp
+	push	%ebx
+	push	%edi
+	sub	$24, %esp
+	# digits are written backwards from the end of the buffer, divided by 10
+	# with a multiplication by 2^35 / 10; puts adds the newline
+	lea	-9(%ebp), %edi
+	movb	$0, (%edi)
+	mov	8(%ebp), %ecx
+	mov	%ecx, %ebx
+	test	%ecx, %ecx
+	jns	.L1
+	neg	%ecx
+.L1:
+	mov	$0xCCCCCCCD, %eax
+	mul	%ecx
+	shr	$3, %edx
+	lea	(%edx,%edx,4), %eax
+	add	%eax, %eax
+	sub	%eax, %ecx
+	add	$48, %ecx
+	dec	%edi
+	mov	%cl, (%edi)
+	mov	%edx, %ecx
+	test	%ecx, %ecx
+	jnz	.L1
+	test	%ebx, %ebx
+	jns	.L2
+	dec	%edi
+	movb	$45, (%edi)
+.L2:
+	push	%edi
+	call	puts
+	add	$4, %esp
+	mov	-4(%ebp), %ebx
+	mov	-8(%ebp), %edi
 	mov	%ebp, %esp
 	pop	%ebp
 	ret
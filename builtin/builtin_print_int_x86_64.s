@@ -0,0 +1,39 @@
+.text
+.globl	__print_int
+__print_int:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	# digits are written backwards from the end of the buffer, divided by 10
+	# with a multiplication by 2^35 / 10; puts adds the newline
+	lea	-1(%rbp), %rsi
+	movb	$0, (%rsi)
+	mov	%edi, %r8d
+	mov	%edi, %ecx
+	test	%ecx, %ecx
+	jns	.L1
+	neg	%ecx
+.L1:
+	mov	$0xCCCCCCCD, %eax
+	mul	%ecx
+	shr	$3, %edx
+	lea	(%edx,%edx,4), %eax
+	add	%eax, %eax
+	sub	%eax, %ecx
+	add	$48, %ecx
+	dec	%rsi
+	mov	%cl, (%rsi)
+	mov	%edx, %ecx
+	test	%ecx, %ecx
+	jnz	.L1
+	test	%r8d, %r8d
+	jns	.L2
+	dec	%rsi
+	movb	$45, (%rsi)
+.L2:
+	mov	%rsi, %rdi
+	call	puts
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
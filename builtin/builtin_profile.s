@@ -0,0 +1,71 @@
+.data
+.SL1:
+	.string	"w"
+.SL2:
+	.string	"%u\n"
+.SL3:
+	.string	"%llu\n"
+.PC:
+	.long	0
+.PN:
+	.long	0
+.PF:
+	.long	0
+.text
+.globl	__profile_init
+__profile_init:
+	push	%ebp
+	mov	%esp, %ebp
+	mov	8(%ebp), %eax
+	mov	%eax, .PC
+	mov	12(%ebp), %eax
+	mov	%eax, .PN
+	mov	16(%ebp), %eax
+	mov	%eax, .PF
+	push	$__profile_dump
+	call	atexit
+	add	$4, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+__profile_dump:
+	push	%ebp
+	mov	%esp, %ebp
+	push	%ebx
+	push	%esi
+	push	$.SL1
+	push	.PF
+	call	fopen
+	add	$8, %esp
+	test	%eax, %eax
+	je	.L3
+	mov	%eax, %ebx
+	push	.PN
+	push	$.SL2
+	push	%ebx
+	call	fprintf
+	add	$12, %esp
+	xor	%esi, %esi
+.L1:
+	cmp	.PN, %esi
+	jae	.L2
+	mov	.PC, %eax
+	push	4(%eax, %esi, 8)
+	push	(%eax, %esi, 8)
+	push	$.SL3
+	push	%ebx
+	call	fprintf
+	add	$16, %esp
+	inc	%esi
+	jmp	.L1
+.L2:
+	push	%ebx
+	call	fclose
+	add	$4, %esp
+.L3:
+	pop	%esi
+	pop	%ebx
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
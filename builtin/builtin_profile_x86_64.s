@@ -0,0 +1,64 @@
+.data
+.SL1:
+	.string	"w"
+.SL2:
+	.string	"%u\n"
+.SL3:
+	.string	"%llu\n"
+.PC:
+	.quad	0
+.PN:
+	.long	0
+.PF:
+	.quad	0
+.text
+.globl	__profile_init
+__profile_init:
+	push	%rbp
+	mov	%rsp, %rbp
+	mov	%rdi, .PC(%rip)
+	mov	%esi, .PN(%rip)
+	mov	%rdx, .PF(%rip)
+	lea	__profile_dump(%rip), %rdi
+	call	atexit
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+__profile_dump:
+	push	%rbp
+	mov	%rsp, %rbp
+	push	%rbx
+	push	%r12
+	mov	.PF(%rip), %rdi
+	lea	.SL1(%rip), %rsi
+	call	fopen
+	test	%rax, %rax
+	je	.L3
+	mov	%rax, %rbx
+	mov	%rbx, %rdi
+	lea	.SL2(%rip), %rsi
+	mov	.PN(%rip), %edx
+	mov	$0, %eax
+	call	fprintf
+	xor	%r12d, %r12d
+.L1:
+	cmp	.PN(%rip), %r12d
+	jae	.L2
+	mov	.PC(%rip), %rax
+	mov	(%rax, %r12, 8), %rdx
+	mov	%rbx, %rdi
+	lea	.SL3(%rip), %rsi
+	mov	$0, %eax
+	call	fprintf
+	inc	%r12d
+	jmp	.L1
+.L2:
+	mov	%rbx, %rdi
+	call	fclose
+.L3:
+	pop	%r12
+	pop	%rbx
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,172 @@
+/*
+	ncc - Nartov C Compiler
+	Copyright 2010-2011  Alexander Nartov
+
+	ncc is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	ncc is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with ncc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _ASSEMBLER_H_
+#define _ASSEMBLER_H_
+
+#include "common.h"
+#include "codegen.h"
+
+/*
+ * Bytes of a section, in little-endian order.
+ */
+class CSectionData
+{
+public:
+	void AddByte(unsigned int AByte);
+	void AddWord(unsigned int AWord);
+	void AddLong(unsigned int ALong);
+	void AddString(const string &AString);
+	void Align(unsigned int AAlignment);
+
+	unsigned int GetLong(unsigned int AOffset) const;
+	void SetLong(unsigned int AOffset, unsigned int ALong);
+
+	unsigned int GetSize() const;
+	void Clear();
+
+	void Output(ostream &Stream) const;
+
+private:
+	string Data;
+};
+
+enum EObjectSection
+{
+	OBJECT_SECTION_UNDEFINED,
+	OBJECT_SECTION_TEXT,
+	OBJECT_SECTION_DATA,
+	OBJECT_SECTION_BSS,
+	OBJECT_SECTION_RODATA,
+	OBJECT_SECTIONS_COUNT,
+};
+
+enum ERelocationType
+{
+	RELOCATION_ABSOLUTE = 1,
+	RELOCATION_RELATIVE = 2,
+};
+
+/*
+ * ELF32 relocatable object for i386. Symbols are created by the first
+ * reference or definition and are undefined until defined. Relocations are
+ * against the text section, with the addend stored in place.
+ */
+class CObjectFile
+{
+public:
+	CObjectFile();
+
+	CSectionData& GetSection(EObjectSection ASection);
+	unsigned int AllocateBss(unsigned int ASize, unsigned int AAlignment);
+
+	unsigned int GetSymbol(const string &AName);
+	void DefineSymbol(unsigned int ASymbol, EObjectSection ASection, unsigned int AValue, unsigned int ASize = 0);
+	void SetGlobal(unsigned int ASymbol);
+
+	bool IsDefined(unsigned int ASymbol) const;
+	EObjectSection GetSymbolSection(unsigned int ASymbol) const;
+	unsigned int GetSymbolValue(unsigned int ASymbol) const;
+
+	void AddRelocation(unsigned int AOffset, unsigned int ASymbol, ERelocationType AType);
+
+	void Output(ostream &Stream);
+
+private:
+	struct CSymbol
+	{
+		string Name;
+		EObjectSection Section;
+		unsigned int Value;
+		unsigned int Size;
+		bool Global;
+	};
+
+	struct CRelocation
+	{
+		unsigned int Offset;
+		unsigned int Symbol;
+		ERelocationType Type;
+	};
+
+	CSectionData Sections[OBJECT_SECTIONS_COUNT];
+	unsigned int BssSize;
+	unsigned int BssAlignment;
+
+	map<string, unsigned int> SymbolIndices;
+	vector<CSymbol> Symbols;
+	vector<CRelocation> Relocations;
+};
+
+/*
+ * Encodes the instruction stream of i386 code into machine code of an object
+ * file, along with the string literals and global variables. Jumps take the
+ * short form where their targets are near enough: all of them start short
+ * and those that don't reach are made long until the layout settles.
+ */
+class CAssembler
+{
+public:
+	CAssembler(CAsmCode &ACode);
+
+	void Output(ostream &Stream);
+
+private:
+	void AssembleData();
+	void Layout();
+	void AssembleText();
+
+	void Encode(const CAsmInstruction &AInstruction);
+	void EncodeArithmetic(unsigned int AExtension, const CAsmOperand &ASource, const CAsmOperand &ADestination);
+	void EncodeUnary(unsigned int AOpcode, unsigned int AExtension, const CAsmOperand &AOp);
+	void EncodeShift(unsigned int AExtension, const CAsmOperand &ASource, const CAsmOperand &ADestination);
+	void EncodeMove(const CAsmOperand &ASource, const CAsmOperand &ADestination);
+	void EncodeSSE(unsigned int APrefix, unsigned int AOpcode, unsigned int ARegister, const CAsmOperand &AOp);
+	void EncodeJump(const CAsmInstruction &AInstruction, bool ALong);
+
+	void EmitModRM(unsigned int ARegister, const CAsmOperand &AOp);
+	void EmitImmediate(const CAsmOperand &AOp);
+	void EmitAddress(int ALabel, int AValue);
+
+	bool IsImmediate(const CAsmOperand &AOp) const;
+	bool IsMemory(const CAsmOperand &AOp) const;
+	bool IsAbsolute(const CAsmOperand &AOp) const;
+	bool IsShort(const CAsmOperand &AOp) const;
+	bool IsJump(const CAsmInstruction &AInstruction) const;
+
+	unsigned int GetNumber(ERegister AReg) const;
+	unsigned int GetNumber(const CAsmOperand &AOp) const;
+	bool IsXMM(const CAsmOperand &AOp) const;
+
+	unsigned int GetTarget(const CAsmOperand &AOp) const;
+	string GetSymbolName(int ALabel) const;
+
+	void Unsupported(const CAsmInstruction &AInstruction) const;
+
+	CAsmCode &Code;
+	CObjectFile Object;
+
+	CSectionData *Out;
+	bool Emitting;
+
+	map<int, unsigned int> Labels;
+	vector<unsigned int> Sizes;
+	vector<bool> Long;
+};
+
+#endif // _ASSEMBLER_H_
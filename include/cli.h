@@ -65,6 +65,7 @@ private:
 	void PopulateHelp();
 
 	void RequireArgument(ArgumentsIterator &AOption);
+	unsigned int RequireNumber(ArgumentsIterator &AOption, unsigned int AMinimum = 0);
 
 	ArgumentsContainer Args;
 	CCompilerParameters Parameters;
@@ -23,6 +23,7 @@
 #include "symbols.h"
 #include "parser.h"
 #include "prettyprinting.h"
+#include "profile.h"
 
 enum ERegister
 {
@@ -37,6 +38,25 @@ enum ERegister
 	AX,
 	CL,
 	ST0,
+	RAX,
+	RBX,
+	RCX,
+	RDX,
+	RSI,
+	RDI,
+	RSP,
+	RBP,
+	R8,
+	R9,
+	RIP,
+	XMM0,
+	XMM1,
+	XMM2,
+	XMM3,
+	XMM4,
+	XMM5,
+	XMM6,
+	XMM7,
 	INVALID_REGISTER,
 };
 
@@ -75,6 +95,7 @@ enum EMnemonic
 	XOR,
 	SAL,
 	SAR,
+	SHR,
 	LEA,
 	SAHF,
 	FLD,
@@ -91,177 +112,129 @@ enum EMnemonic
 	FCOMP,
 	FCOMPP,
 	FSTSW,
+	CLTQ,
+	MOVSLQ,
+	MOVD,
+	MOVSS,
+	MOVDQA,
+	MOVDQU,
+	MOVUPS,
+	PXOR,
+	PADDD,
+	PSUBD,
+	PAND,
+	POR,
+	PUNPCKLDQ,
+	PUNPCKLQDQ,
+	PSRLDQ,
+	PSRLQ,
+	ADDPS,
+	SUBPS,
+	MULPS,
+	DIVPS,
+	ADC,
 };
 
-static map<EMnemonic, string> MnemonicsText;
-static map<ERegister, string> RegistersText;
-
-class CAsmCmd
+enum EAsmOperandType
 {
-public:
-	virtual ~CAsmCmd();
-
-	string GetName() const;
-	void SetName(const string &AName);
-
-	virtual string GetText() const = 0;
-
-protected:
-	string Name;
-
-};
-
-class CAsmOp
-{
-public:
-	virtual string GetText() const = 0;
-
-	virtual bool IsReg() const;
-	virtual bool IsImm() const;
-	virtual bool IsMem() const;
-
+	OPERAND_NONE,
+	OPERAND_REGISTER,
+	OPERAND_IMMEDIATE,
+	OPERAND_MEMORY,
+	OPERAND_LABEL,
 };
 
-class CAsmReg : public CAsmOp
-{
-public:
-	CAsmReg(const string &AName);
-
-	string GetName() const;
-	void SetName(const string &AName);
-
-	string GetText() const;
-
-	bool IsReg() const;
-
-private:
-	string Name;
-
-};
-
-class CAsmImm : public CAsmOp
-{
-public:
-	CAsmImm(int AValue);
-
-	string GetText() const;
-
-	int GetValue() const;
-
-	bool IsImm() const;
-
-private:
-	int Value;
-};
-
-class CAsmMem : public CAsmOp
+/*
+ * Instruction operand. A register operand keeps its register in Base, an
+ * immediate its value in Value, which is the displacement of a memory operand.
+ * Labels are interned by CAsmCode, Label is -1 where there is none.
+ */
+struct CAsmOperand
 {
-public:
-	CAsmMem(int ADisplacement, ERegister ABase, ERegister AOffset, int AMultiplier);
-
-	string GetText() const;
-
-	bool IsMem() const;
-
-private:
-	int Displacement;
+	EAsmOperandType Type;
 	ERegister Base;
 	ERegister Offset;
 	int Multiplier;
-};
-
-CAsmMem* mem(int ADisplacement, ERegister ABase, ERegister AOffset = INVALID_REGISTER, int AMultiplier = 0);
-CAsmMem* mem(ERegister ABase);
-
-class CAsmLabelOp : public CAsmOp
-{
-public:
-	CAsmLabelOp(const string &AName);
-
-	string GetName() const;
-	void SetName(const string &AName);
+	int Value;
+	int Label;
 
-	string GetText() const;
+	bool IsReg() const;
+	bool IsImm() const;
+	bool IsMem() const;
+	bool IsLabel() const;
 
-private:
-	string Name;
+	bool operator==(const CAsmOperand &AOp) const;
+	bool operator!=(const CAsmOperand &AOp) const;
 };
 
-class CAsmCmd0 : public CAsmCmd
-{
-public:
-	CAsmCmd0(const string &AName);
-
-	string GetText() const;
-
-};
+CAsmOperand reg(ERegister AReg);
+CAsmOperand imm(int AValue);
+CAsmOperand mem(int ADisplacement, ERegister ABase, ERegister AOffset = INVALID_REGISTER, int AMultiplier = 0);
+CAsmOperand mem(ERegister ABase);
+CAsmOperand mem(const string &ALabel, ERegister ABase);
+CAsmOperand label(const string &AName);
 
-class CAsmCmd1 : public CAsmCmd
+enum EAsmInstructionType
 {
-public:
-	CAsmCmd1(const string &AName, CAsmOp *AOp);
-	~CAsmCmd1();
-
-	string GetText() const;
-
-	CAsmOp* GetOp() const;
-	void SetOp(CAsmOp *AOp);
-
-private:
-	CAsmOp *Op;
-
+	INSTRUCTION_REMOVED,
+	INSTRUCTION_COMMAND,
+	INSTRUCTION_LABEL,
+	INSTRUCTION_DIRECTIVE,
 };
 
-class CAsmCmd2 : public CAsmCmd
+/*
+ * Entry of the instruction stream: a command with up to two operands, a label,
+ * whose name is the label of the first operand, or a directive, with name and
+ * argument in the labels of both operands.
+ */
+struct CAsmInstruction
 {
-public:
-	CAsmCmd2(const string &AName, CAsmOp *AOp1, CAsmOp *AOp2);
-	~CAsmCmd2();
+	EAsmInstructionType Type;
+	EMnemonic Mnemonic;
+	unsigned int OperandsCount;
+	CAsmOperand Operands[2];
 
-	string GetText() const;
-
-	CAsmOp* GetOp1() const;
-	CAsmOp* GetOp2() const;
-
-	void SetOp1(CAsmOp *AOp1);
-	void SetOp2(CAsmOp *AOp2);
-
-private:
-	CAsmOp *Op1;
-	CAsmOp *Op2;
+	bool IsCommand(EMnemonic AMnemonic) const;
+	bool IsLabel() const;
 };
 
-class CAsmLabel : public CAsmCmd
+/*
+ * Buffered writer of assembler text. Text is formatted straight into a
+ * buffer that is reused for the whole output and written to the stream in one
+ * call whenever it fills up, and when the writer is flushed or destroyed.
+ */
+class CAsmWriter
 {
 public:
-	CAsmLabel(const string &AName);
+	CAsmWriter(ostream &AStream);
+	~CAsmWriter();
 
-	string GetText() const;
+	void Write(char AChar);
+	void Write(const char *AText, unsigned int ALength);
+	void Write(const string &AText);
+	void Write(int AValue);
+	void Write(float AValue);
 
-};
-
-class CAsmDirective : public CAsmCmd
-{
-public:
-	CAsmDirective(const string &AName, const string &AArgument);
-
-	string GetText() const;
+	void Flush();
 
 private:
-	string Argument;
+	static const unsigned int BufferSize = 65536;
 
+	ostream &Stream;
+	vector<char> Buffer;
+	unsigned int Length;
 };
 
 class CAsmCode
 {
 public:
-	typedef list<CAsmCmd *> CodeContainer;
+	typedef vector<CAsmInstruction> CodeContainer;
 	typedef CodeContainer::iterator CodeIterator;
 
-	CAsmCode();
+	CAsmCode(ETarget ATarget = TARGET_I386);
 	~CAsmCode();
 
-	void Add(CAsmCmd *ACmd);
+	ETarget GetTarget() const;
 
 	void Add(EMnemonic ACmd);
 	void Add(EMnemonic ACmd, ERegister AOp);
@@ -269,35 +242,75 @@ public:
 	void Add(EMnemonic ACmd, ERegister AOp1, ERegister AOp2);
 	void Add(EMnemonic ACmd, int AOp1, ERegister AOp2);
 	void Add(EMnemonic ACmd, const string &AOp);
-	void Add(EMnemonic ACmd, CAsmMem *AOp);
-	void Add(EMnemonic ACmd, ERegister AOp1, CAsmMem *AOp2);
-	void Add(EMnemonic ACmd, CAsmMem *AOp1, ERegister AOp2);
+	void Add(EMnemonic ACmd, const CAsmOperand &AOp);
+	void Add(EMnemonic ACmd, ERegister AOp1, const CAsmOperand &AOp2);
+	void Add(EMnemonic ACmd, const CAsmOperand &AOp1, ERegister AOp2);
 	void Add(const string &ALabel);
+	void AddDirective(const string &AName, const string &AArgument);
 
-	CodeIterator Insert(CodeIterator APosition, CAsmCmd *ACmd);
+	void Replace(CodeIterator APosition, const CAsmInstruction &AInstruction);
+	void Remove(CodeIterator APosition);
+	void Compact();
+	void Swap(CodeContainer &ACode);
 
-	CodeIterator Insert(CodeIterator APosition, EMnemonic ACmd, CAsmOp *AOp1, CAsmOp *AOp2);
-	CodeIterator Insert(CodeIterator APosition, EMnemonic ACmd, int AOp1, CAsmOp *AOp2);
+	bool IsChanged(CodeIterator APosition) const;
+	void ClearChanges();
 
 	CodeIterator Begin();
 	CodeIterator End();
 
-	CodeIterator Erase(CodeIterator APosition);
+	CodeIterator Next(CodeIterator APosition);
+	CodeIterator Previous(CodeIterator APosition);
+
+	static int Intern(const string &AName);
+	static const string& GetLabel(int ALabel);
 
 	string AddStringLiteral(const string &ALiteral);
 	void AddGlobalVariable(CVariableSymbol *AVariable);
 
+	const map<string, string>& GetStringLiterals() const;
+	const list<CVariableSymbol *>& GetGlobalVariables() const;
+
 	string GenerateLabel();
 
+	int GetStackDepth() const;
+	void SetStackDepth(int ADepth);
+
+	bool GetCold() const;
+	void SetCold(bool ACold);
+	bool IsCold(int ALabel) const;
+	bool HasColdLabels() const;
+	void ClearColdLabels();
+
 	void Output(ostream &Stream);
+	void OutputInstruction(CAsmWriter &AWriter, const CAsmInstruction &AInstruction);
 
 private:
+	ERegister Legalize(EMnemonic ACmd, ERegister AReg, bool ADestination = false);
+	CAsmOperand Legalize(const CAsmOperand &AOp);
+	void TrackStack(EMnemonic ACmd);
+	void MarkChanged(CodeIterator APosition);
+	void Append(EMnemonic ACmd, unsigned int ACount, const CAsmOperand &AOp1, const CAsmOperand &AOp2);
+	void OutputOperand(CAsmWriter &AWriter, const CAsmOperand &AOp);
+	void OutputRegister(CAsmWriter &AWriter, ERegister AReg);
+
+	ETarget Target;
+	map<ERegister, ERegister> WideRegisters;
+
 	CodeContainer Code;
+	vector<bool> Changed;
 
 	map<string, string> StringLiterals;
 	list<CVariableSymbol *> GlobalVariables;
 
 	unsigned int LabelsCount;
+	int StackDepth;
+
+	bool Cold;
+	set<int> ColdLabels;
+
+	static map<string, int> Labels;
+	static vector<string> LabelNames;
 
 };
 
@@ -346,9 +359,14 @@ private:
 class CCodeGenerationVisitor : public CStatementVisitor
 {
 public:
-	CCodeGenerationVisitor(CAsmCode &AAsm, bool AOptimize);
+	CCodeGenerationVisitor(CAsmCode &AAsm, bool AOptimize, bool AOmitFramePointer);
 
 	void SetFunction(CFunctionSymbol *AFuncSym);
+	void SetProfile(const CProfile *AProfile);
+	void SetCounters(CVariableSymbol *ACounters);
+
+	CAsmOperand FrameAddress(int AOffset);
+	CAsmOperand SelectAddress(CExpression *AExpr);
 
 	void Visit(CUnaryOp &AStmt);
 	void Visit(CBinaryOp &AStmt);
@@ -380,6 +398,45 @@ public:
 	void Visit(CSwitchStatement &AStmt);
 
 private:
+	void GenerateCondition(CExpression *ACondition, const string &ALabel, bool AJumpIfTrue);
+	void GenerateConditionValue(CExpression *ACondition);
+
+	ERegister ValueRegister(ERegister AReg, CTypeSymbol *AType);
+	void PushValue(const CAsmOperand &AMem, CTypeSymbol *AType);
+	CAsmOperand SelectElementAddress(CArrayAccess &AExpr);
+	bool IsDirectAddress(CExpression *AExpr);
+
+	bool IsFastCall(CFunctionSymbol *AFunc) const;
+	string GetCallName(CFunctionSymbol *AFunc) const;
+	void ClassifyArguments(CFunctionSymbol *AFunc, vector<ERegister> &ARegisters);
+	size_t AllocateArguments(CBlockStatement &ABody);
+	void SpillArguments();
+	void GenerateStatement(CStatement *AStmt);
+	void GenerateColdStatement(CStatement *AStmt, const string &ALabel);
+	bool IsCold(CStatement *AStmt, EProfileCounter ACounter) const;
+	bool IsCounter(CExpression *AExpr) const;
+	void GenerateCount(CArrayAccess &ACounter);
+	size_t GetLocalsSize(CBlockStatement &ABlock);
+	bool NeedsFrame(CBlockStatement &ABlock);
+	void ShiftLocals(CBlockStatement &ABlock, size_t AShift);
+	void GenerateSystemVCall(CFunctionSymbol *AFunc);
+	void GenerateFastCall(CFunctionSymbol *AFunc);
+	void GenerateFastCallWrapper();
+	void PushArguments(CFunctionCall &ACall);
+	bool CanTailCall(CFunctionSymbol *AFunc);
+	size_t GetStackArgumentsSize(CFunctionSymbol *AFunc);
+	void GenerateTailCall(CFunctionCall &ACall);
+
+	void GenerateVectorLoop(CForStatement &AStmt);
+	void BroadcastOperands(CExpression *AExpr, map<CExpression *, ERegister> &ABroadcasts, ERegister &AFree);
+	void GenerateVectorExpression(CExpression *AExpr, ERegister AReg, bool AFloat, map<CExpression *, ERegister> &ABroadcasts);
+
+	void GenerateMultiplication(int AValue);
+	void GenerateDivision(int AValue, bool ARemainder);
+	void ComputeMagic(int ADivisor, int &AMultiplier, int &AShift);
+	bool IsPowerOfTwo(unsigned int AValue) const;
+	int Log2(unsigned int AValue) const;
+
 	void ConvertFloatToInt();
 	void ConvertIntToFloat();
 	void PerformConversion(CTypeSymbol *LHS, CTypeSymbol *RHS);
@@ -387,6 +444,8 @@ private:
 	CAsmCode &Asm;
 	CFunctionSymbol *FuncSym;
 	int BlockNesting;
+	bool Frame;
+	size_t FrameSize;
 
 	stack<CBlockStatement *> Blocks;
 	stack<string> BreakLabels;
@@ -394,11 +453,18 @@ private:
 
 	map<ETokenType, EMnemonic> IntOperationCmd;
 	map<ETokenType, EMnemonic> FloatOperationCmd;
+	map<ETokenType, EMnemonic> IntVectorOperationCmd;
+	map<ETokenType, EMnemonic> FloatVectorOperationCmd;
 	map<ETokenType, ETokenType> CompoundAssignmentOp;
+	map<EMnemonic, EMnemonic> InvertedJump;
 
 	CAddressGenerationVisitor Addr;
 
 	bool Optimize;
+	bool OmitFramePointer;
+
+	const CProfile *Profile;
+	CVariableSymbol *Counters;
 };
 
 class CCodeGenerator
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <climits>
 #include <cstdarg>
 #include <deque>
 #include <fstream>
@@ -43,6 +44,8 @@ using namespace std;
 #define COMPILER_TITLE "Nartov C Compiler"
 #define COMPILER_VERSION "0.6.0"
 
+#define DEFAULT_PROFILE_FILENAME COMPILER_NAME ".profile"
+
 enum EExitCode
 {
 	EXIT_CODE_SUCCESS,
@@ -54,6 +57,8 @@ enum EExitCode
 	EXIT_CODE_PARSER_ERROR,
 	EXIT_CODE_UNKNOWN_ERROR,
 	EXIT_CODE_NOT_IMPLEMENTED,
+	EXIT_CODE_PROFILE_ERROR,
+	EXIT_CODE_RUNTIME_ERROR,
 };
 
 enum ECompilerMode
@@ -62,6 +67,7 @@ enum ECompilerMode
 	COMPILER_MODE_SCAN,
 	COMPILER_MODE_PARSE,
 	COMPILER_MODE_GENERATE,
+	COMPILER_MODE_RUN,
 };
 
 enum EParserOutputMode
@@ -76,6 +82,19 @@ enum EParserMode
 	PARSER_MODE_EXPRESSION,
 };
 
+enum ETarget
+{
+	TARGET_I386,
+	TARGET_X86_64,
+};
+
+enum ETimeReportFormat
+{
+	TIME_REPORT_FORMAT_NONE,
+	TIME_REPORT_FORMAT_TABLE,
+	TIME_REPORT_FORMAT_JSON,
+};
+
 enum ETokenType
 {
 	TOKEN_TYPE_INVALID,
@@ -163,6 +182,18 @@ struct CCompilerParameters
 	EParserMode ParserMode;
 	bool SymbolTables;
 	bool Optimize;
+	unsigned int InlineLimit;
+	unsigned int UnrollLimit;
+	unsigned int UnrollFactor;
+	bool OmitFramePointer;
+	bool ConstantPropagation;
+	bool GlobalCSE;
+	ETarget Target;
+	bool SSE2;
+	bool Assemble;
+	string ProfileGenerateFilename;
+	string ProfileUseFilename;
+	ETimeReportFormat TimeReport;
 };
 
 struct CPosition
@@ -226,6 +257,8 @@ string ToString(const T &t)
 	return ss.str();
 }
 
+string Unescape(const string &AString);
+
 class CStatement;
 class CUnaryOp;
 class CBinaryOp;
@@ -298,7 +331,7 @@ namespace TypeSize
 {
 	const size_t Integer = 4;
 	const size_t Float = 4;
-	const size_t Pointer = 4;
+	extern size_t Pointer;	// depends on target, also the size of a stack slot
 };
 
 namespace CharTraits
@@ -0,0 +1,431 @@
+/*
+	ncc - Nartov C Compiler
+	Copyright 2010-2011  Alexander Nartov
+
+	ncc is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	ncc is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with ncc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _DATAFLOW_H_
+#define _DATAFLOW_H_
+
+#include "common.h"
+#include "expressions.h"
+
+/*
+ * Fixed-size set of small integers stored as a bit vector.
+ */
+class CBitSet
+{
+public:
+	CBitSet(unsigned int ASize = 0, bool AValue = false);
+
+	void Resize(unsigned int ASize, bool AValue = false);
+	unsigned int GetSize() const;
+
+	bool Get(unsigned int AIndex) const;
+	void Set(unsigned int AIndex);
+	void Reset(unsigned int AIndex);
+
+	void Fill();
+	void Clear();
+
+	bool Empty() const;
+	unsigned int Count() const;
+
+	bool Union(const CBitSet &ASet);
+	bool Intersect(const CBitSet &ASet);
+	void Subtract(const CBitSet &ASet);
+	bool Intersects(const CBitSet &ASet) const;
+
+	bool operator==(const CBitSet &ASet) const;
+	bool operator!=(const CBitSet &ASet) const;
+
+private:
+	typedef unsigned long WordType;
+
+	static const unsigned int WordBits = 8 * sizeof(WordType);
+
+	void Trim();
+
+	vector<WordType> Words;
+	unsigned int Size;
+};
+
+/*
+ * Dense per-function numbering of the variables that a function accesses.
+ * Globals, arrays, structs and variables whose address is taken are escaped:
+ * they can be read or written behind the back of the analyses.
+ */
+class CVariableNumbering
+{
+public:
+	unsigned int Add(CVariableSymbol *AVariable);
+
+	int GetIndex(CVariableSymbol *AVariable) const;
+	CVariableSymbol* GetVariable(unsigned int AIndex) const;
+	unsigned int GetCount() const;
+
+	void SetEscaped(unsigned int AIndex);
+	bool GetEscaped(unsigned int AIndex) const;
+	CBitSet GetEscaped() const;
+
+private:
+	map<CVariableSymbol *, unsigned int> Indices;
+	vector<CVariableSymbol *> Variables;
+	vector<bool> Escaped;
+};
+
+/*
+ * Variables read and written by one expression. Writes in arms of ?:, && and
+ * || and partial writes to arrays and structs may not happen, so they don't
+ * kill previous values.
+ */
+struct CAccesses
+{
+	CAccesses();
+
+	vector<unsigned int> Uses;
+	vector<unsigned int> Defs;
+	vector<unsigned int> MayDefs;
+
+	bool Loads;
+	bool Stores;
+	bool Calls;
+};
+
+class CAccessCollector : public CStatementVisitor
+{
+public:
+	CAccessCollector(CVariableNumbering &ANumbering, CAccesses &AAccesses);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+private:
+	void AddDef(CExpression *AExpr);
+
+	CVariableNumbering &Numbering;
+	CAccesses &Accesses;
+
+	bool AddressOperand;
+	bool Conditional;
+};
+
+/*
+ * Straight-line piece of a function. Elements are the expressions evaluated
+ * in the block in order, along with the statement each one belongs to: an
+ * expression statement itself, a condition, a for init or update, or a
+ * return.
+ */
+class CBasicBlock
+{
+public:
+	struct CElement
+	{
+		CStatement *Statement;
+		CExpression *Expression;
+		CAccesses Accesses;
+	};
+
+	typedef vector<CElement> ElementsContainer;
+	typedef ElementsContainer::iterator ElementsIterator;
+
+	typedef vector<CBasicBlock *> BlocksContainer;
+	typedef BlocksContainer::iterator BlocksIterator;
+
+	CBasicBlock(unsigned int AIndex);
+
+	unsigned int GetIndex() const;
+
+	ElementsContainer& GetElements();
+	BlocksContainer& GetSuccessors();
+	BlocksContainer& GetPredecessors();
+
+	bool GetReachable() const;
+	void SetReachable(bool AReachable);
+
+private:
+	unsigned int Index;
+	ElementsContainer Elements;
+	BlocksContainer Successors;
+	BlocksContainer Predecessors;
+	bool Reachable;
+};
+
+/*
+ * Control flow graph of a function body, built over the statement tree.
+ * Branches that a constant condition never takes get no edges.
+ */
+class CControlFlowGraph : public CStatementVisitor
+{
+public:
+	typedef CBasicBlock::BlocksContainer BlocksContainer;
+	typedef CBasicBlock::BlocksIterator BlocksIterator;
+
+	CControlFlowGraph(CFunctionSymbol *AFunction);
+	~CControlFlowGraph();
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+	CVariableNumbering& GetNumbering();
+
+	CBasicBlock* GetEntry() const;
+	CBasicBlock* GetExit() const;
+
+	unsigned int GetSize() const;
+	CBasicBlock* GetBlock(unsigned int AIndex) const;
+
+	CBasicBlock* GetBlock(CStatement *AStmt) const;
+
+	BlocksIterator Begin();
+	BlocksIterator End();
+
+	BlocksContainer& GetOrder();
+
+	static bool IsConstant(CExpression *AExpr, bool &AValue);
+
+private:
+	CBasicBlock* NewBlock();
+	CBasicBlock* GetLabelBlock(const string &AName);
+	void Link(CBasicBlock *AFrom, CBasicBlock *ATo);
+	void Jump(CBasicBlock *ATo);
+	void Enter(CStatement *AStmt);
+	void AddElement(CStatement *AStmt, CExpression *AExpr);
+	bool IsTaken(CLabel *ACase);
+	void ComputeOrder();
+
+	CVariableNumbering Numbering;
+
+	BlocksContainer Blocks;
+	BlocksContainer Order;
+
+	CBasicBlock *Entry;
+	CBasicBlock *Exit;
+	CBasicBlock *Current;
+
+	map<CStatement *, CBasicBlock *> StatementBlocks;
+	map<string, CBasicBlock *> Labels;
+
+	stack<CBasicBlock *> BreakTargets;
+	stack<CBasicBlock *> ContinueTargets;
+	stack<CSwitchStatement *> Switches;
+	stack<CBasicBlock *> SwitchBlocks;
+};
+
+/*
+ * Iterative worklist solver of a gen/kill problem over a control flow graph.
+ * Clients fill Gen, Kill and Boundary in Initialize, the solver computes In
+ * and Out of every block. For backward problems In is still the value at the
+ * start of a block and Out is the value at its end.
+ */
+class CDataflowAnalysis
+{
+public:
+	CDataflowAnalysis(CControlFlowGraph &AGraph, bool AForward, bool AIntersection);
+	virtual ~CDataflowAnalysis();
+
+	unsigned int GetSize() const;
+
+	const CBitSet& GetIn(CBasicBlock *ABlock) const;
+	const CBitSet& GetOut(CBasicBlock *ABlock) const;
+
+protected:
+	virtual void Initialize() = 0;
+
+	void Solve();
+
+	CControlFlowGraph &Graph;
+
+	bool Forward;
+	bool Intersection;
+	unsigned int Size;
+
+	vector<CBitSet> Gen;
+	vector<CBitSet> Kill;
+	vector<CBitSet> In;
+	vector<CBitSet> Out;
+
+	CBitSet Boundary;
+};
+
+/*
+ * Variables whose current value may be read later. Escaped variables are
+ * live wherever memory is read and at the exit.
+ */
+class CLiveness : public CDataflowAnalysis
+{
+public:
+	CLiveness(CControlFlowGraph &AGraph);
+
+	void Transfer(const CBasicBlock::CElement &AElement, CBitSet &ALive) const;
+
+protected:
+	void Initialize();
+
+	CBitSet Escaped;
+};
+
+/*
+ * Assignments to variables that are not escaped which may reach a point. The
+ * first definitions are implicit ones at the entry, one per variable, with
+ * the same index as the variable.
+ */
+class CReachingDefinitions : public CDataflowAnalysis
+{
+public:
+	struct CDefinition
+	{
+		CBasicBlock *Block;
+		unsigned int Element;
+		unsigned int Variable;
+		bool May;
+	};
+
+	CReachingDefinitions(CControlFlowGraph &AGraph);
+
+	const CDefinition& GetDefinition(unsigned int AIndex) const;
+	const CBitSet& GetDefinitions(unsigned int AVariable) const;
+
+	void Transfer(CBasicBlock *ABlock, unsigned int AElement, CBitSet &AReaching) const;
+
+protected:
+	void Initialize();
+
+	vector<CDefinition> Definitions;
+	vector<CBitSet> VariableDefinitions;
+	vector<vector<unsigned int> > ElementDefinitions;
+};
+
+/*
+ * Pure expressions that have been evaluated on every path to a point and
+ * whose operands haven't changed since. Expressions are identified by value
+ * numbers, which are the same for expressions of the same structure.
+ */
+class CAvailableExpressions : public CDataflowAnalysis
+{
+public:
+	CAvailableExpressions(CControlFlowGraph &AGraph);
+
+	int GetIndex(CExpression *AExpr) const;
+	CExpression* GetExpression(unsigned int AIndex) const;
+
+	void GetEffect(const CBasicBlock::CElement &AElement, CBitSet &AGen, CBitSet &AKill) const;
+	void Transfer(const CBasicBlock::CElement &AElement, CBitSet &AAvailable) const;
+
+protected:
+	void Initialize();
+
+private:
+	enum EValueKind
+	{
+		VALUE_VARIABLE,
+		VALUE_ADDRESS,
+		VALUE_INTEGER,
+		VALUE_CHAR,
+		VALUE_FLOAT,
+		VALUE_FUNCTION,
+		VALUE_UNARY,
+		VALUE_BINARY,
+		VALUE_ELEMENT,
+		VALUE_CONDITIONAL,
+		VALUE_FIELD,
+		VALUE_INDIRECT,
+	};
+
+	/*
+	 * An operation applied to value numbers of its operands, or a leaf.
+	 */
+	struct CValueKey
+	{
+		CValueKey(EValueKind AKind, int AValue, CSymbol *ASymbol, CTypeSymbol *AType, unsigned int AFirst = 0, unsigned int ASecond = 0, unsigned int AThird = 0);
+
+		bool operator<(const CValueKey &AKey) const;
+
+		EValueKind Kind;
+		int Value;
+		CSymbol *Symbol;
+		CTypeSymbol *Type;
+		unsigned int Operands[3];
+	};
+
+	bool Enumerate(CExpression *AExpr, unsigned int &AValue, vector<unsigned int> &AOperands, bool &ALoads);
+	void Generate(CExpression *AExpr, bool AConditional, CBitSet &AGenerated) const;
+	void GenerateAddress(CExpression *AExpr, bool AConditional, CBitSet &AGenerated) const;
+	unsigned int Number(const CValueKey &AKey);
+
+	map<CValueKey, unsigned int> Values;
+	vector<int> ValueExpressions;
+
+	map<CExpression *, unsigned int> Indices;
+	vector<CExpression *> Expressions;
+
+	vector<CBitSet> VariableExpressions;
+	CBitSet LoadExpressions;
+	CBitSet Escaped;
+};
+
+#endif // _DATAFLOW_H_
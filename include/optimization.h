@@ -21,6 +21,7 @@
 
 #include "common.h"
 #include "codegen.h"
+#include "dataflow.h"
 
 class CLowLevelOptimization
 {
@@ -29,6 +30,7 @@ public:
 	virtual ~CLowLevelOptimization();
 
 	virtual bool Optimize() = 0;
+	virtual const char* GetName() const = 0;
 
 protected:
 	CAsmCode &Asm;
@@ -46,36 +48,322 @@ private:
 	typedef vector<CLowLevelOptimization *> OptimizationsContainer;
 	typedef OptimizationsContainer::iterator OptimizationsIterator;
 
+	void Run();
+
+	CAsmCode &Asm;
 	OptimizationsContainer Optimizations;
+	CLowLevelOptimization *Layout;
+};
+
+/*
+ * Control flow graph of the instruction stream. A block starts at a label or
+ * after a jump or ret and directives are blocks of their own. Each directive
+ * starts a function, which extends to the next directive. Successors of a
+ * conditional jump are its target and then the next block. The code has to be
+ * compacted before the graph is built.
+ */
+class CAsmFlowGraph
+{
+public:
+	struct CBlock
+	{
+		unsigned int Begin;
+		unsigned int End;
+		unsigned int Function;
+		vector<unsigned int> Successors;
+		vector<unsigned int> Predecessors;
+		bool Leaves;
+	};
+
+	struct CFunction
+	{
+		unsigned int Begin;
+		unsigned int End;
+		unsigned int FirstBlock;
+		unsigned int LastBlock;
+	};
+
+	CAsmFlowGraph(CAsmCode &AAsm);
+
+	void Build();
+
+	unsigned int GetSize() const;
+	const CBlock& GetBlock(unsigned int AIndex) const;
+
+	unsigned int GetFunctionsCount() const;
+	const CFunction& GetFunction(unsigned int AIndex) const;
+
+	int GetLabelBlock(int ALabel) const;
+	int GetTarget(unsigned int ABlock) const;
+	bool GetFalls(unsigned int ABlock) const;
+
+	bool IsEntry(unsigned int ABlock) const;
+	bool IsReferenced(int ALabel) const;
+
+	static bool IsJump(EMnemonic AMnemonic);
+	static bool IsConditionalJump(EMnemonic AMnemonic);
+	static EMnemonic InvertJump(EMnemonic AMnemonic);
+
+private:
+	CAsmCode &Asm;
+
+	vector<CBlock> Blocks;
+	vector<CFunction> Functions;
+	vector<int> Labels;
+
+	vector<bool> Entries;
+	vector<bool> References;
+};
+
+enum EPeepholeOperand
+{
+	PEEPHOLE_NONE,
+	PEEPHOLE_ANY,
+	PEEPHOLE_REGISTER,
+	PEEPHOLE_MEMORY,
+	PEEPHOLE_NOT_MEMORY,
+	PEEPHOLE_IMMEDIATE,
+	PEEPHOLE_STACK_TOP,
+};
+
+/*
+ * Operand of a peephole pattern. An operand with a variable binds it on its
+ * first occurrence and has to be equal to it on the next ones; in a rewrite
+ * it stands for the bound operand. Immediates are constants with Value.
+ */
+struct CPeepholeOperand
+{
+	EPeepholeOperand Kind;
+	int Variable;
+	int Value;
+};
+
+struct CPeepholeInstruction
+{
+	EAsmInstructionType Type;
+	EMnemonic Mnemonic;
+	CPeepholeOperand Operands[2];
+};
+
+/*
+ * Sequence of instructions and what it is rewritten to, which is never
+ * longer. Both end at the first entry of type INSTRUCTION_REMOVED.
+ */
+struct CPeepholeRule
+{
+	static const unsigned int Length = 2;
+	static const unsigned int Variables = 2;
+
+	CPeepholeInstruction Pattern[Length];
+	CPeepholeInstruction Rewrite[Length];
+};
+
+class CPeepholeOptimization : public CLowLevelOptimization
+{
+public:
+	CPeepholeOptimization(CAsmCode &AAsm);
+
+	bool Optimize();
+	const char* GetName() const;
+
+private:
+	typedef vector<CAsmCode::CodeIterator> WindowContainer;
+
+	bool Match(const CPeepholeRule &ARule, const WindowContainer &AWindow);
+	bool Match(const CPeepholeOperand &APattern, const CAsmOperand &AOp);
+	void Rewrite(const CPeepholeRule &ARule, const WindowContainer &AWindow);
+	CAsmOperand Substitute(const CPeepholeOperand &APattern);
+
+	void Enqueue(CAsmCode::CodeIterator APosition);
+
+	vector<CAsmCode::CodeIterator> Worklist;
+	vector<bool> Queued;
+
+	CAsmOperand Bindings[CPeepholeRule::Variables];
+	bool Bound[CPeepholeRule::Variables];
 };
 
-class CSuperfluousInstructionsRemoval : public CLowLevelOptimization
+/*
+ * Forwards values stored to stack slots, locals and globals to the loads that
+ * follow in the same basic block, folds addresses of such locations into
+ * memory operands, propagates register copies and removes pushes paired with
+ * pops. Moves to dead registers and stores to dead locals are then removed.
+ */
+class CLoadStoreOptimization : public CLowLevelOptimization
 {
 public:
-	CSuperfluousInstructionsRemoval(CAsmCode &AAsm);
+	CLoadStoreOptimization(CAsmCode &AAsm);
 
 	bool Optimize();
+	const char* GetName() const;
+
+private:
+	struct CEffects
+	{
+		unsigned int Uses;
+		unsigned int Defs;
+		bool Reads[2];
+		bool Writes[2];
+		unsigned int Size;
+		bool Call;
+		bool Barrier;
+	};
+
+	struct CFrame
+	{
+		bool Frame;
+		bool Escaped;
+		int Low;
+		int High;
+	};
+
+	struct CValue
+	{
+		bool Constant;
+		int Number;
+		bool Address;
+		int Area;
+		int Offset;
+	};
+
+	struct CSlot
+	{
+		int Area;
+		int Offset;
+		unsigned int Size;
+		unsigned int Value;
+	};
+
+	void FindFrames();
+	void ComputeLiveness();
+	void GetEffects(const CAsmInstruction &AInstruction, CEffects &AEffects);
+	unsigned int GetWidth(const CAsmInstruction &AInstruction);
+
+	bool Forward(const CAsmFlowGraph::CBlock &ABlock);
+	bool RemovePairs(const CAsmFlowGraph::CBlock &ABlock);
+	bool RemovePair(unsigned int APush, unsigned int APop);
+	bool RemoveDeadCode(unsigned int ABlock);
+	bool RemoveDeadStores(unsigned int AFunction);
+
+	void Reset(const CAsmFlowGraph::CBlock &ABlock);
+	bool Classify(const CAsmOperand &AOp, int &AArea, int &AOffset);
+	bool Fold(CAsmOperand &AOp);
+	bool Substitute(CAsmInstruction &AInstruction, unsigned int AWidth);
+	void Transfer(const CAsmInstruction &AInstruction, const CEffects &AEffects);
+	unsigned int Peek(const CAsmOperand &AOp, unsigned int AWidth);
+	unsigned int Evaluate(const CAsmOperand &AOp, unsigned int AWidth);
+	void Assign(ERegister AReg, unsigned int AValue);
+	void Forget(unsigned int AIndex);
+	void Write(const CAsmOperand &AOp, unsigned int ASize, unsigned int AValue);
+	void Store(int AArea, int AOffset, unsigned int ASize, unsigned int AValue);
+	void Invalidate(int AArea, int AOffset, unsigned int ASize);
+	void InvalidateMemory();
+	void InvalidateArea(int AArea);
+	void Release();
+	int FindSlot(int AArea, int AOffset, unsigned int ASize);
+
+	unsigned int NewValue();
+	unsigned int ConstantValue(int AValue, unsigned int AWidth);
+	unsigned int AddressValue(int AArea, int AOffset);
+
+	void GetFrameAccess(const CFrame &AFrame, const CAsmInstruction &AInstruction, const CEffects &AEffects, CBitSet &ALive);
+	void GetFrameLive(const CAsmFlowGraph::CFunction &AFunction, unsigned int ABlock, const vector<CBitSet> &AIn, CBitSet &ALive);
+
+	unsigned int Pointer;
+
+	CAsmFlowGraph Graph;
+	vector<CFrame> Frames;
+	vector<unsigned int> LiveIn;
+	vector<unsigned int> LiveOut;
+	vector<unsigned int> Live;
+
+	vector<CValue> Values;
+	map<pair<int, unsigned int>, unsigned int> Constants;
+	map<pair<int, int>, unsigned int> Addresses;
+
+	vector<unsigned int> RegisterValues;
+	vector<unsigned int> RegisterWidths;
+	vector<int> Copies;
+	vector<CSlot> Slots;
+
+	int Depth;
+	bool DepthKnown;
+	bool Frame;
+	bool FrameKnown;
 };
 
-class CArithmeticInstructionsOptimization : public CLowLevelOptimization
+/*
+ * Threads jumps to blocks that only jump further, turns a conditional jump
+ * over an unconditional one into the inverted conditional jump, and removes
+ * jumps to the next block, unreachable blocks and labels nothing refers to.
+ */
+class CBranchOptimization : public CLowLevelOptimization
 {
 public:
-	CArithmeticInstructionsOptimization(CAsmCode &AAsm);
+	CBranchOptimization(CAsmCode &AAsm);
 
 	bool Optimize();
+	const char* GetName() const;
+
+private:
+	bool ThreadJumps();
+	bool RemoveJumps();
+	bool RemoveUnreachable();
+	bool RemoveLabels();
+
+	bool IsTrivial(unsigned int ABlock);
+	int Resolve(unsigned int ABlock);
+
+	CAsmFlowGraph Graph;
 };
 
-class CJumpsOptimization : public CLowLevelOptimization
+/*
+ * Reorders the blocks of every function so that the likely path falls
+ * through. Edges inside deeper loops are chained first, and a loop whose
+ * header ends with the exit test is rotated: its latch falls into the header
+ * and the header branches back to the body. Jumps are then added, removed or
+ * inverted to keep the control flow. Functions that fall off their end are
+ * left alone.
+ */
+class CBlockLayout : public CLowLevelOptimization
 {
 public:
-	CJumpsOptimization(CAsmCode &AAsm);
+	CBlockLayout(CAsmCode &AAsm);
 
 	bool Optimize();
+	const char* GetName() const;
+
+private:
+	struct CEdge
+	{
+		unsigned int From;
+		unsigned int To;
+		int Weight;
+	};
+
+	void FindLoops(const CAsmFlowGraph::CFunction &AFunction);
+	void FindCold(const CAsmFlowGraph::CFunction &AFunction);
+	bool Arrange(const CAsmFlowGraph::CFunction &AFunction, vector<unsigned int> &AOrder);
+	void Emit(const CAsmFlowGraph::CFunction &AFunction, const vector<unsigned int> &AOrder, CAsmCode::CodeContainer &ACode);
+
+	int GetLabel(unsigned int ABlock);
+
+	static bool IsHeavier(const CEdge &AFirst, const CEdge &ASecond);
+
+	CAsmFlowGraph Graph;
+
+	vector<unsigned int> Depths;
+	vector<bool> Rotated;
+	set<pair<unsigned int, unsigned int> > BackEdges;
+	vector<bool> Cold;
+	vector<int> Labels;
 };
 
-class CUnreachableCodeElimination : public CStatementVisitor
+class CDeadCodeElimination : public CStatementVisitor
 {
 public:
+	CDeadCodeElimination(CFunctionSymbol *AFunction);
+
 	void Visit(CUnaryOp &AStmt);
 	void Visit(CBinaryOp &AStmt);
 	void Visit(CConditionalOp &AStmt);
@@ -104,6 +392,26 @@ public:
 	void Visit(CContinueStatement &AStmt);
 	void Visit(CReturnStatement &AStmt);
 	void Visit(CSwitchStatement &AStmt);
+
+private:
+	void Analyze();
+	void ProcessBlock(CBlockStatement &AStmt);
+
+	CStatement* Rewrite(CStatement *AStmt);
+	CStatement* Keep(CStatement *AStmt);
+	void Remove(CStatement *AStmt);
+
+	bool IsUnreachable(CStatement *AStmt);
+	bool HasSideEffects(CExpression *AExpr);
+
+	CFunctionSymbol *Function;
+	CControlFlowGraph *Graph;
+
+	set<CStatement *> Dead;
+
+	stack<CBlockStatement *> ParentBlocks;
+
+	bool Changed;
 };
 
 class CConstantExpressionComputer : public CStatementVisitor
@@ -142,7 +450,7 @@ public:
 	float GetFloatResult();
 
 private:
-	float Result;
+	double Result;
 };
 
 class CConstantFolding : public CStatementVisitor
@@ -183,6 +491,55 @@ private:
 	CConstantExpressionComputer ConstExprComp;
 };
 
+class CConstantPropagation : public CStatementVisitor
+{
+public:
+	CConstantPropagation(CFunctionSymbol *AFunction);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+private:
+	typedef map<CVariableSymbol *, int> ConstantsContainer;
+
+	void Analyze();
+	bool GetConstant(CReachingDefinitions &ADefinitions, const CBitSet &AReaching, unsigned int AVariable, int &AValue);
+
+	CExpression* Enter(CStatement *AStmt);
+	CExpression* Propagate(CStatement *AStmt);
+
+	CFunctionSymbol *Function;
+
+	map<CExpression *, ConstantsContainer> Constants;
+	ConstantsContainer *Current;
+};
+
 class CLoopInvariantHoisting : public CStatementVisitor
 {
 public:
@@ -227,4 +584,590 @@ private:
 };
 
 
+class CInliningCostEstimator : public CStatementVisitor
+{
+public:
+	CInliningCostEstimator(CBlockStatement *ABody);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+	unsigned int GetCost() const;
+	bool GetInlinable() const;
+	bool GetJumps() const;
+	bool GetReturns() const;
+
+private:
+	CBlockStatement *Body;
+	unsigned int Cost;
+	bool Inlinable;
+	bool Jumps;
+	bool Returns;
+	int FramedBlocks;
+};
+
+class CInlineExpander : public CStatementVisitor
+{
+public:
+	CInlineExpander(CFunctionSymbol *AFunction, CBlockStatement *AParent, CVariableSymbol *AResult, const string &AEndLabel);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+	void AddSymbol(CVariableSymbol *AOriginal, CVariableSymbol *AReplacement);
+	void AddConstant(CVariableSymbol *AVariable, int AValue);
+	void AddOffset(CVariableSymbol *AVariable, int AOffset);
+
+	CStatement* Clone(CStatement *AStmt);
+	CExpression* CloneExpression(CExpression *AExpr);
+	CExpression* Assign(CVariableSymbol *AVariable, CExpression *AValue);
+	CBlockStatement* ExpandBody();
+
+private:
+	CFunctionSymbol *Function;
+	CVariableSymbol *ResultVariable;
+	string EndLabel;
+	bool EndLabelUsed;
+	bool TailPosition;
+
+	map<CVariableSymbol *, CVariableSymbol *> Symbols;
+	map<CVariableSymbol *, int> Constants;
+	map<CVariableSymbol *, int> Offsets;
+	stack<CBlockStatement *> Blocks;
+
+	CStatement *Copy;
+};
+
+class CFunctionInlining : public CStatementVisitor
+{
+public:
+	CFunctionInlining(CFunctionSymbol *ACaller, unsigned int ALimit, const CProfile *AProfile = NULL);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+private:
+	CStatement* TryInline(CStatement *AStmt, CBlockStatement *AParent);
+	CFunctionCall* FindCall(CExpression *AExpr);
+	CExpression* ReplaceCall(CExpression *AExpr, CFunctionCall *ACall, CExpression *AReplacement);
+	bool CanInline(CFunctionSymbol *AFunction, unsigned int ALimit);
+	bool IsEvaluated(CExpression *AExpr);
+	unsigned int GetLimit(CFunctionCall *ACall) const;
+
+	CFunctionSymbol *Caller;
+	unsigned int Limit;
+	const CProfile *Profile;
+	int LabelsCount;
+
+	stack<CBlockStatement *> Blocks;
+	set<CFunctionSymbol *> Expanding;
+	set<CVariableSymbol *> Results;
+};
+
+class CTailCallDetection : public CStatementVisitor
+{
+public:
+	CTailCallDetection();
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+private:
+	void CheckDecay(CExpression &AAccess, CExpression *AAggregate);
+
+	int BlockNesting;
+	bool AddressTaken;
+	vector<CReturnStatement *> Returns;
+};
+
+class CInductionVariableAnalyzer : public CStatementVisitor
+{
+public:
+	typedef vector<CArrayAccess *> AccessesContainer;
+	typedef AccessesContainer::iterator AccessesIterator;
+
+	CInductionVariableAnalyzer();
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+	int GetWrites(CVariableSymbol *AVariable);
+	int GetUses(CVariableSymbol *AVariable);
+	bool GetAddressTaken(CVariableSymbol *AVariable) const;
+	bool GetLabels() const;
+
+	AccessesIterator AccessesBegin();
+	AccessesIterator AccessesEnd();
+
+	static bool GetIncrement(CExpression *AExpr, CVariableSymbol *&AVariable, int &AStep);
+	bool IsInvariant(CExpression *AExpr, CInductionVariableAnalyzer &AFunction);
+
+private:
+	void AddWrite(CExpression *AExpr);
+
+	bool AddressOperand;
+	bool Labels;
+
+	map<CVariableSymbol *, int> Writes;
+	map<CVariableSymbol *, int> Uses;
+	set<CVariableSymbol *> AddressTaken;
+	AccessesContainer Accesses;
+};
+
+class CInductionVariableReduction : public CStatementVisitor
+{
+public:
+	CInductionVariableReduction(CBlockStatement *ABody);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+	static void ShiftBlock(CBlockStatement *ABlock, size_t AShift);
+
+private:
+	struct CCandidate
+	{
+		CArrayAccess *Access;
+		CExpression *Base;
+		CExpression *Index;
+		int Offset;
+		unsigned int Group;
+	};
+
+	bool IsReducible(CStatement *ALoop);
+	void ReduceSingleConditionLoop(CSingleConditionLoopStatement &AStmt);
+	bool ReduceLoop(CStatement *ALoop, CForStatement *AFor, CVariableSymbol *AVariable, int AStep, CBlockStatement *ABody, CBlockStatement::StatementsIterator AIncrement);
+	bool GetIndexOffset(CExpression *AIndex, CVariableSymbol *AVariable, int &AOffset);
+	bool IsEqual(CExpression *A, CExpression *B);
+	CExpression* ElementAddress(CExpression *ABase, CExpression *AIndex);
+	CExpression* Assign(CVariableSymbol *AVariable, CExpression *AValue);
+	CVariable* Variable(CVariableSymbol *AVariable, const CPosition &APosition);
+	void MoveNestedBlocks(CStatement *AStmt, CBlockStatement *AFrom, CBlockStatement *ATo, size_t AShift);
+
+	CBlockStatement *Body;
+
+	stack<CBlockStatement *> ParentBlock;
+	stack<CBlockStatement::StatementsIterator> ParentBlockIterator;
+};
+
+class CLoopUnrolling : public CStatementVisitor
+{
+public:
+	CLoopUnrolling(CFunctionSymbol *AFunction, unsigned int ALimit, unsigned int AFactor, const CProfile *AProfile = NULL);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+	static CExpression* Constant(int AValue, CTypeSymbol *AType);
+	static void MoveNestedBlocks(CStatement *AStmt, CBlockStatement *AFrom, CBlockStatement *ATo);
+
+private:
+	bool Unroll(CForStatement &AStmt);
+
+	CFunctionSymbol *Function;
+	unsigned int Limit;
+	unsigned int Factor;
+	const CProfile *Profile;
+
+	stack<CBlockStatement *> ParentBlock;
+	stack<CBlockStatement::StatementsIterator> ParentBlockIterator;
+};
+
+class CLoopVectorization : public CStatementVisitor
+{
+public:
+	typedef vector<CBinaryOp *> StatementsContainer;
+
+	CLoopVectorization(CFunctionSymbol *AFunction);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+	static const unsigned int Width = 4;
+
+	static bool GetStatements(CStatement *AStmt, StatementsContainer &AStatements);
+	static CExpression* GetReduction(CBinaryOp *AStmt);
+	static bool IsBroadcast(CExpression *AExpr);
+
+private:
+	bool Vectorize(CForStatement &AStmt);
+	ETokenType GetOperation(ETokenType AType);
+	bool IsOperation(ETokenType AType, bool AFloat);
+	int GetRegisters(CExpression *AExpr, bool AFloat, CInductionVariableAnalyzer &ALoop, CInductionVariableAnalyzer &AFunction, int &ABroadcasts);
+	bool IsElement(CExpression *AExpr, bool AFloat);
+
+	CFunctionSymbol *Function;
+	CVariableSymbol *Counter;
+
+	stack<CBlockStatement *> ParentBlock;
+	stack<CBlockStatement::StatementsIterator> ParentBlockIterator;
+};
+
+class CCommonSubexpressionElimination : public CStatementVisitor
+{
+public:
+	CCommonSubexpressionElimination(CFunctionSymbol *AFunction);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+	static CVariableSymbol* AddTemporary(CBlockStatement *ABlock, CExpression *AExpr, const string &AName);
+	static bool IsCandidate(CExpression *AExpr);
+
+private:
+	typedef map<CVariableSymbol *, unsigned int> VariablesContainer;
+	typedef map<unsigned int, unsigned int> AvailableContainer;
+
+	void ProcessBlock(CBlockStatement &AStmt);
+	CStatement* ProcessNested(CStatement *AStmt);
+	CExpression* ProcessStatement(CExpression *AExpr, bool ADefining);
+	CExpression* Replace(CExpression *AExpr);
+	void ReplaceOperands(CExpression *AExpr);
+
+	unsigned int Number(CExpression *AExpr);
+	string Address(CExpression *AExpr);
+	unsigned int Lookup(const string &AKey);
+
+	bool IsPure(CExpression *AExpr);
+	bool IsSimple(CExpression *AExpr);
+	bool IsCall(CExpression *AExpr);
+	bool IsLoad(CExpression *AExpr);
+	bool IsRegister(CVariableSymbol *AVariable);
+	bool IsSameType(CTypeSymbol *A, CTypeSymbol *B);
+
+	void Kill(CStatement *AStmt);
+	void Merge(const VariablesContainer &AVariables, unsigned int AMemory);
+	void Barrier();
+	void Reset();
+
+	CFunctionSymbol *Function;
+	CInductionVariableAnalyzer Usage;
+
+	bool Transform;
+	bool Anchored;
+	bool Defining;
+
+	unsigned int Numbers;
+	unsigned int Memory;
+	unsigned int Occurrences;
+
+	VariablesContainer Variables;
+	map<string, unsigned int> Values;
+	AvailableContainer Available;
+	vector<AvailableContainer> Scopes;
+	set<unsigned int> Reused;
+	map<unsigned int, CVariableSymbol *> Temporaries;
+
+	stack<CBlockStatement *> ParentBlock;
+	stack<CBlockStatement::StatementsIterator> ParentBlockIterator;
+};
+
+/*
+ * Replaces expressions that are available on every path to them with a
+ * temporary, which is assigned where each of the paths last computes them.
+ */
+class CGlobalSubexpressionElimination : public CStatementVisitor
+{
+public:
+	CGlobalSubexpressionElimination(CFunctionSymbol *AFunction);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+private:
+	typedef map<CExpression *, CVariableSymbol *> OccurrencesContainer;
+	typedef vector<pair<CExpression *, CExpression *> > GeneratorsContainer;
+
+	/*
+	 * What an element is rewritten for in the current round.
+	 */
+	struct CChange
+	{
+		unsigned int Index;
+		bool Use;
+	};
+
+	void ProcessBlock(CBlockStatement &AStmt);
+	bool Analyze();
+	bool FindGenerators(CBasicBlock *ABlock, unsigned int AEnd, unsigned int AIndex, set<CBasicBlock *> &AVisited, GeneratorsContainer &AGenerators);
+	CExpression* Find(CExpression *AExpr, const CBitSet &AIndices, bool AAlways, bool AConditional = false);
+	CExpression* FindOperands(CExpression *AExpr, const CBitSet &AIndices, bool AAlways, bool AConditional);
+
+	CExpression* Enter(CStatement *AStmt);
+	CExpression* Rewrite(CStatement *AStmt);
+
+	CFunctionSymbol *Function;
+	CAvailableExpressions *Available;
+
+	bool Transform;
+	unsigned int Count;
+
+	set<CExpression *> Roots;
+	map<CExpression *, CChange> Changes;
+	map<unsigned int, CVariableSymbol *> Temporaries;
+
+	OccurrencesContainer Uses;
+	OccurrencesContainer Generators;
+};
+
 #endif // _OPTIMIZATION_H_
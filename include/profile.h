@@ -0,0 +1,125 @@
+/*
+	ncc - Nartov C Compiler
+	Copyright 2010-2011  Alexander Nartov
+
+	ncc is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	ncc is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with ncc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+
+#include "common.h"
+#include "expressions.h"
+#include "statements.h"
+
+enum EProfileCounter
+{
+	PROFILE_COUNTER_ENTRY,
+	PROFILE_COUNTER_BODY,
+	PROFILE_COUNTER_THEN,
+	PROFILE_COUNTER_ELSE,
+};
+
+/*
+ * Execution counts of the points of a program, numbered in the order they
+ * are added. Counts are known only once a profile is loaded, and only for
+ * the statements that were numbered, not for their copies.
+ */
+class CProfile
+{
+public:
+	CProfile();
+
+	unsigned int Add(CStatement *AStmt, EProfileCounter ACounter);
+	unsigned int GetSize() const;
+
+	void Load(const string &AFilename);
+	bool GetLoaded() const;
+
+	bool GetCount(CStatement *AStmt, EProfileCounter ACounter, unsigned long long &ACount) const;
+	unsigned long long GetMaximum() const;
+
+	bool IsHot(CStatement *AStmt, EProfileCounter ACounter) const;
+	bool IsCold(CStatement *AStmt, EProfileCounter ACounter) const;
+
+private:
+	map<pair<CStatement *, EProfileCounter>, unsigned int> Points;
+	vector<unsigned long long> Counts;
+	unsigned long long Maximum;
+	bool Loaded;
+};
+
+/*
+ * Numbers the profiled points of a function: its entry, both arms of ifs,
+ * entries and iterations of loops, case labels and calls. When instrumenting,
+ * an increment of the point's counter is inserted at each of them as well.
+ * Points are numbered the same way either way, so a profile written by an
+ * instrumented build applies to the same source compiled without counters.
+ */
+class CProfileInstrumentation : public CStatementVisitor
+{
+public:
+	CProfileInstrumentation(CProfile &AProfile, CGlobalSymbolTable *ASymbols, bool AInstrument);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+	CVariableSymbol* Register(CFunctionSymbol *AMain, const string &AFilename);
+
+private:
+	CExpression* Count(CStatement *AStmt, EProfileCounter ACounter);
+	CStatement* Prepend(CStatement *AStmt, CExpression *ACounter);
+	CStatement* Enclose(CStatement *AStmt);
+	CExpression* Wrap(CExpression *AExpr);
+	void VisitStatement(CStatement *AStmt);
+	CFunctionCall* GetDirectCall(CStatement *AStmt) const;
+
+	CProfile &Profile;
+	CGlobalSymbolTable *Symbols;
+	bool Instrumenting;
+
+	CVariableSymbol *Counters;
+
+	stack<CBlockStatement *> Blocks;
+	CFunctionCall *Direct;
+	vector<CStatement *> Pending;
+};
+
+#endif // _PROFILE_H_
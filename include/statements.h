@@ -82,6 +82,7 @@ public:
 	NestedBlocksIterator NestedBlocksEnd();
 
 	void AddNestedBlock(CBlockStatement *ABlock);
+	void RemoveNestedBlock(CBlockStatement *ABlock);
 
 	unsigned int GetStatementsCount() const;
 
@@ -150,11 +151,15 @@ public:
 	CStatement* GetBody() const;
 	void SetBody(CStatement *ABody);
 
+	bool GetVectorized() const;
+	void SetVectorized(bool AVectorized);
+
 private:
 	CExpression *Init;
 	CExpression *Condition;
 	CExpression *Update;
 	CStatement *Body;
+	bool Vectorized;
 };
 
 class CSingleConditionLoopStatement : public CStatement
@@ -275,8 +280,12 @@ public:
 	CExpression* GetReturnExpression() const;
 	void SetReturnExpression(CExpression *AReturnExpression);
 
+	bool GetTailCall() const;
+	void SetTailCall(bool ATailCall);
+
 private:
 	CExpression *ReturnExpression;
+	bool TailCall;
 };
 
 class CSwitchStatement : public CBlockStatement
@@ -0,0 +1,83 @@
+/*
+	ncc - Nartov C Compiler
+	Copyright 2010-2011  Alexander Nartov
+
+	ncc is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	ncc is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with ncc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef _TIMEREPORT_H_
+#define _TIMEREPORT_H_
+
+#include "common.h"
+
+/*
+ * Wall and CPU time, allocations and allocated bytes of each phase of a
+ * compiler run. Phases nest, and what runs in a phase entered from another
+ * one is counted only for the inner phase, e.g. scanning during parsing.
+ */
+class CTimeReport
+{
+public:
+	CTimeReport();
+
+	void Enter(const char *APhase);
+	void Leave();
+
+	void Output(ostream &Stream, ETimeReportFormat AFormat);
+
+	static CTimeReport *Active;
+
+private:
+	struct CCounters
+	{
+		double Wall;
+		double CPU;
+		unsigned long long Allocations;
+		unsigned long long Bytes;
+	};
+
+	struct CPhase
+	{
+		string Name;
+		CCounters Counters;
+	};
+
+	static CCounters Sample();
+	void Charge();
+	void Exclude();
+
+	vector<CPhase> Phases;
+	map<string, unsigned int> Indices;
+	vector<unsigned int> Stack;
+
+	CCounters Start;
+	CCounters Last;
+};
+
+/*
+ * Counts what runs during its lifetime as a phase of the active report, if
+ * there is one.
+ */
+class CTimePhase
+{
+public:
+	CTimePhase(const char *APhase);
+	~CTimePhase();
+
+private:
+	CTimeReport *Report;
+};
+
+#endif // _TIMEREPORT_H_
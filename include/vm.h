@@ -0,0 +1,335 @@
+/*
+	ncc - Nartov C Compiler
+	Copyright 2010-2011  Alexander Nartov
+
+	ncc is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	ncc is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with ncc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _VM_H_
+#define _VM_H_
+
+#include "common.h"
+#include "symbols.h"
+#include "parser.h"
+#include "optimization.h"
+
+/*
+ * Operations of the bytecode. A is the destination register, B and C the
+ * operands, registers unless named K (a constant) or L (a jump target, which
+ * is always in C). Memory is addressed by 32-bit offsets, the F forms relative
+ * to the frame memory of the call, the A forms absolute.
+ */
+enum EOpcode
+{
+	OPCODE_MOVE,		// A = B
+	OPCODE_LOADK,		// A = K(B)
+	OPCODE_ADD,
+	OPCODE_ADDK,		// A = B + K(C)
+	OPCODE_SUB,
+	OPCODE_MUL,
+	OPCODE_MULK,		// A = B * K(C)
+	OPCODE_DIV,
+	OPCODE_MOD,
+	OPCODE_AND,
+	OPCODE_OR,
+	OPCODE_XOR,
+	OPCODE_SHL,
+	OPCODE_SHR,
+	OPCODE_NEG,
+	OPCODE_NOT,
+	OPCODE_FADD,
+	OPCODE_FSUB,
+	OPCODE_FMUL,
+	OPCODE_FDIV,
+	OPCODE_FNEG,
+	OPCODE_ITOF,
+	OPCODE_FTOI,
+	OPCODE_LOAD,		// A = [B + K(C)]
+	OPCODE_STORE,		// [B + K(C)] = A
+	OPCODE_LOADX,		// A = [B + 4 * C]
+	OPCODE_STOREX,		// [B + 4 * C] = A
+	OPCODE_LOADF,		// A = [frame + K(B)]
+	OPCODE_STOREF,		// [frame + K(B)] = A
+	OPCODE_LOADA,		// A = [K(B)]
+	OPCODE_STOREA,		// [K(B)] = A
+	OPCODE_ADDRF,		// A = frame + K(B)
+	OPCODE_JMP,
+	OPCODE_JZ,		// if A == 0 goto L
+	OPCODE_JNZ,
+	OPCODE_FJZ,
+	OPCODE_FJNZ,
+	OPCODE_JEQ,		// if A == B goto L
+	OPCODE_JNE,
+	OPCODE_JLT,
+	OPCODE_JGT,
+	OPCODE_JLE,
+	OPCODE_JGE,
+	OPCODE_JB,
+	OPCODE_JA,
+	OPCODE_JBE,
+	OPCODE_JAE,
+	OPCODE_FJEQ,
+	OPCODE_FJNE,
+	OPCODE_FJLT,
+	OPCODE_FJGT,
+	OPCODE_FJLE,
+	OPCODE_FJGE,
+	OPCODE_JEQK,		// if A == K(B) goto L
+	OPCODE_JNEK,
+	OPCODE_JLTK,
+	OPCODE_JGTK,
+	OPCODE_JLEK,
+	OPCODE_JGEK,
+	OPCODE_CALL,		// A... = function B(A...)
+	OPCODE_NATIVE,		// A... = hook B(A...)
+	OPCODE_RET,		// return A
+	OPCODE_RETV,
+	OPCODES_COUNT,
+};
+
+enum ENativeHook
+{
+	NATIVE_HOOK_PRINT_INT,
+	NATIVE_HOOK_PRINT_FLOAT,
+	NATIVE_HOOK_PRINTF,
+};
+
+struct CInstruction
+{
+	EOpcode Op;
+	int A;
+	int B;
+	int C;
+};
+
+/*
+ * Arguments of a call are in the first registers of its callee, which start
+ * at the register the caller put the first one in; the result is returned in
+ * that register.
+ */
+struct CBytecodeFunction
+{
+	string Name;
+	vector<CInstruction> Code;
+	unsigned int RegistersCount;
+	unsigned int FrameSize;
+};
+
+/*
+ * Functions of a translation unit along with the initial contents of the
+ * memory: string literals and globals, after a guard area at address 0.
+ */
+class CBytecodeProgram
+{
+public:
+	static const unsigned int GuardSize = 16;
+
+	CBytecodeProgram();
+
+	unsigned int AddFunction(CFunctionSymbol *AFunc);
+	bool GetFunctionIndex(CFunctionSymbol *AFunc, unsigned int &AIndex) const;
+	CBytecodeFunction& GetFunction(unsigned int AIndex);
+	unsigned int GetFunctionsCount() const;
+
+	unsigned int AddStringLiteral(const string &AValue);
+	unsigned int AddGlobalVariable(CVariableSymbol *AVariable);
+	unsigned int GetGlobalAddress(CVariableSymbol *AVariable) const;
+
+	const string& GetData() const;
+
+private:
+	vector<CBytecodeFunction> Functions;
+	map<CFunctionSymbol *, unsigned int> FunctionIndices;
+
+	string Data;
+	map<string, unsigned int> StringLiterals;
+	map<CVariableSymbol *, unsigned int> GlobalAddresses;
+};
+
+/*
+ * Lowers the checked parse tree of a function to bytecode, evaluating the
+ * expressions the same way the code generator does. Scalar locals and
+ * arguments whose address isn't taken live in registers, other locals in the
+ * frame memory; temporaries are allocated above them as a stack.
+ */
+class CBytecodeGenerationVisitor : public CStatementVisitor
+{
+public:
+	CBytecodeGenerationVisitor(CBytecodeProgram &AProgram);
+
+	void Generate(CFunctionSymbol *AFunc);
+
+	void Visit(CUnaryOp &AStmt);
+	void Visit(CBinaryOp &AStmt);
+	void Visit(CConditionalOp &AStmt);
+	void Visit(CIntegerConst &AStmt);
+	void Visit(CFloatConst &AStmt);
+	void Visit(CCharConst &AStmt);
+	void Visit(CStringConst &AStmt);
+	void Visit(CVariable &AStmt);
+	void Visit(CFunction &AStmt);
+	void Visit(CPostfixOp &AStmt);
+	void Visit(CFunctionCall &AStmt);
+	void Visit(CStructAccess &AStmt);
+	void Visit(CIndirectAccess &AStmt);
+	void Visit(CArrayAccess &AStmt);
+	void Visit(CNullStatement &AStmt);
+	void Visit(CBlockStatement &AStmt);
+	void Visit(CIfStatement &AStmt);
+	void Visit(CForStatement &AStmt);
+	void Visit(CWhileStatement &AStmt);
+	void Visit(CDoStatement &AStmt);
+	void Visit(CLabel &AStmt);
+	void Visit(CCaseLabel &AStmt);
+	void Visit(CDefaultCaseLabel &AStmt);
+	void Visit(CGotoStatement &AStmt);
+	void Visit(CBreakStatement &AStmt);
+	void Visit(CContinueStatement &AStmt);
+	void Visit(CReturnStatement &AStmt);
+	void Visit(CSwitchStatement &AStmt);
+
+private:
+	enum EAddressType
+	{
+		ADDRESS_VARIABLE,
+		ADDRESS_FRAME,
+		ADDRESS_ABSOLUTE,
+		ADDRESS_POINTER,
+		ADDRESS_INDEXED,
+	};
+
+	/*
+	 * Location of an lvalue: the register variable in Base, Offset from the
+	 * frame memory or from address 0, Offset from the address in Base, or the
+	 * address in Base plus 4 times Index.
+	 */
+	struct CAddress
+	{
+		EAddressType Type;
+		int Base;
+		int Index;
+		int Offset;
+	};
+
+	void AllocateVariables(CBlockStatement *ABlock, CInductionVariableAnalyzer &AUsage);
+	void AllocateFrameVariable(CVariableSymbol *AVariable);
+	int AllocateRegister();
+
+	void Add(EOpcode AOp, int A = 0, int B = 0, int C = 0);
+	int GenerateLabel();
+	void AddLabel(int ALabel);
+	int GetUserLabel(const string &AName);
+
+	void GenerateValue(CExpression *AExpr, int ARegister);
+	int GenerateOperand(CExpression *AExpr, CExpression *ALater = NULL);
+	int GenerateConvertedOperand(CExpression *AExpr, CTypeSymbol *AType, CExpression *ALater = NULL);
+	void GenerateCondition(CExpression *ACondition, int ALabel, bool AJumpIfTrue);
+	void GenerateConditionValue(CExpression *ACondition);
+	void GenerateStatement(CStatement *AStmt);
+
+	CAddress SelectAddress(CExpression *AExpr);
+	CAddress SelectElementAddress(CArrayAccess &AExpr);
+	CAddress AddOffset(CAddress AAddress, int AOffset);
+	void PinAddress(CAddress &AAddress);
+	void Load(const CAddress &AAddress, int ARegister);
+	void Store(const CAddress &AAddress, int ARegister);
+	void LoadAddress(const CAddress &AAddress, int ARegister);
+	void LoadValue(const CAddress &AAddress, CTypeSymbol *AType, int ARegister);
+
+	void GenerateArithmetic(ETokenType AOp, bool AFloat, int AResult, int ALeft, int ARight);
+	bool NeedsConversion(CTypeSymbol *LHS, CTypeSymbol *RHS) const;
+	void PerformConversion(CTypeSymbol *LHS, CTypeSymbol *RHS, int ARegister);
+
+	CBytecodeProgram &Program;
+	CBytecodeFunction *Function;
+	CFunctionSymbol *FuncSym;
+
+	map<CVariableSymbol *, int> VariableRegisters;
+	map<CVariableSymbol *, int> VariableOffsets;
+
+	int Target;
+	int FirstFree;
+	int VariablesCount;
+
+	vector<int> Labels;
+	map<string, int> UserLabels;
+	map<CStatement *, int> CaseLabels;
+	stack<int> BreakLabels;
+	stack<int> ContinueLabels;
+
+	map<ETokenType, EOpcode> IntOperationOp;
+	map<ETokenType, EOpcode> FloatOperationOp;
+	map<ETokenType, EOpcode> IntJumpOp;
+	map<ETokenType, EOpcode> UnsignedJumpOp;
+	map<ETokenType, EOpcode> FloatJumpOp;
+	map<ETokenType, EOpcode> ConstJumpOp;
+	map<ETokenType, ETokenType> CompoundAssignmentOp;
+	map<EOpcode, EOpcode> InvertedJump;
+};
+
+/*
+ * Runs a translation unit in process: lowers it to bytecode and interprets
+ * that, dispatching on the threaded code where the compiler supports labels
+ * as values. __print_int, __print_float and printf are native hooks, the
+ * output of which is written to the stream.
+ */
+class CVirtualMachine
+{
+public:
+	static const unsigned int StackSize = 8 * 1024 * 1024;
+	static const unsigned int RegistersSize = 1024 * 1024;
+	static const unsigned int InitialStackSize = 64 * 1024;
+	static const unsigned int InitialRegistersSize = 4 * 1024;
+
+	CVirtualMachine(CParser &AParser, const CCompilerParameters &AParameters);
+
+	int Run(ostream &AStream);
+
+private:
+	union CValue
+	{
+		int Int;
+		unsigned int Unsigned;
+		float Float;
+	};
+
+	struct CCallFrame
+	{
+		const CInstruction *Return;
+		unsigned int Registers;
+		unsigned int Frame;
+	};
+
+	int Execute(unsigned int AMain);
+	void CallNative(ENativeHook AHook, CValue *AArguments);
+	void Grow(unsigned int ARegistersSize, unsigned int AMemorySize);
+
+	void Write(const char *AText, unsigned int ALength);
+	void Flush();
+	void RuntimeError(const string &AMessage);
+
+	CParser &Parser;
+	const CCompilerParameters &Parameters;
+
+	CBytecodeProgram Program;
+
+	vector<char> Memory;
+	vector<CValue> Registers;
+	unsigned int StackBase;
+
+	ostream *Stream;
+	string Output;
+};
+
+#endif // _VM_H_
@@ -0,0 +1,1120 @@
+/*
+	ncc - Nartov C Compiler
+	Copyright 2010-2011  Alexander Nartov
+
+	ncc is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	ncc is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with ncc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "assembler.h"
+
+/******************************************************************************
+ * CSectionData
+ ******************************************************************************/
+
+void CSectionData::AddByte(unsigned int AByte)
+{
+	Data += (char) (AByte & 0xFF);
+}
+
+void CSectionData::AddWord(unsigned int AWord)
+{
+	AddByte(AWord);
+	AddByte(AWord >> 8);
+}
+
+void CSectionData::AddLong(unsigned int ALong)
+{
+	AddWord(ALong);
+	AddWord(ALong >> 16);
+}
+
+void CSectionData::AddString(const string &AString)
+{
+	Data += AString;
+}
+
+void CSectionData::Align(unsigned int AAlignment)
+{
+	while (Data.size() % AAlignment) {
+		AddByte(0);
+	}
+}
+
+unsigned int CSectionData::GetLong(unsigned int AOffset) const
+{
+	unsigned int result = 0;
+	for (unsigned int i = 0; i < 4; i++) {
+		result |= (unsigned int) (unsigned char) Data[AOffset + i] << 8 * i;
+	}
+	return result;
+}
+
+void CSectionData::SetLong(unsigned int AOffset, unsigned int ALong)
+{
+	for (unsigned int i = 0; i < 4; i++) {
+		Data[AOffset + i] = (char) (ALong >> 8 * i & 0xFF);
+	}
+}
+
+unsigned int CSectionData::GetSize() const
+{
+	return Data.size();
+}
+
+void CSectionData::Clear()
+{
+	Data.clear();
+}
+
+void CSectionData::Output(ostream &Stream) const
+{
+	Stream.write(Data.data(), Data.size());
+}
+
+/******************************************************************************
+ * CObjectFile
+ ******************************************************************************/
+
+namespace ELF
+{
+	enum
+	{
+		HEADER_SIZE = 52,
+		SECTION_HEADER_SIZE = 40,
+		SYMBOL_SIZE = 16,
+		RELOCATION_SIZE = 8,
+
+		ET_REL = 1,
+		EM_386 = 3,
+
+		SHT_PROGBITS = 1,
+		SHT_SYMTAB = 2,
+		SHT_STRTAB = 3,
+		SHT_NOBITS = 8,
+		SHT_REL = 9,
+
+		SHF_WRITE = 0x1,
+		SHF_ALLOC = 0x2,
+		SHF_EXECINSTR = 0x4,
+		SHF_INFO_LINK = 0x40,
+
+		STB_LOCAL = 0,
+		STB_GLOBAL = 1,
+
+		STT_NOTYPE = 0,
+		STT_OBJECT = 1,
+		STT_FUNC = 2,
+		STT_SECTION = 3,
+
+		SHN_UNDEF = 0,
+	};
+}
+
+/*
+ * Indices of the section headers of an object file. Allocated sections go
+ * first, so that their indices match EObjectSection.
+ */
+enum
+{
+	SECTION_HEADER_TEXT = OBJECT_SECTION_TEXT,
+	SECTION_HEADER_DATA = OBJECT_SECTION_DATA,
+	SECTION_HEADER_BSS = OBJECT_SECTION_BSS,
+	SECTION_HEADER_RODATA = OBJECT_SECTION_RODATA,
+	SECTION_HEADER_REL_TEXT,
+	SECTION_HEADER_NOTE,
+	SECTION_HEADER_SYMTAB,
+	SECTION_HEADER_STRTAB,
+	SECTION_HEADER_SHSTRTAB,
+	SECTION_HEADERS_COUNT,
+};
+
+static unsigned int AddName(CSectionData &ATable, const string &AName)
+{
+	unsigned int result = ATable.GetSize();
+	ATable.AddString(AName);
+	ATable.AddByte(0);
+	return result;
+}
+
+static void AddSectionHeader(CSectionData &AHeaders, unsigned int AName, unsigned int AType, unsigned int AFlags, unsigned int AOffset, unsigned int ASize, unsigned int ALink, unsigned int AInfo, unsigned int AAlignment, unsigned int AEntrySize)
+{
+	AHeaders.AddLong(AName);
+	AHeaders.AddLong(AType);
+	AHeaders.AddLong(AFlags);
+	AHeaders.AddLong(0);
+	AHeaders.AddLong(AOffset);
+	AHeaders.AddLong(ASize);
+	AHeaders.AddLong(ALink);
+	AHeaders.AddLong(AInfo);
+	AHeaders.AddLong(AAlignment);
+	AHeaders.AddLong(AEntrySize);
+}
+
+static void AddSymbolEntry(CSectionData &ATable, unsigned int AName, unsigned int AValue, unsigned int ASize, unsigned int ABinding, unsigned int AType, unsigned int ASection)
+{
+	ATable.AddLong(AName);
+	ATable.AddLong(AValue);
+	ATable.AddLong(ASize);
+	ATable.AddByte(ABinding << 4 | AType);
+	ATable.AddByte(0);
+	ATable.AddWord(ASection);
+}
+
+CObjectFile::CObjectFile() : BssSize(0), BssAlignment(1)
+{
+}
+
+CSectionData& CObjectFile::GetSection(EObjectSection ASection)
+{
+	return Sections[ASection];
+}
+
+unsigned int CObjectFile::AllocateBss(unsigned int ASize, unsigned int AAlignment)
+{
+	BssSize = (BssSize + AAlignment - 1) / AAlignment * AAlignment;
+	BssAlignment = max(BssAlignment, AAlignment);
+
+	unsigned int result = BssSize;
+	BssSize += ASize;
+	return result;
+}
+
+unsigned int CObjectFile::GetSymbol(const string &AName)
+{
+	map<string, unsigned int>::iterator it = SymbolIndices.find(AName);
+	if (it != SymbolIndices.end()) {
+		return it->second;
+	}
+
+	CSymbol Symbol;
+	Symbol.Name = AName;
+	Symbol.Section = OBJECT_SECTION_UNDEFINED;
+	Symbol.Value = 0;
+	Symbol.Size = 0;
+	Symbol.Global = false;
+	Symbols.push_back(Symbol);
+
+	return SymbolIndices[AName] = Symbols.size() - 1;
+}
+
+void CObjectFile::DefineSymbol(unsigned int ASymbol, EObjectSection ASection, unsigned int AValue, unsigned int ASize /*= 0*/)
+{
+	Symbols[ASymbol].Section = ASection;
+	Symbols[ASymbol].Value = AValue;
+	Symbols[ASymbol].Size = ASize;
+}
+
+void CObjectFile::SetGlobal(unsigned int ASymbol)
+{
+	Symbols[ASymbol].Global = true;
+}
+
+bool CObjectFile::IsDefined(unsigned int ASymbol) const
+{
+	return Symbols[ASymbol].Section != OBJECT_SECTION_UNDEFINED;
+}
+
+EObjectSection CObjectFile::GetSymbolSection(unsigned int ASymbol) const
+{
+	return Symbols[ASymbol].Section;
+}
+
+unsigned int CObjectFile::GetSymbolValue(unsigned int ASymbol) const
+{
+	return Symbols[ASymbol].Value;
+}
+
+void CObjectFile::AddRelocation(unsigned int AOffset, unsigned int ASymbol, ERelocationType AType)
+{
+	CRelocation Relocation;
+	Relocation.Offset = AOffset;
+	Relocation.Symbol = ASymbol;
+	Relocation.Type = AType;
+	Relocations.push_back(Relocation);
+}
+
+/*
+ * Local symbols are not visible to the linker, so relocations against them
+ * are made against their sections, with the symbol value added to the
+ * addend. Labels starting with .L are left out of the symbol table, like
+ * GNU as does.
+ */
+void CObjectFile::Output(ostream &Stream)
+{
+	CSectionData &Text = Sections[OBJECT_SECTION_TEXT];
+
+	CSectionData Names;
+	CSectionData SectionNames;
+	CSectionData SymbolTable;
+	CSectionData RelocationTable;
+
+	AddName(Names, "");
+	AddName(SectionNames, "");
+
+	AddSymbolEntry(SymbolTable, 0, 0, 0, ELF::STB_LOCAL, ELF::STT_NOTYPE, ELF::SHN_UNDEF);
+	for (unsigned int i = OBJECT_SECTION_TEXT; i < OBJECT_SECTIONS_COUNT; i++) {
+		AddSymbolEntry(SymbolTable, 0, 0, 0, ELF::STB_LOCAL, ELF::STT_SECTION, i);
+	}
+
+	vector<unsigned int> Indices(Symbols.size(), 0);
+	unsigned int Count = OBJECT_SECTIONS_COUNT;
+	unsigned int FirstGlobal = 0;
+
+	for (unsigned int Pass = 0; Pass < 2; Pass++) {
+		bool Global = Pass == 1;
+		if (Global) {
+			FirstGlobal = Count;
+		}
+
+		for (unsigned int i = 0; i < Symbols.size(); i++) {
+			CSymbol &Symbol = Symbols[i];
+			bool SymbolGlobal = Symbol.Global || Symbol.Section == OBJECT_SECTION_UNDEFINED;
+
+			if (SymbolGlobal != Global || (!Global && Symbol.Name.compare(0, 2, ".L") == 0)) {
+				continue;
+			}
+
+			unsigned int Type = ELF::STT_NOTYPE;
+			if (Symbol.Section == OBJECT_SECTION_TEXT && Global) {
+				Type = ELF::STT_FUNC;
+			} else if (Symbol.Section == OBJECT_SECTION_DATA || Symbol.Section == OBJECT_SECTION_BSS) {
+				Type = ELF::STT_OBJECT;
+			}
+
+			AddSymbolEntry(SymbolTable, AddName(Names, Symbol.Name), Symbol.Value, Symbol.Size, Global ? ELF::STB_GLOBAL : ELF::STB_LOCAL, Type, Symbol.Section);
+			Indices[i] = Count++;
+		}
+	}
+
+	for (vector<CRelocation>::iterator it = Relocations.begin(); it != Relocations.end(); ++it) {
+		CSymbol &Symbol = Symbols[it->Symbol];
+		unsigned int Index = Indices[it->Symbol];
+
+		if (!Symbol.Global && Symbol.Section != OBJECT_SECTION_UNDEFINED) {
+			Text.SetLong(it->Offset, Text.GetLong(it->Offset) + Symbol.Value);
+			Index = Symbol.Section;
+		}
+
+		RelocationTable.AddLong(it->Offset);
+		RelocationTable.AddLong(Index << 8 | it->Type);
+	}
+
+	unsigned int SectionNameIndices[SECTION_HEADERS_COUNT];
+	SectionNameIndices[0] = 0;
+	SectionNameIndices[SECTION_HEADER_TEXT] = AddName(SectionNames, ".text");
+	SectionNameIndices[SECTION_HEADER_DATA] = AddName(SectionNames, ".data");
+	SectionNameIndices[SECTION_HEADER_BSS] = AddName(SectionNames, ".bss");
+	SectionNameIndices[SECTION_HEADER_RODATA] = AddName(SectionNames, ".rodata");
+	SectionNameIndices[SECTION_HEADER_REL_TEXT] = AddName(SectionNames, ".rel.text");
+	SectionNameIndices[SECTION_HEADER_NOTE] = AddName(SectionNames, ".note.GNU-stack");
+	SectionNameIndices[SECTION_HEADER_SYMTAB] = AddName(SectionNames, ".symtab");
+	SectionNameIndices[SECTION_HEADER_STRTAB] = AddName(SectionNames, ".strtab");
+	SectionNameIndices[SECTION_HEADER_SHSTRTAB] = AddName(SectionNames, ".shstrtab");
+
+	const CSectionData *Contents[SECTION_HEADERS_COUNT] = {
+		NULL,
+		&Text,
+		&Sections[OBJECT_SECTION_DATA],
+		NULL,
+		&Sections[OBJECT_SECTION_RODATA],
+		&RelocationTable,
+		NULL,
+		&SymbolTable,
+		&Names,
+		&SectionNames,
+	};
+
+	unsigned int Offsets[SECTION_HEADERS_COUNT];
+	unsigned int Offset = ELF::HEADER_SIZE;
+	for (unsigned int i = 0; i < SECTION_HEADERS_COUNT; i++) {
+		if (Contents[i] && (i == SECTION_HEADER_REL_TEXT || i == SECTION_HEADER_SYMTAB)) {
+			Offset = (Offset + 3) & ~3;
+		}
+		Offsets[i] = Offset;
+		if (Contents[i]) {
+			Offset += Contents[i]->GetSize();
+		}
+	}
+	unsigned int HeadersOffset = (Offset + 3) & ~3;
+
+	CSectionData Headers;
+	AddSectionHeader(Headers, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+	AddSectionHeader(Headers, SectionNameIndices[SECTION_HEADER_TEXT], ELF::SHT_PROGBITS, ELF::SHF_ALLOC | ELF::SHF_EXECINSTR, Offsets[SECTION_HEADER_TEXT], Text.GetSize(), 0, 0, 1, 0);
+	AddSectionHeader(Headers, SectionNameIndices[SECTION_HEADER_DATA], ELF::SHT_PROGBITS, ELF::SHF_ALLOC | ELF::SHF_WRITE, Offsets[SECTION_HEADER_DATA], Sections[OBJECT_SECTION_DATA].GetSize(), 0, 0, 4, 0);
+	AddSectionHeader(Headers, SectionNameIndices[SECTION_HEADER_BSS], ELF::SHT_NOBITS, ELF::SHF_ALLOC | ELF::SHF_WRITE, Offsets[SECTION_HEADER_BSS], BssSize, 0, 0, BssAlignment, 0);
+	AddSectionHeader(Headers, SectionNameIndices[SECTION_HEADER_RODATA], ELF::SHT_PROGBITS, ELF::SHF_ALLOC, Offsets[SECTION_HEADER_RODATA], Sections[OBJECT_SECTION_RODATA].GetSize(), 0, 0, 1, 0);
+	AddSectionHeader(Headers, SectionNameIndices[SECTION_HEADER_REL_TEXT], ELF::SHT_REL, ELF::SHF_INFO_LINK, Offsets[SECTION_HEADER_REL_TEXT], RelocationTable.GetSize(), SECTION_HEADER_SYMTAB, SECTION_HEADER_TEXT, 4, ELF::RELOCATION_SIZE);
+	AddSectionHeader(Headers, SectionNameIndices[SECTION_HEADER_NOTE], ELF::SHT_PROGBITS, 0, Offsets[SECTION_HEADER_NOTE], 0, 0, 0, 1, 0);
+	AddSectionHeader(Headers, SectionNameIndices[SECTION_HEADER_SYMTAB], ELF::SHT_SYMTAB, 0, Offsets[SECTION_HEADER_SYMTAB], SymbolTable.GetSize(), SECTION_HEADER_STRTAB, FirstGlobal, 4, ELF::SYMBOL_SIZE);
+	AddSectionHeader(Headers, SectionNameIndices[SECTION_HEADER_STRTAB], ELF::SHT_STRTAB, 0, Offsets[SECTION_HEADER_STRTAB], Names.GetSize(), 0, 0, 1, 0);
+	AddSectionHeader(Headers, SectionNameIndices[SECTION_HEADER_SHSTRTAB], ELF::SHT_STRTAB, 0, Offsets[SECTION_HEADER_SHSTRTAB], SectionNames.GetSize(), 0, 0, 1, 0);
+
+	CSectionData File;
+	File.AddString("\177ELF");
+	File.AddByte(1);	// 32-bit
+	File.AddByte(1);	// little-endian
+	File.AddByte(1);	// version
+	for (unsigned int i = 7; i < 16; i++) {
+		File.AddByte(0);
+	}
+	File.AddWord(ELF::ET_REL);
+	File.AddWord(ELF::EM_386);
+	File.AddLong(1);
+	File.AddLong(0);
+	File.AddLong(0);
+	File.AddLong(HeadersOffset);
+	File.AddLong(0);
+	File.AddWord(ELF::HEADER_SIZE);
+	File.AddWord(0);
+	File.AddWord(0);
+	File.AddWord(ELF::SECTION_HEADER_SIZE);
+	File.AddWord(SECTION_HEADERS_COUNT);
+	File.AddWord(SECTION_HEADER_SHSTRTAB);
+	File.Output(Stream);
+
+	unsigned int Position = ELF::HEADER_SIZE;
+	for (unsigned int i = 0; i < SECTION_HEADERS_COUNT; i++) {
+		if (!Contents[i]) {
+			continue;
+		}
+		for (; Position < Offsets[i]; Position++) {
+			Stream.put(0);
+		}
+		Contents[i]->Output(Stream);
+		Position += Contents[i]->GetSize();
+	}
+	for (; Position < HeadersOffset; Position++) {
+		Stream.put(0);
+	}
+
+	Headers.Output(Stream);
+}
+
+/******************************************************************************
+ * CAssembler
+ ******************************************************************************/
+
+CAssembler::CAssembler(CAsmCode &ACode) : Code(ACode), Out(NULL), Emitting(false)
+{
+}
+
+void CAssembler::Output(ostream &Stream)
+{
+	AssembleData();
+	Layout();
+	AssembleText();
+	Object.Output(Stream);
+}
+
+void CAssembler::AssembleData()
+{
+	CSectionData &Data = Object.GetSection(OBJECT_SECTION_DATA);
+	CSectionData &ReadOnlyData = Object.GetSection(OBJECT_SECTION_RODATA);
+
+	const map<string, string> &StringLiterals = Code.GetStringLiterals();
+	for (map<string, string>::const_iterator it = StringLiterals.begin(); it != StringLiterals.end(); ++it) {
+		string Value = Unescape(it->first);
+		Object.DefineSymbol(Object.GetSymbol(it->second), OBJECT_SECTION_RODATA, ReadOnlyData.GetSize(), Value.length() + 1);
+		ReadOnlyData.AddString(Value);
+		ReadOnlyData.AddByte(0);
+	}
+
+	const list<CVariableSymbol *> &GlobalVariables = Code.GetGlobalVariables();
+	for (list<CVariableSymbol *>::const_iterator it = GlobalVariables.begin(); it != GlobalVariables.end(); ++it) {
+		CVariableSymbol *Var = *it;
+		unsigned int Symbol = Object.GetSymbol(Var->GetName());
+		unsigned int Size = Var->GetType()->GetSize();
+
+		if (!Var->GetType()->IsScalar()) {
+			unsigned int Alignment = 1;
+			while (Alignment < Size && Alignment < 16) {
+				Alignment *= 2;
+			}
+
+			Object.DefineSymbol(Symbol, OBJECT_SECTION_BSS, Object.AllocateBss(Size, Alignment), Size);
+			Object.SetGlobal(Symbol);
+			continue;
+		}
+
+		Data.Align(4);
+		Object.DefineSymbol(Symbol, OBJECT_SECTION_DATA, Data.GetSize(), 4);
+
+		if (Var->GetType()->IsFloat()) {
+			float Value = Var->GetInitValue();
+			Data.AddLong(*((unsigned int *) &Value));
+		} else {
+			Data.AddLong((int) Var->GetInitValue());
+		}
+	}
+}
+
+/*
+ * Sizes of all instructions but jumps are fixed, so they are measured once;
+ * then label addresses are computed and the jumps that don't reach their
+ * targets are made long, until none is.
+ */
+void CAssembler::Layout()
+{
+	CSectionData Scratch;
+	Out = &Scratch;
+	Emitting = false;
+
+	Sizes.clear();
+	Long.clear();
+
+	for (CAsmCode::CodeIterator it = Code.Begin(); it != Code.End(); ++it) {
+		unsigned int Size = 0;
+		if (it->Type == INSTRUCTION_COMMAND && !IsJump(*it)) {
+			Scratch.Clear();
+			Encode(*it);
+			Size = Scratch.GetSize();
+		}
+
+		Sizes.push_back(Size);
+		Long.push_back(false);
+	}
+
+	bool Changed = true;
+
+	while (Changed) {
+		Changed = false;
+
+		unsigned int Address = 0;
+		unsigned int i = 0;
+
+		for (CAsmCode::CodeIterator it = Code.Begin(); it != Code.End(); ++it, ++i) {
+			if (it->Type == INSTRUCTION_LABEL) {
+				Labels[it->Operands[0].Label] = Address;
+			} else if (it->Type == INSTRUCTION_COMMAND && IsJump(*it)) {
+				Sizes[i] = !Long[i] ? 2 : it->Mnemonic == JMP ? 5 : 6;
+			}
+			Address += Sizes[i];
+		}
+
+		Address = 0;
+		i = 0;
+
+		for (CAsmCode::CodeIterator it = Code.Begin(); it != Code.End(); ++it, ++i) {
+			Address += Sizes[i];
+
+			if (it->Type == INSTRUCTION_COMMAND && IsJump(*it) && !Long[i]) {
+				int Displacement = (int) GetTarget(it->Operands[0]) - (int) Address;
+				if (Displacement < -128 || Displacement > 127) {
+					Long[i] = true;
+					Changed = true;
+				}
+			}
+		}
+	}
+}
+
+void CAssembler::AssembleText()
+{
+	CSectionData &Text = Object.GetSection(OBJECT_SECTION_TEXT);
+	Out = &Text;
+	Emitting = true;
+
+	unsigned int i = 0;
+
+	for (CAsmCode::CodeIterator it = Code.Begin(); it != Code.End(); ++it, ++i) {
+		if (it->Type == INSTRUCTION_LABEL) {
+			Object.DefineSymbol(Object.GetSymbol(CAsmCode::GetLabel(it->Operands[0].Label)), OBJECT_SECTION_TEXT, Text.GetSize());
+		} else if (it->Type == INSTRUCTION_DIRECTIVE) {
+			if (CAsmCode::GetLabel(it->Operands[0].Label) != "globl") {
+				Unsupported(*it);
+			}
+			Object.SetGlobal(Object.GetSymbol(CAsmCode::GetLabel(it->Operands[1].Label)));
+		} else if (it->Type == INSTRUCTION_COMMAND) {
+			if (IsJump(*it)) {
+				EncodeJump(*it, Long[i]);
+			} else {
+				Encode(*it);
+			}
+		}
+	}
+}
+
+void CAssembler::Encode(const CAsmInstruction &AInstruction)
+{
+	const CAsmOperand &Op1 = AInstruction.Operands[0];
+	const CAsmOperand &Op2 = AInstruction.Operands[1];
+	unsigned int Count = AInstruction.OperandsCount;
+
+	switch (AInstruction.Mnemonic) {
+	case MOV:
+		EncodeMove(Op1, Op2);
+		return;
+
+	case PUSH:
+		if (Op1.IsReg()) {
+			Out->AddByte(0x50 + GetNumber(Op1));
+		} else if (IsShort(Op1)) {
+			Out->AddByte(0x6A);
+			Out->AddByte(Op1.Value);
+		} else if (IsImmediate(Op1)) {
+			Out->AddByte(0x68);
+			EmitImmediate(Op1);
+		} else {
+			Out->AddByte(0xFF);
+			EmitModRM(6, Op1);
+		}
+		return;
+
+	case POP:
+		if (Op1.IsReg()) {
+			Out->AddByte(0x58 + GetNumber(Op1));
+		} else {
+			Out->AddByte(0x8F);
+			EmitModRM(0, Op1);
+		}
+		return;
+
+	case RET:
+		Out->AddByte(0xC3);
+		return;
+
+	case CALL:
+		if (!Op1.IsLabel()) {
+			Unsupported(AInstruction);
+		}
+		Out->AddByte(0xE8);
+		if (!Emitting) {
+			Out->AddLong(0);
+		} else if (Labels.count(Op1.Label)) {
+			Out->AddLong(Labels[Op1.Label] - (Out->GetSize() + 4));
+		} else {
+			Object.AddRelocation(Out->GetSize(), Object.GetSymbol(GetSymbolName(Op1.Label)), RELOCATION_RELATIVE);
+			Out->AddLong(-4);
+		}
+		return;
+
+	case ADD:
+		EncodeArithmetic(0, Op1, Op2);
+		return;
+	case OR:
+		EncodeArithmetic(1, Op1, Op2);
+		return;
+	case ADC:
+		EncodeArithmetic(2, Op1, Op2);
+		return;
+	case AND:
+		EncodeArithmetic(4, Op1, Op2);
+		return;
+	case SUB:
+		EncodeArithmetic(5, Op1, Op2);
+		return;
+	case XOR:
+		EncodeArithmetic(6, Op1, Op2);
+		return;
+	case CMP:
+		EncodeArithmetic(7, Op1, Op2);
+		return;
+
+	case NOT:
+		EncodeUnary(0xF7, 2, Op1);
+		return;
+	case NEG:
+		EncodeUnary(0xF7, 3, Op1);
+		return;
+	case MUL:
+		EncodeUnary(0xF7, 4, Op1);
+		return;
+	case DIV:
+		EncodeUnary(0xF7, 6, Op1);
+		return;
+	case IDIV:
+		EncodeUnary(0xF7, 7, Op1);
+		return;
+
+	case IMUL:
+		if (Count == 1) {
+			EncodeUnary(0xF7, 5, Op1);
+		} else if (!Op2.IsReg()) {
+			Unsupported(AInstruction);
+		} else if (IsShort(Op1)) {
+			Out->AddByte(0x6B);
+			EmitModRM(GetNumber(Op2), Op2);
+			Out->AddByte(Op1.Value);
+		} else if (IsImmediate(Op1)) {
+			Out->AddByte(0x69);
+			EmitModRM(GetNumber(Op2), Op2);
+			EmitImmediate(Op1);
+		} else {
+			Out->AddByte(0x0F);
+			Out->AddByte(0xAF);
+			EmitModRM(GetNumber(Op2), Op1);
+		}
+		return;
+
+	case INC:
+		if (Op1.IsReg()) {
+			Out->AddByte(0x40 + GetNumber(Op1));
+		} else {
+			EncodeUnary(0xFF, 0, Op1);
+		}
+		return;
+	case DEC:
+		if (Op1.IsReg()) {
+			Out->AddByte(0x48 + GetNumber(Op1));
+		} else {
+			EncodeUnary(0xFF, 1, Op1);
+		}
+		return;
+
+	case SAL:
+		EncodeShift(4, Op1, Op2);
+		return;
+	case SHR:
+		EncodeShift(5, Op1, Op2);
+		return;
+	case SAR:
+		EncodeShift(7, Op1, Op2);
+		return;
+
+	case LEA:
+		if (!IsMemory(Op1) || !Op2.IsReg()) {
+			Unsupported(AInstruction);
+		}
+		Out->AddByte(0x8D);
+		EmitModRM(GetNumber(Op2), Op1);
+		return;
+
+	case CDQ:
+		Out->AddByte(0x99);
+		return;
+	case SAHF:
+		Out->AddByte(0x9E);
+		return;
+
+	case FLD:
+		EncodeUnary(0xD9, 0, Op1);
+		return;
+	case FILD:
+		EncodeUnary(0xDB, 0, Op1);
+		return;
+	case FSTP:
+		if (Op1.IsReg()) {
+			Out->AddByte(0xDD);
+			Out->AddByte(0xD8 + GetNumber(Op1));
+		} else {
+			EncodeUnary(0xD9, 3, Op1);
+		}
+		return;
+	case FISTTP:
+		EncodeUnary(0xDB, 1, Op1);
+		return;
+	case FADD:
+		EncodeUnary(0xD8, 0, Op1);
+		return;
+	case FMUL:
+		EncodeUnary(0xD8, 1, Op1);
+		return;
+	case FSUBR:
+		EncodeUnary(0xD8, 5, Op1);
+		return;
+	case FDIVR:
+		EncodeUnary(0xD8, 7, Op1);
+		return;
+	case FCOMP:
+		if (Count) {
+			EncodeUnary(0xD8, 3, Op1);
+		} else {
+			Out->AddByte(0xD8);
+			Out->AddByte(0xD9);
+		}
+		return;
+	case FCOMPP:
+		Out->AddByte(0xDE);
+		Out->AddByte(0xD9);
+		return;
+	case FCHS:
+		Out->AddByte(0xD9);
+		Out->AddByte(0xE0);
+		return;
+	case FLD1:
+		Out->AddByte(0xD9);
+		Out->AddByte(0xE8);
+		return;
+	case FTST:
+		Out->AddByte(0xD9);
+		Out->AddByte(0xE4);
+		return;
+	case FSTSW:
+		if (!Op1.IsReg() || Op1.Base != AX) {
+			Unsupported(AInstruction);
+		}
+		Out->AddByte(0x9B);
+		Out->AddByte(0xDF);
+		Out->AddByte(0xE0);
+		return;
+
+	case MOVD:
+		if (IsXMM(Op2)) {
+			EncodeSSE(0x66, 0x6E, GetNumber(Op2), Op1);
+		} else {
+			EncodeSSE(0x66, 0x7E, GetNumber(Op1), Op2);
+		}
+		return;
+	case MOVSS:
+		if (IsXMM(Op2)) {
+			EncodeSSE(0xF3, 0x10, GetNumber(Op2), Op1);
+		} else {
+			EncodeSSE(0xF3, 0x11, GetNumber(Op1), Op2);
+		}
+		return;
+	case MOVDQA:
+		if (IsXMM(Op2)) {
+			EncodeSSE(0x66, 0x6F, GetNumber(Op2), Op1);
+		} else {
+			EncodeSSE(0x66, 0x7F, GetNumber(Op1), Op2);
+		}
+		return;
+	case MOVDQU:
+		if (IsXMM(Op2)) {
+			EncodeSSE(0xF3, 0x6F, GetNumber(Op2), Op1);
+		} else {
+			EncodeSSE(0xF3, 0x7F, GetNumber(Op1), Op2);
+		}
+		return;
+	case MOVUPS:
+		if (IsXMM(Op2)) {
+			EncodeSSE(0, 0x10, GetNumber(Op2), Op1);
+		} else {
+			EncodeSSE(0, 0x11, GetNumber(Op1), Op2);
+		}
+		return;
+
+	case PXOR:
+		EncodeSSE(0x66, 0xEF, GetNumber(Op2), Op1);
+		return;
+	case PADDD:
+		EncodeSSE(0x66, 0xFE, GetNumber(Op2), Op1);
+		return;
+	case PSUBD:
+		EncodeSSE(0x66, 0xFA, GetNumber(Op2), Op1);
+		return;
+	case PAND:
+		EncodeSSE(0x66, 0xDB, GetNumber(Op2), Op1);
+		return;
+	case POR:
+		EncodeSSE(0x66, 0xEB, GetNumber(Op2), Op1);
+		return;
+	case PUNPCKLDQ:
+		EncodeSSE(0x66, 0x62, GetNumber(Op2), Op1);
+		return;
+	case PUNPCKLQDQ:
+		EncodeSSE(0x66, 0x6C, GetNumber(Op2), Op1);
+		return;
+	case PSRLDQ:
+	case PSRLQ:
+		if (!IsShort(Op1)) {
+			Unsupported(AInstruction);
+		}
+		EncodeSSE(0x66, 0x73, AInstruction.Mnemonic == PSRLDQ ? 3 : 2, Op2);
+		Out->AddByte(Op1.Value);
+		return;
+	case ADDPS:
+		EncodeSSE(0, 0x58, GetNumber(Op2), Op1);
+		return;
+	case SUBPS:
+		EncodeSSE(0, 0x5C, GetNumber(Op2), Op1);
+		return;
+	case MULPS:
+		EncodeSSE(0, 0x59, GetNumber(Op2), Op1);
+		return;
+	case DIVPS:
+		EncodeSSE(0, 0x5E, GetNumber(Op2), Op1);
+		return;
+
+	default:
+		Unsupported(AInstruction);
+	}
+}
+
+/*
+ * Two-operand integer instructions that share the encoding of add: the
+ * extension selects the operation, both in the opcode and in the ModR/M byte.
+ */
+void CAssembler::EncodeArithmetic(unsigned int AExtension, const CAsmOperand &ASource, const CAsmOperand &ADestination)
+{
+	if (IsShort(ASource)) {
+		Out->AddByte(0x83);
+		EmitModRM(AExtension, ADestination);
+		Out->AddByte(ASource.Value);
+	} else if (IsImmediate(ASource) && ADestination.IsReg() && ADestination.Base == EAX) {
+		Out->AddByte(AExtension << 3 | 0x05);
+		EmitImmediate(ASource);
+	} else if (IsImmediate(ASource)) {
+		Out->AddByte(0x81);
+		EmitModRM(AExtension, ADestination);
+		EmitImmediate(ASource);
+	} else if (ASource.IsReg()) {
+		Out->AddByte(AExtension << 3 | 0x01);
+		EmitModRM(GetNumber(ASource), ADestination);
+	} else if (ADestination.IsReg()) {
+		Out->AddByte(AExtension << 3 | 0x03);
+		EmitModRM(GetNumber(ADestination), ASource);
+	} else {
+		throw logic_error("can't assemble arithmetic instruction with two memory operands");
+	}
+}
+
+void CAssembler::EncodeUnary(unsigned int AOpcode, unsigned int AExtension, const CAsmOperand &AOp)
+{
+	if (!AOp.IsReg() && !IsMemory(AOp)) {
+		throw logic_error("can't assemble instruction with an immediate operand");
+	}
+	Out->AddByte(AOpcode);
+	EmitModRM(AExtension, AOp);
+}
+
+void CAssembler::EncodeShift(unsigned int AExtension, const CAsmOperand &ASource, const CAsmOperand &ADestination)
+{
+	if (ASource.IsReg() && ASource.Base == CL) {
+		Out->AddByte(0xD3);
+		EmitModRM(AExtension, ADestination);
+	} else if (ASource.IsImm() && ASource.Value == 1) {
+		Out->AddByte(0xD1);
+		EmitModRM(AExtension, ADestination);
+	} else if (ASource.IsImm()) {
+		Out->AddByte(0xC1);
+		EmitModRM(AExtension, ADestination);
+		Out->AddByte(ASource.Value);
+	} else {
+		throw logic_error("can't assemble shift by a register other than cl");
+	}
+}
+
+/*
+ * Moves between eax and an absolute address have a form of their own, which
+ * is one byte shorter.
+ */
+void CAssembler::EncodeMove(const CAsmOperand &ASource, const CAsmOperand &ADestination)
+{
+	if (IsImmediate(ASource) && ADestination.IsReg()) {
+		Out->AddByte(0xB8 + GetNumber(ADestination));
+		EmitImmediate(ASource);
+	} else if (IsImmediate(ASource)) {
+		Out->AddByte(0xC7);
+		EmitModRM(0, ADestination);
+		EmitImmediate(ASource);
+	} else if (ASource.IsReg() && ASource.Base == EAX && IsAbsolute(ADestination)) {
+		Out->AddByte(0xA3);
+		EmitAddress(ADestination.Label, ADestination.Value);
+	} else if (ADestination.IsReg() && ADestination.Base == EAX && IsAbsolute(ASource)) {
+		Out->AddByte(0xA1);
+		EmitAddress(ASource.Label, ASource.Value);
+	} else if (ASource.IsReg()) {
+		Out->AddByte(0x89);
+		EmitModRM(GetNumber(ASource), ADestination);
+	} else if (ADestination.IsReg()) {
+		Out->AddByte(0x8B);
+		EmitModRM(GetNumber(ADestination), ASource);
+	} else {
+		throw logic_error("can't assemble move between two memory operands");
+	}
+}
+
+void CAssembler::EncodeSSE(unsigned int APrefix, unsigned int AOpcode, unsigned int ARegister, const CAsmOperand &AOp)
+{
+	if (APrefix) {
+		Out->AddByte(APrefix);
+	}
+	Out->AddByte(0x0F);
+	Out->AddByte(AOpcode);
+	EmitModRM(ARegister, AOp);
+}
+
+void CAssembler::EncodeJump(const CAsmInstruction &AInstruction, bool ALong)
+{
+	static const unsigned int Conditions[] = {
+		0x4,	// JE
+		0x5,	// JNE
+		0xC,	// JL
+		0xF,	// JG
+		0xE,	// JLE
+		0xD,	// JGE
+		0x7,	// JA
+		0x2,	// JB
+		0x3,	// JAE
+		0x6,	// JBE
+	};
+
+	unsigned int Target = GetTarget(AInstruction.Operands[0]);
+
+	if (!ALong) {
+		Out->AddByte(AInstruction.Mnemonic == JMP ? 0xEB : 0x70 | Conditions[AInstruction.Mnemonic - JE]);
+		Out->AddByte(Target - (Out->GetSize() + 1));
+		return;
+	}
+
+	if (AInstruction.Mnemonic == JMP) {
+		Out->AddByte(0xE9);
+	} else {
+		Out->AddByte(0x0F);
+		Out->AddByte(0x80 | Conditions[AInstruction.Mnemonic - JE]);
+	}
+	Out->AddLong(Target - (Out->GetSize() + 4));
+}
+
+void CAssembler::EmitModRM(unsigned int ARegister, const CAsmOperand &AOp)
+{
+	if (AOp.IsReg()) {
+		Out->AddByte(0xC0 | ARegister << 3 | GetNumber(AOp));
+		return;
+	}
+
+	if (AOp.Base == INVALID_REGISTER && AOp.Offset == INVALID_REGISTER) {
+		Out->AddByte(ARegister << 3 | 0x05);
+		EmitAddress(AOp.Label, AOp.Value);
+		return;
+	}
+
+	unsigned int Mod = 2;
+	if (AOp.Base == INVALID_REGISTER || (AOp.Label < 0 && AOp.Value == 0 && AOp.Base != EBP)) {
+		Mod = 0;
+	} else if (AOp.Label < 0 && AOp.Value >= -128 && AOp.Value <= 127) {
+		Mod = 1;
+	}
+
+	if (AOp.Offset == INVALID_REGISTER && AOp.Base != ESP) {
+		Out->AddByte(Mod << 6 | ARegister << 3 | GetNumber(AOp.Base));
+	} else {
+		unsigned int Scale = 0;
+		while (Scale < 3 && 1 << Scale < AOp.Multiplier) {
+			Scale++;
+		}
+
+		Out->AddByte(Mod << 6 | ARegister << 3 | 0x04);
+		Out->AddByte(Scale << 6 | (AOp.Offset == INVALID_REGISTER ? 0x04 : GetNumber(AOp.Offset)) << 3 | (AOp.Base == INVALID_REGISTER ? 0x05 : GetNumber(AOp.Base)));
+	}
+
+	if (Mod == 1) {
+		Out->AddByte(AOp.Value);
+	} else if (Mod == 2 || AOp.Base == INVALID_REGISTER) {
+		EmitAddress(AOp.Label, AOp.Value);
+	}
+}
+
+void CAssembler::EmitImmediate(const CAsmOperand &AOp)
+{
+	EmitAddress(AOp.Label, AOp.Value);
+}
+
+/*
+ * 32-bit value, plus the address of a symbol if there is one.
+ */
+void CAssembler::EmitAddress(int ALabel, int AValue)
+{
+	if (ALabel >= 0 && Emitting) {
+		Object.AddRelocation(Out->GetSize(), Object.GetSymbol(GetSymbolName(ALabel)), RELOCATION_ABSOLUTE);
+	}
+	Out->AddLong(AValue);
+}
+
+/*
+ * Label operands of instructions other than jumps and calls are addresses of
+ * symbols, written with a dollar sign, or memory at those addresses.
+ */
+bool CAssembler::IsImmediate(const CAsmOperand &AOp) const
+{
+	return AOp.IsImm() || (AOp.IsLabel() && CAsmCode::GetLabel(AOp.Label)[0] == '$');
+}
+
+bool CAssembler::IsMemory(const CAsmOperand &AOp) const
+{
+	return AOp.IsMem() || (AOp.IsLabel() && CAsmCode::GetLabel(AOp.Label)[0] != '$');
+}
+
+bool CAssembler::IsAbsolute(const CAsmOperand &AOp) const
+{
+	return IsMemory(AOp) && AOp.Base == INVALID_REGISTER && AOp.Offset == INVALID_REGISTER;
+}
+
+bool CAssembler::IsShort(const CAsmOperand &AOp) const
+{
+	return AOp.IsImm() && AOp.Value >= -128 && AOp.Value <= 127;
+}
+
+bool CAssembler::IsJump(const CAsmInstruction &AInstruction) const
+{
+	return AInstruction.Mnemonic == JMP || (AInstruction.Mnemonic >= JE && AInstruction.Mnemonic <= JBE);
+}
+
+unsigned int CAssembler::GetNumber(ERegister AReg) const
+{
+	switch (AReg) {
+	case EAX:
+	case AX:
+	case ST0:
+		return 0;
+	case ECX:
+	case CL:
+		return 1;
+	case EDX:
+		return 2;
+	case EBX:
+		return 3;
+	case ESP:
+		return 4;
+	case EBP:
+		return 5;
+	case ESI:
+		return 6;
+	case EDI:
+		return 7;
+	default:
+		if (AReg >= XMM0 && AReg <= XMM7) {
+			return AReg - XMM0;
+		}
+		throw logic_error("can't assemble 64-bit register");
+	}
+}
+
+unsigned int CAssembler::GetNumber(const CAsmOperand &AOp) const
+{
+	if (!AOp.IsReg()) {
+		throw logic_error("can't assemble instruction: register operand expected");
+	}
+	return GetNumber(AOp.Base);
+}
+
+bool CAssembler::IsXMM(const CAsmOperand &AOp) const
+{
+	return AOp.IsReg() && AOp.Base >= XMM0 && AOp.Base <= XMM7;
+}
+
+unsigned int CAssembler::GetTarget(const CAsmOperand &AOp) const
+{
+	map<int, unsigned int>::const_iterator it;
+	if (!AOp.IsLabel() || (it = Labels.find(AOp.Label)) == Labels.end()) {
+		throw logic_error("can't assemble jump to an undefined label");
+	}
+	return it->second;
+}
+
+string CAssembler::GetSymbolName(int ALabel) const
+{
+	const string &Name = CAsmCode::GetLabel(ALabel);
+	return Name[0] == '$' ? Name.substr(1) : Name;
+}
+
+void CAssembler::Unsupported(const CAsmInstruction &AInstruction) const
+{
+	ostringstream Instruction;
+	CAsmWriter Writer(Instruction);
+	Code.OutputInstruction(Writer, AInstruction);
+	Writer.Flush();
+	throw logic_error("can't assemble instruction: " + Instruction.str());
+}
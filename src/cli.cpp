@@ -60,7 +60,7 @@ CCompilerParameters CCommandLineInterface::ParseArguments()
 				}
 
 				Parameters.OutputFilename = *(++it);
-			} else if (CurArg == "-S" || CurArg == "--scan" || CurArg == "-P" || CurArg == "--parse" || CurArg == "-G" || CurArg == "--generate") {
+			} else if (CurArg == "-S" || CurArg == "--scan" || CurArg == "-P" || CurArg == "--parse" || CurArg == "-G" || CurArg == "--generate" || CurArg == "-R" || CurArg == "--run") {
 				if (Parameters.CompilerMode != COMPILER_MODE_UNDEFINED) {
 					throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "only one mode could be specified");
 				}
@@ -71,7 +71,11 @@ CCompilerParameters CCommandLineInterface::ParseArguments()
 					Parameters.CompilerMode = COMPILER_MODE_PARSE;
 				} else if (CurArg == "-G" || CurArg == "--generate") {
 					Parameters.CompilerMode = COMPILER_MODE_GENERATE;
+				} else if (CurArg == "-R" || CurArg == "--run") {
+					Parameters.CompilerMode = COMPILER_MODE_RUN;
 				}
+			} else if (CurArg == "-c" || CurArg == "--assemble") {
+				Parameters.Assemble = true;
 			} else if (CurArg == "-T" || CurArg == "--symbol-tables") {
 				Parameters.SymbolTables = true;
 			} else if (CurArg == "-O" || CurArg == "--optimize") {
@@ -98,6 +102,67 @@ CCompilerParameters CCommandLineInterface::ParseArguments()
 				} else {
 					throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "invalid value for " + CurArg + " option");
 				}
+			} else if (CurArg == "--target" || CurArg.compare(0, 9, "--target=") == 0) {
+				string OptValue;
+				if (CurArg == "--target") {
+					RequireArgument(it);
+					OptValue = *(++it);
+				} else {
+					OptValue = CurArg.substr(9);
+					CurArg = "--target";
+				}
+
+				if (OptValue == "i386") {
+					Parameters.Target = TARGET_I386;
+				} else if (OptValue == "x86_64") {
+					Parameters.Target = TARGET_X86_64;
+				} else {
+					throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "invalid value for " + CurArg + " option");
+				}
+			} else if (CurArg == "-fomit-frame-pointer") {
+				Parameters.OmitFramePointer = true;
+			} else if (CurArg == "-fno-omit-frame-pointer") {
+				Parameters.OmitFramePointer = false;
+			} else if (CurArg == "-fconstant-propagation") {
+				Parameters.ConstantPropagation = true;
+			} else if (CurArg == "-fno-constant-propagation") {
+				Parameters.ConstantPropagation = false;
+			} else if (CurArg == "-fgcse") {
+				Parameters.GlobalCSE = true;
+			} else if (CurArg == "-fno-gcse") {
+				Parameters.GlobalCSE = false;
+			} else if (CurArg == "-msse2") {
+				Parameters.SSE2 = true;
+			} else if (CurArg == "-mno-sse2") {
+				Parameters.SSE2 = false;
+			} else if (CurArg == "--inline-limit") {
+				Parameters.InlineLimit = RequireNumber(it);
+			} else if (CurArg == "--unroll-limit") {
+				Parameters.UnrollLimit = RequireNumber(it);
+			} else if (CurArg == "--unroll-factor") {
+				Parameters.UnrollFactor = RequireNumber(it, 1);
+			} else if (CurArg == "-fprofile-generate" || CurArg.compare(0, 19, "-fprofile-generate=") == 0) {
+				Parameters.ProfileGenerateFilename = CurArg == "-fprofile-generate" ? DEFAULT_PROFILE_FILENAME : CurArg.substr(19);
+
+				if (Parameters.ProfileGenerateFilename.empty()) {
+					throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "invalid value for -fprofile-generate option");
+				}
+			} else if (CurArg == "-fprofile-use" || CurArg.compare(0, 14, "-fprofile-use=") == 0) {
+				Parameters.ProfileUseFilename = CurArg == "-fprofile-use" ? DEFAULT_PROFILE_FILENAME : CurArg.substr(14);
+
+				if (Parameters.ProfileUseFilename.empty()) {
+					throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "invalid value for -fprofile-use option");
+				}
+			} else if (CurArg == "--time-report" || CurArg.compare(0, 14, "--time-report=") == 0) {
+				string OptValue = CurArg == "--time-report" ? "table" : CurArg.substr(14);
+
+				if (OptValue == "table") {
+					Parameters.TimeReport = TIME_REPORT_FORMAT_TABLE;
+				} else if (OptValue == "json") {
+					Parameters.TimeReport = TIME_REPORT_FORMAT_JSON;
+				} else {
+					throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "invalid value for --time-report option");
+				}
 			} else if (CurArg == "--tree") {
 				RequireArgument(it);
 
@@ -139,6 +204,26 @@ CCompilerParameters CCommandLineInterface::ParseArguments()
 		throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "optimization can only be enabled when compiler mode is code generation");
 	}
 
+	if ((!Parameters.ProfileGenerateFilename.empty() || !Parameters.ProfileUseFilename.empty()) && Parameters.CompilerMode != COMPILER_MODE_GENERATE) {
+		throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "profiling can only be enabled when compiler mode is code generation");
+	}
+
+	if (!Parameters.ProfileGenerateFilename.empty() && !Parameters.ProfileUseFilename.empty()) {
+		throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "a profile can't be generated and used at the same time");
+	}
+
+	if (Parameters.Assemble && Parameters.CompilerMode != COMPILER_MODE_GENERATE) {
+		throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "object file can only be written when compiler mode is code generation");
+	}
+
+	if (Parameters.Assemble && Parameters.Target != TARGET_I386) {
+		throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "object file can only be written for i386 target");
+	}
+
+	if (Parameters.CompilerMode == COMPILER_MODE_RUN && Parameters.Target != TARGET_I386) {
+		throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "programs can only be run for i386 target");
+	}
+
 	if (!Parameters.TreeFilename.empty() && Parameters.CompilerMode != COMPILER_MODE_GENERATE) {
 		throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "parse tree can only be written to a separate file when compiler mode is code generation");
 	}
@@ -214,11 +299,22 @@ void CCommandLineInterface::PopulateHelp()
 	Help.Add("-S", "--scan", "Run scanner");
 	Help.Add("-P", "--parse", "Run parser");
 	Help.Add("-G", "--generate", "Run code generator");
+	Help.Add("-R", "--run", "Run the program in process, compiled to bytecode, and exit with its result");
+	Help.Add("-c", "--assemble", "Write an ELF32 object file instead of assembler code (i386 only)");
 
 	Help.AddSeparator();
 
 	Help.Add("-T", "--symbol-tables", "Print symbol tables");
 	Help.Add("-O", "--optimize", "Perform optimizations");
+	Help.Add("", "-fomit-frame-pointer", "Address locals relative to the stack pointer, freeing the frame pointer");
+	Help.Add("", "-fno-omit-frame-pointer", "Keep frame pointers, e.g. for profiling (default)");
+	Help.Add("", "-fno-constant-propagation", "Keep variables whose reaching definitions all assign one constant");
+	Help.Add("", "-fno-gcse", "Keep expressions already computed on every path to them");
+	Help.Add("", "--inline-limit size", "Inline functions up to this size when optimizing, 0 disables inlining");
+	Help.Add("", "--unroll-limit size", "Unroll loops up to this size when optimizing, 0 disables unrolling");
+	Help.Add("", "--unroll-factor n", "Unroll loops with unknown trip counts n times, 1 unrolls only constant ones");
+	Help.Add("", "-fprofile-generate[=file]", "Count how often blocks and calls run, writing the counts to file (" DEFAULT_PROFILE_FILENAME ") at exit");
+	Help.Add("", "-fprofile-use[=file]", "Place code, invert branches, order cases, inline and unroll by the counts in file");
 
 	Help.AddSeparator();
 
@@ -228,6 +324,10 @@ void CCommandLineInterface::PopulateHelp()
 	Help.AddSeparator();
 
 	Help.Add("", "--tree filename", "Output parse tree to a separate file");
+	Help.Add("", "--time-report[=table|json]", "Print time and allocations of each compiler phase to stderr");
+	Help.Add("", "--target i386|x86_64", "Generate code for i386 (default) or x86-64");
+	Help.Add("", "-msse2", "Use SSE2 instructions, which lets loops be vectorized when optimizing");
+	Help.Add("", "-mno-sse2", "Don't use SSE2 instructions (default)");
 }
 
 void CCommandLineInterface::RequireArgument(ArgumentsIterator &AOption)
@@ -236,3 +336,22 @@ void CCommandLineInterface::RequireArgument(ArgumentsIterator &AOption)
 		throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, *AOption + " option requires an argument");
 	}
 }
+
+/*
+ * Reads the argument of an option as a decimal number no less than AMinimum.
+ * Signs aren't accepted, so that negative values don't wrap around.
+ */
+unsigned int CCommandLineInterface::RequireNumber(ArgumentsIterator &AOption, unsigned int AMinimum /*= 0*/)
+{
+	RequireArgument(AOption);
+
+	const string &Option = *AOption;
+	istringstream OptValue(*(++AOption));
+	unsigned int Result;
+
+	if (!CharTraits::IsDigit(OptValue.peek()) || !(OptValue >> Result) || !OptValue.eof() || Result < AMinimum) {
+		throw CFatalException(EXIT_CODE_INVALID_ARGUMENTS, "invalid value for " + Option + " option");
+	}
+
+	return Result;
+}
@@ -21,464 +21,732 @@
 #include "expressions.h"
 #include "parser.h"
 #include "optimization.h"
+#include "assembler.h"
+#include "timereport.h"
 
 /******************************************************************************
- * CAsmCmd
+ * CAsmOperand
  ******************************************************************************/
 
-CAsmCmd::~CAsmCmd()
+bool CAsmOperand::IsReg() const
 {
+	return Type == OPERAND_REGISTER;
 }
 
-string CAsmCmd::GetName() const
+bool CAsmOperand::IsImm() const
 {
-	return Name;
+	return Type == OPERAND_IMMEDIATE;
 }
 
-void CAsmCmd::SetName(const string &AName)
+bool CAsmOperand::IsMem() const
 {
-	Name = AName;
+	return Type == OPERAND_MEMORY;
 }
 
-/******************************************************************************
- * CAsmOp
- ******************************************************************************/
+bool CAsmOperand::IsLabel() const
+{
+	return Type == OPERAND_LABEL;
+}
 
-bool CAsmOp::IsReg() const
+bool CAsmOperand::operator==(const CAsmOperand &AOp) const
 {
-	return false;
+	return Type == AOp.Type && Base == AOp.Base && Offset == AOp.Offset && Multiplier == AOp.Multiplier && Value == AOp.Value && Label == AOp.Label;
 }
 
-bool CAsmOp::IsImm() const
+bool CAsmOperand::operator!=(const CAsmOperand &AOp) const
 {
-	return false;
+	return !(*this == AOp);
 }
 
-bool CAsmOp::IsMem() const
+static CAsmOperand operand(EAsmOperandType AType, ERegister ABase, ERegister AOffset, int AMultiplier, int AValue, int ALabel)
 {
-	return false;
+	CAsmOperand result;
+
+	result.Type = AType;
+	result.Base = ABase;
+	result.Offset = AOffset;
+	result.Multiplier = AMultiplier;
+	result.Value = AValue;
+	result.Label = ALabel;
+
+	return result;
 }
 
-/******************************************************************************
- * CAsmReg
- ******************************************************************************/
+CAsmOperand reg(ERegister AReg)
+{
+	return operand(OPERAND_REGISTER, AReg, INVALID_REGISTER, 0, 0, -1);
+}
 
-CAsmReg::CAsmReg(const string &AName) : Name(AName)
+CAsmOperand imm(int AValue)
 {
+	return operand(OPERAND_IMMEDIATE, INVALID_REGISTER, INVALID_REGISTER, 0, AValue, -1);
 }
 
-string CAsmReg::GetName() const
+CAsmOperand mem(int ADisplacement, ERegister ABase, ERegister AOffset /*= INVALID_REGISTER*/, int AMultiplier /*= 0*/)
 {
-	return Name;
+	return operand(OPERAND_MEMORY, ABase, AOffset, AMultiplier, ADisplacement, -1);
 }
 
-void CAsmReg::SetName(const string &AName)
+CAsmOperand mem(ERegister ABase)
 {
-	Name = AName;
+	return operand(OPERAND_MEMORY, ABase, INVALID_REGISTER, 0, 0, -1);
 }
 
-string CAsmReg::GetText() const
+CAsmOperand mem(const string &ALabel, ERegister ABase)
 {
-	return "%" + Name;
+	return operand(OPERAND_MEMORY, ABase, INVALID_REGISTER, 0, 0, CAsmCode::Intern(ALabel));
 }
 
-bool CAsmReg::IsReg() const
+CAsmOperand label(const string &AName)
 {
-	return true;
+	return operand(OPERAND_LABEL, INVALID_REGISTER, INVALID_REGISTER, 0, 0, CAsmCode::Intern(AName));
 }
 
 /******************************************************************************
- * CAsmImm
+ * CAsmInstruction
  ******************************************************************************/
 
-CAsmImm::CAsmImm(int AValue) : Value(AValue)
+bool CAsmInstruction::IsCommand(EMnemonic AMnemonic) const
 {
+	return Type == INSTRUCTION_COMMAND && Mnemonic == AMnemonic;
 }
 
-string CAsmImm::GetText() const
+bool CAsmInstruction::IsLabel() const
 {
-	return "$" + ToString(Value);
+	return Type == INSTRUCTION_LABEL;
 }
 
-int CAsmImm::GetValue() const
+/******************************************************************************
+ * CAsmWriter
+ ******************************************************************************/
+
+CAsmWriter::CAsmWriter(ostream &AStream) : Stream(AStream), Buffer(BufferSize), Length(0)
 {
-	return Value;
 }
 
-bool CAsmImm::IsImm() const
+CAsmWriter::~CAsmWriter()
 {
-	return true;
+	Flush();
 }
 
-/******************************************************************************
- * CAsmMem
- ******************************************************************************/
-
-CAsmMem::CAsmMem(int ADisplacement, ERegister ABase, ERegister AOffset, int AMultiplier) : Displacement(ADisplacement), Base(ABase), Offset(AOffset), Multiplier(AMultiplier)
+void CAsmWriter::Write(char AChar)
 {
+	if (Length == BufferSize) {
+		Flush();
+	}
+	Buffer[Length++] = AChar;
 }
 
-string CAsmMem::GetText() const
+void CAsmWriter::Write(const char *AText, unsigned int ALength)
 {
-	string result;
-
-	result += Displacement ? ToString(Displacement) : "";
-	result += "(";
-	result += (Base != INVALID_REGISTER) ? "%" + RegistersText[Base] : "";
-	if (Offset != INVALID_REGISTER || Multiplier) {
-		result += ", ";
+	if (Length + ALength > BufferSize) {
+		Flush();
+		if (ALength > BufferSize) {
+			Stream.write(AText, ALength);
+			return;
+		}
 	}
-	result += (Offset != INVALID_REGISTER) ? "%" + RegistersText[Offset] : "";
-	result += Multiplier ? ", " + ToString(Multiplier) : "";
-	result += ")";
+	copy(AText, AText + ALength, &Buffer[Length]);
+	Length += ALength;
+}
 
-	return result;
+void CAsmWriter::Write(const string &AText)
+{
+	Write(AText.data(), AText.length());
 }
 
-bool CAsmMem::IsMem() const
+void CAsmWriter::Write(int AValue)
 {
-	return true;
+	char Digits[12];
+	unsigned int Count = 0;
+	unsigned int Value = AValue < 0 ? 0u - AValue : AValue;
+
+	do {
+		Digits[sizeof(Digits) - ++Count] = '0' + Value % 10;
+		Value /= 10;
+	} while (Value);
+
+	if (AValue < 0) {
+		Digits[sizeof(Digits) - ++Count] = '-';
+	}
+
+	Write(Digits + sizeof(Digits) - Count, Count);
 }
 
-CAsmMem* mem(int ADisplacement, ERegister ABase, ERegister AOffset /*= INVALID_REGISTER*/, int AMultiplier /*= 0*/)
+/*
+ * Formats like a stream with default flags does.
+ */
+void CAsmWriter::Write(float AValue)
 {
-	return new CAsmMem(ADisplacement, ABase, AOffset, AMultiplier);
+	char Text[32];
+	Write(Text, snprintf(Text, sizeof(Text), "%g", AValue));
 }
 
-CAsmMem* mem(ERegister ABase)
+void CAsmWriter::Flush()
 {
-	return new CAsmMem(0, ABase, INVALID_REGISTER, 0);
+	Stream.write(&Buffer[0], Length);
+	Length = 0;
 }
 
 /******************************************************************************
- * CAsmLabelOp
+ * CAsmCode
  ******************************************************************************/
 
-CAsmLabelOp::CAsmLabelOp(const string &AName)
-{
-	Name = AName;
+/*
+ * Spellings of mnemonics and registers, in the order of their enumerations,
+ * with their lengths, so that they are written without a lookup.
+ */
+struct CAsmText
+{
+	const char *Text;
+	unsigned int Length;
+};
+
+#define ASM_TEXT(text) { text, sizeof(text) - 1 }
+
+static const CAsmText MnemonicsText[] = {
+	ASM_TEXT("mov"),	// MOV
+	ASM_TEXT("push"),	// PUSH
+	ASM_TEXT("pop"),	// POP
+	ASM_TEXT("ret"),	// RET
+	ASM_TEXT("call"),	// CALL
+	ASM_TEXT("jmp"),	// JMP
+	ASM_TEXT("je"),	// JE
+	ASM_TEXT("jne"),	// JNE
+	ASM_TEXT("jl"),	// JL
+	ASM_TEXT("jg"),	// JG
+	ASM_TEXT("jle"),	// JLE
+	ASM_TEXT("jge"),	// JGE
+	ASM_TEXT("ja"),	// JA
+	ASM_TEXT("jb"),	// JB
+	ASM_TEXT("jae"),	// JAE
+	ASM_TEXT("jbe"),	// JBE
+	ASM_TEXT("add"),	// ADD
+	ASM_TEXT("sub"),	// SUB
+	ASM_TEXT("mul"),	// MUL
+	ASM_TEXT("imul"),	// IMUL
+	ASM_TEXT("div"),	// DIV
+	ASM_TEXT("idiv"),	// IDIV
+	ASM_TEXT("inc"),	// INC
+	ASM_TEXT("dec"),	// DEC
+	ASM_TEXT("neg"),	// NEG
+	ASM_TEXT("cmp"),	// CMP
+	ASM_TEXT("cdq"),	// CDQ
+	ASM_TEXT("not"),	// NOT
+	ASM_TEXT("and"),	// AND
+	ASM_TEXT("or"),	// OR
+	ASM_TEXT("xor"),	// XOR
+	ASM_TEXT("sal"),	// SAL
+	ASM_TEXT("sar"),	// SAR
+	ASM_TEXT("shr"),	// SHR
+	ASM_TEXT("lea"),	// LEA
+	ASM_TEXT("sahf"),	// SAHF
+	ASM_TEXT("fld"),	// FLD
+	ASM_TEXT("fildl"),	// FILD
+	ASM_TEXT("fstp"),	// FSTP
+	ASM_TEXT("fisttpl"),	// FISTTP
+	ASM_TEXT("fchs"),	// FCHS
+	ASM_TEXT("fld1"),	// FLD1
+	ASM_TEXT("fadd"),	// FADD
+	ASM_TEXT("fsubr"),	// FSUBR
+	ASM_TEXT("fmul"),	// FMUL
+	ASM_TEXT("fdivr"),	// FDIVR
+	ASM_TEXT("ftst"),	// FTST
+	ASM_TEXT("fcomp"),	// FCOMP
+	ASM_TEXT("fcompp"),	// FCOMPP
+	ASM_TEXT("fstsw"),	// FSTSW
+	ASM_TEXT("cltq"),	// CLTQ
+	ASM_TEXT("movslq"),	// MOVSLQ
+	ASM_TEXT("movd"),	// MOVD
+	ASM_TEXT("movss"),	// MOVSS
+	ASM_TEXT("movdqa"),	// MOVDQA
+	ASM_TEXT("movdqu"),	// MOVDQU
+	ASM_TEXT("movups"),	// MOVUPS
+	ASM_TEXT("pxor"),	// PXOR
+	ASM_TEXT("paddd"),	// PADDD
+	ASM_TEXT("psubd"),	// PSUBD
+	ASM_TEXT("pand"),	// PAND
+	ASM_TEXT("por"),	// POR
+	ASM_TEXT("punpckldq"),	// PUNPCKLDQ
+	ASM_TEXT("punpcklqdq"),	// PUNPCKLQDQ
+	ASM_TEXT("psrldq"),	// PSRLDQ
+	ASM_TEXT("psrlq"),	// PSRLQ
+	ASM_TEXT("addps"),	// ADDPS
+	ASM_TEXT("subps"),	// SUBPS
+	ASM_TEXT("mulps"),	// MULPS
+	ASM_TEXT("divps"),	// DIVPS
+	ASM_TEXT("adc"),	// ADC
+};
+
+static const CAsmText RegistersText[] = {
+	ASM_TEXT("eax"),	// EAX
+	ASM_TEXT("ebx"),	// EBX
+	ASM_TEXT("ecx"),	// ECX
+	ASM_TEXT("edx"),	// EDX
+	ASM_TEXT("esi"),	// ESI
+	ASM_TEXT("edi"),	// EDI
+	ASM_TEXT("esp"),	// ESP
+	ASM_TEXT("ebp"),	// EBP
+	ASM_TEXT("ax"),	// AX
+	ASM_TEXT("cl"),	// CL
+	ASM_TEXT("st(0)"),	// ST0
+	ASM_TEXT("rax"),	// RAX
+	ASM_TEXT("rbx"),	// RBX
+	ASM_TEXT("rcx"),	// RCX
+	ASM_TEXT("rdx"),	// RDX
+	ASM_TEXT("rsi"),	// RSI
+	ASM_TEXT("rdi"),	// RDI
+	ASM_TEXT("rsp"),	// RSP
+	ASM_TEXT("rbp"),	// RBP
+	ASM_TEXT("r8"),	// R8
+	ASM_TEXT("r9"),	// R9
+	ASM_TEXT("rip"),	// RIP
+	ASM_TEXT("xmm0"),	// XMM0
+	ASM_TEXT("xmm1"),	// XMM1
+	ASM_TEXT("xmm2"),	// XMM2
+	ASM_TEXT("xmm3"),	// XMM3
+	ASM_TEXT("xmm4"),	// XMM4
+	ASM_TEXT("xmm5"),	// XMM5
+	ASM_TEXT("xmm6"),	// XMM6
+	ASM_TEXT("xmm7"),	// XMM7
+};
+
+#undef ASM_TEXT
+
+
+map<string, int> CAsmCode::Labels;
+vector<string> CAsmCode::LabelNames;
+
+CAsmCode::CAsmCode(ETarget ATarget /*= TARGET_I386*/) : Target(ATarget), LabelsCount(0), StackDepth(0), Cold(false)
+{
+	WideRegisters[EAX] = RAX;
+	WideRegisters[EBX] = RBX;
+	WideRegisters[ECX] = RCX;
+	WideRegisters[EDX] = RDX;
+	WideRegisters[ESI] = RSI;
+	WideRegisters[EDI] = RDI;
+	WideRegisters[ESP] = RSP;
+	WideRegisters[EBP] = RBP;
 }
 
-string CAsmLabelOp::GetName() const
+CAsmCode::~CAsmCode()
 {
-	return Name;
 }
 
-void CAsmLabelOp::SetName(const string &AName)
+ETarget CAsmCode::GetTarget() const
 {
-	Name = AName;
+	return Target;
 }
 
-string CAsmLabelOp::GetText() const
+void CAsmCode::Add(EMnemonic ACmd)
 {
-	return Name;
+	Append(ACmd, 0, CAsmOperand(), CAsmOperand());
 }
 
-/******************************************************************************
- * CAsmCmd0
- ******************************************************************************/
-
-CAsmCmd0::CAsmCmd0(const string &AName)
+void CAsmCode::Add(EMnemonic ACmd, ERegister AOp)
 {
-	Name = AName;
+	TrackStack(ACmd);
+	Append(ACmd, 1, reg(Legalize(ACmd, AOp)), CAsmOperand());
 }
 
-string CAsmCmd0::GetText() const
+void CAsmCode::Add(EMnemonic ACmd, int AOp)
 {
-	return "\t" + Name;
+	TrackStack(ACmd);
+	Append(ACmd, 1, imm(AOp), CAsmOperand());
 }
 
-/******************************************************************************
- * CAsmCmd1
- ******************************************************************************/
-
-CAsmCmd1::CAsmCmd1(const string &AName, CAsmOp *AOp) : Op(AOp)
+void CAsmCode::Add(EMnemonic ACmd, ERegister AOp1, ERegister AOp2)
 {
-	Name = AName;
+	Append(ACmd, 2, reg(Legalize(ACmd, AOp1)), reg(Legalize(ACmd, AOp2, true)));
 }
 
-CAsmCmd1::~CAsmCmd1()
+void CAsmCode::Add(EMnemonic ACmd, int AOp1, ERegister AOp2)
 {
-	delete Op;
+	if (AOp2 == ESP && ACmd == SUB) {
+		StackDepth += AOp1;
+	} else if (AOp2 == ESP && ACmd == ADD) {
+		StackDepth -= AOp1;
+	}
+
+	Append(ACmd, 2, imm(AOp1), reg(Legalize(ACmd, AOp2, true)));
 }
 
-string CAsmCmd1::GetText() const
+void CAsmCode::Add(EMnemonic ACmd, const string &AOp)
 {
-	return "\t" + Name + "\t" + Op->GetText();
+	TrackStack(ACmd);
+	Append(ACmd, 1, label(AOp), CAsmOperand());
 }
 
-CAsmOp* CAsmCmd1::GetOp() const
+void CAsmCode::Add(EMnemonic ACmd, const CAsmOperand &AOp)
 {
-	return Op;
+	TrackStack(ACmd);
+	Append(ACmd, 1, Legalize(AOp), CAsmOperand());
 }
 
-void CAsmCmd1::SetOp(CAsmOp *AOp)
+void CAsmCode::Add(EMnemonic ACmd, ERegister AOp1, const CAsmOperand &AOp2)
 {
-	Op = AOp;
+	Append(ACmd, 2, reg(Legalize(ACmd, AOp1)), Legalize(AOp2));
 }
 
-/******************************************************************************
- * CAsmCmd2
- ******************************************************************************/
-
-CAsmCmd2::CAsmCmd2(const string &AName, CAsmOp *AOp1, CAsmOp *AOp2) : Op1(AOp1), Op2(AOp2)
+void CAsmCode::Add(EMnemonic ACmd, const CAsmOperand &AOp1, ERegister AOp2)
 {
-	Name = AName;
+	Append(ACmd, 2, Legalize(AOp1), reg(Legalize(ACmd, AOp2, true)));
 }
 
-CAsmCmd2::~CAsmCmd2()
+void CAsmCode::Add(const string &ALabel)
 {
-	delete Op1;
-	delete Op2;
+	CAsmInstruction Instruction = CAsmInstruction();
+
+	Instruction.Type = INSTRUCTION_LABEL;
+	Instruction.Operands[0] = label(ALabel);
+
+	if (Cold) {
+		ColdLabels.insert(Instruction.Operands[0].Label);
+	}
+
+	Code.push_back(Instruction);
 }
 
-string CAsmCmd2::GetText() const
+void CAsmCode::AddDirective(const string &AName, const string &AArgument)
 {
-	return "\t" + Name + "\t" + Op1->GetText() + ", " + Op2->GetText();
+	CAsmInstruction Instruction = CAsmInstruction();
+
+	Instruction.Type = INSTRUCTION_DIRECTIVE;
+	Instruction.Operands[0] = label(AName);
+	Instruction.Operands[1] = label(AArgument);
+
+	Code.push_back(Instruction);
 }
 
-CAsmOp* CAsmCmd2::GetOp1() const
+/*
+ * Optimizations edit the stream in place: an instruction is replaced by
+ * another one or marked removed, and removed ones are dropped by Compact, so
+ * that iterators stay valid during a pass. Edited instructions are marked
+ * changed until ClearChanges, as are the ones added since.
+ */
+void CAsmCode::Replace(CAsmCode::CodeIterator APosition, const CAsmInstruction &AInstruction)
 {
-	return Op1;
+	*APosition = AInstruction;
+	APosition->Operands[0] = Legalize(AInstruction.Operands[0]);
+	APosition->Operands[1] = Legalize(AInstruction.Operands[1]);
+	MarkChanged(APosition);
 }
 
-CAsmOp* CAsmCmd2::GetOp2() const
+void CAsmCode::Remove(CAsmCode::CodeIterator APosition)
 {
-	return Op2;
+	APosition->Type = INSTRUCTION_REMOVED;
+	MarkChanged(APosition);
 }
 
-void CAsmCmd2::SetOp1(CAsmOp *AOp1)
+/*
+ * A removed instruction passes its change on to the instruction that follows
+ * it, which now has different neighbours.
+ */
+void CAsmCode::Compact()
 {
-	Op1 = AOp1;
+	unsigned int Last = 0;
+	bool Pending = false;
+
+	for (unsigned int i = 0; i < Code.size(); i++) {
+		Pending = Pending || IsChanged(Code.begin() + i);
+
+		if (Code[i].Type == INSTRUCTION_REMOVED) {
+			continue;
+		}
+
+		Code[Last] = Code[i];
+		if (Last < Changed.size()) {
+			Changed[Last] = Pending;
+		}
+
+		Last++;
+		Pending = false;
+	}
+
+	if (Pending && Last > 0) {
+		MarkChanged(Code.begin() + Last - 1);
+	}
+
+	Code.erase(Code.begin() + Last, Code.end());
+	Changed.resize(min((unsigned int) Changed.size(), Last));
 }
 
-void CAsmCmd2::SetOp2(CAsmOp *AOp2)
+/*
+ * Replaces the whole stream, for optimizations that reorder it. The previous
+ * stream is left in the argument.
+ */
+void CAsmCode::Swap(CodeContainer &ACode)
 {
-	Op2 = AOp2;
+	Code.swap(ACode);
+	Changed.clear();
 }
 
-/******************************************************************************
- * CAsmLabel
- ******************************************************************************/
-
-CAsmLabel::CAsmLabel(const string &AName)
+bool CAsmCode::IsChanged(CAsmCode::CodeIterator APosition) const
 {
-	Name = AName;
+	unsigned int Index = APosition - Code.begin();
+	return Index >= Changed.size() || Changed[Index];
 }
 
-string CAsmLabel::GetText() const
+void CAsmCode::ClearChanges()
 {
-	return Name + ":";
+	Changed.assign(Code.size(), false);
 }
 
-/******************************************************************************
- * CAsmDirective
- ******************************************************************************/
-
-CAsmDirective::CAsmDirective(const string &AName, const string &AArgument) : Argument(AArgument)
+CAsmCode::CodeIterator CAsmCode::Begin()
 {
-	Name = AName;
+	return Code.begin();
 }
 
-string CAsmDirective::GetText() const
+CAsmCode::CodeIterator CAsmCode::End()
 {
-	return "." + Name + "\t" + Argument;
+	return Code.end();
 }
 
-/******************************************************************************
- * CAsmCode
- ******************************************************************************/
+CAsmCode::CodeIterator CAsmCode::Next(CAsmCode::CodeIterator APosition)
+{
+	do {
+		++APosition;
+	} while (APosition != Code.end() && APosition->Type == INSTRUCTION_REMOVED);
 
-CAsmCode::CAsmCode() : LabelsCount(0)
-{
-	MnemonicsText[MOV] = "mov";
-	MnemonicsText[PUSH] = "push";
-	MnemonicsText[POP] = "pop";
-	MnemonicsText[RET] = "ret";
-	MnemonicsText[CALL] = "call";
-	MnemonicsText[JMP] = "jmp";
-	MnemonicsText[JE] = "je";
-	MnemonicsText[JNE] = "jne";
-	MnemonicsText[JL] = "jl";
-	MnemonicsText[JG] = "jg";
-	MnemonicsText[JLE] = "jle";
-	MnemonicsText[JGE] = "jge";
-	MnemonicsText[JA] = "ja";
-	MnemonicsText[JB] = "jb";
-	MnemonicsText[JAE] = "jae";
-	MnemonicsText[JBE] = "jbe";
-	MnemonicsText[ADD] = "add";
-	MnemonicsText[SUB] = "sub";
-	MnemonicsText[MUL] = "mul";
-	MnemonicsText[IMUL] = "imul";
-	MnemonicsText[DIV] = "div";
-	MnemonicsText[IDIV] = "idiv";
-	MnemonicsText[INC] = "inc";
-	MnemonicsText[DEC] = "dec";
-	MnemonicsText[NEG] = "neg";
-	MnemonicsText[CMP] = "cmp";
-	MnemonicsText[CDQ] = "cdq";
-	MnemonicsText[NOT] = "not";
-	MnemonicsText[AND] = "and";
-	MnemonicsText[OR] = "or";
-	MnemonicsText[XOR] = "xor";
-	MnemonicsText[SAL] = "sal";
-	MnemonicsText[SAR] = "sar";
-	MnemonicsText[LEA] = "lea";
-	MnemonicsText[SAHF] = "sahf";
-	MnemonicsText[FLD] = "fld";
-	MnemonicsText[FILD] = "fild";
-	MnemonicsText[FSTP] = "fstp";
-	MnemonicsText[FISTTP] = "fisttpl";
-	MnemonicsText[FCHS] = "fchs";
-	MnemonicsText[FLD1] = "fld1";
-	MnemonicsText[FADD] = "fadd";
-	MnemonicsText[FSUBR] = "fsubr";
-	MnemonicsText[FMUL] = "fmul";
-	MnemonicsText[FDIVR] = "fdivr";
-	MnemonicsText[FTST] = "ftst";
-	MnemonicsText[FCOMP] = "fcomp";
-	MnemonicsText[FCOMPP] = "fcompp";
-	MnemonicsText[FSTSW] = "fstsw";
-
-	RegistersText[EAX] = "eax";
-	RegistersText[EBX] = "ebx";
-	RegistersText[ECX] = "ecx";
-	RegistersText[EDX] = "edx";
-	RegistersText[ESI] = "esi";
-	RegistersText[EDI] = "edi";
-	RegistersText[ESP] = "esp";
-	RegistersText[EBP] = "ebp";
-	RegistersText[AX] = "ax";
-	RegistersText[CL] = "cl";
-	RegistersText[ST0] = "st(0)";
+	return APosition;
 }
 
-CAsmCode::~CAsmCode()
+/*
+ * Returns End if there is no instruction before the position.
+ */
+CAsmCode::CodeIterator CAsmCode::Previous(CAsmCode::CodeIterator APosition)
 {
-	for (CodeIterator it = Code.begin(); it != Code.end(); ++it) {
-		delete *it;
+	while (APosition != Code.begin()) {
+		if ((--APosition)->Type != INSTRUCTION_REMOVED) {
+			return APosition;
+		}
 	}
-}
 
-void CAsmCode::Add(CAsmCmd *ACmd)
-{
-	Code.push_back(ACmd);
+	return Code.end();
 }
 
-void CAsmCode::Add(EMnemonic ACmd)
+int CAsmCode::Intern(const string &AName)
 {
-	Code.push_back(new CAsmCmd0(MnemonicsText[ACmd]));
+	map<string, int>::iterator it = Labels.find(AName);
+
+	if (it != Labels.end()) {
+		return it->second;
+	}
+
+	LabelNames.push_back(AName);
+
+	return Labels[AName] = LabelNames.size() - 1;
 }
 
-void CAsmCode::Add(EMnemonic ACmd, ERegister AOp)
+const string& CAsmCode::GetLabel(int ALabel)
 {
-	Code.push_back(new CAsmCmd1(MnemonicsText[ACmd], new CAsmReg(RegistersText[AOp])));
+	return LabelNames[ALabel];
 }
 
-void CAsmCode::Add(EMnemonic ACmd, int AOp)
+string CAsmCode::AddStringLiteral(const string &ALiteral)
 {
-	Code.push_back(new CAsmCmd1(MnemonicsText[ACmd], new CAsmImm(AOp)));
+	if (StringLiterals.count(ALiteral)) {
+		return StringLiterals[ALiteral];
+	}
+
+	string NewLiteralLabel = ".SL" + ToString(StringLiterals.size() + 1);
+
+	StringLiterals[ALiteral] = NewLiteralLabel;
+
+	return NewLiteralLabel;
 }
 
-void CAsmCode::Add(EMnemonic ACmd, ERegister AOp1, ERegister AOp2)
+void CAsmCode::AddGlobalVariable(CVariableSymbol *AVariable)
 {
-	Code.push_back(new CAsmCmd2(MnemonicsText[ACmd], new CAsmReg(RegistersText[AOp1]), new CAsmReg(RegistersText[AOp2])));
+	GlobalVariables.push_back(AVariable);
 }
 
-void CAsmCode::Add(EMnemonic ACmd, int AOp1, ERegister AOp2)
+const map<string, string>& CAsmCode::GetStringLiterals() const
 {
-	Code.push_back(new CAsmCmd2(MnemonicsText[ACmd], new CAsmImm(AOp1), new CAsmReg(RegistersText[AOp2])));
+	return StringLiterals;
 }
 
-void CAsmCode::Add(EMnemonic ACmd, const string &AOp)
+const list<CVariableSymbol *>& CAsmCode::GetGlobalVariables() const
 {
-	Code.push_back(new CAsmCmd1(MnemonicsText[ACmd], new CAsmLabelOp(AOp)));
+	return GlobalVariables;
 }
 
-void CAsmCode::Add(EMnemonic ACmd, CAsmMem *AOp)
+string CAsmCode::GenerateLabel()
 {
-	Code.push_back(new CAsmCmd1(MnemonicsText[ACmd], AOp));
+	return ".L" + ToString(++LabelsCount);
 }
 
-void CAsmCode::Add(EMnemonic ACmd, ERegister AOp1, CAsmMem *AOp2)
+int CAsmCode::GetStackDepth() const
 {
-	Code.push_back(new CAsmCmd2(MnemonicsText[ACmd], new CAsmReg(RegistersText[AOp1]), AOp2));
+	return StackDepth;
 }
 
-void CAsmCode::Add(EMnemonic ACmd, CAsmMem *AOp1, ERegister AOp2)
+void CAsmCode::SetStackDepth(int ADepth)
 {
-	Code.push_back(new CAsmCmd2(MnemonicsText[ACmd], AOp1, new CAsmReg(RegistersText[AOp2])));
+	StackDepth = ADepth;
 }
 
-void CAsmCode::Add(const string &ALabel)
+bool CAsmCode::GetCold() const
 {
-	Code.push_back(new CAsmLabel(ALabel));
+	return Cold;
 }
 
-CAsmCode::CodeIterator CAsmCode::Insert(CAsmCode::CodeIterator APosition, CAsmCmd *ACmd)
+/*
+ * Labels added while the code is cold mark code that is rarely executed, so
+ * that it can be placed away from the rest.
+ */
+void CAsmCode::SetCold(bool ACold)
 {
-	return Code.insert(APosition, ACmd);
+	Cold = ACold;
 }
 
-CAsmCode::CodeIterator CAsmCode::Insert(CAsmCode::CodeIterator APosition, EMnemonic ACmd, CAsmOp *AOp1, CAsmOp *AOp2)
+bool CAsmCode::IsCold(int ALabel) const
 {
-	return Code.insert(APosition, new CAsmCmd2(MnemonicsText[ACmd], AOp1, AOp2));
+	return ColdLabels.count(ALabel) != 0;
 }
 
-CAsmCode::CodeIterator CAsmCode::Insert(CAsmCode::CodeIterator APosition, EMnemonic ACmd, int AOp1, CAsmOp *AOp2)
+bool CAsmCode::HasColdLabels() const
 {
-	return Code.insert(APosition, new CAsmCmd2(MnemonicsText[ACmd], new CAsmImm(AOp1), AOp2));
+	return !ColdLabels.empty();
 }
 
-CAsmCode::CodeIterator CAsmCode::Begin()
+void CAsmCode::ClearColdLabels()
 {
-	return Code.begin();
+	ColdLabels.clear();
 }
 
-CAsmCode::CodeIterator CAsmCode::End()
-{
-	return Code.end();
+/*
+ * The code generator works with 32-bit registers. On x86-64 stack slots and
+ * addresses are 64 bits wide, so the stack and frame pointers, push/pop
+ * operands, memory operand registers and lea destinations are replaced with
+ * their 64-bit counterparts; everything else is left to the generator.
+ */
+ERegister CAsmCode::Legalize(EMnemonic ACmd, ERegister AReg, bool ADestination /*= false*/)
+{
+	if (Target != TARGET_X86_64 || !WideRegisters.count(AReg)) {
+		return AReg;
+	}
+
+	if (AReg == ESP || AReg == EBP || ACmd == PUSH || ACmd == POP || (ACmd == LEA && ADestination)) {
+		return WideRegisters[AReg];
+	}
+
+	return AReg;
 }
 
-CAsmCode::CodeIterator CAsmCode::Erase(CAsmCode::CodeIterator APosition)
+CAsmOperand CAsmCode::Legalize(const CAsmOperand &AOp)
 {
-	if (APosition != End()) {
-		delete *APosition;
+	CAsmOperand result = AOp;
+
+	if (AOp.IsMem() && Target == TARGET_X86_64) {
+		if (WideRegisters.count(AOp.Base)) {
+			result.Base = WideRegisters[AOp.Base];
+		}
+		if (WideRegisters.count(AOp.Offset)) {
+			result.Offset = WideRegisters[AOp.Offset];
+		}
 	}
 
-	return Code.erase(APosition);
+	return result;
 }
 
-string CAsmCode::AddStringLiteral(const string &ALiteral)
+/*
+ * Keeps the number of bytes the stack pointer is below the frame base, as far
+ * as pushes, pops and constant adjustments tell. The code generator sets the
+ * depth where the stack pointer changes in any other way.
+ */
+void CAsmCode::TrackStack(EMnemonic ACmd)
+{
+	if (ACmd == PUSH) {
+		StackDepth += TypeSize::Pointer;
+	} else if (ACmd == POP) {
+		StackDepth -= TypeSize::Pointer;
+	}
+}
+
+void CAsmCode::MarkChanged(CAsmCode::CodeIterator APosition)
 {
-	if (StringLiterals.count(ALiteral)) {
-		return StringLiterals[ALiteral];
+	unsigned int Index = APosition - Code.begin();
+
+	if (Index < Changed.size()) {
+		Changed[Index] = true;
 	}
+}
 
-	string NewLiteralLabel = ".SL" + ToString(StringLiterals.size() + 1);
+void CAsmCode::Append(EMnemonic ACmd, unsigned int ACount, const CAsmOperand &AOp1, const CAsmOperand &AOp2)
+{
+	CAsmInstruction Instruction;
 
-	StringLiterals[ALiteral] = NewLiteralLabel;
+	Instruction.Type = INSTRUCTION_COMMAND;
+	Instruction.Mnemonic = ACmd;
+	Instruction.OperandsCount = ACount;
+	Instruction.Operands[0] = AOp1;
+	Instruction.Operands[1] = AOp2;
 
-	return NewLiteralLabel;
+	Code.push_back(Instruction);
 }
 
-void CAsmCode::AddGlobalVariable(CVariableSymbol *AVariable)
+void CAsmCode::OutputRegister(CAsmWriter &AWriter, ERegister AReg)
 {
-	GlobalVariables.push_back(AVariable);
+	AWriter.Write('%');
+	AWriter.Write(RegistersText[AReg].Text, RegistersText[AReg].Length);
 }
 
-string CAsmCode::GenerateLabel()
+void CAsmCode::OutputOperand(CAsmWriter &AWriter, const CAsmOperand &AOp)
 {
-	return ".L" + ToString(++LabelsCount);
+	if (AOp.IsReg()) {
+		OutputRegister(AWriter, AOp.Base);
+		return;
+	}
+	if (AOp.IsImm()) {
+		AWriter.Write('$');
+		AWriter.Write(AOp.Value);
+		return;
+	}
+	if (AOp.IsLabel()) {
+		AWriter.Write(LabelNames[AOp.Label]);
+		return;
+	}
+
+	if (AOp.Label >= 0) {
+		AWriter.Write(LabelNames[AOp.Label]);
+		if (AOp.Value > 0) {
+			AWriter.Write('+');
+		}
+	}
+	if (AOp.Value) {
+		AWriter.Write(AOp.Value);
+	}
+
+	if (AOp.Label < 0 || AOp.Base != INVALID_REGISTER || AOp.Offset != INVALID_REGISTER) {
+		AWriter.Write('(');
+		if (AOp.Base != INVALID_REGISTER) {
+			OutputRegister(AWriter, AOp.Base);
+		}
+		if (AOp.Offset != INVALID_REGISTER || AOp.Multiplier) {
+			AWriter.Write(", ", 2);
+		}
+		if (AOp.Offset != INVALID_REGISTER) {
+			OutputRegister(AWriter, AOp.Offset);
+		}
+		if (AOp.Multiplier) {
+			AWriter.Write(", ", 2);
+			AWriter.Write(AOp.Multiplier);
+		}
+		AWriter.Write(')');
+	}
 }
 
 void CAsmCode::Output(ostream &Stream)
 {
-	Stream << ".data" << endl;
+	CAsmWriter Writer(Stream);
+
+	Writer.Write(".data\n", 6);
 	for (map<string, string>::iterator it = StringLiterals.begin(); it != StringLiterals.end(); ++it) {
-		Stream << it->second << ":" << endl;
-		Stream << "\t.string\t\"" << it->first << "\"" << endl;
+		Writer.Write(it->second);
+		Writer.Write(":\n\t.string\t\"", 12);
+		Writer.Write(it->first);
+		Writer.Write("\"\n", 2);
 	}
 
 	CVariableSymbol *Var;
@@ -486,29 +754,63 @@ void CAsmCode::Output(ostream &Stream)
 	for (list<CVariableSymbol *>::iterator it = GlobalVariables.begin(); it != GlobalVariables.end(); ++it) {
 		Var = *it;
 		if (!Var->GetType()->IsScalar()) {
-			Stream << ".comm\t" << Var->GetName() + "," + ToString(Var->GetType()->GetSize());
+			Writer.Write(".comm\t", 6);
+			Writer.Write(Var->GetName());
+			Writer.Write(',');
+			Writer.Write((int) Var->GetType()->GetSize());
 		} else {
-			Stream << Var->GetName() << ":" << endl << "\t";
+			Writer.Write(Var->GetName());
+			Writer.Write(":\n\t", 3);
 
 			if (Var->GetType()->IsFloat()) {
-				Stream << ".float";
+				Writer.Write(".float", 6);
+			} else if (Var->GetType()->GetSize() == 8) {
+				Writer.Write(".quad", 5);
 			} else {
-				Stream << ".long";
+				Writer.Write(".long", 5);
 			}
 
-			Stream << "\t" << Var->GetInitValue();
+			Writer.Write('\t');
+			Writer.Write(Var->GetInitValue());
 		}
 
-		Stream << endl;
+		Writer.Write('\n');
 	}
 
-	Stream << ".text" << endl;
+	Writer.Write(".text\n", 6);
 
 	for (CodeIterator it = Code.begin(); it != Code.end(); ++it) {
-		Stream << (*it)->GetText() << endl;
+		if (it->Type != INSTRUCTION_REMOVED) {
+			OutputInstruction(Writer, *it);
+			Writer.Write('\n');
+		}
 	}
 
-	Stream << ".end" << endl;
+	Writer.Write(".end\n", 5);
+}
+
+void CAsmCode::OutputInstruction(CAsmWriter &AWriter, const CAsmInstruction &AInstruction)
+{
+	if (AInstruction.Type == INSTRUCTION_COMMAND) {
+		AWriter.Write('\t');
+		AWriter.Write(MnemonicsText[AInstruction.Mnemonic].Text, MnemonicsText[AInstruction.Mnemonic].Length);
+		for (unsigned int i = 0; i < AInstruction.OperandsCount; i++) {
+			if (i) {
+				AWriter.Write(", ", 2);
+			} else {
+				AWriter.Write('\t');
+			}
+			OutputOperand(AWriter, AInstruction.Operands[i]);
+		}
+	} else if (AInstruction.Type == INSTRUCTION_LABEL) {
+		AWriter.Write(LabelNames[AInstruction.Operands[0].Label]);
+		AWriter.Write(':');
+	} else if (AInstruction.Type == INSTRUCTION_DIRECTIVE) {
+		AWriter.Write('.');
+		AWriter.Write(LabelNames[AInstruction.Operands[0].Label]);
+		AWriter.Write('\t');
+		AWriter.Write(LabelNames[AInstruction.Operands[1].Label]);
+	}
 }
 
 /******************************************************************************
@@ -556,9 +858,14 @@ void CAddressGenerationVisitor::Visit(CStringConst &AStmt)
 void CAddressGenerationVisitor::Visit(CVariable &AStmt)
 {
 	if (AStmt.GetSymbol()->GetGlobal()) {
-		Asm.Add(PUSH, "$" + AStmt.GetName());
+		if (Asm.GetTarget() == TARGET_X86_64) {
+			Asm.Add(LEA, mem(AStmt.GetName(), RIP), EAX);
+			Asm.Add(PUSH, EAX);
+		} else {
+			Asm.Add(PUSH, "$" + AStmt.GetName());
+		}
 	} else {
-		Asm.Add(LEA, mem(AStmt.GetSymbol()->GetOffset(), EBP), EAX);
+		Asm.Add(LEA, Code.FrameAddress(AStmt.GetSymbol()->GetOffset()), EAX);
 		Asm.Add(PUSH, EAX);
 	}
 }
@@ -577,50 +884,19 @@ void CAddressGenerationVisitor::Visit(CFunctionCall &AStmt)
 
 void CAddressGenerationVisitor::Visit(CStructAccess &AStmt)
 {
-	AStmt.GetStruct()->Accept(*this);
-	Asm.Add(POP, EBX);
-
-	Asm.Add(MOV, AStmt.GetField()->GetSymbol()->GetOffset(), EAX);
-
-	Asm.Add(LEA, mem(0, EBX, EAX, 1), EAX);
+	Asm.Add(LEA, Code.SelectAddress(&AStmt), EAX);
 	Asm.Add(PUSH, EAX);
 }
 
 void CAddressGenerationVisitor::Visit(CIndirectAccess &AStmt)
 {
-	AStmt.GetPointer()->Accept(Code);
-	Asm.Add(POP, EBX);
-
-	Asm.Add(MOV, AStmt.GetField()->GetSymbol()->GetOffset(), EAX);
-
-	Asm.Add(LEA, mem(0, EBX, EAX, 1), EAX);
+	Asm.Add(LEA, Code.SelectAddress(&AStmt), EAX);
 	Asm.Add(PUSH, EAX);
 }
 
 void CAddressGenerationVisitor::Visit(CArrayAccess &AStmt)
 {
-	if (AStmt.GetLeft()->GetResultType()->IsPointer()) {
-		if (AStmt.GetLeft()->GetResultType()->IsArray()) {
-			AStmt.GetLeft()->Accept(*this);
-		} else {
-			AStmt.GetLeft()->Accept(Code);
-		}
-		AStmt.GetRight()->Accept(Code);
-	} else {
-		if (AStmt.GetRight()->GetResultType()->IsArray()) {
-			AStmt.GetRight()->Accept(*this);
-		} else {
-			AStmt.GetRight()->Accept(Code);
-		}
-		AStmt.GetLeft()->Accept(Code);
-	}
-	
-	Asm.Add(POP, EAX);
-	Asm.Add(MOV, AStmt.GetElementSize(), EBX);
-	Asm.Add(IMUL, EBX, EAX);
-	Asm.Add(POP, EBX);
-
-	Asm.Add(LEA, mem(0, EBX, EAX, 1), EAX);
+	Asm.Add(LEA, Code.SelectAddress(&AStmt), EAX);
 	Asm.Add(PUSH, EAX);
 }
 
@@ -684,7 +960,7 @@ void CAddressGenerationVisitor::Visit(CSwitchStatement &AStmt)
  * CCodeGenerationVisitor
  ******************************************************************************/
 
-CCodeGenerationVisitor::CCodeGenerationVisitor(CAsmCode &AAsm, bool AOptimize) : Asm(AAsm), FuncSym(NULL), BlockNesting(0), Addr(AAsm, *this), Optimize(AOptimize)
+CCodeGenerationVisitor::CCodeGenerationVisitor(CAsmCode &AAsm, bool AOptimize, bool AOmitFramePointer) : Asm(AAsm), FuncSym(NULL), BlockNesting(0), Frame(true), FrameSize(0), Addr(AAsm, *this), Optimize(AOptimize), OmitFramePointer(AOmitFramePointer), Profile(NULL), Counters(NULL)
 {
 	IntOperationCmd[TOKEN_TYPE_OPERATION_EQUAL] = JE;
 	IntOperationCmd[TOKEN_TYPE_OPERATION_NOT_EQUAL] = JNE;
@@ -716,6 +992,17 @@ CCodeGenerationVisitor::CCodeGenerationVisitor(CAsmCode &AAsm, bool AOptimize) :
 	FloatOperationCmd[TOKEN_TYPE_OPERATION_INCREMENT] = FADD;
 	FloatOperationCmd[TOKEN_TYPE_OPERATION_DECREMENT] = FSUBR;
 
+	IntVectorOperationCmd[TOKEN_TYPE_OPERATION_PLUS] = PADDD;
+	IntVectorOperationCmd[TOKEN_TYPE_OPERATION_MINUS] = PSUBD;
+	IntVectorOperationCmd[TOKEN_TYPE_OPERATION_AMPERSAND] = PAND;
+	IntVectorOperationCmd[TOKEN_TYPE_OPERATION_BITWISE_OR] = POR;
+	IntVectorOperationCmd[TOKEN_TYPE_OPERATION_BITWISE_XOR] = PXOR;
+
+	FloatVectorOperationCmd[TOKEN_TYPE_OPERATION_PLUS] = ADDPS;
+	FloatVectorOperationCmd[TOKEN_TYPE_OPERATION_MINUS] = SUBPS;
+	FloatVectorOperationCmd[TOKEN_TYPE_OPERATION_ASTERISK] = MULPS;
+	FloatVectorOperationCmd[TOKEN_TYPE_OPERATION_SLASH] = DIVPS;
+
 	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_PLUS_ASSIGN] = TOKEN_TYPE_OPERATION_PLUS;
 	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_MINUS_ASSIGN] = TOKEN_TYPE_OPERATION_MINUS;
 	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_ASTERISK_ASSIGN] = TOKEN_TYPE_OPERATION_ASTERISK;
@@ -726,6 +1013,17 @@ CCodeGenerationVisitor::CCodeGenerationVisitor(CAsmCode &AAsm, bool AOptimize) :
 	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_BITWISE_XOR_ASSIGN] = TOKEN_TYPE_OPERATION_BITWISE_XOR;
 	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_SHIFT_LEFT_ASSIGN] = TOKEN_TYPE_OPERATION_SHIFT_LEFT;
 	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_SHIFT_RIGHT_ASSIGN] = TOKEN_TYPE_OPERATION_SHIFT_RIGHT;
+
+	InvertedJump[JE] = JNE;
+	InvertedJump[JNE] = JE;
+	InvertedJump[JL] = JGE;
+	InvertedJump[JGE] = JL;
+	InvertedJump[JG] = JLE;
+	InvertedJump[JLE] = JG;
+	InvertedJump[JB] = JAE;
+	InvertedJump[JAE] = JB;
+	InvertedJump[JA] = JBE;
+	InvertedJump[JBE] = JA;
 }
 
 void CCodeGenerationVisitor::SetFunction(CFunctionSymbol *AFuncSym)
@@ -733,6 +1031,16 @@ void CCodeGenerationVisitor::SetFunction(CFunctionSymbol *AFuncSym)
 	FuncSym = AFuncSym;
 }
 
+void CCodeGenerationVisitor::SetProfile(const CProfile *AProfile)
+{
+	Profile = AProfile;
+}
+
+void CCodeGenerationVisitor::SetCounters(CVariableSymbol *ACounters)
+{
+	Counters = ACounters;
+}
+
 void CCodeGenerationVisitor::Visit(CUnaryOp &AStmt)
 {
 	ETokenType OpType = AStmt.GetType();
@@ -742,6 +1050,9 @@ void CCodeGenerationVisitor::Visit(CUnaryOp &AStmt)
 		Arg->Accept(Addr);
 	} else if (OpType == TOKEN_TYPE_KEYWORD && AStmt.GetName() == "sizeof") {
 		Asm.Add(PUSH, Arg->GetResultType()->GetSize());
+	} else if (OpType == TOKEN_TYPE_OPERATION_LOGIC_NOT) {
+		GenerateConditionValue(&AStmt);
+		Asm.Add(PUSH, EAX);
 	} else {
 		if (Arg->GetResultType()->IsFloat()) {
 			Arg->Accept(*this);
@@ -767,25 +1078,6 @@ void CCodeGenerationVisitor::Visit(CUnaryOp &AStmt)
 				Asm.Add(MOV, mem(ESP), EAX);
 				Asm.Add(MOV, EAX, mem(EBX));
 
-			} else if (OpType == TOKEN_TYPE_OPERATION_LOGIC_NOT) {
-				string TrueLabel = Asm.GenerateLabel();
-				string EndLabel = Asm.GenerateLabel();
-
-				Asm.Add(FLD, mem(ESP));
-				Asm.Add(ADD, TypeSize::Float, ESP);
-
-				Asm.Add(FTST);
-				Asm.Add(FSTSW, AX);
-				Asm.Add(SAHF);
-
-				Asm.Add(JNE, TrueLabel);
-				Asm.Add(MOV, 1, EAX);
-				Asm.Add(JMP, EndLabel);
-				Asm.Add(TrueLabel);
-				Asm.Add(MOV, 0, EAX);
-				Asm.Add(EndLabel);
-
-				Asm.Add(PUSH, EAX);
 			}
 		} else {
 			if (OpType == TOKEN_TYPE_OPERATION_INCREMENT || OpType == TOKEN_TYPE_OPERATION_DECREMENT) {
@@ -795,30 +1087,19 @@ void CCodeGenerationVisitor::Visit(CUnaryOp &AStmt)
 				Asm.Add(POP, EAX);
 				Asm.Add(POP, EBX);
 
-				Asm.Add(IntOperationCmd[OpType], EAX);
+				Asm.Add(IntOperationCmd[OpType], ValueRegister(EAX, Arg->GetResultType()));
 
-				Asm.Add(MOV, EAX, mem(EBX));
+				Asm.Add(MOV, ValueRegister(EAX, Arg->GetResultType()), mem(EBX));
 			} else {
 				Arg->Accept(*this);
 				Asm.Add(POP, EAX);
 
 				if (OpType == TOKEN_TYPE_OPERATION_ASTERISK) {
-					Asm.Add(MOV, mem(EAX), EAX);
+					Asm.Add(MOV, mem(EAX), ValueRegister(EAX, AStmt.GetResultType()));
 				} else if (OpType == TOKEN_TYPE_OPERATION_MINUS) {
 					Asm.Add(NEG, EAX);
 				} else if (OpType == TOKEN_TYPE_OPERATION_BITWISE_NOT) {
 					Asm.Add(NOT, EAX);
-				} else if (OpType == TOKEN_TYPE_OPERATION_LOGIC_NOT) {
-					string TrueLabel = Asm.GenerateLabel();
-					string EndLabel = Asm.GenerateLabel();
-
-					Asm.Add(CMP, 0, EAX);
-					Asm.Add(JNE, TrueLabel);
-					Asm.Add(MOV, 1, EAX);
-					Asm.Add(JMP, EndLabel);
-					Asm.Add(TrueLabel);
-					Asm.Add(MOV, 0, EAX);
-					Asm.Add(EndLabel);
 				}
 			}
 
@@ -840,13 +1121,15 @@ void CCodeGenerationVisitor::Visit(CBinaryOp &AStmt)
 		Asm.Add(POP, EAX);
 		Asm.Add(POP, EBX);
 
-		Asm.Add(MOV, EAX, mem(EBX));
+		Asm.Add(MOV, ValueRegister(EAX, AStmt.GetLeft()->GetResultType()), mem(EBX));
 	} else if (OpType == TOKEN_TYPE_SEPARATOR_COMMA) {
 		AStmt.GetLeft()->Accept(*this);
 		AStmt.GetRight()->Accept(*this);
 		Asm.Add(POP, EBX);
 		Asm.Add(POP, EAX);
-		Asm.Add(MOV, EBX, EAX);
+		Asm.Add(MOV, ValueRegister(EBX, AStmt.GetResultType()), ValueRegister(EAX, AStmt.GetResultType()));
+	} else if (TokenTraits::IsComparisonOperation(OpType) || OpType == TOKEN_TYPE_OPERATION_LOGIC_AND || OpType == TOKEN_TYPE_OPERATION_LOGIC_OR) {
+		GenerateConditionValue(&AStmt);
 	} else {
 		bool CompoundAssignment = false;
 
@@ -856,158 +1139,72 @@ void CCodeGenerationVisitor::Visit(CBinaryOp &AStmt)
 			CompoundAssignment = true;
 		}
 
-		AStmt.GetLeft()->Accept(*this);
-		PerformConversion(AStmt.GetCommonRealType(), AStmt.GetLeft()->GetResultType());
-
-		AStmt.GetRight()->Accept(*this);
-		PerformConversion(AStmt.GetCommonRealType(), AStmt.GetRight()->GetResultType());
-
-		if (AStmt.GetCommonRealType()->IsFloat()) {
-			if (TokenTraits::IsTrivialOperation(OpType) || OpType == TOKEN_TYPE_OPERATION_SLASH) {
-				Asm.Add(FLD, mem(ESP));
-				Asm.Add(ADD, TypeSize::Float, ESP);
-				Asm.Add(FloatOperationCmd[OpType], mem(ESP));
-				Asm.Add(FSTP, mem(ESP));
-				Asm.Add(POP, EAX);
-
-			} else if (OpType == TOKEN_TYPE_OPERATION_LOGIC_AND) {
-				string FalseLabel = Asm.GenerateLabel();
-				string EndCheckLabel = Asm.GenerateLabel();
-
-				Asm.Add(FLD, mem(TypeSize::Float, ESP));
-
-				Asm.Add(FTST);
-				Asm.Add(FSTSW, AX);
-				Asm.Add(SAHF);
-				Asm.Add(JE, FalseLabel);
-
-				Asm.Add(FLD, mem(ESP));
-
-				Asm.Add(FTST);
-				Asm.Add(FSTSW, AX);
-				Asm.Add(SAHF);
-				Asm.Add(JE, FalseLabel);
-
-				Asm.Add(MOV, 1, EAX);
-				Asm.Add(JMP, EndCheckLabel);
-				Asm.Add(FalseLabel);
-				Asm.Add(MOV, 0, EAX);
-				Asm.Add(EndCheckLabel);
-
-				Asm.Add(FSTP, ST0);
-				Asm.Add(FSTP, ST0);
-				Asm.Add(ADD, 2 * TypeSize::Float, ESP);
-
-			} else if (OpType == TOKEN_TYPE_OPERATION_LOGIC_OR) {
-				string TrueLabel = Asm.GenerateLabel();
-				string EndCheckLabel = Asm.GenerateLabel();
-
-				Asm.Add(FLD, mem(TypeSize::Float, ESP));
-
-				Asm.Add(FTST);
-				Asm.Add(FSTSW, AX);
-				Asm.Add(SAHF);
-				Asm.Add(JNE, TrueLabel);
-
-				Asm.Add(FLD, mem(ESP));
-
-				Asm.Add(FTST);
-				Asm.Add(FSTSW, AX);
-				Asm.Add(SAHF);
-				Asm.Add(JNE, TrueLabel);
-
-				Asm.Add(MOV, 0, EAX);
-				Asm.Add(JMP, EndCheckLabel);
-				Asm.Add(TrueLabel);
-				Asm.Add(MOV, 1, EAX);
-				Asm.Add(EndCheckLabel);
-
-				Asm.Add(FSTP, ST0);
-				Asm.Add(FSTP, ST0);
-				Asm.Add(ADD, 2 * TypeSize::Float, ESP);
-
-			} else if (TokenTraits::IsComparisonOperation(OpType)) {
-				string TrueLabel = Asm.GenerateLabel();
-				string EndCheckLabel = Asm.GenerateLabel();
+		CExpression *Operand = AStmt.GetLeft();
+		CIntegerConst *Const = NULL;
 
-				Asm.Add(FLD, mem(ESP));
-				Asm.Add(FLD, mem(TypeSize::Float, ESP));
+		if (Optimize && AStmt.GetCommonRealType()->IsInt()) {
+			Const = dynamic_cast<CIntegerConst *>(AStmt.GetRight());
 
-				Asm.Add(FCOMPP);
-				Asm.Add(FSTSW, AX);
-				Asm.Add(SAHF);
+			if (!Const && OpType == TOKEN_TYPE_OPERATION_ASTERISK && !CompoundAssignment) {
+				Const = dynamic_cast<CIntegerConst *>(AStmt.GetLeft());
+				Operand = AStmt.GetRight();
+			}
+		}
 
-				Asm.Add(FloatOperationCmd[OpType], TrueLabel);
-				Asm.Add(MOV, 0, EAX);
-				Asm.Add(JMP, EndCheckLabel);
-				Asm.Add(TrueLabel);
-				Asm.Add(MOV, 1, EAX);
-				Asm.Add(EndCheckLabel);
+		if (Const && (OpType == TOKEN_TYPE_OPERATION_ASTERISK || ((OpType == TOKEN_TYPE_OPERATION_SLASH || OpType == TOKEN_TYPE_OPERATION_PERCENT) && Const->GetValue() != 0 && Const->GetValue() != INT_MIN))) {
+			Operand->Accept(*this);
+			Asm.Add(POP, EAX);
 
-				Asm.Add(ADD, 2 * TypeSize::Float, ESP);
+			if (OpType == TOKEN_TYPE_OPERATION_ASTERISK) {
+				GenerateMultiplication(Const->GetValue());
+			} else {
+				GenerateDivision(Const->GetValue(), OpType == TOKEN_TYPE_OPERATION_PERCENT);
 			}
 		} else {
-			Asm.Add(POP, EBX);
-			Asm.Add(POP, EAX);
+			AStmt.GetLeft()->Accept(*this);
+			PerformConversion(AStmt.GetCommonRealType(), AStmt.GetLeft()->GetResultType());
 
-			if (TokenTraits::IsTrivialOperation(OpType)) {
-				Asm.Add(IntOperationCmd[OpType], EBX, EAX);
-			} else if (OpType == TOKEN_TYPE_OPERATION_SLASH || OpType == TOKEN_TYPE_OPERATION_PERCENT) {
-				Asm.Add(CDQ);
-				Asm.Add(IDIV, EBX);
-				if (OpType == TOKEN_TYPE_OPERATION_PERCENT) {
-					Asm.Add(MOV, EDX, EAX);
+			AStmt.GetRight()->Accept(*this);
+			PerformConversion(AStmt.GetCommonRealType(), AStmt.GetRight()->GetResultType());
+
+			if (AStmt.GetCommonRealType()->IsFloat()) {
+				if (TokenTraits::IsTrivialOperation(OpType) || OpType == TOKEN_TYPE_OPERATION_SLASH) {
+					Asm.Add(FLD, mem(ESP));
+					Asm.Add(ADD, TypeSize::Pointer, ESP);
+					Asm.Add(FloatOperationCmd[OpType], mem(ESP));
+					Asm.Add(FSTP, mem(ESP));
+					Asm.Add(POP, EAX);
 				}
-			} else if (OpType == TOKEN_TYPE_OPERATION_SHIFT_LEFT || OpType == TOKEN_TYPE_OPERATION_SHIFT_RIGHT) {
-				Asm.Add(MOV, EBX, ECX);
-				Asm.Add(IntOperationCmd[OpType], CL, EAX);
-
-			} else if (OpType == TOKEN_TYPE_OPERATION_LOGIC_AND) {
-				string FalseLabel = Asm.GenerateLabel();
-				string EndCheckLabel = Asm.GenerateLabel();
-
-				Asm.Add(CMP, 0, EAX);
-				Asm.Add(JE, FalseLabel);
-				Asm.Add(CMP, 0, EBX);
-				Asm.Add(JE, FalseLabel);
-				Asm.Add(MOV, 1, EAX);
-				Asm.Add(JMP, EndCheckLabel);
-				Asm.Add(FalseLabel);
-				Asm.Add(MOV, 0, EAX);
-				Asm.Add(EndCheckLabel);
-
-			} else if (OpType == TOKEN_TYPE_OPERATION_LOGIC_OR) {
-				string TrueLabel = Asm.GenerateLabel();
-				string EndCheckLabel = Asm.GenerateLabel();
-
-				Asm.Add(CMP, 0, EAX);
-				Asm.Add(JNE, TrueLabel);
-				Asm.Add(CMP, 0, EBX);
-				Asm.Add(JNE, TrueLabel);
-				Asm.Add(MOV, 0, EAX);
-				Asm.Add(JMP, EndCheckLabel);
-				Asm.Add(TrueLabel);
-				Asm.Add(MOV, 1, EAX);
-				Asm.Add(EndCheckLabel);
-
-			} else if (TokenTraits::IsComparisonOperation(OpType)) {
-				string TrueLabel = Asm.GenerateLabel();
-				string EndCheckLabel = Asm.GenerateLabel();
-
-				Asm.Add(CMP, EBX, EAX);
-				Asm.Add(IntOperationCmd[OpType], TrueLabel);
-				Asm.Add(MOV, 0, EAX);
-				Asm.Add(JMP, EndCheckLabel);
-				Asm.Add(TrueLabel);
-				Asm.Add(MOV, 1, EAX);
-				Asm.Add(EndCheckLabel);
-			}
+			} else {
+				Asm.Add(POP, EBX);
+				Asm.Add(POP, EAX);
 
+				if (TokenTraits::IsTrivialOperation(OpType) && Asm.GetTarget() == TARGET_X86_64 && (AStmt.GetLeft()->GetResultType()->IsPointer() || AStmt.GetRight()->GetResultType()->IsPointer())) {
+					if (!AStmt.GetLeft()->GetResultType()->IsPointer()) {
+						Asm.Add(MOVSLQ, EAX, RAX);
+					}
+					if (!AStmt.GetRight()->GetResultType()->IsPointer()) {
+						Asm.Add(MOVSLQ, EBX, RBX);
+					}
+					Asm.Add(IntOperationCmd[OpType], RBX, RAX);
+				} else if (TokenTraits::IsTrivialOperation(OpType)) {
+					Asm.Add(IntOperationCmd[OpType], EBX, EAX);
+				} else if (OpType == TOKEN_TYPE_OPERATION_SLASH || OpType == TOKEN_TYPE_OPERATION_PERCENT) {
+					Asm.Add(CDQ);
+					Asm.Add(IDIV, EBX);
+					if (OpType == TOKEN_TYPE_OPERATION_PERCENT) {
+						Asm.Add(MOV, EDX, EAX);
+					}
+				} else if (OpType == TOKEN_TYPE_OPERATION_SHIFT_LEFT || OpType == TOKEN_TYPE_OPERATION_SHIFT_RIGHT) {
+					Asm.Add(MOV, EBX, ECX);
+					Asm.Add(IntOperationCmd[OpType], CL, EAX);
+				}
+			}
 		}
 
 		if (CompoundAssignment) {
 			Asm.Add(POP, EBX);
-			Asm.Add(MOV, EAX, mem(EBX));
+			Asm.Add(MOV, ValueRegister(EAX, AStmt.GetLeft()->GetResultType()), mem(EBX));
 		}
 	}
 
@@ -1017,30 +1214,20 @@ void CCodeGenerationVisitor::Visit(CBinaryOp &AStmt)
 
 void CCodeGenerationVisitor::Visit(CConditionalOp &AStmt)
 {
-	AStmt.GetCondition()->Accept(*this);
-
 	string ElseLabel = Asm.GenerateLabel();
 	string ConditionalEndLabel = Asm.GenerateLabel();
 
-	if (AStmt.GetCondition()->GetResultType()->IsFloat()) {
-		Asm.Add(FLD, mem(ESP));
-		Asm.Add(ADD, TypeSize::Float, ESP);
-
-		Asm.Add(FTST);
-		Asm.Add(FSTSW, AX);
-		Asm.Add(SAHF);
-	} else {
-		Asm.Add(POP, EAX);
-		Asm.Add(CMP, 0, EAX);
-	}
+	GenerateCondition(AStmt.GetCondition(), ElseLabel, false);
 
-	Asm.Add(JE, ElseLabel);
+	int Depth = Asm.GetStackDepth();
 
 	AStmt.GetTrueExpr()->Accept(*this);
 
 	Asm.Add(JMP, ConditionalEndLabel);
 	Asm.Add(ElseLabel);
 
+	Asm.SetStackDepth(Depth);
+
 	AStmt.GetFalseExpr()->Accept(*this);
 
 	Asm.Add(ConditionalEndLabel);
@@ -1067,7 +1254,12 @@ void CCodeGenerationVisitor::Visit(CCharConst &AStmt)
 
 void CCodeGenerationVisitor::Visit(CStringConst &AStmt)
 {
-	Asm.Add(PUSH, "$" + Asm.AddStringLiteral(AStmt.GetValue()));
+	if (Asm.GetTarget() == TARGET_X86_64) {
+		Asm.Add(LEA, mem(Asm.AddStringLiteral(AStmt.GetValue()), RIP), EAX);
+		Asm.Add(PUSH, EAX);
+	} else {
+		Asm.Add(PUSH, "$" + Asm.AddStringLiteral(AStmt.GetValue()));
+	}
 }
 
 void CCodeGenerationVisitor::Visit(CVariable &AStmt)
@@ -1076,9 +1268,13 @@ void CCodeGenerationVisitor::Visit(CVariable &AStmt)
 		AStmt.Accept(Addr);
 	} else {
 		if (AStmt.GetSymbol()->GetGlobal()) {
-			Asm.Add(PUSH, AStmt.GetSymbol()->GetName());
+			if (Asm.GetTarget() == TARGET_X86_64) {
+				PushValue(mem(AStmt.GetSymbol()->GetName(), RIP), AStmt.GetResultType());
+			} else {
+				Asm.Add(PUSH, AStmt.GetSymbol()->GetName());
+			}
 		} else {
-			Asm.Add(PUSH, mem(AStmt.GetSymbol()->GetOffset(), EBP));
+			PushValue(FrameAddress(AStmt.GetSymbol()->GetOffset()), AStmt.GetResultType());
 		}
 	}
 }
@@ -1089,13 +1285,20 @@ void CCodeGenerationVisitor::Visit(CFunction &AStmt)
 
 void CCodeGenerationVisitor::Visit(CPostfixOp &AStmt)
 {
+	if (IsCounter(AStmt.GetArgument())) {
+		GenerateCount(*static_cast<CArrayAccess *>(AStmt.GetArgument()));
+		return;
+	}
+
 	AStmt.GetArgument()->Accept(*this);
 	AStmt.GetArgument()->Accept(Addr);
 
+	CTypeSymbol *ArgType = AStmt.GetArgument()->GetResultType();
+
 	Asm.Add(POP, EBX);
-	Asm.Add(MOV, mem(ESP), EAX);
+	Asm.Add(MOV, mem(ESP), ValueRegister(EAX, ArgType));
 
-	if (AStmt.GetArgument()->GetResultType()->IsFloat()) {
+	if (ArgType->IsFloat()) {
 		Asm.Add(FLD1);
 
 		Asm.Add(FloatOperationCmd[AStmt.GetType()], mem(ESP));
@@ -1103,78 +1306,45 @@ void CCodeGenerationVisitor::Visit(CPostfixOp &AStmt)
 		Asm.Add(FSTP, mem(-TypeSize::Float, ESP));
 		Asm.Add(MOV, mem(-TypeSize::Float, ESP), EAX);
 	} else {
-		Asm.Add(IntOperationCmd[AStmt.GetType()], EAX);
+		Asm.Add(IntOperationCmd[AStmt.GetType()], ValueRegister(EAX, ArgType));
 	}
 
-	Asm.Add(MOV, EAX, mem(EBX));
+	Asm.Add(MOV, ValueRegister(EAX, ArgType), mem(EBX));
 }
 
 void CCodeGenerationVisitor::Visit(CFunctionCall &AStmt)
 {
 	CFunctionSymbol *Func = AStmt.GetFunction();
-	CFunctionSymbol::ArgumentsOrderContainer *FormalArgs = Func->GetArgumentsOrderedList();
 
-	CFunctionCall::ArgumentsReverseIterator ait;
-	CFunctionSymbol::ArgumentsReverseOrderIterator fit;
+	PushArguments(AStmt);
 
-	for (ait = AStmt.RBegin(), fit = FormalArgs->rbegin(); ait != AStmt.REnd() && fit != FormalArgs->rend(); ++ait, ++fit) {
-		(*ait)->Accept(*this);
-		PerformConversion(static_cast<CVariableSymbol *>(*fit)->GetType(), (*ait)->GetResultType());
+	if (Asm.GetTarget() == TARGET_X86_64) {
+		GenerateSystemVCall(Func);
+	} else {
+		GenerateFastCall(Func);
 	}
 
-	Asm.Add(CALL, Func->GetName());
-	Asm.Add(ADD, Func->GetArgumentsSymbolTable()->GetElementsSize(), ESP);
-
 	if (!Func->GetReturnType()->IsVoid()) {
+		if (Asm.GetTarget() == TARGET_X86_64 && Func->GetReturnType()->IsFloat()) {
+			Asm.Add(MOVD, XMM0, EAX);
+		}
 		Asm.Add(PUSH, EAX);
 	}
 }
 
 void CCodeGenerationVisitor::Visit(CStructAccess &AStmt)
 {
-	AStmt.GetStruct()->Accept(Addr);
-	Asm.Add(POP, EBX);
-
-	Asm.Add(MOV, AStmt.GetField()->GetSymbol()->GetOffset(), EAX);
-
-	Asm.Add(PUSH, mem(0, EBX, EAX, 1));
+	PushValue(SelectAddress(&AStmt), AStmt.GetResultType());
 }
 
 void CCodeGenerationVisitor::Visit(CIndirectAccess &AStmt)
 {
-	AStmt.GetPointer()->Accept(*this);
-	Asm.Add(POP, EBX);
-
-	Asm.Add(MOV, AStmt.GetField()->GetSymbol()->GetOffset(), EAX);
-
-	Asm.Add(PUSH, mem(0, EBX, EAX, 1));
+	PushValue(SelectAddress(&AStmt), AStmt.GetResultType());
 }
 
 void CCodeGenerationVisitor::Visit(CArrayAccess &AStmt)
 {
-	if (AStmt.GetLeft()->GetResultType()->IsPointer()) {
-		if (AStmt.GetLeft()->GetResultType()->IsArray()) {
-			AStmt.GetLeft()->Accept(Addr);
-		} else {
-			AStmt.GetLeft()->Accept(*this);
-		}
-
-		AStmt.GetRight()->Accept(*this);
-	} else {
-		if (AStmt.GetRight()->GetResultType()->IsArray()) {
-			AStmt.GetRight()->Accept(Addr);
-		} else {
-			AStmt.GetRight()->Accept(*this);
-		}
-		AStmt.GetLeft()->Accept(*this);
-	}
-
-	Asm.Add(POP, EAX);
-	Asm.Add(MOV, AStmt.GetElementSize(), EBX);
-	Asm.Add(IMUL, EBX, EAX);
-	Asm.Add(POP, EBX);
-
-	Asm.Add(PUSH, mem(0, EBX, EAX, 1));
+	PushValue(SelectAddress(&AStmt), AStmt.GetResultType());
 }
 
 void CCodeGenerationVisitor::Visit(CNullStatement &AStmt)
@@ -1185,75 +1355,121 @@ void CCodeGenerationVisitor::Visit(CBlockStatement &AStmt)
 {
 	Blocks.push(&AStmt);
 
-	if (BlockNesting && AStmt.GetStatementsCount() == 0) {
+	if (BlockNesting) {
+		BlockNesting++;
+
+		for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+			GenerateStatement(*it);
+		}
+
+		BlockNesting--;
+		Blocks.pop();
 		return;
 	}
 
-	if (!BlockNesting) {
-		Asm.Add(new CAsmDirective("globl", FuncSym->GetName()));
-		Asm.Add(FuncSym->GetName());
+	Asm.AddDirective("globl", FuncSym->GetName());
+	Asm.Add(FuncSym->GetName());
 
-		if (!Optimize || AStmt.GetSymbolTable()->GetElementsSize() != 0 || FuncSym->GetArgumentsSymbolTable()->GetElementsSize() != 0) {
-			Asm.Add(PUSH, EBP);
-			Asm.Add(MOV, ESP, EBP);
-		}
+	if (IsFastCall(FuncSym)) {
+		GenerateFastCallWrapper();
 	}
 
-	Asm.Add(SUB, AStmt.GetSymbolTable()->GetElementsSize(), ESP);
+	size_t SpillSize = 0;
+	if (Asm.GetTarget() == TARGET_X86_64 || IsFastCall(FuncSym)) {
+		SpillSize = AllocateArguments(AStmt);
+	}
 
-	BlockNesting++;
+	FrameSize = SpillSize + GetLocalsSize(AStmt);
 
-	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
-		(*it)->Accept(*this);
+	Frame = !OmitFramePointer && (!Optimize || NeedsFrame(AStmt) || FuncSym->GetArgumentsSymbolTable()->GetElementsSize() != 0);
 
-		if ((*it)->IsExpression()) {
-			Asm.Add(POP, EAX);
-		}
+	if (Frame) {
+		Asm.Add(PUSH, EBP);
+		Asm.Add(MOV, ESP, EBP);
 	}
 
-	BlockNesting--;
+	Asm.SetStackDepth(0);
+	Asm.Add(SUB, FrameSize, ESP);
 
-	if (!BlockNesting) {
-		Asm.Add(".RL" + FuncSym->GetName());
+	if (Asm.GetTarget() == TARGET_X86_64 || IsFastCall(FuncSym)) {
+		SpillArguments();
 	}
 
-	Asm.Add(ADD, AStmt.GetSymbolTable()->GetElementsSize(), ESP);
+	if (Optimize) {
+		Asm.Add(".TL" + FuncSym->GetName());
+	}
 
-	if (!BlockNesting) {
-		if (!Optimize || AStmt.GetSymbolTable()->GetElementsSize() != 0 || FuncSym->GetArgumentsSymbolTable()->GetElementsSize() != 0) {
-			Asm.Add(MOV, EBP, ESP);
-			Asm.Add(POP, EBP);
-		}
+	BlockNesting++;
+
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		GenerateStatement(*it);
+	}
+
+	BlockNesting--;
+
+	Asm.Add(".RL" + FuncSym->GetName());
+	Asm.Add(ADD, FrameSize, ESP);
 
-		Asm.Add(RET);
+	if (Frame) {
+		Asm.Add(MOV, EBP, ESP);
+		Asm.Add(POP, EBP);
 	}
 
+	Asm.Add(RET);
+
 	Blocks.pop();
 }
 
+/*
+ * The arm that the profile shows runs more often goes first, falling through
+ * from the condition.
+ */
 void CCodeGenerationVisitor::Visit(CIfStatement &AStmt)
 {
-	AStmt.GetCondition()->Accept(*this);
-
 	string ElseLabel = Asm.GenerateLabel();
 	string IfEndLabel = Asm.GenerateLabel();
 
-	Asm.Add(POP, EAX);
-	Asm.Add(CMP, 0, EAX);
-	Asm.Add(JE, ElseLabel);
+	CStatement *Then = AStmt.GetThenStatement();
+	CStatement *Else = AStmt.GetElseStatement();
+	EProfileCounter ThenCounter = PROFILE_COUNTER_THEN;
+	EProfileCounter ElseCounter = PROFILE_COUNTER_ELSE;
+	unsigned long long ThenCount, ElseCount;
+
+	bool Inverted = Profile && Else && Profile->GetCount(&AStmt, ThenCounter, ThenCount)
+		&& Profile->GetCount(&AStmt, ElseCounter, ElseCount) && ElseCount > ThenCount;
+
+	if (Inverted) {
+		swap(Then, Else);
+		swap(ThenCounter, ElseCounter);
+	}
+
+	GenerateCondition(AStmt.GetCondition(), ElseLabel, Inverted);
 
-	TryVisit(AStmt.GetThenStatement());
+	if (IsCold(&AStmt, ThenCounter)) {
+		GenerateColdStatement(Then, Asm.GenerateLabel());
+	} else {
+		GenerateStatement(Then);
+	}
 
 	Asm.Add(JMP, IfEndLabel);
-	Asm.Add(ElseLabel);
 
-	TryVisit(AStmt.GetElseStatement());
+	if (Else && IsCold(&AStmt, ElseCounter)) {
+		GenerateColdStatement(Else, ElseLabel);
+	} else {
+		Asm.Add(ElseLabel);
+		GenerateStatement(Else);
+	}
 
 	Asm.Add(IfEndLabel);
 }
 
 void CCodeGenerationVisitor::Visit(CForStatement &AStmt)
 {
+	if (AStmt.GetVectorized()) {
+		GenerateVectorLoop(AStmt);
+		return;
+	}
+
 	string LoopStart = Asm.GenerateLabel();
 	string LoopEnd = Asm.GenerateLabel();
 	string LoopContinue = Asm.GenerateLabel();
@@ -1266,16 +1482,17 @@ void CCodeGenerationVisitor::Visit(CForStatement &AStmt)
 	Asm.Add(LoopStart);
 
 	if (AStmt.GetCondition()) {
-		AStmt.GetCondition()->Accept(*this);
-		Asm.Add(POP, EAX);
-		Asm.Add(CMP, 0, EAX);
-		Asm.Add(JE, LoopEnd);
+		GenerateCondition(AStmt.GetCondition(), LoopEnd, false);
 	}
 
 	BreakLabels.push(LoopEnd);
 	ContinueLabels.push(LoopContinue);
 
-	AStmt.GetBody()->Accept(*this);
+	if (IsCold(&AStmt, PROFILE_COUNTER_BODY)) {
+		GenerateColdStatement(AStmt.GetBody(), Asm.GenerateLabel());
+	} else {
+		GenerateStatement(AStmt.GetBody());
+	}
 
 	BreakLabels.pop();
 	ContinueLabels.pop();
@@ -1297,15 +1514,16 @@ void CCodeGenerationVisitor::Visit(CWhileStatement &AStmt)
 
 	Asm.Add(LoopStart);
 
-	AStmt.GetCondition()->Accept(*this);
-	Asm.Add(POP, EAX);
-	Asm.Add(CMP, 0, EAX);
-	Asm.Add(JE, LoopEnd);
+	GenerateCondition(AStmt.GetCondition(), LoopEnd, false);
 
 	BreakLabels.push(LoopEnd);
 	ContinueLabels.push(LoopStart);
 
-	AStmt.GetBody()->Accept(*this);
+	if (IsCold(&AStmt, PROFILE_COUNTER_BODY)) {
+		GenerateColdStatement(AStmt.GetBody(), Asm.GenerateLabel());
+	} else {
+		GenerateStatement(AStmt.GetBody());
+	}
 
 	BreakLabels.pop();
 	ContinueLabels.pop();
@@ -1325,17 +1543,14 @@ void CCodeGenerationVisitor::Visit(CDoStatement &AStmt)
 	BreakLabels.push(LoopEnd);
 	ContinueLabels.push(LoopContinue);
 
-	AStmt.GetBody()->Accept(*this);
+	GenerateStatement(AStmt.GetBody());
 
 	BreakLabels.pop();
 	ContinueLabels.pop();
 
 	Asm.Add(LoopContinue);
 
-	AStmt.GetCondition()->Accept(*this);
-	Asm.Add(POP, EAX);
-	Asm.Add(CMP, 0, EAX);
-	Asm.Add(JNE, LoopStart);
+	GenerateCondition(AStmt.GetCondition(), LoopStart, true);
 
 	Asm.Add(LoopEnd);
 }
@@ -1344,19 +1559,27 @@ void CCodeGenerationVisitor::Visit(CLabel &AStmt)
 {
 	Asm.Add(".CL" + FuncSym->GetName() + "_" + AStmt.GetName());
 
-	TryVisit(AStmt.GetNext());
+	GenerateStatement(AStmt.GetNext());
 }
 
 void CCodeGenerationVisitor::Visit(CCaseLabel &AStmt)
 {
-	Asm.Add(AStmt.GetName());
-	TryVisit(AStmt.GetNext());
+	if (IsCold(&AStmt, PROFILE_COUNTER_ENTRY)) {
+		GenerateColdStatement(AStmt.GetNext(), AStmt.GetName());
+	} else {
+		Asm.Add(AStmt.GetName());
+		GenerateStatement(AStmt.GetNext());
+	}
 }
 
 void CCodeGenerationVisitor::Visit(CDefaultCaseLabel &AStmt)
 {
-	Asm.Add(AStmt.GetName());
-	TryVisit(AStmt.GetNext());
+	if (IsCold(&AStmt, PROFILE_COUNTER_ENTRY)) {
+		GenerateColdStatement(AStmt.GetNext(), AStmt.GetName());
+	} else {
+		Asm.Add(AStmt.GetName());
+		GenerateStatement(AStmt.GetNext());
+	}
 }
 
 void CCodeGenerationVisitor::Visit(CGotoStatement &AStmt)
@@ -1376,12 +1599,25 @@ void CCodeGenerationVisitor::Visit(CContinueStatement &AStmt)
 
 void CCodeGenerationVisitor::Visit(CReturnStatement &AStmt)
 {
+	if (AStmt.GetTailCall()) {
+		CFunctionCall *Call = static_cast<CFunctionCall *>(AStmt.GetReturnExpression());
+
+		if (CanTailCall(Call->GetFunction())) {
+			GenerateTailCall(*Call);
+			return;
+		}
+	}
+
 	if (AStmt.GetReturnExpression()) {
 		AStmt.GetReturnExpression()->Accept(*this);
 
 		PerformConversion(FuncSym->GetReturnType(), AStmt.GetReturnExpression()->GetResultType());
 
 		Asm.Add(POP, EAX);
+
+		if (Asm.GetTarget() == TARGET_X86_64 && FuncSym->GetReturnType()->IsFloat()) {
+			Asm.Add(MOVD, EAX, XMM0);
+		}
 	}
 
 	Asm.Add(JMP, ".RL" + FuncSym->GetName());
@@ -1395,7 +1631,20 @@ void CCodeGenerationVisitor::Visit(CSwitchStatement &AStmt)
 
 	string CaseLabelName;
 
+	// cases that the profile shows are taken more often are tested first
+	multimap<unsigned long long, CCaseLabel *, greater<unsigned long long> > Cases;
+
 	for (CSwitchStatement::CasesIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		unsigned long long Count = 0;
+
+		if (Profile) {
+			Profile->GetCount(it->second, PROFILE_COUNTER_ENTRY, Count);
+		}
+
+		Cases.insert(make_pair(Count, it->second));
+	}
+
+	for (multimap<unsigned long long, CCaseLabel *, greater<unsigned long long> >::iterator it = Cases.begin(); it != Cases.end(); ++it) {
 		Asm.Add(MOV, it->second->GetValue(), EAX);
 
 		CaseLabelName = Asm.GenerateLabel();
@@ -1423,83 +1672,1195 @@ void CCodeGenerationVisitor::Visit(CSwitchStatement &AStmt)
 	Asm.Add(CaseLabelName);
 }
 
-void CCodeGenerationVisitor::ConvertFloatToInt()
+void CCodeGenerationVisitor::GenerateCondition(CExpression *ACondition, const string &ALabel, bool AJumpIfTrue)
 {
-	Asm.Add(FLD, mem(ESP));
-	Asm.Add(FISTTP, mem(ESP));
+	CUnaryOp *UnaryOp = dynamic_cast<CUnaryOp *>(ACondition);
+	CBinaryOp *BinaryOp = dynamic_cast<CBinaryOp *>(ACondition);
+	CIntegerConst *IntConst = dynamic_cast<CIntegerConst *>(ACondition);
+
+	if (UnaryOp && UnaryOp->GetType() == TOKEN_TYPE_OPERATION_LOGIC_NOT) {
+		GenerateCondition(UnaryOp->GetArgument(), ALabel, !AJumpIfTrue);
+
+	} else if (BinaryOp && (BinaryOp->GetType() == TOKEN_TYPE_OPERATION_LOGIC_AND || BinaryOp->GetType() == TOKEN_TYPE_OPERATION_LOGIC_OR)) {
+		bool IsAnd = (BinaryOp->GetType() == TOKEN_TYPE_OPERATION_LOGIC_AND);
+
+		if (IsAnd == AJumpIfTrue) {
+			// the right operand decides only when the left one doesn't
+			string SkipLabel = Asm.GenerateLabel();
+			GenerateCondition(BinaryOp->GetLeft(), SkipLabel, !AJumpIfTrue);
+			GenerateCondition(BinaryOp->GetRight(), ALabel, AJumpIfTrue);
+			Asm.Add(SkipLabel);
+		} else {
+			GenerateCondition(BinaryOp->GetLeft(), ALabel, AJumpIfTrue);
+			GenerateCondition(BinaryOp->GetRight(), ALabel, AJumpIfTrue);
+		}
+
+	} else if (BinaryOp && TokenTraits::IsComparisonOperation(BinaryOp->GetType())) {
+		EMnemonic Jump;
+
+		BinaryOp->GetLeft()->Accept(*this);
+		PerformConversion(BinaryOp->GetCommonRealType(), BinaryOp->GetLeft()->GetResultType());
+
+		if (BinaryOp->GetCommonRealType()->IsFloat()) {
+			BinaryOp->GetRight()->Accept(*this);
+			PerformConversion(BinaryOp->GetCommonRealType(), BinaryOp->GetRight()->GetResultType());
+
+			Asm.Add(FLD, mem(ESP));
+			Asm.Add(FLD, mem(TypeSize::Pointer, ESP));
+			Asm.Add(ADD, 2 * TypeSize::Pointer, ESP);
+
+			Asm.Add(FCOMPP);
+			Asm.Add(FSTSW, AX);
+			Asm.Add(SAHF);
+
+			Jump = FloatOperationCmd[BinaryOp->GetType()];
+		} else {
+			CTypeSymbol *Type = BinaryOp->GetCommonRealType();
+
+			if (CIntegerConst *RightConst = dynamic_cast<CIntegerConst *>(BinaryOp->GetRight())) {
+				Asm.Add(POP, EAX);
+				Asm.Add(CMP, RightConst->GetValue(), ValueRegister(EAX, Type));
+			} else {
+				BinaryOp->GetRight()->Accept(*this);
+				Asm.Add(POP, EBX);
+				Asm.Add(POP, EAX);
+				Asm.Add(CMP, ValueRegister(EBX, Type), ValueRegister(EAX, Type));
+			}
+
+			// pointers are compared as unsigned, the same way the FPU flags are
+			Jump = Type->IsPointer() ? FloatOperationCmd[BinaryOp->GetType()] : IntOperationCmd[BinaryOp->GetType()];
+		}
+
+		Asm.Add(AJumpIfTrue ? Jump : InvertedJump[Jump], ALabel);
+
+	} else if (IntConst) {
+		if ((IntConst->GetValue() != 0) == AJumpIfTrue) {
+			Asm.Add(JMP, ALabel);
+		}
+
+	} else {
+		ACondition->Accept(*this);
+
+		if (ACondition->GetResultType()->IsFloat()) {
+			Asm.Add(FLD, mem(ESP));
+			Asm.Add(ADD, TypeSize::Pointer, ESP);
+
+			Asm.Add(FTST);
+			Asm.Add(FSTSW, AX);
+			Asm.Add(SAHF);
+			Asm.Add(FSTP, ST0);
+		} else {
+			Asm.Add(POP, EAX);
+			Asm.Add(CMP, 0, ValueRegister(EAX, ACondition->GetResultType()));
+		}
+
+		Asm.Add(AJumpIfTrue ? JNE : JE, ALabel);
+	}
 }
 
-void CCodeGenerationVisitor::ConvertIntToFloat()
+void CCodeGenerationVisitor::GenerateConditionValue(CExpression *ACondition)
 {
-	Asm.Add(FILD, mem(ESP));
-	Asm.Add(FSTP, mem(ESP));
+	string FalseLabel = Asm.GenerateLabel();
+	string EndLabel = Asm.GenerateLabel();
+
+	GenerateCondition(ACondition, FalseLabel, false);
+
+	Asm.Add(MOV, 1, EAX);
+	Asm.Add(JMP, EndLabel);
+	Asm.Add(FalseLabel);
+	Asm.Add(MOV, 0, EAX);
+	Asm.Add(EndLabel);
 }
 
-void CCodeGenerationVisitor::PerformConversion(CTypeSymbol *LHS, CTypeSymbol *RHS)
+ERegister CCodeGenerationVisitor::ValueRegister(ERegister AReg, CTypeSymbol *AType)
 {
-	if (LHS->IsInt() && RHS->IsFloat()) {
-		ConvertFloatToInt();
-	} else if (LHS->IsFloat() && RHS->IsInt()) {
-		ConvertIntToFloat();
+	if (Asm.GetTarget() == TARGET_X86_64 && AType->IsPointer()) {
+		return AReg == EAX ? RAX : RBX;
 	}
+
+	return AReg;
 }
 
-/******************************************************************************
- * CCodeGenerator
- ******************************************************************************/
+void CCodeGenerationVisitor::PushValue(const CAsmOperand &AMem, CTypeSymbol *AType)
+{
+	if (AType->IsArray()) {
+		// an array operand stands for the address of its first element
+		Asm.Add(LEA, AMem, EAX);
+		Asm.Add(PUSH, EAX);
+	} else if (Asm.GetTarget() == TARGET_X86_64 && !AType->IsPointer()) {
+		// a 64-bit push would read past the end of 32-bit values
+		Asm.Add(MOV, AMem, EAX);
+		Asm.Add(PUSH, EAX);
+	} else {
+		Asm.Add(PUSH, AMem);
+	}
+}
+
+/*
+ * With optimization enabled, functions defined in the translation unit take
+ * their leading scalar arguments in ECX and EDX on i386. The global symbol
+ * stays a cdecl entry point, which forwards to the fast one.
+ */
+bool CCodeGenerationVisitor::IsFastCall(CFunctionSymbol *AFunc) const
+{
+	if (!Optimize || Asm.GetTarget() != TARGET_I386 || !AFunc->GetBody() || AFunc->GetBuiltIn() || AFunc->GetName() == "main") {
+		return false;
+	}
+
+	CFunctionSymbol::ArgumentsOrderContainer *Args = AFunc->GetArgumentsOrderedList();
+
+	return !Args->empty() && (*Args)[0]->GetType()->IsScalar();
+}
 
-CCodeGenerator::CCodeGenerator(CParser &AParser, const CCompilerParameters &AParameters) : Parser(AParser), Parameters(AParameters), Visitor(Code, Parameters.Optimize)
+string CCodeGenerationVisitor::GetCallName(CFunctionSymbol *AFunc) const
 {
+	return IsFastCall(AFunc) ? ".FC" + AFunc->GetName() : AFunc->GetName();
 }
 
-void CCodeGenerator::Output(ostream &Stream)
+void CCodeGenerationVisitor::ClassifyArguments(CFunctionSymbol *AFunc, vector<ERegister> &ARegisters)
 {
+	if (Asm.GetTarget() == TARGET_I386) {
+		static const ERegister FastCallRegisters[] = { ECX, EDX };
 
-	CGlobalSymbolTable *SymTable = Parser.ParseTranslationUnit();
+		CFunctionSymbol::ArgumentsOrderContainer *Args = AFunc->GetArgumentsOrderedList();
+		bool Registers = IsFastCall(AFunc);
+
+		for (size_t i = 0; i < Args->size(); i++) {
+			Registers = Registers && i < 2 && (*Args)[i]->GetType()->IsScalar();
+			ARegisters.push_back(Registers ? FastCallRegisters[i] : INVALID_REGISTER);
+		}
 
-	for (CGlobalSymbolTable::VariablesIterator it = SymTable->VariablesBegin(); it != SymTable->VariablesEnd(); ++it) {
-		Code.AddGlobalVariable(it->second);
+		return;
 	}
 
-	ofstream *TreeStream = NULL;
-	if (!Parameters.TreeFilename.empty()) {
-		TreeStream = new ofstream(Parameters.TreeFilename.c_str());
+	static const ERegister IntegerRegisters[] = { RDI, RSI, RDX, RCX, R8, R9 };
+	static const ERegister FloatRegisters[] = { XMM0, XMM1, XMM2, XMM3, XMM4, XMM5, XMM6, XMM7 };
+
+	size_t IntegerCount = 0;
+	size_t FloatCount = 0;
+
+	CFunctionSymbol::ArgumentsOrderContainer *Args = AFunc->GetArgumentsOrderedList();
+
+	for (CFunctionSymbol::ArgumentsOrderIterator it = Args->begin(); it != Args->end(); ++it) {
+		if ((*it)->GetType()->IsFloat()) {
+			ARegisters.push_back(FloatCount < 8 ? FloatRegisters[FloatCount++] : INVALID_REGISTER);
+		} else {
+			ARegisters.push_back(IntegerCount < 6 ? IntegerRegisters[IntegerCount++] : INVALID_REGISTER);
+		}
 	}
+}
 
-	CFunctionSymbol *FuncSym = NULL;
+size_t CCodeGenerationVisitor::AllocateArguments(CBlockStatement &ABody)
+{
+	vector<ERegister> Registers;
+	ClassifyArguments(FuncSym, Registers);
 
-	for (CGlobalSymbolTable::FunctionsIterator it = SymTable->FunctionsBegin(); it != SymTable->FunctionsEnd(); ++it) {
-		FuncSym = it->second;
+	CFunctionSymbol::ArgumentsOrderContainer *Args = FuncSym->GetArgumentsOrderedList();
 
-		if (FuncSym->GetBody()) {
-			if (Parameters.Optimize) {
-				CConstantFolding cf;
-				FuncSym->GetBody()->Accept(cf);
+	size_t SpillSize = 0;
+	size_t StackOffset = 2 * TypeSize::Pointer;
 
-				CUnreachableCodeElimination uce;
-				FuncSym->GetBody()->Accept(uce);
+	for (size_t i = 0; i < Registers.size(); i++) {
+		CVariableSymbol *Arg = (*Args)[i];
 
-				CLoopInvariantHoisting lih;
-				FuncSym->GetBody()->Accept(lih);
-			}
+		if (Registers[i] != INVALID_REGISTER) {
+			SpillSize += TypeSize::Pointer;
+			Arg->SetOffset(-SpillSize);
+		} else {
+			Arg->SetOffset(StackOffset);
+			StackOffset += Asm.GetTarget() == TARGET_X86_64 ? TypeSize::Pointer : Arg->GetType()->GetSize();
+		}
+	}
 
-			if (TreeStream) {
-				CStatementTreePrintVisitor stpv(*TreeStream);
-				*TreeStream << FuncSym->GetName() << ":" << endl;
-				FuncSym->GetBody()->Accept(stpv);
-			}
+	ShiftLocals(ABody, SpillSize);
 
-			Visitor.SetFunction(FuncSym);
-			FuncSym->GetBody()->Accept(Visitor);
+	return SpillSize;
+}
+
+void CCodeGenerationVisitor::SpillArguments()
+{
+	vector<ERegister> Registers;
+	ClassifyArguments(FuncSym, Registers);
+
+	CFunctionSymbol::ArgumentsOrderContainer *Args = FuncSym->GetArgumentsOrderedList();
+
+	for (size_t i = 0; i < Registers.size(); i++) {
+		CVariableSymbol *Arg = (*Args)[i];
+
+		if (Registers[i] == INVALID_REGISTER) {
+			continue;
 		}
+
+		Asm.Add(Registers[i] >= XMM0 ? MOVSS : MOV, Registers[i], FrameAddress(Arg->GetOffset()));
 	}
+}
 
-	delete TreeStream;
+/*
+ * Without a frame pointer locals are addressed relative to the stack pointer,
+ * and arguments are one slot closer, as the old frame pointer is not saved.
+ */
+CAsmOperand CCodeGenerationVisitor::FrameAddress(int AOffset)
+{
+	if (Frame) {
+		return mem(AOffset, EBP);
+	}
 
-	if (Parameters.Optimize) {
-		CLowLevelOptimizer optimizer(Code);
-		optimizer.Optimize();
+	if (AOffset > 0) {
+		AOffset -= TypeSize::Pointer;
+	}
+
+	return mem(AOffset + Asm.GetStackDepth(), ESP);
+}
+
+/*
+ * Returns the memory operand of an lvalue, computing only the registers it
+ * needs. The operand may be relative to ESP, so it has to be used before
+ * anything else is pushed.
+ */
+CAsmOperand CCodeGenerationVisitor::SelectAddress(CExpression *AExpr)
+{
+	if (CVariable *Var = dynamic_cast<CVariable *>(AExpr)) {
+		if (Var->GetSymbol()->GetGlobal()) {
+			return mem(Var->GetName(), Asm.GetTarget() == TARGET_X86_64 ? RIP : INVALID_REGISTER);
+		}
+
+		return FrameAddress(Var->GetSymbol()->GetOffset());
+	}
+
+	if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		CAsmOperand Mem = SelectAddress(Access->GetStruct());
+		Mem.Value += Access->GetField()->GetSymbol()->GetOffset();
+		return Mem;
+	}
+
+	if (CIndirectAccess *Access = dynamic_cast<CIndirectAccess *>(AExpr)) {
+		Access->GetPointer()->Accept(*this);
+		Asm.Add(POP, EBX);
+
+		return mem(Access->GetField()->GetSymbol()->GetOffset(), EBX);
+	}
+
+	if (CArrayAccess *Access = dynamic_cast<CArrayAccess *>(AExpr)) {
+		return SelectElementAddress(*Access);
+	}
+
+	AExpr->Accept(Addr);
+	Asm.Add(POP, EBX);
+
+	return mem(EBX);
+}
+
+CAsmOperand CCodeGenerationVisitor::SelectElementAddress(CArrayAccess &AExpr)
+{
+	CExpression *Base = AExpr.GetLeft();
+	CExpression *Index = AExpr.GetRight();
+
+	if (!Base->GetResultType()->IsPointer()) {
+		swap(Base, Index);
+	}
+
+	int Size = AExpr.GetElementSize();
+	bool Array = Base->GetResultType()->IsArray();
+	CAsmOperand Mem;
+
+	if (CIntegerConst *Const = dynamic_cast<CIntegerConst *>(Index)) {
+		if (Array) {
+			Mem = SelectAddress(Base);
+		} else {
+			Base->Accept(*this);
+			Asm.Add(POP, EBX);
+			Mem = mem(EBX);
+		}
+
+		Mem.Value += Const->GetValue() * Size;
+		return Mem;
+	}
+
+	if (Array && IsDirectAddress(Base)) {
+		Index->Accept(*this);
+		Asm.Add(POP, EAX);
+
+		Mem = SelectAddress(Base);
+
+		// RIP-relative operands take no index
+		if (Mem.Base == RIP) {
+			Asm.Add(LEA, Mem, EBX);
+			Mem = mem(EBX);
+		}
+	} else {
+		if (Array) {
+			Base->Accept(Addr);
+		} else {
+			Base->Accept(*this);
+		}
+
+		Index->Accept(*this);
+
+		Asm.Add(POP, EAX);
+		Asm.Add(POP, EBX);
+
+		Mem = mem(EBX);
+	}
+
+	if (Size != 1 && Size != 2 && Size != 4 && Size != 8) {
+		Asm.Add(IMUL, Size, EAX);
+		Size = 1;
+	}
+
+	if (Asm.GetTarget() == TARGET_X86_64) {
+		Asm.Add(CLTQ);
 	}
 
-	Code.Output(Stream);
+	Mem.Offset = EAX;
+	Mem.Multiplier = Size;
+
+	return Mem;
+}
+
+bool CCodeGenerationVisitor::IsDirectAddress(CExpression *AExpr)
+{
+	if (dynamic_cast<CVariable *>(AExpr)) {
+		return true;
+	}
+
+	if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		return IsDirectAddress(Access->GetStruct());
+	}
+
+	return false;
+}
+
+/*
+ * The value of an expression statement is dropped, so that the stack depth
+ * is the same at every statement and jumps need no adjustment.
+ */
+void CCodeGenerationVisitor::GenerateStatement(CStatement *AStmt)
+{
+	if (!AStmt) {
+		return;
+	}
+
+	AStmt->Accept(*this);
+
+	if (AStmt->IsExpression()) {
+		Asm.Add(POP, EAX);
+	}
+}
+
+/*
+ * Generates a statement that the profile shows is never executed after a
+ * label of its own, so that its code can be moved away from the rest.
+ */
+void CCodeGenerationVisitor::GenerateColdStatement(CStatement *AStmt, const string &ALabel)
+{
+	bool Cold = Asm.GetCold();
+
+	Asm.SetCold(true);
+	Asm.Add(ALabel);
+	GenerateStatement(AStmt);
+	Asm.SetCold(Cold);
+}
+
+/*
+ * Whether a point of a function that has run was never reached.
+ */
+bool CCodeGenerationVisitor::IsCold(CStatement *AStmt, EProfileCounter ACounter) const
+{
+	unsigned long long Count;
+	return Profile && Profile->GetCount(FuncSym->GetBody(), PROFILE_COUNTER_ENTRY, Count) && Count && Profile->IsCold(AStmt, ACounter);
+}
+
+/*
+ * Whether an expression is the low half of a profile counter.
+ */
+bool CCodeGenerationVisitor::IsCounter(CExpression *AExpr) const
+{
+	CArrayAccess *Access = dynamic_cast<CArrayAccess *>(AExpr);
+	CVariable *Var = Access ? dynamic_cast<CVariable *>(Access->GetLeft()) : NULL;
+	return Counters && Var && Var->GetSymbol() == Counters;
+}
+
+/*
+ * Increment of a 64-bit profile counter, with the old low half as its value.
+ * On i386 the carry out of the low half is added to the high one.
+ */
+void CCodeGenerationVisitor::GenerateCount(CArrayAccess &ACounter)
+{
+	CAsmOperand Low = SelectElementAddress(ACounter);
+	CAsmOperand High = Low;
+	High.Value += TypeSize::Integer;
+
+	PushValue(Low, ACounter.GetResultType());
+
+	if (Asm.GetTarget() == TARGET_X86_64) {
+		Asm.Add(MOV, Low, RAX);
+		Asm.Add(INC, RAX);
+		Asm.Add(MOV, RAX, Low);
+		return;
+	}
+
+	Asm.Add(MOV, Low, EAX);
+	Asm.Add(MOV, High, EDX);
+	Asm.Add(ADD, 1, EAX);
+	Asm.Add(ADC, 0, EDX);
+	Asm.Add(MOV, EAX, Low);
+	Asm.Add(MOV, EDX, High);
+}
+
+size_t CCodeGenerationVisitor::GetLocalsSize(CBlockStatement &ABlock)
+{
+	size_t Size = 0;
+
+	for (CBlockStatement::NestedBlocksIterator it = ABlock.NestedBlocksBegin(); it != ABlock.NestedBlocksEnd(); ++it) {
+		Size = max(Size, GetLocalsSize(**it));
+	}
+
+	return ABlock.GetSymbolTable()->GetElementsSize() + Size;
+}
+
+bool CCodeGenerationVisitor::NeedsFrame(CBlockStatement &ABlock)
+{
+	if (ABlock.GetSymbolTable()->GetElementsSize() != 0) {
+		return true;
+	}
+
+	for (CBlockStatement::NestedBlocksIterator it = ABlock.NestedBlocksBegin(); it != ABlock.NestedBlocksEnd(); ++it) {
+		if (NeedsFrame(**it)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void CCodeGenerationVisitor::ShiftLocals(CBlockStatement &ABlock, size_t AShift)
+{
+	CSymbolTable *SymTable = ABlock.GetSymbolTable();
+
+	for (CSymbolTable::VariablesIterator it = SymTable->VariablesBegin(); it != SymTable->VariablesEnd(); ++it) {
+		it->second->SetOffset(it->second->GetOffset() - AShift);
+	}
+
+	for (CBlockStatement::NestedBlocksIterator it = ABlock.NestedBlocksBegin(); it != ABlock.NestedBlocksEnd(); ++it) {
+		ShiftLocals(**it, AShift);
+	}
+}
+
+/*
+ * Arguments are already on the stack, the first one on top. Register arguments
+ * are loaded from there, stack arguments are copied below a 16-byte aligned
+ * stack pointer together with the old one, which is restored after the call.
+ */
+void CCodeGenerationVisitor::GenerateSystemVCall(CFunctionSymbol *AFunc)
+{
+	vector<ERegister> Registers;
+	ClassifyArguments(AFunc, Registers);
+
+	vector<size_t> StackArguments;
+	int FloatRegistersCount = 0;
+
+	for (size_t i = 0; i < Registers.size(); i++) {
+		if (Registers[i] == INVALID_REGISTER) {
+			StackArguments.push_back(i);
+		} else if (Registers[i] >= XMM0) {
+			FloatRegistersCount++;
+		}
+	}
+
+	int Depth = Asm.GetStackDepth();
+
+	Asm.Add(MOV, RSP, RAX);
+	Asm.Add(AND, -16, ESP);
+	if (StackArguments.size() % 2 == 0) {
+		Asm.Add(SUB, TypeSize::Pointer, ESP);
+	}
+	Asm.Add(PUSH, EAX);
+
+	for (vector<size_t>::reverse_iterator it = StackArguments.rbegin(); it != StackArguments.rend(); ++it) {
+		Asm.Add(PUSH, mem(*it * TypeSize::Pointer, EAX));
+	}
+
+	for (size_t i = 0; i < Registers.size(); i++) {
+		if (Registers[i] != INVALID_REGISTER) {
+			Asm.Add(Registers[i] >= XMM0 ? MOVSS : MOV, mem(i * TypeSize::Pointer, EAX), Registers[i]);
+		}
+	}
+
+	// number of vector registers used, in case the callee has variable arguments
+	Asm.Add(MOV, FloatRegistersCount, EAX);
+	Asm.Add(CALL, AFunc->GetName());
+
+	Asm.Add(ADD, StackArguments.size() * TypeSize::Pointer, ESP);
+	Asm.Add(POP, ESP);
+	Asm.SetStackDepth(Depth);
+	Asm.Add(ADD, Registers.size() * TypeSize::Pointer, ESP);
+}
+
+/*
+ * Register arguments are the first ones, so they are on top of the stack.
+ */
+void CCodeGenerationVisitor::GenerateFastCall(CFunctionSymbol *AFunc)
+{
+	vector<ERegister> Registers;
+	ClassifyArguments(AFunc, Registers);
+
+	size_t ArgumentsSize = AFunc->GetArgumentsSymbolTable()->GetElementsSize();
+
+	for (size_t i = 0; i < Registers.size() && Registers[i] != INVALID_REGISTER; i++) {
+		Asm.Add(POP, Registers[i]);
+		ArgumentsSize -= TypeSize::Pointer;
+	}
+
+	Asm.Add(CALL, GetCallName(AFunc));
+	Asm.Add(ADD, ArgumentsSize, ESP);
+}
+
+void CCodeGenerationVisitor::PushArguments(CFunctionCall &ACall)
+{
+	CFunctionSymbol::ArgumentsOrderContainer *FormalArgs = ACall.GetFunction()->GetArgumentsOrderedList();
+
+	CFunctionCall::ArgumentsReverseIterator ait;
+	CFunctionSymbol::ArgumentsReverseOrderIterator fit;
+
+	for (ait = ACall.RBegin(), fit = FormalArgs->rbegin(); ait != ACall.REnd() && fit != FormalArgs->rend(); ++ait, ++fit) {
+		(*ait)->Accept(*this);
+		PerformConversion(static_cast<CVariableSymbol *>(*fit)->GetType(), (*ait)->GetResultType());
+	}
+}
+
+/*
+ * A call can replace the function if its result needs no conversion. The
+ * function itself is reentered with new values of its arguments, other
+ * callees need all their stack arguments to fit into the incoming ones.
+ */
+bool CCodeGenerationVisitor::CanTailCall(CFunctionSymbol *AFunc)
+{
+	CTypeSymbol *ReturnType = FuncSym->GetReturnType();
+
+	if ((ReturnType->IsInt() && AFunc->GetReturnType()->IsFloat()) || (ReturnType->IsFloat() && AFunc->GetReturnType()->IsInt())) {
+		return false;
+	}
+
+	vector<ERegister> Registers;
+	ClassifyArguments(AFunc, Registers);
+
+	if (AFunc == FuncSym) {
+		CFunctionSymbol::ArgumentsOrderContainer *Args = AFunc->GetArgumentsOrderedList();
+
+		for (CFunctionSymbol::ArgumentsOrderIterator it = Args->begin(); it != Args->end(); ++it) {
+			if (!(*it)->GetType()->IsScalar()) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	if (Asm.GetTarget() == TARGET_X86_64) {
+		return find(Registers.begin(), Registers.end(), INVALID_REGISTER) == Registers.end();
+	}
+
+	return GetStackArgumentsSize(AFunc) <= GetStackArgumentsSize(FuncSym);
+}
+
+size_t CCodeGenerationVisitor::GetStackArgumentsSize(CFunctionSymbol *AFunc)
+{
+	vector<ERegister> Registers;
+	ClassifyArguments(AFunc, Registers);
+
+	size_t Size = AFunc->GetArgumentsSymbolTable()->GetElementsSize();
+
+	for (size_t i = 0; i < Registers.size() && Registers[i] != INVALID_REGISTER; i++) {
+		Size -= TypeSize::Pointer;
+	}
+
+	return Size;
+}
+
+void CCodeGenerationVisitor::GenerateTailCall(CFunctionCall &ACall)
+{
+	CFunctionSymbol *Func = ACall.GetFunction();
+	int Depth = Asm.GetStackDepth();
+
+	PushArguments(ACall);
+
+	vector<ERegister> Registers;
+	ClassifyArguments(Func, Registers);
+
+	if (Func == FuncSym) {
+		CFunctionSymbol::ArgumentsOrderContainer *Args = Func->GetArgumentsOrderedList();
+
+		for (CFunctionSymbol::ArgumentsOrderIterator it = Args->begin(); it != Args->end(); ++it) {
+			Asm.Add(POP, EAX);
+			Asm.Add(MOV, ValueRegister(EAX, (*it)->GetType()), FrameAddress((*it)->GetOffset()));
+		}
+
+		Asm.Add(JMP, ".TL" + FuncSym->GetName());
+		Asm.SetStackDepth(Depth);
+		return;
+	}
+
+	int FloatRegistersCount = 0;
+
+	if (Asm.GetTarget() == TARGET_X86_64) {
+		Asm.Add(MOV, RSP, RAX);
+
+		for (size_t i = 0; i < Registers.size(); i++) {
+			if (Registers[i] >= XMM0) {
+				FloatRegistersCount++;
+			}
+			Asm.Add(Registers[i] >= XMM0 ? MOVSS : MOV, mem(i * TypeSize::Pointer, EAX), Registers[i]);
+		}
+
+		Asm.Add(ADD, Registers.size() * TypeSize::Pointer, ESP);
+	} else {
+		size_t i = 0;
+
+		for (; i < Registers.size() && Registers[i] != INVALID_REGISTER; i++) {
+			Asm.Add(POP, Registers[i]);
+		}
+
+		// the incoming arguments are overwritten, the caller releases them
+		size_t StackArgumentsSize = GetStackArgumentsSize(Func);
+
+		for (size_t Offset = 0; Offset < StackArgumentsSize; Offset += TypeSize::Pointer) {
+			Asm.Add(POP, EAX);
+			Asm.Add(MOV, EAX, FrameAddress(2 * TypeSize::Pointer + Offset));
+		}
+	}
+
+	if (Frame) {
+		Asm.Add(MOV, EBP, ESP);
+		Asm.Add(POP, EBP);
+	} else {
+		Asm.Add(ADD, Asm.GetStackDepth(), ESP);
+	}
+
+	if (Asm.GetTarget() == TARGET_X86_64) {
+		Asm.Add(MOV, FloatRegistersCount, EAX);
+	}
+
+	Asm.Add(JMP, GetCallName(Func));
+	Asm.SetStackDepth(Depth);
+}
+
+void CCodeGenerationVisitor::GenerateFastCallWrapper()
+{
+	vector<ERegister> Registers;
+	ClassifyArguments(FuncSym, Registers);
+
+	size_t ArgumentsSize = FuncSym->GetArgumentsSymbolTable()->GetElementsSize();
+	size_t RegistersSize = 0;
+
+	for (size_t i = 0; i < Registers.size() && Registers[i] != INVALID_REGISTER; i++) {
+		RegistersSize += TypeSize::Pointer;
+		Asm.Add(MOV, mem(RegistersSize, ESP), Registers[i]);
+	}
+
+	// each push moves the next word of the remaining arguments to the same offset
+	for (size_t i = RegistersSize; i < ArgumentsSize; i += TypeSize::Pointer) {
+		Asm.Add(PUSH, mem(ArgumentsSize, ESP));
+	}
+
+	Asm.Add(CALL, GetCallName(FuncSym));
+	Asm.Add(ADD, ArgumentsSize - RegistersSize, ESP);
+	Asm.Add(RET);
+
+	Asm.Add(GetCallName(FuncSym));
+}
+
+/*
+ * The body of a vectorized loop is evaluated in XMM registers, an element of
+ * every lane for each iteration. Sums are accumulated lane by lane and added
+ * to their variables after the loop, and the operands that are the same for
+ * all the lanes are broadcast to registers of their own before it.
+ */
+void CCodeGenerationVisitor::GenerateVectorLoop(CForStatement &AStmt)
+{
+	string LoopStart = Asm.GenerateLabel();
+	string LoopEnd = Asm.GenerateLabel();
+
+	CLoopVectorization::StatementsContainer Statements;
+	CLoopVectorization::GetStatements(AStmt.GetBody(), Statements);
+
+	map<CBinaryOp *, ERegister> Accumulators;
+	map<CExpression *, ERegister> Broadcasts;
+	ERegister Free = XMM0;
+
+	AStmt.GetInit()->Accept(*this);
+	Asm.Add(POP, EAX);
+
+	for (CLoopVectorization::StatementsContainer::iterator it = Statements.begin(); it != Statements.end(); ++it) {
+		if (CLoopVectorization::GetReduction(*it)) {
+			Asm.Add(PXOR, Free, Free);
+			Accumulators[*it] = Free;
+			Free = ERegister(Free + 1);
+		}
+	}
+
+	for (CLoopVectorization::StatementsContainer::iterator it = Statements.begin(); it != Statements.end(); ++it) {
+		CExpression *Value = CLoopVectorization::GetReduction(*it);
+		BroadcastOperands(Value ? Value : (*it)->GetRight(), Broadcasts, Free);
+	}
+
+	Asm.Add(LoopStart);
+
+	GenerateCondition(AStmt.GetCondition(), LoopEnd, false);
+
+	for (CLoopVectorization::StatementsContainer::iterator it = Statements.begin(); it != Statements.end(); ++it) {
+		if (CExpression *Value = CLoopVectorization::GetReduction(*it)) {
+			GenerateVectorExpression(Value, Free, false, Broadcasts);
+			Asm.Add(PADDD, Free, Accumulators[*it]);
+			continue;
+		}
+
+		bool Float = (*it)->GetLeft()->GetResultType()->IsFloat();
+		EMnemonic Move = Float ? MOVUPS : MOVDQU;
+		CExpression *Value = (*it)->GetRight();
+
+		if ((*it)->GetType() == TOKEN_TYPE_OPERATION_ASSIGN) {
+			GenerateVectorExpression(Value, Free, Float, Broadcasts);
+		} else {
+			EMnemonic Cmd = (Float ? FloatVectorOperationCmd : IntVectorOperationCmd)[CompoundAssignmentOp[(*it)->GetType()]];
+
+			Asm.Add(Move, SelectAddress((*it)->GetLeft()), Free);
+
+			if (CLoopVectorization::IsBroadcast(Value)) {
+				Asm.Add(Cmd, Broadcasts[Value], Free);
+			} else {
+				GenerateVectorExpression(Value, ERegister(Free + 1), Float, Broadcasts);
+				Asm.Add(Cmd, ERegister(Free + 1), Free);
+			}
+		}
+
+		Asm.Add(Move, Free, SelectAddress((*it)->GetLeft()));
+	}
+
+	AStmt.GetUpdate()->Accept(*this);
+	Asm.Add(POP, EAX);
+
+	Asm.Add(JMP, LoopStart);
+	Asm.Add(LoopEnd);
+
+	for (CLoopVectorization::StatementsContainer::iterator it = Statements.begin(); it != Statements.end(); ++it) {
+		if (!Accumulators.count(*it)) {
+			continue;
+		}
+
+		ERegister Accumulator = Accumulators[*it];
+
+		Asm.Add(MOVDQA, Accumulator, Free);
+		Asm.Add(PSRLDQ, 8, Free);
+		Asm.Add(PADDD, Free, Accumulator);
+		Asm.Add(MOVDQA, Accumulator, Free);
+		Asm.Add(PSRLQ, 32, Free);
+		Asm.Add(PADDD, Free, Accumulator);
+		Asm.Add(MOVD, Accumulator, EAX);
+		Asm.Add(ADD, EAX, SelectAddress((*it)->GetLeft()));
+	}
+}
+
+void CCodeGenerationVisitor::BroadcastOperands(CExpression *AExpr, map<CExpression *, ERegister> &ABroadcasts, ERegister &AFree)
+{
+	if (dynamic_cast<CArrayAccess *>(AExpr)) {
+		return;
+	}
+
+	if (CLoopVectorization::IsBroadcast(AExpr)) {
+		AExpr->Accept(*this);
+		Asm.Add(POP, EAX);
+		Asm.Add(MOVD, EAX, AFree);
+		Asm.Add(PUNPCKLDQ, AFree, AFree);
+		Asm.Add(PUNPCKLQDQ, AFree, AFree);
+
+		ABroadcasts[AExpr] = AFree;
+		AFree = ERegister(AFree + 1);
+		return;
+	}
+
+	CBinaryOp *Op = static_cast<CBinaryOp *>(AExpr);
+	BroadcastOperands(Op->GetLeft(), ABroadcasts, AFree);
+	BroadcastOperands(Op->GetRight(), ABroadcasts, AFree);
+}
+
+void CCodeGenerationVisitor::GenerateVectorExpression(CExpression *AExpr, ERegister AReg, bool AFloat, map<CExpression *, ERegister> &ABroadcasts)
+{
+	if (dynamic_cast<CArrayAccess *>(AExpr)) {
+		Asm.Add(AFloat ? MOVUPS : MOVDQU, SelectAddress(AExpr), AReg);
+		return;
+	}
+
+	if (CLoopVectorization::IsBroadcast(AExpr)) {
+		Asm.Add(MOVDQA, ABroadcasts[AExpr], AReg);
+		return;
+	}
+
+	CBinaryOp *Op = static_cast<CBinaryOp *>(AExpr);
+	EMnemonic Cmd = (AFloat ? FloatVectorOperationCmd : IntVectorOperationCmd)[Op->GetType()];
+
+	GenerateVectorExpression(Op->GetLeft(), AReg, AFloat, ABroadcasts);
+
+	if (CLoopVectorization::IsBroadcast(Op->GetRight())) {
+		Asm.Add(Cmd, ABroadcasts[Op->GetRight()], AReg);
+	} else {
+		GenerateVectorExpression(Op->GetRight(), ERegister(AReg + 1), AFloat, ABroadcasts);
+		Asm.Add(Cmd, ERegister(AReg + 1), AReg);
+	}
+}
+
+/*
+ * Multiplies EAX by a constant with shifts and lea where a short sequence
+ * exists, using EBX as a scratch register.
+ */
+void CCodeGenerationVisitor::GenerateMultiplication(int AValue)
+{
+	unsigned int Value = AValue < 0 ? -(unsigned int) AValue : AValue;
+	int Shift = 0;
+
+	if (Value == 0) {
+		Asm.Add(MOV, 0, EAX);
+		return;
+	}
+
+	while (!(Value & 1)) {
+		Value >>= 1;
+		Shift++;
+	}
+
+	if (Value == 1) {
+	} else if (Value == 3 || Value == 5 || Value == 9) {
+		Asm.Add(LEA, mem(0, EAX, EAX, Value - 1), EAX);
+	} else if (Shift == 0 && IsPowerOfTwo(Value - 1)) {
+		Asm.Add(MOV, EAX, EBX);
+		Asm.Add(SAL, Log2(Value - 1), EAX);
+		Asm.Add(ADD, EBX, EAX);
+	} else if (Shift == 0 && IsPowerOfTwo(Value + 1)) {
+		Asm.Add(MOV, EAX, EBX);
+		Asm.Add(SAL, Log2(Value + 1), EAX);
+		Asm.Add(SUB, EBX, EAX);
+	} else {
+		Asm.Add(IMUL, AValue, EAX);
+		return;
+	}
+
+	if (Shift) {
+		Asm.Add(SAL, Shift, EAX);
+	}
+
+	if (AValue < 0) {
+		Asm.Add(NEG, EAX);
+	}
+}
+
+/*
+ * Divides EAX by a constant other than 0 and INT_MIN, rounding toward zero
+ * like idiv. Powers of two are shifted after adding a bias to negative
+ * dividends, other divisors are multiplied by a magic number (Hacker's
+ * Delight, chapter 10).
+ */
+void CCodeGenerationVisitor::GenerateDivision(int AValue, bool ARemainder)
+{
+	unsigned int Value = AValue < 0 ? -(unsigned int) AValue : AValue;
+
+	if (Value == 1) {
+		if (ARemainder) {
+			Asm.Add(MOV, 0, EAX);
+		} else if (AValue < 0) {
+			Asm.Add(NEG, EAX);
+		}
+		return;
+	}
+
+	Asm.Add(MOV, EAX, EBX);
+
+	if (IsPowerOfTwo(Value)) {
+		int Shift = Log2(Value);
+
+		Asm.Add(SAR, 31, EAX);
+		Asm.Add(SHR, 32 - Shift, EAX);
+		Asm.Add(ADD, EBX, EAX);
+
+		if (ARemainder) {
+			Asm.Add(AND, -(int) Value, EAX);
+			Asm.Add(SUB, EAX, EBX);
+			Asm.Add(MOV, EBX, EAX);
+		} else {
+			Asm.Add(SAR, Shift, EAX);
+
+			if (AValue < 0) {
+				Asm.Add(NEG, EAX);
+			}
+		}
+
+		return;
+	}
+
+	int Multiplier;
+	int Shift;
+	ComputeMagic(AValue, Multiplier, Shift);
+
+	Asm.Add(MOV, Multiplier, EAX);
+	Asm.Add(IMUL, EBX);
+
+	if (AValue > 0 && Multiplier < 0) {
+		Asm.Add(ADD, EBX, EDX);
+	} else if (AValue < 0 && Multiplier > 0) {
+		Asm.Add(SUB, EBX, EDX);
+	}
+
+	if (Shift) {
+		Asm.Add(SAR, Shift, EDX);
+	}
+
+	Asm.Add(MOV, EDX, EAX);
+	Asm.Add(SHR, 31, EAX);
+	Asm.Add(ADD, EDX, EAX);
+
+	if (ARemainder) {
+		Asm.Add(IMUL, AValue, EAX);
+		Asm.Add(SUB, EAX, EBX);
+		Asm.Add(MOV, EBX, EAX);
+	}
+}
+
+void CCodeGenerationVisitor::ComputeMagic(int ADivisor, int &AMultiplier, int &AShift)
+{
+	const unsigned int Two31 = 0x80000000u;
+
+	unsigned int AbsDivisor = ADivisor < 0 ? -(unsigned int) ADivisor : ADivisor;
+	unsigned int T = Two31 + ((unsigned int) ADivisor >> 31);
+	unsigned int AbsNc = T - 1 - T % AbsDivisor;
+
+	unsigned int Q1 = Two31 / AbsNc;
+	unsigned int R1 = Two31 - Q1 * AbsNc;
+	unsigned int Q2 = Two31 / AbsDivisor;
+	unsigned int R2 = Two31 - Q2 * AbsDivisor;
+	unsigned int Delta;
+	int P = 31;
+
+	do {
+		P++;
+
+		Q1 *= 2;
+		R1 *= 2;
+		if (R1 >= AbsNc) {
+			Q1++;
+			R1 -= AbsNc;
+		}
+
+		Q2 *= 2;
+		R2 *= 2;
+		if (R2 >= AbsDivisor) {
+			Q2++;
+			R2 -= AbsDivisor;
+		}
+
+		Delta = AbsDivisor - R2;
+	} while (Q1 < Delta || (Q1 == Delta && R1 == 0));
+
+	AMultiplier = Q2 + 1;
+	if (ADivisor < 0) {
+		AMultiplier = -AMultiplier;
+	}
+
+	AShift = P - 32;
+}
+
+bool CCodeGenerationVisitor::IsPowerOfTwo(unsigned int AValue) const
+{
+	return AValue && !(AValue & (AValue - 1));
+}
+
+int CCodeGenerationVisitor::Log2(unsigned int AValue) const
+{
+	int Result = 0;
+
+	while (AValue >>= 1) {
+		Result++;
+	}
+
+	return Result;
+}
+
+void CCodeGenerationVisitor::ConvertFloatToInt()
+{
+	Asm.Add(FLD, mem(ESP));
+	Asm.Add(FISTTP, mem(ESP));
+}
+
+void CCodeGenerationVisitor::ConvertIntToFloat()
+{
+	Asm.Add(FILD, mem(ESP));
+	Asm.Add(FSTP, mem(ESP));
+}
+
+void CCodeGenerationVisitor::PerformConversion(CTypeSymbol *LHS, CTypeSymbol *RHS)
+{
+	if (LHS->IsInt() && RHS->IsFloat()) {
+		ConvertFloatToInt();
+	} else if (LHS->IsFloat() && RHS->IsInt()) {
+		ConvertIntToFloat();
+	}
+}
+
+/******************************************************************************
+ * CCodeGenerator
+ ******************************************************************************/
+
+CCodeGenerator::CCodeGenerator(CParser &AParser, const CCompilerParameters &AParameters) : Parser(AParser), Parameters(AParameters), Code(AParameters.Target), Visitor(Code, Parameters.Optimize, Parameters.OmitFramePointer)
+{
+}
+
+void CCodeGenerator::Output(ostream &Stream)
+{
+
+	CGlobalSymbolTable *SymTable = Parser.ParseTranslationUnit();
+
+	{
+		CTimePhase Phase("code generation");
+
+		for (CGlobalSymbolTable::VariablesIterator it = SymTable->VariablesBegin(); it != SymTable->VariablesEnd(); ++it) {
+			Code.AddGlobalVariable(it->second);
+		}
+	}
+
+	ofstream *TreeStream = NULL;
+	if (!Parameters.TreeFilename.empty()) {
+		TreeStream = new ofstream(Parameters.TreeFilename.c_str());
+	}
+
+	CFunctionSymbol *FuncSym = NULL;
+
+	CProfile Profile;
+
+	if (!Parameters.ProfileGenerateFilename.empty() || !Parameters.ProfileUseFilename.empty()) {
+		CTimePhase Phase("profile instrumentation");
+		bool Instrument = !Parameters.ProfileGenerateFilename.empty();
+		CProfileInstrumentation pi(Profile, SymTable, Instrument);
+
+		for (CGlobalSymbolTable::FunctionsIterator it = SymTable->FunctionsBegin(); it != SymTable->FunctionsEnd(); ++it) {
+			if (it->second->GetBody()) {
+				it->second->GetBody()->Accept(pi);
+			}
+		}
+
+		if (Instrument) {
+			CVariableSymbol *Counters = pi.Register(SymTable->GetFunction("main"), Parameters.ProfileGenerateFilename);
+			Code.AddGlobalVariable(Counters);
+			Visitor.SetCounters(Counters);
+		} else {
+			Profile.Load(Parameters.ProfileUseFilename);
+		}
+	}
+
+	const CProfile *Counts = Parameters.Optimize && Profile.GetLoaded() ? &Profile : NULL;
+	Visitor.SetProfile(Counts);
+
+	if (Parameters.Optimize && Parameters.InlineLimit) {
+		CTimePhase Phase("function inlining");
+
+		for (CGlobalSymbolTable::FunctionsIterator it = SymTable->FunctionsBegin(); it != SymTable->FunctionsEnd(); ++it) {
+			FuncSym = it->second;
+
+			if (FuncSym->GetBody()) {
+				CFunctionInlining fi(FuncSym, Parameters.InlineLimit, Counts);
+				FuncSym->GetBody()->Accept(fi);
+			}
+		}
+	}
+
+	for (CGlobalSymbolTable::FunctionsIterator it = SymTable->FunctionsBegin(); it != SymTable->FunctionsEnd(); ++it) {
+		FuncSym = it->second;
+
+		if (FuncSym->GetBody()) {
+			if (Parameters.Optimize) {
+				if (Parameters.ConstantPropagation) {
+					CTimePhase Phase("constant propagation");
+					CConstantPropagation cp(FuncSym);
+					FuncSym->GetBody()->Accept(cp);
+				}
+
+				if (Parameters.SSE2) {
+					CTimePhase Phase("loop vectorization");
+					CLoopVectorization lv(FuncSym);
+					FuncSym->GetBody()->Accept(lv);
+				}
+
+				if (Parameters.UnrollLimit) {
+					CTimePhase Phase("loop unrolling");
+					CLoopUnrolling lu(FuncSym, Parameters.UnrollLimit, Parameters.UnrollFactor, Counts);
+					FuncSym->GetBody()->Accept(lu);
+				}
+
+				{
+					CTimePhase Phase("constant folding");
+					CConstantFolding cf;
+					FuncSym->GetBody()->Accept(cf);
+				}
+
+				{
+					CTimePhase Phase("dead code elimination");
+					CDeadCodeElimination dce(FuncSym);
+					FuncSym->GetBody()->Accept(dce);
+				}
+
+				{
+					CTimePhase Phase("common subexpression elimination");
+					CCommonSubexpressionElimination cse(FuncSym);
+					FuncSym->GetBody()->Accept(cse);
+				}
+
+				if (Parameters.GlobalCSE) {
+					CTimePhase Phase("global common subexpression elimination");
+					CGlobalSubexpressionElimination gcse(FuncSym);
+					FuncSym->GetBody()->Accept(gcse);
+				}
+
+				{
+					CTimePhase Phase("loop invariant hoisting");
+					CLoopInvariantHoisting lih;
+					FuncSym->GetBody()->Accept(lih);
+				}
+
+				{
+					CTimePhase Phase("tail call detection");
+					CTailCallDetection tcd;
+					FuncSym->GetBody()->Accept(tcd);
+				}
+
+				{
+					CTimePhase Phase("induction variable reduction");
+					CInductionVariableReduction ivr(FuncSym->GetBody());
+					FuncSym->GetBody()->Accept(ivr);
+				}
+			}
+
+			if (TreeStream) {
+				CTimePhase Phase("tree output");
+				CStatementTreePrintVisitor stpv(*TreeStream);
+				*TreeStream << FuncSym->GetName() << ":" << endl;
+				FuncSym->GetBody()->Accept(stpv);
+			}
+
+			CTimePhase Phase("code generation");
+			Visitor.SetFunction(FuncSym);
+			FuncSym->GetBody()->Accept(Visitor);
+		}
+	}
+
+	delete TreeStream;
+
+	if (Parameters.Optimize) {
+		CLowLevelOptimizer optimizer(Code);
+		optimizer.Optimize();
+	}
+
+	CTimePhase Phase("output");
+
+	if (Parameters.Assemble) {
+		CAssembler Assembler(Code);
+		Assembler.Output(Stream);
+	} else {
+		Code.Output(Stream);
+	}
 }
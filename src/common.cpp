@@ -25,7 +25,7 @@
  * CCompilerParameters
  ******************************************************************************/
 
-CCompilerParameters::CCompilerParameters() : CompilerMode(COMPILER_MODE_UNDEFINED), ParserOutputMode(PARSER_OUTPUT_MODE_TREE), ParserMode(PARSER_MODE_NORMAL), SymbolTables(false), Optimize(false)
+CCompilerParameters::CCompilerParameters() : CompilerMode(COMPILER_MODE_UNDEFINED), ParserOutputMode(PARSER_OUTPUT_MODE_TREE), ParserMode(PARSER_MODE_NORMAL), SymbolTables(false), Optimize(false), InlineLimit(40), UnrollLimit(64), UnrollFactor(4), OmitFramePointer(false), ConstantPropagation(true), GlobalCSE(true), Target(TARGET_I386), SSE2(false), Assemble(false), TimeReport(TIME_REPORT_FORMAT_NONE)
 {
 }
 
@@ -109,6 +109,57 @@ string CFatalException::GetMessage() const
 	return Message;
 }
 
+/******************************************************************************
+ * Unescape
+ ******************************************************************************/
+
+/*
+ * Decodes the escape sequences of a string literal, which keeps them as in the
+ * source; they are the ones of GNU as strings.
+ */
+string Unescape(const string &AString)
+{
+	string result;
+
+	for (unsigned int i = 0; i < AString.length(); i++) {
+		if (AString[i] != '\\' || i + 1 == AString.length()) {
+			result += AString[i];
+			continue;
+		}
+
+		char c = AString[++i];
+		if (c >= '0' && c <= '7') {
+			unsigned int Code = 0;
+			for (unsigned int j = 0; j < 3 && i < AString.length() && AString[i] >= '0' && AString[i] <= '7'; j++, i++) {
+				Code = Code * 8 + AString[i] - '0';
+			}
+			result += (char) Code;
+			i--;
+		} else if (c == 'x') {
+			unsigned int Code = 0;
+			while (i + 1 < AString.length() && isxdigit(AString[i + 1])) {
+				c = AString[++i];
+				Code = Code * 16 + (isdigit(c) ? c - '0' : tolower(c) - 'a' + 10);
+			}
+			result += (char) Code;
+		} else if (c == 'b') {
+			result += '\b';
+		} else if (c == 'f') {
+			result += '\f';
+		} else if (c == 'n') {
+			result += '\n';
+		} else if (c == 'r') {
+			result += '\r';
+		} else if (c == 't') {
+			result += '\t';
+		} else {
+			result += c;
+		}
+	}
+
+	return result;
+}
+
 /******************************************************************************
  * CStatementVisitor
  ******************************************************************************/
@@ -124,6 +175,15 @@ void CStatementVisitor::TryVisit(CStatement *AStmt)
 	}
 }
 
+/******************************************************************************
+ * TypeSize
+ ******************************************************************************/
+
+namespace TypeSize
+{
+	size_t Pointer = 4;
+};
+
 /******************************************************************************
  * CharTraits
  ******************************************************************************/
@@ -0,0 +1,1637 @@
+/*
+	ncc - Nartov C Compiler
+	Copyright 2010-2011  Alexander Nartov
+
+	ncc is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	ncc is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with ncc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "dataflow.h"
+
+#include "statements.h"
+
+/******************************************************************************
+ * CBitSet
+ ******************************************************************************/
+
+CBitSet::CBitSet(unsigned int ASize /*= 0*/, bool AValue /*= false*/) : Size(0)
+{
+	Resize(ASize, AValue);
+}
+
+void CBitSet::Resize(unsigned int ASize, bool AValue /*= false*/)
+{
+	Size = ASize;
+	Words.assign((Size + WordBits - 1) / WordBits, AValue ? ~WordType(0) : 0);
+	Trim();
+}
+
+unsigned int CBitSet::GetSize() const
+{
+	return Size;
+}
+
+bool CBitSet::Get(unsigned int AIndex) const
+{
+	return (Words[AIndex / WordBits] >> (AIndex % WordBits)) & 1;
+}
+
+void CBitSet::Set(unsigned int AIndex)
+{
+	Words[AIndex / WordBits] |= WordType(1) << (AIndex % WordBits);
+}
+
+void CBitSet::Reset(unsigned int AIndex)
+{
+	Words[AIndex / WordBits] &= ~(WordType(1) << (AIndex % WordBits));
+}
+
+void CBitSet::Fill()
+{
+	fill(Words.begin(), Words.end(), ~WordType(0));
+	Trim();
+}
+
+void CBitSet::Clear()
+{
+	fill(Words.begin(), Words.end(), 0);
+}
+
+bool CBitSet::Empty() const
+{
+	for (unsigned int i = 0; i < Words.size(); i++) {
+		if (Words[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+unsigned int CBitSet::Count() const
+{
+	unsigned int Result = 0;
+
+	for (unsigned int i = 0; i < Words.size(); i++) {
+		for (WordType Word = Words[i]; Word; Word &= Word - 1) {
+			Result++;
+		}
+	}
+
+	return Result;
+}
+
+/*
+ * Both Union and Intersect return whether the set has changed.
+ */
+bool CBitSet::Union(const CBitSet &ASet)
+{
+	WordType Changed = 0;
+
+	for (unsigned int i = 0; i < Words.size(); i++) {
+		WordType Word = Words[i] | ASet.Words[i];
+		Changed |= Word ^ Words[i];
+		Words[i] = Word;
+	}
+
+	return Changed != 0;
+}
+
+bool CBitSet::Intersect(const CBitSet &ASet)
+{
+	WordType Changed = 0;
+
+	for (unsigned int i = 0; i < Words.size(); i++) {
+		WordType Word = Words[i] & ASet.Words[i];
+		Changed |= Word ^ Words[i];
+		Words[i] = Word;
+	}
+
+	return Changed != 0;
+}
+
+void CBitSet::Subtract(const CBitSet &ASet)
+{
+	for (unsigned int i = 0; i < Words.size(); i++) {
+		Words[i] &= ~ASet.Words[i];
+	}
+}
+
+bool CBitSet::Intersects(const CBitSet &ASet) const
+{
+	for (unsigned int i = 0; i < Words.size(); i++) {
+		if (Words[i] & ASet.Words[i]) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool CBitSet::operator==(const CBitSet &ASet) const
+{
+	return Size == ASet.Size && Words == ASet.Words;
+}
+
+bool CBitSet::operator!=(const CBitSet &ASet) const
+{
+	return !(*this == ASet);
+}
+
+/*
+ * Keeps the bits past Size cleared, so that whole words can be compared.
+ */
+void CBitSet::Trim()
+{
+	if (Size % WordBits) {
+		Words.back() &= (WordType(1) << (Size % WordBits)) - 1;
+	}
+}
+
+/******************************************************************************
+ * CVariableNumbering
+ ******************************************************************************/
+
+unsigned int CVariableNumbering::Add(CVariableSymbol *AVariable)
+{
+	map<CVariableSymbol *, unsigned int>::iterator it = Indices.find(AVariable);
+
+	if (it != Indices.end()) {
+		return it->second;
+	}
+
+	unsigned int Index = Variables.size();
+
+	Indices[AVariable] = Index;
+	Variables.push_back(AVariable);
+	Escaped.push_back(AVariable->GetGlobal() || !AVariable->GetType()->IsScalar());
+
+	return Index;
+}
+
+int CVariableNumbering::GetIndex(CVariableSymbol *AVariable) const
+{
+	map<CVariableSymbol *, unsigned int>::const_iterator it = Indices.find(AVariable);
+	return (it != Indices.end()) ? it->second : -1;
+}
+
+CVariableSymbol* CVariableNumbering::GetVariable(unsigned int AIndex) const
+{
+	return Variables[AIndex];
+}
+
+unsigned int CVariableNumbering::GetCount() const
+{
+	return Variables.size();
+}
+
+void CVariableNumbering::SetEscaped(unsigned int AIndex)
+{
+	Escaped[AIndex] = true;
+}
+
+bool CVariableNumbering::GetEscaped(unsigned int AIndex) const
+{
+	return Escaped[AIndex];
+}
+
+CBitSet CVariableNumbering::GetEscaped() const
+{
+	CBitSet Result(Variables.size());
+
+	for (unsigned int i = 0; i < Escaped.size(); i++) {
+		if (Escaped[i]) {
+			Result.Set(i);
+		}
+	}
+
+	return Result;
+}
+
+/******************************************************************************
+ * CAccessCollector
+ ******************************************************************************/
+
+CAccesses::CAccesses() : Loads(false), Stores(false), Calls(false)
+{
+}
+
+CAccessCollector::CAccessCollector(CVariableNumbering &ANumbering, CAccesses &AAccesses) : Numbering(ANumbering), Accesses(AAccesses), AddressOperand(false), Conditional(false)
+{
+}
+
+void CAccessCollector::Visit(CUnaryOp &AStmt)
+{
+	bool Address = AddressOperand;
+	AddressOperand = (dynamic_cast<CAddressOfOp *>(&AStmt) != NULL);
+
+	if (AStmt.GetType() == TOKEN_TYPE_OPERATION_ASTERISK && !AddressOperand) {
+		Accesses.Loads = true;
+	}
+
+	AStmt.GetArgument()->Accept(*this);
+	AddressOperand = Address;
+
+	if (AStmt.GetType() == TOKEN_TYPE_OPERATION_INCREMENT || AStmt.GetType() == TOKEN_TYPE_OPERATION_DECREMENT) {
+		AddDef(AStmt.GetArgument());
+	}
+}
+
+void CAccessCollector::Visit(CBinaryOp &AStmt)
+{
+	ETokenType Type = AStmt.GetType();
+
+	bool Address = AddressOperand;
+	AddressOperand = false;
+
+	// a plain assignment to a variable doesn't read it
+	if (Type != TOKEN_TYPE_OPERATION_ASSIGN || !dynamic_cast<CVariable *>(AStmt.GetLeft())) {
+		AStmt.GetLeft()->Accept(*this);
+	}
+
+	bool Cond = Conditional;
+	Conditional = Conditional || Type == TOKEN_TYPE_OPERATION_LOGIC_AND || Type == TOKEN_TYPE_OPERATION_LOGIC_OR;
+	AStmt.GetRight()->Accept(*this);
+	Conditional = Cond;
+
+	AddressOperand = Address;
+
+	if (TokenTraits::IsAssignment(Type)) {
+		AddDef(AStmt.GetLeft());
+	}
+}
+
+void CAccessCollector::Visit(CConditionalOp &AStmt)
+{
+	bool Address = AddressOperand;
+	AddressOperand = false;
+	AStmt.GetCondition()->Accept(*this);
+
+	bool Cond = Conditional;
+	Conditional = true;
+	AStmt.GetTrueExpr()->Accept(*this);
+	AStmt.GetFalseExpr()->Accept(*this);
+	Conditional = Cond;
+
+	AddressOperand = Address;
+}
+
+void CAccessCollector::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CFloatConst &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CCharConst &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CStringConst &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CVariable &AStmt)
+{
+	unsigned int Index = Numbering.Add(AStmt.GetSymbol());
+
+	if (AddressOperand) {
+		Numbering.SetEscaped(Index);
+	} else {
+		Accesses.Uses.push_back(Index);
+	}
+}
+
+void CAccessCollector::Visit(CFunction &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CPostfixOp &AStmt)
+{
+	bool Address = AddressOperand;
+	AddressOperand = false;
+	AStmt.GetArgument()->Accept(*this);
+	AddressOperand = Address;
+
+	AddDef(AStmt.GetArgument());
+}
+
+void CAccessCollector::Visit(CFunctionCall &AStmt)
+{
+	Accesses.Calls = true;
+
+	bool Address = AddressOperand;
+	AddressOperand = false;
+	for (CFunctionCall::ArgumentsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		(*it)->Accept(*this);
+	}
+	AddressOperand = Address;
+}
+
+void CAccessCollector::Visit(CStructAccess &AStmt)
+{
+	if (!AddressOperand) {
+		Accesses.Loads = true;
+	}
+
+	AStmt.GetStruct()->Accept(*this);
+}
+
+void CAccessCollector::Visit(CIndirectAccess &AStmt)
+{
+	if (!AddressOperand) {
+		Accesses.Loads = true;
+	}
+
+	bool Address = AddressOperand;
+	AddressOperand = false;
+	AStmt.GetPointer()->Accept(*this);
+	AddressOperand = Address;
+}
+
+void CAccessCollector::Visit(CArrayAccess &AStmt)
+{
+	if (!AddressOperand) {
+		Accesses.Loads = true;
+	}
+
+	bool Address = AddressOperand;
+
+	// only the address of an array base is taken, a pointer base is just read
+	AddressOperand = Address && AStmt.GetLeft()->GetResultType()->IsArray();
+	AStmt.GetLeft()->Accept(*this);
+	AddressOperand = Address && AStmt.GetRight()->GetResultType()->IsArray();
+	AStmt.GetRight()->Accept(*this);
+
+	AddressOperand = Address;
+}
+
+void CAccessCollector::Visit(CNullStatement &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CBlockStatement &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CIfStatement &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CForStatement &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CWhileStatement &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CDoStatement &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CLabel &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CCaseLabel &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CDefaultCaseLabel &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CReturnStatement &AStmt)
+{
+}
+
+void CAccessCollector::Visit(CSwitchStatement &AStmt)
+{
+}
+
+/*
+ * A write to a variable defines it, any other write is a store to memory,
+ * which may also partially define the array or struct variable it is in.
+ */
+void CAccessCollector::AddDef(CExpression *AExpr)
+{
+	if (CVariable *Var = dynamic_cast<CVariable *>(AExpr)) {
+		unsigned int Index = Numbering.Add(Var->GetSymbol());
+		(Conditional ? Accesses.MayDefs : Accesses.Defs).push_back(Index);
+		return;
+	}
+
+	Accesses.Stores = true;
+
+	while (AExpr) {
+		if (CVariable *Var = dynamic_cast<CVariable *>(AExpr)) {
+			if (Var->GetResultType()->IsArray() || Var->GetResultType()->IsStruct()) {
+				Accesses.MayDefs.push_back(Numbering.Add(Var->GetSymbol()));
+			}
+			break;
+		} else if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+			AExpr = Access->GetStruct();
+		} else if (CArrayAccess *Access = dynamic_cast<CArrayAccess *>(AExpr)) {
+			AExpr = Access->GetLeft()->GetResultType()->IsArray() ? Access->GetLeft() : Access->GetRight();
+		} else {
+			break;
+		}
+	}
+}
+
+/******************************************************************************
+ * CBasicBlock
+ ******************************************************************************/
+
+CBasicBlock::CBasicBlock(unsigned int AIndex) : Index(AIndex), Reachable(false)
+{
+}
+
+unsigned int CBasicBlock::GetIndex() const
+{
+	return Index;
+}
+
+CBasicBlock::ElementsContainer& CBasicBlock::GetElements()
+{
+	return Elements;
+}
+
+CBasicBlock::BlocksContainer& CBasicBlock::GetSuccessors()
+{
+	return Successors;
+}
+
+CBasicBlock::BlocksContainer& CBasicBlock::GetPredecessors()
+{
+	return Predecessors;
+}
+
+bool CBasicBlock::GetReachable() const
+{
+	return Reachable;
+}
+
+void CBasicBlock::SetReachable(bool AReachable)
+{
+	Reachable = AReachable;
+}
+
+/******************************************************************************
+ * CControlFlowGraph
+ ******************************************************************************/
+
+/*
+ * Statements after a jump start a new block with no predecessors, it becomes
+ * reachable only if a label follows.
+ */
+CControlFlowGraph::CControlFlowGraph(CFunctionSymbol *AFunction)
+{
+	CFunctionSymbol::ArgumentsOrderContainer *Arguments = AFunction->GetArgumentsOrderedList();
+	for (CFunctionSymbol::ArgumentsOrderIterator it = Arguments->begin(); it != Arguments->end(); ++it) {
+		Numbering.Add(*it);
+	}
+
+	Entry = NewBlock();
+	Exit = NewBlock();
+	Current = NewBlock();
+	Link(Entry, Current);
+
+	AFunction->GetBody()->Accept(*this);
+	Link(Current, Exit);
+
+	ComputeOrder();
+}
+
+CControlFlowGraph::~CControlFlowGraph()
+{
+	for (BlocksIterator it = Blocks.begin(); it != Blocks.end(); ++it) {
+		delete *it;
+	}
+}
+
+void CControlFlowGraph::Visit(CUnaryOp &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CBinaryOp &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CConditionalOp &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CIntegerConst &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CFloatConst &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CCharConst &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CStringConst &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CVariable &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CFunction &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CPostfixOp &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CFunctionCall &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CStructAccess &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CIndirectAccess &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CArrayAccess &AStmt)
+{
+	AddElement(&AStmt, &AStmt);
+}
+
+void CControlFlowGraph::Visit(CNullStatement &AStmt)
+{
+	Enter(&AStmt);
+}
+
+void CControlFlowGraph::Visit(CBlockStatement &AStmt)
+{
+	Enter(&AStmt);
+
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		(*it)->Accept(*this);
+	}
+}
+
+void CControlFlowGraph::Visit(CIfStatement &AStmt)
+{
+	AddElement(&AStmt, AStmt.GetCondition());
+
+	CBasicBlock *Condition = Current;
+	CBasicBlock *Join = NewBlock();
+
+	bool Value = false;
+	bool Constant = IsConstant(AStmt.GetCondition(), Value);
+
+	Current = NewBlock();
+	if (!Constant || Value) {
+		Link(Condition, Current);
+	}
+	AStmt.GetThenStatement()->Accept(*this);
+	Link(Current, Join);
+
+	if (AStmt.GetElseStatement()) {
+		Current = NewBlock();
+		if (!Constant || !Value) {
+			Link(Condition, Current);
+		}
+		AStmt.GetElseStatement()->Accept(*this);
+		Link(Current, Join);
+	} else if (!Constant || !Value) {
+		Link(Condition, Join);
+	}
+
+	Current = Join;
+}
+
+void CControlFlowGraph::Visit(CForStatement &AStmt)
+{
+	if (AStmt.GetInit()) {
+		AddElement(&AStmt, AStmt.GetInit());
+	} else {
+		Enter(&AStmt);
+	}
+
+	CBasicBlock *Head = NewBlock();
+	CBasicBlock *Update = NewBlock();
+	CBasicBlock *Next = NewBlock();
+
+	Link(Current, Head);
+	Current = Head;
+
+	bool Value = true;
+	bool Constant = !AStmt.GetCondition() || IsConstant(AStmt.GetCondition(), Value);
+
+	if (AStmt.GetCondition()) {
+		AddElement(&AStmt, AStmt.GetCondition());
+	}
+
+	if (!Constant || !Value) {
+		Link(Head, Next);
+	}
+
+	BreakTargets.push(Next);
+	ContinueTargets.push(Update);
+
+	Current = NewBlock();
+	if (!Constant || Value) {
+		Link(Head, Current);
+	}
+	AStmt.GetBody()->Accept(*this);
+	Link(Current, Update);
+
+	ContinueTargets.pop();
+	BreakTargets.pop();
+
+	Current = Update;
+	if (AStmt.GetUpdate()) {
+		AddElement(&AStmt, AStmt.GetUpdate());
+	}
+	Link(Update, Head);
+
+	Current = Next;
+}
+
+void CControlFlowGraph::Visit(CWhileStatement &AStmt)
+{
+	Enter(&AStmt);
+
+	CBasicBlock *Head = NewBlock();
+	CBasicBlock *Next = NewBlock();
+
+	Link(Current, Head);
+	Current = Head;
+	AddElement(&AStmt, AStmt.GetCondition());
+
+	bool Value = false;
+	bool Constant = IsConstant(AStmt.GetCondition(), Value);
+
+	if (!Constant || !Value) {
+		Link(Head, Next);
+	}
+
+	BreakTargets.push(Next);
+	ContinueTargets.push(Head);
+
+	Current = NewBlock();
+	if (!Constant || Value) {
+		Link(Head, Current);
+	}
+	AStmt.GetBody()->Accept(*this);
+	Link(Current, Head);
+
+	ContinueTargets.pop();
+	BreakTargets.pop();
+
+	Current = Next;
+}
+
+void CControlFlowGraph::Visit(CDoStatement &AStmt)
+{
+	Enter(&AStmt);
+
+	CBasicBlock *Body = NewBlock();
+	CBasicBlock *Condition = NewBlock();
+	CBasicBlock *Next = NewBlock();
+
+	Link(Current, Body);
+
+	BreakTargets.push(Next);
+	ContinueTargets.push(Condition);
+
+	Current = Body;
+	AStmt.GetBody()->Accept(*this);
+	Link(Current, Condition);
+
+	ContinueTargets.pop();
+	BreakTargets.pop();
+
+	Current = Condition;
+	AddElement(&AStmt, AStmt.GetCondition());
+
+	bool Value = false;
+	bool Constant = IsConstant(AStmt.GetCondition(), Value);
+
+	if (!Constant || Value) {
+		Link(Condition, Body);
+	}
+
+	if (!Constant || !Value) {
+		Link(Condition, Next);
+	}
+
+	Current = Next;
+}
+
+void CControlFlowGraph::Visit(CLabel &AStmt)
+{
+	CBasicBlock *Block = GetLabelBlock(AStmt.GetName());
+
+	Link(Current, Block);
+	Current = Block;
+	Enter(&AStmt);
+
+	TryVisit(AStmt.GetNext());
+}
+
+void CControlFlowGraph::Visit(CCaseLabel &AStmt)
+{
+	CBasicBlock *Block = NewBlock();
+
+	Link(Current, Block);
+	if (IsTaken(&AStmt)) {
+		Link(SwitchBlocks.top(), Block);
+	}
+	Current = Block;
+	Enter(&AStmt);
+
+	TryVisit(AStmt.GetNext());
+}
+
+void CControlFlowGraph::Visit(CDefaultCaseLabel &AStmt)
+{
+	CBasicBlock *Block = NewBlock();
+
+	Link(Current, Block);
+	if (IsTaken(&AStmt)) {
+		Link(SwitchBlocks.top(), Block);
+	}
+	Current = Block;
+	Enter(&AStmt);
+
+	TryVisit(AStmt.GetNext());
+}
+
+void CControlFlowGraph::Visit(CGotoStatement &AStmt)
+{
+	Enter(&AStmt);
+	Jump(GetLabelBlock(AStmt.GetLabelName()));
+}
+
+void CControlFlowGraph::Visit(CBreakStatement &AStmt)
+{
+	Enter(&AStmt);
+	Jump(BreakTargets.top());
+}
+
+void CControlFlowGraph::Visit(CContinueStatement &AStmt)
+{
+	Enter(&AStmt);
+	Jump(ContinueTargets.top());
+}
+
+void CControlFlowGraph::Visit(CReturnStatement &AStmt)
+{
+	if (AStmt.GetReturnExpression()) {
+		AddElement(&AStmt, AStmt.GetReturnExpression());
+	} else {
+		Enter(&AStmt);
+	}
+
+	Jump(Exit);
+}
+
+void CControlFlowGraph::Visit(CSwitchStatement &AStmt)
+{
+	AddElement(&AStmt, AStmt.GetTestExpression());
+
+	CBasicBlock *Next = NewBlock();
+
+	Switches.push(&AStmt);
+	SwitchBlocks.push(Current);
+	BreakTargets.push(Next);
+
+	// statements before the first case are never executed
+	Current = NewBlock();
+	AStmt.GetBody()->Accept(*this);
+	Link(Current, Next);
+
+	if (!AStmt.GetDefaultCase() && IsTaken(NULL)) {
+		Link(SwitchBlocks.top(), Next);
+	}
+
+	BreakTargets.pop();
+	SwitchBlocks.pop();
+	Switches.pop();
+
+	Current = Next;
+}
+
+CVariableNumbering& CControlFlowGraph::GetNumbering()
+{
+	return Numbering;
+}
+
+CBasicBlock* CControlFlowGraph::GetEntry() const
+{
+	return Entry;
+}
+
+CBasicBlock* CControlFlowGraph::GetExit() const
+{
+	return Exit;
+}
+
+unsigned int CControlFlowGraph::GetSize() const
+{
+	return Blocks.size();
+}
+
+CBasicBlock* CControlFlowGraph::GetBlock(unsigned int AIndex) const
+{
+	return Blocks[AIndex];
+}
+
+/*
+ * Returns the block in which execution of a statement starts.
+ */
+CBasicBlock* CControlFlowGraph::GetBlock(CStatement *AStmt) const
+{
+	map<CStatement *, CBasicBlock *>::const_iterator it = StatementBlocks.find(AStmt);
+	return (it != StatementBlocks.end()) ? it->second : NULL;
+}
+
+CControlFlowGraph::BlocksIterator CControlFlowGraph::Begin()
+{
+	return Blocks.begin();
+}
+
+CControlFlowGraph::BlocksIterator CControlFlowGraph::End()
+{
+	return Blocks.end();
+}
+
+/*
+ * Reachable blocks in reverse postorder.
+ */
+CControlFlowGraph::BlocksContainer& CControlFlowGraph::GetOrder()
+{
+	return Order;
+}
+
+bool CControlFlowGraph::IsConstant(CExpression *AExpr, bool &AValue)
+{
+	if (CIntegerConst *Const = dynamic_cast<CIntegerConst *>(AExpr)) {
+		AValue = Const->GetValue() != 0;
+	} else if (CCharConst *Const = dynamic_cast<CCharConst *>(AExpr)) {
+		AValue = Const->GetValue() != 0;
+	} else if (CFloatConst *Const = dynamic_cast<CFloatConst *>(AExpr)) {
+		AValue = Const->GetValue() != 0;
+	} else {
+		return false;
+	}
+
+	return true;
+}
+
+CBasicBlock* CControlFlowGraph::NewBlock()
+{
+	CBasicBlock *Block = new CBasicBlock(Blocks.size());
+	Blocks.push_back(Block);
+	return Block;
+}
+
+CBasicBlock* CControlFlowGraph::GetLabelBlock(const string &AName)
+{
+	map<string, CBasicBlock *>::iterator it = Labels.find(AName);
+
+	if (it != Labels.end()) {
+		return it->second;
+	}
+
+	return Labels[AName] = NewBlock();
+}
+
+void CControlFlowGraph::Link(CBasicBlock *AFrom, CBasicBlock *ATo)
+{
+	AFrom->GetSuccessors().push_back(ATo);
+	ATo->GetPredecessors().push_back(AFrom);
+}
+
+void CControlFlowGraph::Jump(CBasicBlock *ATo)
+{
+	Link(Current, ATo);
+	Current = NewBlock();
+}
+
+void CControlFlowGraph::Enter(CStatement *AStmt)
+{
+	StatementBlocks[AStmt] = Current;
+}
+
+void CControlFlowGraph::AddElement(CStatement *AStmt, CExpression *AExpr)
+{
+	if (!StatementBlocks.count(AStmt)) {
+		Enter(AStmt);
+	}
+
+	CBasicBlock::CElement Element;
+	Element.Statement = AStmt;
+	Element.Expression = AExpr;
+
+	Current->GetElements().push_back(Element);
+
+	CAccessCollector Collector(Numbering, Current->GetElements().back().Accesses);
+	AExpr->Accept(Collector);
+}
+
+/*
+ * Whether a constant test of the innermost switch can select the case, NULL
+ * standing for the default one.
+ */
+bool CControlFlowGraph::IsTaken(CLabel *ACase)
+{
+	CIntegerConst *Test = dynamic_cast<CIntegerConst *>(Switches.top()->GetTestExpression());
+
+	if (!Test) {
+		return true;
+	}
+
+	if (CCaseLabel *Case = dynamic_cast<CCaseLabel *>(ACase)) {
+		return Case->GetValue() == Test->GetValue();
+	}
+
+	for (CSwitchStatement::CasesIterator it = Switches.top()->Begin(); it != Switches.top()->End(); ++it) {
+		if (it->first == Test->GetValue()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void CControlFlowGraph::ComputeOrder()
+{
+	BlocksContainer Postorder;
+	stack<pair<CBasicBlock *, unsigned int> > Path;
+
+	Entry->SetReachable(true);
+	Path.push(make_pair(Entry, 0));
+
+	while (!Path.empty()) {
+		CBasicBlock *Block = Path.top().first;
+		unsigned int &Next = Path.top().second;
+
+		if (Next == Block->GetSuccessors().size()) {
+			Postorder.push_back(Block);
+			Path.pop();
+			continue;
+		}
+
+		CBasicBlock *Successor = Block->GetSuccessors()[Next++];
+
+		if (!Successor->GetReachable()) {
+			Successor->SetReachable(true);
+			Path.push(make_pair(Successor, 0));
+		}
+	}
+
+	Order.assign(Postorder.rbegin(), Postorder.rend());
+}
+
+/******************************************************************************
+ * CDataflowAnalysis
+ ******************************************************************************/
+
+CDataflowAnalysis::CDataflowAnalysis(CControlFlowGraph &AGraph, bool AForward, bool AIntersection) : Graph(AGraph), Forward(AForward), Intersection(AIntersection), Size(0)
+{
+}
+
+CDataflowAnalysis::~CDataflowAnalysis()
+{
+}
+
+unsigned int CDataflowAnalysis::GetSize() const
+{
+	return Size;
+}
+
+const CBitSet& CDataflowAnalysis::GetIn(CBasicBlock *ABlock) const
+{
+	return In[ABlock->GetIndex()];
+}
+
+const CBitSet& CDataflowAnalysis::GetOut(CBasicBlock *ABlock) const
+{
+	return Out[ABlock->GetIndex()];
+}
+
+/*
+ * Blocks are visited in reverse postorder for forward problems and in
+ * postorder for backward ones, so most of them see final values of their
+ * neighbours on the first pass. Unreachable blocks are left at the initial
+ * value.
+ */
+void CDataflowAnalysis::Solve()
+{
+	unsigned int Count = Graph.GetSize();
+
+	Gen.assign(Count, CBitSet(Size));
+	Kill.assign(Count, CBitSet(Size));
+	Boundary.Resize(Size);
+
+	Initialize();
+
+	In.assign(Count, CBitSet(Size, Intersection));
+	Out.assign(Count, CBitSet(Size, Intersection));
+
+	CControlFlowGraph::BlocksContainer &Order = Graph.GetOrder();
+	CBasicBlock *Start = Forward ? Graph.GetEntry() : Graph.GetExit();
+
+	(Forward ? In : Out)[Start->GetIndex()] = Boundary;
+
+	deque<CBasicBlock *> Worklist;
+	vector<bool> Queued(Count, false);
+
+	for (unsigned int i = 0; i < Order.size(); i++) {
+		Worklist.push_back(Order[Forward ? i : Order.size() - 1 - i]);
+		Queued[Worklist.back()->GetIndex()] = true;
+	}
+
+	while (!Worklist.empty()) {
+		CBasicBlock *Block = Worklist.front();
+		unsigned int Index = Block->GetIndex();
+
+		Worklist.pop_front();
+		Queued[Index] = false;
+
+		CBasicBlock::BlocksContainer &Sources = Forward ? Block->GetPredecessors() : Block->GetSuccessors();
+		CBitSet &Input = Forward ? In[Index] : Out[Index];
+		CBitSet &Output = Forward ? Out[Index] : In[Index];
+
+		if (Block != Start) {
+			bool First = true;
+
+			for (CBasicBlock::BlocksIterator it = Sources.begin(); it != Sources.end(); ++it) {
+				if (!(*it)->GetReachable()) {
+					continue;
+				}
+
+				const CBitSet &Source = Forward ? Out[(*it)->GetIndex()] : In[(*it)->GetIndex()];
+
+				if (First) {
+					Input = Source;
+					First = false;
+				} else if (Intersection) {
+					Input.Intersect(Source);
+				} else {
+					Input.Union(Source);
+				}
+			}
+		}
+
+		CBitSet Result = Input;
+		Result.Subtract(Kill[Index]);
+		Result.Union(Gen[Index]);
+
+		if (Result == Output) {
+			continue;
+		}
+
+		Output = Result;
+
+		CBasicBlock::BlocksContainer &Targets = Forward ? Block->GetSuccessors() : Block->GetPredecessors();
+
+		for (CBasicBlock::BlocksIterator it = Targets.begin(); it != Targets.end(); ++it) {
+			if ((*it)->GetReachable() && !Queued[(*it)->GetIndex()]) {
+				Queued[(*it)->GetIndex()] = true;
+				Worklist.push_back(*it);
+			}
+		}
+	}
+}
+
+/******************************************************************************
+ * CLiveness
+ ******************************************************************************/
+
+CLiveness::CLiveness(CControlFlowGraph &AGraph) : CDataflowAnalysis(AGraph, false, false)
+{
+	Size = Graph.GetNumbering().GetCount();
+	Escaped = Graph.GetNumbering().GetEscaped();
+	Solve();
+}
+
+/*
+ * Steps backwards over an element: turns the set of variables live after it
+ * into the set of variables live before it.
+ */
+void CLiveness::Transfer(const CBasicBlock::CElement &AElement, CBitSet &ALive) const
+{
+	const CAccesses &Accesses = AElement.Accesses;
+
+	for (unsigned int i = 0; i < Accesses.Defs.size(); i++) {
+		if (!Escaped.Get(Accesses.Defs[i])) {
+			ALive.Reset(Accesses.Defs[i]);
+		}
+	}
+
+	for (unsigned int i = 0; i < Accesses.Uses.size(); i++) {
+		ALive.Set(Accesses.Uses[i]);
+	}
+
+	if (Accesses.Loads || Accesses.Calls) {
+		ALive.Union(Escaped);
+	}
+}
+
+void CLiveness::Initialize()
+{
+	Boundary = Escaped;
+
+	for (CControlFlowGraph::BlocksIterator it = Graph.Begin(); it != Graph.End(); ++it) {
+		CBasicBlock::ElementsContainer &Elements = (*it)->GetElements();
+		CBitSet &BlockGen = Gen[(*it)->GetIndex()];
+		CBitSet &BlockKill = Kill[(*it)->GetIndex()];
+
+		for (CBasicBlock::ElementsContainer::reverse_iterator el = Elements.rbegin(); el != Elements.rend(); ++el) {
+			const CAccesses &Accesses = el->Accesses;
+
+			for (unsigned int i = 0; i < Accesses.Defs.size(); i++) {
+				if (!Escaped.Get(Accesses.Defs[i])) {
+					BlockKill.Set(Accesses.Defs[i]);
+				}
+			}
+
+			Transfer(*el, BlockGen);
+		}
+	}
+}
+
+/******************************************************************************
+ * CReachingDefinitions
+ ******************************************************************************/
+
+CReachingDefinitions::CReachingDefinitions(CControlFlowGraph &AGraph) : CDataflowAnalysis(AGraph, true, false)
+{
+	CVariableNumbering &Numbering = Graph.GetNumbering();
+	unsigned int Variables = Numbering.GetCount();
+
+	for (unsigned int i = 0; i < Variables; i++) {
+		CDefinition Definition = { Graph.GetEntry(), 0, i, false };
+		Definitions.push_back(Definition);
+	}
+
+	ElementDefinitions.resize(Graph.GetSize());
+
+	for (CControlFlowGraph::BlocksIterator it = Graph.Begin(); it != Graph.End(); ++it) {
+		CBasicBlock::ElementsContainer &Elements = (*it)->GetElements();
+		vector<unsigned int> &Starts = ElementDefinitions[(*it)->GetIndex()];
+
+		for (unsigned int el = 0; el < Elements.size(); el++) {
+			const CAccesses &Accesses = Elements[el].Accesses;
+			Starts.push_back(Definitions.size());
+
+			for (unsigned int i = 0; i < Accesses.Defs.size() + Accesses.MayDefs.size(); i++) {
+				bool May = i >= Accesses.Defs.size();
+				unsigned int Variable = May ? Accesses.MayDefs[i - Accesses.Defs.size()] : Accesses.Defs[i];
+
+				if (!Numbering.GetEscaped(Variable)) {
+					CDefinition Definition = { *it, el, Variable, May };
+					Definitions.push_back(Definition);
+				}
+			}
+		}
+
+		Starts.push_back(Definitions.size());
+	}
+
+	Size = Definitions.size();
+
+	VariableDefinitions.assign(Variables, CBitSet(Size));
+	for (unsigned int i = 0; i < Size; i++) {
+		VariableDefinitions[Definitions[i].Variable].Set(i);
+	}
+
+	Solve();
+}
+
+const CReachingDefinitions::CDefinition& CReachingDefinitions::GetDefinition(unsigned int AIndex) const
+{
+	return Definitions[AIndex];
+}
+
+const CBitSet& CReachingDefinitions::GetDefinitions(unsigned int AVariable) const
+{
+	return VariableDefinitions[AVariable];
+}
+
+/*
+ * Steps forward over an element of a block.
+ */
+void CReachingDefinitions::Transfer(CBasicBlock *ABlock, unsigned int AElement, CBitSet &AReaching) const
+{
+	const vector<unsigned int> &Starts = ElementDefinitions[ABlock->GetIndex()];
+
+	for (unsigned int i = Starts[AElement]; i < Starts[AElement + 1]; i++) {
+		if (!Definitions[i].May) {
+			AReaching.Subtract(VariableDefinitions[Definitions[i].Variable]);
+		}
+	}
+
+	for (unsigned int i = Starts[AElement]; i < Starts[AElement + 1]; i++) {
+		AReaching.Set(i);
+	}
+}
+
+void CReachingDefinitions::Initialize()
+{
+	for (unsigned int i = 0; i < Graph.GetNumbering().GetCount(); i++) {
+		Boundary.Set(i);
+	}
+
+	for (CControlFlowGraph::BlocksIterator it = Graph.Begin(); it != Graph.End(); ++it) {
+		unsigned int Index = (*it)->GetIndex();
+
+		for (unsigned int el = 0; el < (*it)->GetElements().size(); el++) {
+			const vector<unsigned int> &Starts = ElementDefinitions[Index];
+
+			for (unsigned int i = Starts[el]; i < Starts[el + 1]; i++) {
+				if (!Definitions[i].May) {
+					Kill[Index].Union(VariableDefinitions[Definitions[i].Variable]);
+				}
+			}
+
+			Transfer(*it, el, Gen[Index]);
+		}
+	}
+}
+
+
+/******************************************************************************
+ * CAvailableExpressions
+ ******************************************************************************/
+
+CAvailableExpressions::CValueKey::CValueKey(EValueKind AKind, int AValue, CSymbol *ASymbol, CTypeSymbol *AType, unsigned int AFirst, unsigned int ASecond, unsigned int AThird)
+	: Kind(AKind), Value(AValue), Symbol(ASymbol), Type(AType)
+{
+	Operands[0] = AFirst;
+	Operands[1] = ASecond;
+	Operands[2] = AThird;
+}
+
+bool CAvailableExpressions::CValueKey::operator<(const CValueKey &AKey) const
+{
+	if (Kind != AKey.Kind) {
+		return Kind < AKey.Kind;
+	} else if (Value != AKey.Value) {
+		return Value < AKey.Value;
+	} else if (Symbol != AKey.Symbol) {
+		return Symbol < AKey.Symbol;
+	} else if (Type != AKey.Type) {
+		return Type < AKey.Type;
+	}
+
+	return lexicographical_compare(Operands, Operands + 3, AKey.Operands, AKey.Operands + 3);
+}
+
+CAvailableExpressions::CAvailableExpressions(CControlFlowGraph &AGraph) : CDataflowAnalysis(AGraph, true, true)
+{
+	CVariableNumbering &Numbering = Graph.GetNumbering();
+
+	Escaped = Numbering.GetEscaped();
+	VariableExpressions.resize(Numbering.GetCount());
+
+	for (CControlFlowGraph::BlocksIterator it = Graph.Begin(); it != Graph.End(); ++it) {
+		CBasicBlock::ElementsContainer &Elements = (*it)->GetElements();
+
+		for (CBasicBlock::ElementsIterator el = Elements.begin(); el != Elements.end(); ++el) {
+			vector<unsigned int> ExprOperands;
+			unsigned int ExprValue;
+			bool ExprLoads = false;
+			Enumerate(el->Expression, ExprValue, ExprOperands, ExprLoads);
+		}
+	}
+
+	Size = Expressions.size();
+
+	for (unsigned int i = 0; i < VariableExpressions.size(); i++) {
+		VariableExpressions[i].Resize(Size);
+	}
+	LoadExpressions.Resize(Size);
+
+	// operands are collected again for the first occurrence of each expression
+	for (unsigned int i = 0; i < Size; i++) {
+		vector<unsigned int> ExprOperands;
+		unsigned int ExprValue;
+		bool ExprLoads = false;
+		Enumerate(Expressions[i], ExprValue, ExprOperands, ExprLoads);
+
+		for (unsigned int j = 0; j < ExprOperands.size(); j++) {
+			VariableExpressions[ExprOperands[j]].Set(i);
+		}
+
+		if (ExprLoads) {
+			LoadExpressions.Set(i);
+		}
+	}
+
+	Solve();
+}
+
+int CAvailableExpressions::GetIndex(CExpression *AExpr) const
+{
+	map<CExpression *, unsigned int>::const_iterator it = Indices.find(AExpr);
+	return (it != Indices.end()) ? it->second : -1;
+}
+
+CExpression* CAvailableExpressions::GetExpression(unsigned int AIndex) const
+{
+	return Expressions[AIndex];
+}
+
+/*
+ * Writes in an element are assumed to happen after all of its evaluations,
+ * so an element doesn't generate the expressions that it kills.
+ */
+void CAvailableExpressions::GetEffect(const CBasicBlock::CElement &AElement, CBitSet &AGen, CBitSet &AKill) const
+{
+	const CAccesses &Accesses = AElement.Accesses;
+	bool Memory = Accesses.Stores || Accesses.Calls;
+
+	for (unsigned int i = 0; i < Accesses.Defs.size() + Accesses.MayDefs.size(); i++) {
+		unsigned int Variable = (i < Accesses.Defs.size()) ? Accesses.Defs[i] : Accesses.MayDefs[i - Accesses.Defs.size()];
+
+		AKill.Union(VariableExpressions[Variable]);
+		Memory = Memory || Escaped.Get(Variable);
+	}
+
+	if (Memory) {
+		AKill.Union(LoadExpressions);
+	}
+
+	Generate(AElement.Expression, false, AGen);
+	AGen.Subtract(AKill);
+}
+
+/*
+ * Steps forward over an element.
+ */
+void CAvailableExpressions::Transfer(const CBasicBlock::CElement &AElement, CBitSet &AAvailable) const
+{
+	CBitSet ElementGen(Size), ElementKill(Size);
+	GetEffect(AElement, ElementGen, ElementKill);
+
+	AAvailable.Subtract(ElementKill);
+	AAvailable.Union(ElementGen);
+}
+
+void CAvailableExpressions::Initialize()
+{
+	CBitSet ElementGen(Size), ElementKill(Size);
+
+	for (CControlFlowGraph::BlocksIterator it = Graph.Begin(); it != Graph.End(); ++it) {
+		CBasicBlock::ElementsContainer &Elements = (*it)->GetElements();
+		CBitSet &BlockGen = Gen[(*it)->GetIndex()];
+		CBitSet &BlockKill = Kill[(*it)->GetIndex()];
+
+		for (CBasicBlock::ElementsIterator el = Elements.begin(); el != Elements.end(); ++el) {
+			ElementGen.Clear();
+			ElementKill.Clear();
+			GetEffect(*el, ElementGen, ElementKill);
+
+			BlockGen.Subtract(ElementKill);
+			BlockGen.Union(ElementGen);
+			BlockKill.Subtract(ElementGen);
+			BlockKill.Union(ElementKill);
+		}
+	}
+}
+
+/*
+ * Numbers the pure operations in an expression and collects the variables
+ * that they read. Returns whether the expression itself is pure, in which
+ * case AValue is its value number.
+ */
+bool CAvailableExpressions::Enumerate(CExpression *AExpr, unsigned int &AValue, vector<unsigned int> &AOperands, bool &ALoads)
+{
+	bool Pure = true;
+	bool Candidate = true;
+	ETokenType Type = AExpr->GetType();
+	CTypeSymbol *ResultType = AExpr->GetResultType();
+	unsigned int Operands[3] = { 0, 0, 0 };
+	EValueKind Kind;
+	CSymbol *Symbol = NULL;
+
+	if (CVariable *Var = dynamic_cast<CVariable *>(AExpr)) {
+		int Index = Graph.GetNumbering().GetIndex(Var->GetSymbol());
+
+		if (Index < 0 || Escaped.Get(Index)) {
+			ALoads = true;
+		} else {
+			AOperands.push_back(Index);
+		}
+
+		AValue = Number(CValueKey(VALUE_VARIABLE, 0, Var->GetSymbol(), NULL));
+		return true;
+	} else if (CIntegerConst *Const = dynamic_cast<CIntegerConst *>(AExpr)) {
+		AValue = Number(CValueKey(VALUE_INTEGER, Const->GetValue(), NULL, ResultType));
+		return true;
+	} else if (CCharConst *Const = dynamic_cast<CCharConst *>(AExpr)) {
+		AValue = Number(CValueKey(VALUE_CHAR, Const->GetValue(), NULL, ResultType));
+		return true;
+	} else if (CFloatConst *Const = dynamic_cast<CFloatConst *>(AExpr)) {
+		float Value = Const->GetValue();
+		AValue = Number(CValueKey(VALUE_FLOAT, *((int32_t *) &Value), NULL, ResultType));
+		return true;
+	} else if (CFunction *Function = dynamic_cast<CFunction *>(AExpr)) {
+		AValue = Number(CValueKey(VALUE_FUNCTION, 0, Function->GetSymbol(), NULL));
+		return true;
+	} else if (dynamic_cast<CFunctionCall *>(AExpr) || dynamic_cast<CPostfixOp *>(AExpr)) {
+		unsigned int Ignored;
+
+		if (CFunctionCall *Call = dynamic_cast<CFunctionCall *>(AExpr)) {
+			for (CFunctionCall::ArgumentsIterator it = Call->Begin(); it != Call->End(); ++it) {
+				Enumerate(*it, Ignored, AOperands, ALoads);
+			}
+		} else {
+			Enumerate(static_cast<CPostfixOp *>(AExpr)->GetArgument(), Ignored, AOperands, ALoads);
+		}
+
+		return false;
+	} else if (CConditionalOp *Op = dynamic_cast<CConditionalOp *>(AExpr)) {
+		Kind = VALUE_CONDITIONAL;
+		Candidate = false;
+		Pure = Enumerate(Op->GetCondition(), Operands[0], AOperands, ALoads);
+		Pure = Enumerate(Op->GetTrueExpr(), Operands[1], AOperands, ALoads) && Pure;
+		Pure = Enumerate(Op->GetFalseExpr(), Operands[2], AOperands, ALoads) && Pure;
+	} else if (CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AExpr)) {
+		Kind = dynamic_cast<CArrayAccess *>(Op) ? VALUE_ELEMENT : VALUE_BINARY;
+		Pure = !TokenTraits::IsAssignment(Type);
+		Candidate = Type != TOKEN_TYPE_SEPARATOR_COMMA && Type != TOKEN_TYPE_OPERATION_LOGIC_AND && Type != TOKEN_TYPE_OPERATION_LOGIC_OR;
+		Pure = Enumerate(Op->GetLeft(), Operands[0], AOperands, ALoads) && Pure;
+		Pure = Enumerate(Op->GetRight(), Operands[1], AOperands, ALoads) && Pure;
+		ALoads = ALoads || Kind == VALUE_ELEMENT;
+
+		if (Kind == VALUE_BINARY && TokenTraits::IsTrivialOperation(Type) && Type != TOKEN_TYPE_OPERATION_MINUS && Operands[0] > Operands[1]) {
+			swap(Operands[0], Operands[1]);
+		}
+	} else if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(AExpr)) {
+		Kind = VALUE_UNARY;
+		Pure = Type != TOKEN_TYPE_OPERATION_INCREMENT && Type != TOKEN_TYPE_OPERATION_DECREMENT;
+
+		if (CAddressOfOp *Address = dynamic_cast<CAddressOfOp *>(Op)) {
+			// the address of a variable is a constant
+			if (CVariable *Var = dynamic_cast<CVariable *>(Address->GetArgument())) {
+				AValue = Number(CValueKey(VALUE_ADDRESS, 0, Var->GetSymbol(), NULL));
+				return true;
+			}
+
+			Kind = VALUE_ADDRESS;
+		} else if (Type == TOKEN_TYPE_OPERATION_ASTERISK) {
+			ALoads = true;
+		}
+
+		Pure = Enumerate(Op->GetArgument(), Operands[0], AOperands, ALoads) && Pure;
+	} else if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		Kind = VALUE_FIELD;
+		Symbol = Access->GetField()->GetSymbol();
+		ALoads = true;
+		Pure = Enumerate(Access->GetStruct(), Operands[0], AOperands, ALoads);
+	} else if (CIndirectAccess *Access = dynamic_cast<CIndirectAccess *>(AExpr)) {
+		Kind = VALUE_INDIRECT;
+		Symbol = Access->GetField()->GetSymbol();
+		ALoads = true;
+		Pure = Enumerate(Access->GetPointer(), Operands[0], AOperands, ALoads);
+	} else {
+		return false;
+	}
+
+	if (!Pure) {
+		return false;
+	}
+
+	AValue = Number(CValueKey(Kind, Type, Symbol, ResultType, Operands[0], Operands[1], Operands[2]));
+
+	if (Candidate && !ResultType->IsVoid()) {
+		if (ValueExpressions[AValue] < 0) {
+			ValueExpressions[AValue] = Expressions.size();
+			Expressions.push_back(AExpr);
+		}
+
+		Indices[AExpr] = ValueExpressions[AValue];
+	}
+
+	return true;
+}
+
+/*
+ * Collects the expressions that are always evaluated as a part of AExpr.
+ */
+void CAvailableExpressions::Generate(CExpression *AExpr, bool AConditional, CBitSet &AGenerated) const
+{
+	ETokenType Type = AExpr->GetType();
+
+	if (CConditionalOp *Op = dynamic_cast<CConditionalOp *>(AExpr)) {
+		Generate(Op->GetCondition(), AConditional, AGenerated);
+		Generate(Op->GetTrueExpr(), true, AGenerated);
+		Generate(Op->GetFalseExpr(), true, AGenerated);
+	} else if (CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AExpr)) {
+		if (TokenTraits::IsAssignment(Type)) {
+			GenerateAddress(Op->GetLeft(), AConditional, AGenerated);
+		} else {
+			Generate(Op->GetLeft(), AConditional, AGenerated);
+		}
+
+		Generate(Op->GetRight(), AConditional || Type == TOKEN_TYPE_OPERATION_LOGIC_AND || Type == TOKEN_TYPE_OPERATION_LOGIC_OR, AGenerated);
+	} else if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(AExpr)) {
+		if (dynamic_cast<CAddressOfOp *>(Op) || dynamic_cast<CPostfixOp *>(Op) || Type == TOKEN_TYPE_OPERATION_INCREMENT || Type == TOKEN_TYPE_OPERATION_DECREMENT) {
+			GenerateAddress(Op->GetArgument(), AConditional, AGenerated);
+		} else {
+			Generate(Op->GetArgument(), AConditional, AGenerated);
+		}
+	} else if (CFunctionCall *Call = dynamic_cast<CFunctionCall *>(AExpr)) {
+		for (CFunctionCall::ArgumentsIterator it = Call->Begin(); it != Call->End(); ++it) {
+			Generate(*it, AConditional, AGenerated);
+		}
+	} else if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		GenerateAddress(Access->GetStruct(), AConditional, AGenerated);
+	} else if (CIndirectAccess *Access = dynamic_cast<CIndirectAccess *>(AExpr)) {
+		Generate(Access->GetPointer(), AConditional, AGenerated);
+	}
+
+	int Index = GetIndex(AExpr);
+
+	if (!AConditional && Index >= 0) {
+		AGenerated.Set(Index);
+	}
+}
+
+/*
+ * Collects the expressions evaluated to find the location of an lvalue, which
+ * itself isn't read.
+ */
+void CAvailableExpressions::GenerateAddress(CExpression *AExpr, bool AConditional, CBitSet &AGenerated) const
+{
+	if (CArrayAccess *Access = dynamic_cast<CArrayAccess *>(AExpr)) {
+		Generate(Access->GetLeft(), AConditional, AGenerated);
+		Generate(Access->GetRight(), AConditional, AGenerated);
+	} else if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		GenerateAddress(Access->GetStruct(), AConditional, AGenerated);
+	} else if (CIndirectAccess *Access = dynamic_cast<CIndirectAccess *>(AExpr)) {
+		Generate(Access->GetPointer(), AConditional, AGenerated);
+	} else if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(AExpr)) {
+		Generate(Op->GetArgument(), AConditional, AGenerated);
+	}
+}
+
+/*
+ * Returns the value number of an operation, giving a new one to an operation
+ * that hasn't been seen yet.
+ */
+unsigned int CAvailableExpressions::Number(const CValueKey &AKey)
+{
+	map<CValueKey, unsigned int>::iterator it = Values.find(AKey);
+
+	if (it != Values.end()) {
+		return it->second;
+	}
+
+	ValueExpressions.push_back(-1);
+	return Values[AKey] = ValueExpressions.size() - 1;
+}
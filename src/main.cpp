@@ -21,6 +21,8 @@
 #include "scanner.h"
 #include "parser.h"
 #include "codegen.h"
+#include "vm.h"
+#include "timereport.h"
 #include "prettyprinting.h"
 
 int main(int argc, char *argv[])
@@ -39,6 +41,15 @@ int main(int argc, char *argv[])
 		return e.GetExitCode();
 	}
 
+	if (Parameters.Target == TARGET_X86_64) {
+		TypeSize::Pointer = 8;
+	}
+
+	CTimeReport Report;
+	if (Parameters.TimeReport != TIME_REPORT_FORMAT_NONE) {
+		CTimeReport::Active = &Report;
+	}
+
 	EExitCode ExitCode = EXIT_CODE_SUCCESS;
 
 	istream *in = &cin;
@@ -48,7 +59,7 @@ int main(int argc, char *argv[])
 
 	ostream *out = &cout;
 	if (!Parameters.OutputFilename.empty() && Parameters.OutputFilename != "-") {
-		out = new ofstream(Parameters.OutputFilename.c_str());
+		out = new ofstream(Parameters.OutputFilename.c_str(), Parameters.Assemble ? ios::out | ios::binary : ios::out);
 	}
 
 	try {
@@ -56,22 +67,31 @@ int main(int argc, char *argv[])
 
 		if (Parameters.CompilerMode == COMPILER_MODE_SCAN) {
 			CScanPrettyPrinter Printer(Scanner);
+			CTimePhase Phase("output");
 			Printer.Output(*out);
 
 		} else if (Parameters.CompilerMode == COMPILER_MODE_PARSE) {
 			CParser Parser(Scanner, Parameters.ParserMode);
 			CParsePrettyPrinter Printer(Parser, Parameters);
+			CTimePhase Phase("output");
 			Printer.Output(*out);
 
 		} else if (Parameters.CompilerMode == COMPILER_MODE_GENERATE) {
 			CParser Parser(Scanner, Parameters.ParserMode);
 			CCodeGenerator Generator(Parser, Parameters);
 			Generator.Output(*out);
+
+		} else if (Parameters.CompilerMode == COMPILER_MODE_RUN) {
+			CParser Parser(Scanner, Parameters.ParserMode);
+			CVirtualMachine Machine(Parser, Parameters);
+			ExitCode = (EExitCode) Machine.Run(*out);
 		}
 
 	} catch (CException &e) {
 		e.Output(cerr);
 		ExitCode = e.GetExitCode();
+	} catch (CFatalException &e) {
+		ExitCode = CLI.Error(e.GetMessage(), e.GetExitCode());
 	}
 
 	if (in != &cin) {
@@ -81,5 +101,9 @@ int main(int argc, char *argv[])
 		delete out;
 	}
 
+	if (CTimeReport::Active) {
+		Report.Output(cerr, Parameters.TimeReport);
+	}
+
 	return ExitCode;
 }
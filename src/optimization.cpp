@@ -19,6 +19,7 @@
 #include "optimization.h"
 
 #include "statements.h"
+#include "timereport.h"
 
 /******************************************************************************
  * CLowLevelOptimization
@@ -36,11 +37,11 @@ CLowLevelOptimization::~CLowLevelOptimization()
  * CLowLevelOptimizer
  ******************************************************************************/
 
-CLowLevelOptimizer::CLowLevelOptimizer(CAsmCode &AAsm)
+CLowLevelOptimizer::CLowLevelOptimizer(CAsmCode &AAsm) : Asm(AAsm), Layout(new CBlockLayout(AAsm))
 {
-	Optimizations.push_back(new CSuperfluousInstructionsRemoval(AAsm));
-	Optimizations.push_back(new CArithmeticInstructionsOptimization(AAsm));
-	Optimizations.push_back(new CJumpsOptimization(AAsm));
+	Optimizations.push_back(new CPeepholeOptimization(AAsm));
+	Optimizations.push_back(new CBranchOptimization(AAsm));
+	Optimizations.push_back(new CLoadStoreOptimization(AAsm));
 }
 
 CLowLevelOptimizer::~CLowLevelOptimizer()
@@ -48,944 +49,7797 @@ CLowLevelOptimizer::~CLowLevelOptimizer()
 	for (OptimizationsIterator it = Optimizations.begin(); it != Optimizations.end(); ++it) {
 		delete *it;
 	}
+
+	delete Layout;
 }
 
+/*
+ * Blocks are laid out once the other optimizations have nothing left to do,
+ * and the code is optimized again after that. Cold labels only keep rarely
+ * executed code in blocks of its own until then.
+ */
 void CLowLevelOptimizer::Optimize()
+{
+	Run();
+
+	bool Changed;
+
+	{
+		CTimePhase Phase(Layout->GetName());
+		Changed = Layout->Optimize();
+	}
+
+	if (Asm.HasColdLabels()) {
+		Asm.ClearColdLabels();
+		Changed = true;
+	}
+
+	if (Changed) {
+		Run();
+	}
+}
+
+/*
+ * Every optimization runs in each round. The peephole optimization only looks
+ * at the code changed since it last ran, so a round after which only the
+ * other ones changed something doesn't rescan the whole code.
+ */
+void CLowLevelOptimizer::Run()
 {
 	bool Optimized;
 	do {
 		Optimized = false;
 		for (OptimizationsIterator it = Optimizations.begin(); it != Optimizations.end(); ++it) {
-			Optimized = Optimized || (*it)->Optimize();
+			CTimePhase Phase((*it)->GetName());
+			Optimized = (*it)->Optimize() || Optimized;
+			Asm.Compact();
 		}
 	} while (Optimized);
 }
 
 /******************************************************************************
- * CSuperfluousInstructionsRemoval
+ * CAsmFlowGraph
  ******************************************************************************/
 
-CSuperfluousInstructionsRemoval::CSuperfluousInstructionsRemoval(CAsmCode &AAsm) : CLowLevelOptimization(AAsm)
+CAsmFlowGraph::CAsmFlowGraph(CAsmCode &AAsm) : Asm(AAsm)
 {
 }
 
-bool CSuperfluousInstructionsRemoval::Optimize()
+void CAsmFlowGraph::Build()
 {
-	bool Optimized = false;
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	unsigned int Size = Asm.End() - Asm.Begin();
+	bool Boundary = true;
+
+	Blocks.clear();
+	Functions.clear();
+	Labels.clear();
+	References.clear();
+
+	for (unsigned int i = 0; i < Size; i++) {
+		const CAsmInstruction &Instruction = Code[i];
 
-	CAsmCode::CodeIterator nit1 = Asm.Begin();
-	CAsmCode::CodeIterator nit2 = ++Asm.Begin();
+		if (Functions.empty() || Instruction.Type == INSTRUCTION_DIRECTIVE) {
+			if (!Functions.empty()) {
+				Functions.back().End = i;
+				Functions.back().LastBlock = Blocks.size();
+			}
 
-	CAsmCode::CodeIterator it1;
-	CAsmCode::CodeIterator it2;
+			unsigned int FirstBlock = Blocks.size();
+			CFunction Function = { i, Size, FirstBlock, 0 };
+			Functions.push_back(Function);
+		}
 
-	bool beginning = false;
+		if (Boundary || Instruction.Type == INSTRUCTION_DIRECTIVE || (Instruction.IsLabel() && !Code[i - 1].IsLabel())) {
+			if (!Blocks.empty()) {
+				Blocks.back().End = i;
+			}
 
-	CAsmCmd1 *cmd1;
-	CAsmCmd1 *cmd2;
+			CBlock Block;
+			Block.Begin = i;
+			Block.End = Size;
+			Block.Function = Functions.size() - 1;
+			Block.Leaves = false;
+			Blocks.push_back(Block);
+		}
 
-	while (nit2 != Asm.End()) {
-		it1 = nit1++;
-		it2 = nit2++;
+		if (Instruction.IsLabel()) {
+			int Label = Instruction.Operands[0].Label;
 
-		cmd1 = dynamic_cast<CAsmCmd1 *>(*it1);
-		cmd2 = dynamic_cast<CAsmCmd1 *>(*it2);
+			if (Label >= int(Labels.size())) {
+				Labels.resize(Label + 1, -1);
+			}
 
-		if (cmd1 && cmd2) {
-			if (cmd1->GetName() == "push" && cmd2->GetName() == "pop" && cmd1->GetOp()->GetText() == cmd2->GetOp()->GetText()) {
-				beginning = (it1 == Asm.Begin());
+			Labels[Label] = Blocks.size() - 1;
+		}
 
-				Asm.Erase(it1);
-				Asm.Erase(it2);
+		Boundary = Instruction.Type == INSTRUCTION_DIRECTIVE || (Instruction.Type == INSTRUCTION_COMMAND &&
+			(IsJump(Instruction.Mnemonic) || Instruction.Mnemonic == RET));
+	}
 
-				if (!beginning) {
-					nit1 = nit2;
-					--nit1;
-				} else {
-					nit1 = nit2++;
+	if (!Functions.empty()) {
+		Functions.back().LastBlock = Blocks.size();
+	}
+
+	Entries.assign(Blocks.size(), false);
+
+	for (vector<CFunction>::iterator it = Functions.begin(); it != Functions.end(); ++it) {
+		Entries[it->FirstBlock] = true;
+	}
+
+	for (unsigned int i = 0; i < Blocks.size(); i++) {
+		CBlock &Block = Blocks[i];
+		int Target = GetTarget(i);
+
+		if (Target >= 0) {
+			Block.Successors.push_back(Target);
+		} else if (IsJump(Code[Block.End - 1].Mnemonic) && Code[Block.End - 1].Type == INSTRUCTION_COMMAND) {
+			Block.Leaves = true;
+		}
+
+		if (GetFalls(i) && i + 1 < Blocks.size()) {
+			Block.Successors.push_back(i + 1);
+		}
+
+		for (vector<unsigned int>::iterator it = Block.Successors.begin(); it != Block.Successors.end(); ++it) {
+			Blocks[*it].Predecessors.push_back(i);
+		}
+
+		// labels are entries if they are global, used other than by a jump or jumped to from another function
+		for (unsigned int j = Block.Begin; j < Block.End; j++) {
+			const CAsmInstruction &Instruction = Code[j];
+
+			if (Instruction.IsLabel()) {
+				if (CAsmCode::GetLabel(Instruction.Operands[0].Label)[0] != '.') {
+					Entries[i] = true;
 				}
-				Optimized = true;
+				continue;
+			} else if (Instruction.Type != INSTRUCTION_COMMAND) {
+				continue;
+			}
 
-			} else if (cmd1->GetName() == "pop" && cmd2->GetName() == "push" && cmd1->GetOp()->IsReg() && cmd1->GetOp()->GetText() == cmd2->GetOp()->GetText()) {
-				Asm.Insert(it1, MOV, mem(0, ESP), cmd2->GetOp());
+			for (unsigned int k = 0; k < Instruction.OperandsCount; k++) {
+				int Label = Instruction.Operands[k].Label;
+				int Found = GetLabelBlock(Label);
 
-				cmd2->SetOp(NULL);
-				Asm.Erase(it1);
-				Asm.Erase(it2);
+				if (Label < 0) {
+					continue;
+				}
 
-				nit1 = nit2++;
-				Optimized = true;
-			} else if (cmd1->GetName() == "push" && cmd2->GetName() == "pop") {
-				if (!cmd1->GetOp()->IsMem() || !cmd2->GetOp()->IsMem()) {
-					Asm.Insert(it1, MOV, cmd1->GetOp(), cmd2->GetOp());
+				if (Label >= int(References.size())) {
+					References.resize(Label + 1, false);
+				}
 
-					cmd1->SetOp(NULL);
-					cmd2->SetOp(NULL);
-					Asm.Erase(it1);
-					Asm.Erase(it2);
+				References[Label] = true;
 
-					nit1 = nit2++;
-					Optimized = true;
+				if (Found >= 0 && (!IsJump(Instruction.Mnemonic) || Blocks[Found].Function != Block.Function)) {
+					Entries[Found] = true;
 				}
 			}
 		}
 	}
-
-	return Optimized;
 }
 
-/******************************************************************************
- * CArithmeticInstructionsOptimization
- ******************************************************************************/
+unsigned int CAsmFlowGraph::GetSize() const
+{
+	return Blocks.size();
+}
 
-CArithmeticInstructionsOptimization::CArithmeticInstructionsOptimization(CAsmCode &AAsm) : CLowLevelOptimization(AAsm)
+const CAsmFlowGraph::CBlock& CAsmFlowGraph::GetBlock(unsigned int AIndex) const
 {
+	return Blocks[AIndex];
 }
 
-bool CArithmeticInstructionsOptimization::Optimize()
+unsigned int CAsmFlowGraph::GetFunctionsCount() const
 {
-	bool Optimized = false;
+	return Functions.size();
+}
 
-	CAsmCode::CodeIterator next = Asm.Begin();
-	CAsmCode::CodeIterator cur;
+const CAsmFlowGraph::CFunction& CAsmFlowGraph::GetFunction(unsigned int AIndex) const
+{
+	return Functions[AIndex];
+}
 
-	CAsmCmd1 *cmd1;
-	CAsmCmd2 *cmd2;
+/*
+ * Returns -1 if the label isn't defined in the code.
+ */
+int CAsmFlowGraph::GetLabelBlock(int ALabel) const
+{
+	return ALabel >= 0 && ALabel < int(Labels.size()) ? Labels[ALabel] : -1;
+}
 
-	while (next != Asm.End()) {
-		cur = next++;
+/*
+ * Block that the jump at the end of a block goes to, or -1 if the block
+ * doesn't end with a jump to a label defined in the code.
+ */
+int CAsmFlowGraph::GetTarget(unsigned int ABlock) const
+{
+	const CAsmInstruction &Last = Asm.Begin()[Blocks[ABlock].End - 1];
 
-		cmd1 = dynamic_cast<CAsmCmd1 *>(*cur);
-		cmd2 = dynamic_cast<CAsmCmd2 *>(*cur);
+	if (Last.Type != INSTRUCTION_COMMAND || !IsJump(Last.Mnemonic) || !Last.Operands[0].IsLabel()) {
+		return -1;
+	}
 
-		if (cmd2 && cmd2->GetOp1()->IsImm()) {
-			CAsmImm *imm = dynamic_cast<CAsmImm *>(cmd2->GetOp1());
+	return GetLabelBlock(Last.Operands[0].Label);
+}
 
-			if (imm->GetValue() == 0) {
-				if (cmd2->GetName() == "add" || cmd2->GetName() == "sub") {
-					Asm.Erase(cur);
-					Optimized = true;
-				} else if (cmd2->GetName() == "imul") {
-					Asm.Insert(cur, MOV, imm, cmd2->GetOp2());
+/*
+ * Whether control can go on from the end of a block to the next one.
+ */
+bool CAsmFlowGraph::GetFalls(unsigned int ABlock) const
+{
+	const CAsmInstruction &Last = Asm.Begin()[Blocks[ABlock].End - 1];
+	return !Last.IsCommand(JMP) && !Last.IsCommand(RET);
+}
 
-					cmd2->SetOp1(NULL);
-					cmd2->SetOp2(NULL);
-					Asm.Erase(cur);
-					Optimized = true;
-				} else if (cmd2->GetName() == "mov" && cmd2->GetOp2()->IsReg()) {
-					CAsmReg *reg = dynamic_cast<CAsmReg *>(cmd2->GetOp2());
+/*
+ * Whether a block can be entered other than through the edges of the graph
+ * inside its function: it starts a function, has a global label, its label
+ * is called or used as a value, or it is jumped to from another function.
+ */
+bool CAsmFlowGraph::IsEntry(unsigned int ABlock) const
+{
+	return Entries[ABlock];
+}
 
-					Asm.Insert(cur, XOR, reg, new CAsmReg(*reg));
+/*
+ * Whether any command refers to the label.
+ */
+bool CAsmFlowGraph::IsReferenced(int ALabel) const
+{
+	return ALabel >= 0 && ALabel < int(References.size()) && References[ALabel];
+}
 
-					cmd2->SetOp2(NULL);
-					Asm.Erase(cur);
-					Optimized = true;
-				}
-			} else if (imm->GetValue() == 1) {
-				if (cmd2->GetName() == "imul" || cmd2->GetName() == "idiv") {
-					Asm.Erase(cur);
-					Optimized = true;
-				}
-			}
-		} else if (cmd1 && cmd1->GetOp()->IsReg()) {
-			if (cmd1->GetName() == "inc") {
-				Asm.Insert(cur, ADD, 1, cmd1->GetOp());
+bool CAsmFlowGraph::IsJump(EMnemonic AMnemonic)
+{
+	return AMnemonic >= JMP && AMnemonic <= JBE;
+}
 
-				cmd1->SetOp(NULL);
-				Asm.Erase(cur);
-				Optimized = true;
-			} else if (cmd1->GetName() == "dec") {
-				Asm.Insert(cur, SUB, 1, cmd1->GetOp());
+bool CAsmFlowGraph::IsConditionalJump(EMnemonic AMnemonic)
+{
+	return AMnemonic > JMP && AMnemonic <= JBE;
+}
 
-				cmd1->SetOp(NULL);
-				Asm.Erase(cur);
-				Optimized = true;
-			}
-		}
+/*
+ * Conditional jump taken exactly when the given one isn't.
+ */
+EMnemonic CAsmFlowGraph::InvertJump(EMnemonic AMnemonic)
+{
+	switch (AMnemonic) {
+	case JE:
+		return JNE;
+	case JNE:
+		return JE;
+	case JL:
+		return JGE;
+	case JGE:
+		return JL;
+	case JG:
+		return JLE;
+	case JLE:
+		return JG;
+	case JA:
+		return JBE;
+	case JBE:
+		return JA;
+	case JB:
+		return JAE;
+	case JAE:
+		return JB;
+	default:
+		return AMnemonic;
 	}
-
-	return Optimized;
 }
 
 /******************************************************************************
- * CJumpsOptimization
+ * CPeepholeOptimization
  ******************************************************************************/
 
-CJumpsOptimization::CJumpsOptimization(CAsmCode &AAsm) : CLowLevelOptimization(AAsm)
-{
+/*
+ * Operands of the rules. X and Y match any operand, R a register, M a memory
+ * operand and N anything else, binding it to the first or the second variable.
+ */
+static const CPeepholeOperand X = { PEEPHOLE_ANY, 0, 0 };
+static const CPeepholeOperand Y = { PEEPHOLE_ANY, 1, 0 };
+static const CPeepholeOperand RX = { PEEPHOLE_REGISTER, 0, 0 };
+static const CPeepholeOperand MX = { PEEPHOLE_MEMORY, 0, 0 };
+static const CPeepholeOperand NX = { PEEPHOLE_NOT_MEMORY, 0, 0 };
+static const CPeepholeOperand NY = { PEEPHOLE_NOT_MEMORY, 1, 0 };
+static const CPeepholeOperand ZERO = { PEEPHOLE_IMMEDIATE, -1, 0 };
+static const CPeepholeOperand ONE = { PEEPHOLE_IMMEDIATE, -1, 1 };
+static const CPeepholeOperand TOP = { PEEPHOLE_STACK_TOP, -1, 0 };
+
+static const CPeepholeRule PeepholeRules[] = {
+	// push x; pop x =>
+	{ { { INSTRUCTION_COMMAND, PUSH, { X } }, { INSTRUCTION_COMMAND, POP, { X } } } },
+	// pop r; push r => mov (%esp), r
+	{ { { INSTRUCTION_COMMAND, POP, { RX } }, { INSTRUCTION_COMMAND, PUSH, { X } } }, { { INSTRUCTION_COMMAND, MOV, { TOP, X } } } },
+	// push x; pop y => mov x, y, unless both are in memory
+	{ { { INSTRUCTION_COMMAND, PUSH, { NX } }, { INSTRUCTION_COMMAND, POP, { Y } } }, { { INSTRUCTION_COMMAND, MOV, { X, Y } } } },
+	{ { { INSTRUCTION_COMMAND, PUSH, { MX } }, { INSTRUCTION_COMMAND, POP, { NY } } }, { { INSTRUCTION_COMMAND, MOV, { X, Y } } } },
+
+	// add $0, x =>
+	{ { { INSTRUCTION_COMMAND, ADD, { ZERO, X } } } },
+	{ { { INSTRUCTION_COMMAND, SUB, { ZERO, X } } } },
+	// imul $0, x => mov $0, x
+	{ { { INSTRUCTION_COMMAND, IMUL, { ZERO, X } } }, { { INSTRUCTION_COMMAND, MOV, { ZERO, X } } } },
+	// mov $0, r => xor r, r
+	{ { { INSTRUCTION_COMMAND, MOV, { ZERO, RX } } }, { { INSTRUCTION_COMMAND, XOR, { X, X } } } },
+	// imul $1, x =>
+	{ { { INSTRUCTION_COMMAND, IMUL, { ONE, X } } } },
+	{ { { INSTRUCTION_COMMAND, IDIV, { ONE, X } } } },
+	// inc r => add $1, r
+	{ { { INSTRUCTION_COMMAND, INC, { RX } } }, { { INSTRUCTION_COMMAND, ADD, { ONE, X } } } },
+	{ { { INSTRUCTION_COMMAND, DEC, { RX } } }, { { INSTRUCTION_COMMAND, SUB, { ONE, X } } } },
+
+	// jmp l; l: => l:
+	{ { { INSTRUCTION_COMMAND, JMP, { X } }, { INSTRUCTION_LABEL, EMnemonic(), { X } } }, { { INSTRUCTION_LABEL, EMnemonic(), { X } } } },
+	// jmp x; jmp y => jmp x
+	{ { { INSTRUCTION_COMMAND, JMP, { X } }, { INSTRUCTION_COMMAND, JMP, { Y } } }, { { INSTRUCTION_COMMAND, JMP, { X } } } },
+};
+
+CPeepholeOptimization::CPeepholeOptimization(CAsmCode &AAsm) : CLowLevelOptimization(AAsm)
+{
+}
+
+const char* CPeepholeOptimization::GetName() const
+{
+	return "peephole optimization";
 }
 
-bool CJumpsOptimization::Optimize()
+/*
+ * Tries the rules on the instructions starting at every position whose window
+ * includes an instruction changed since the last run, in order. After a
+ * rewrite only the positions whose window includes the rewritten instructions
+ * are tried again, so unchanged code isn't looked at twice.
+ */
+bool CPeepholeOptimization::Optimize()
 {
 	bool Optimized = false;
+	unsigned int Pending = 0;
+
+	Worklist.clear();
+	Queued.assign(Asm.End() - Asm.Begin(), false);
+
+	for (CAsmCode::CodeIterator it = Asm.End(); it != Asm.Begin(); ) {
+		if (Asm.IsChanged(--it)) {
+			Pending = CPeepholeRule::Length;
+		}
+
+		if (Pending > 0) {
+			Enqueue(it);
+			Pending--;
+		}
+	}
+
+	WindowContainer Window;
 
-	CAsmCode::CodeIterator nit1 = Asm.Begin();
-	CAsmCode::CodeIterator nit2 = ++Asm.Begin();
+	while (!Worklist.empty()) {
+		CAsmCode::CodeIterator Position = Worklist.back();
+		Worklist.pop_back();
+		Queued[Position - Asm.Begin()] = false;
+
+		if (Position->Type == INSTRUCTION_REMOVED) {
+			continue;
+		}
 
-	CAsmCode::CodeIterator it1;
-	CAsmCode::CodeIterator it2;
+		Window.clear();
+		for (CAsmCode::CodeIterator it = Position; it != Asm.End() && Window.size() < CPeepholeRule::Length; it = Asm.Next(it)) {
+			Window.push_back(it);
+		}
 
-	CAsmCmd1 *cmd1;
-	CAsmLabel *cmd2l;
-	CAsmCmd1 *cmd2j;
+		for (unsigned int i = 0; i < sizeof(PeepholeRules) / sizeof(PeepholeRules[0]); i++) {
+			if (!Match(PeepholeRules[i], Window)) {
+				continue;
+			}
 
-	while (nit2 != Asm.End()) {
-		it1 = nit1++;
-		it2 = nit2++;
+			Rewrite(PeepholeRules[i], Window);
 
-		cmd1 = dynamic_cast<CAsmCmd1 *>(*it1);
-		cmd2l = dynamic_cast<CAsmLabel *>(*it2);
-		cmd2j = dynamic_cast<CAsmCmd1 *>(*it2);
+			for (WindowContainer::reverse_iterator it = Window.rbegin(); it != Window.rend(); ++it) {
+				if ((*it)->Type != INSTRUCTION_REMOVED) {
+					Enqueue(*it);
+				}
+			}
 
-		if (cmd1 && cmd1->GetName() == "jmp") {
-			if (cmd2l && cmd1->GetOp()->GetText() == cmd2l->GetName()) {
-				Asm.Erase(it1);
-				nit1 = nit2++;
-				Optimized = true;
-			} else if (cmd2j && cmd2j->GetName() == "jmp") {
-				Asm.Erase(it2);
-				nit1 = it1;
-				Optimized = true;
+			CAsmCode::CodeIterator Previous = Position;
+			for (unsigned int j = 1; j < CPeepholeRule::Length; j++) {
+				if ((Previous = Asm.Previous(Previous)) == Asm.End()) {
+					break;
+				}
+				Enqueue(Previous);
 			}
+
+			Optimized = true;
+			break;
 		}
 	}
 
+	Asm.ClearChanges();
+
 	return Optimized;
 }
 
-/******************************************************************************
- * CUnreachableCodeElimination
- ******************************************************************************/
-
-void CUnreachableCodeElimination::Visit(CUnaryOp &AStmt)
+bool CPeepholeOptimization::Match(const CPeepholeRule &ARule, const WindowContainer &AWindow)
 {
-}
+	for (unsigned int i = 0; i < CPeepholeRule::Variables; i++) {
+		Bound[i] = false;
+	}
 
-void CUnreachableCodeElimination::Visit(CBinaryOp &AStmt)
-{
-}
+	for (unsigned int i = 0; i < CPeepholeRule::Length && ARule.Pattern[i].Type != INSTRUCTION_REMOVED; i++) {
+		const CPeepholeInstruction &Pattern = ARule.Pattern[i];
 
-void CUnreachableCodeElimination::Visit(CConditionalOp &AStmt)
-{
-}
+		if (i >= AWindow.size() || AWindow[i]->Type != Pattern.Type) {
+			return false;
+		}
 
-void CUnreachableCodeElimination::Visit(CIntegerConst &AStmt)
-{
-}
+		const CAsmInstruction &Instruction = *AWindow[i];
 
-void CUnreachableCodeElimination::Visit(CFloatConst &AStmt)
-{
-}
+		if (Pattern.Type == INSTRUCTION_LABEL) {
+			if (!Match(Pattern.Operands[0], Instruction.Operands[0])) {
+				return false;
+			}
+			continue;
+		}
 
-void CUnreachableCodeElimination::Visit(CCharConst &AStmt)
-{
-}
+		if (Instruction.Mnemonic != Pattern.Mnemonic) {
+			return false;
+		}
 
-void CUnreachableCodeElimination::Visit(CStringConst &AStmt)
-{
-}
+		unsigned int Count = 0;
+		while (Count < 2 && Pattern.Operands[Count].Kind != PEEPHOLE_NONE) {
+			Count++;
+		}
 
-void CUnreachableCodeElimination::Visit(CVariable &AStmt)
-{
-}
+		if (Instruction.OperandsCount != Count) {
+			return false;
+		}
 
-void CUnreachableCodeElimination::Visit(CFunction &AStmt)
-{
-}
+		for (unsigned int j = 0; j < Count; j++) {
+			if (!Match(Pattern.Operands[j], Instruction.Operands[j])) {
+				return false;
+			}
+		}
+	}
 
-void CUnreachableCodeElimination::Visit(CPostfixOp &AStmt)
-{
+	return true;
 }
 
-void CUnreachableCodeElimination::Visit(CFunctionCall &AStmt)
+bool CPeepholeOptimization::Match(const CPeepholeOperand &APattern, const CAsmOperand &AOp)
 {
-}
+	switch (APattern.Kind) {
+	case PEEPHOLE_REGISTER:
+		if (!AOp.IsReg()) {
+			return false;
+		}
+		break;
+	case PEEPHOLE_MEMORY:
+		if (!AOp.IsMem()) {
+			return false;
+		}
+		break;
+	case PEEPHOLE_NOT_MEMORY:
+		if (AOp.IsMem()) {
+			return false;
+		}
+		break;
+	case PEEPHOLE_IMMEDIATE:
+		return AOp.IsImm() && AOp.Value == APattern.Value;
+	case PEEPHOLE_ANY:
+		break;
+	default:
+		return false;
+	}
 
-void CUnreachableCodeElimination::Visit(CStructAccess &AStmt)
-{
-}
+	if (Bound[APattern.Variable]) {
+		return Bindings[APattern.Variable] == AOp;
+	}
 
-void CUnreachableCodeElimination::Visit(CIndirectAccess &AStmt)
-{
-}
+	Bindings[APattern.Variable] = AOp;
+	Bound[APattern.Variable] = true;
 
-void CUnreachableCodeElimination::Visit(CArrayAccess &AStmt)
-{
+	return true;
 }
 
-void CUnreachableCodeElimination::Visit(CNullStatement &AStmt)
+void CPeepholeOptimization::Rewrite(const CPeepholeRule &ARule, const WindowContainer &AWindow)
 {
-}
+	unsigned int Length = 0;
 
-void CUnreachableCodeElimination::Visit(CBlockStatement &AStmt)
-{
-	bool DoNotAct = false;
+	while (Length < CPeepholeRule::Length && ARule.Pattern[Length].Type != INSTRUCTION_REMOVED) {
+		Length++;
+	}
 
-	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
-		if (dynamic_cast<CGotoStatement *>(*it) || dynamic_cast<CLabel *>(*it)) {
-			DoNotAct = true;
+	for (unsigned int i = 0; i < Length; i++) {
+		const CPeepholeInstruction &Rewrite = ARule.Rewrite[i];
+
+		if (Rewrite.Type == INSTRUCTION_REMOVED) {
+			Asm.Remove(AWindow[i]);
+			continue;
 		}
 
-		(*it)->Accept(*this);
+		CAsmInstruction Instruction = CAsmInstruction();
 
-		if (!DoNotAct) {
-			if (dynamic_cast<CReturnStatement *>(*it) || dynamic_cast<CContinueStatement *>(*it) || dynamic_cast<CBreakStatement *>(*it)) {
-				for (CBlockStatement::StatementsIterator dit = ++it; dit != AStmt.End(); ++dit) {
-					delete *dit;
-				}
+		Instruction.Type = Rewrite.Type;
+		Instruction.Mnemonic = Rewrite.Mnemonic;
 
-				AStmt.Erase(it, AStmt.End());
-				break;
-			}
+		while (Instruction.OperandsCount < 2 && Rewrite.Operands[Instruction.OperandsCount].Kind != PEEPHOLE_NONE) {
+			Instruction.Operands[Instruction.OperandsCount] = Substitute(Rewrite.Operands[Instruction.OperandsCount]);
+			Instruction.OperandsCount++;
 		}
+
+		if (Rewrite.Type == INSTRUCTION_LABEL) {
+			Instruction.OperandsCount = 0;
+		}
+
+		Asm.Replace(AWindow[i], Instruction);
 	}
 }
 
-void CUnreachableCodeElimination::Visit(CIfStatement &AStmt)
+CAsmOperand CPeepholeOptimization::Substitute(const CPeepholeOperand &APattern)
 {
-	AStmt.GetThenStatement()->Accept(*this);
-	TryVisit(AStmt.GetElseStatement());
+	if (APattern.Kind == PEEPHOLE_IMMEDIATE) {
+		return imm(APattern.Value);
+	} else if (APattern.Kind == PEEPHOLE_STACK_TOP) {
+		return mem(0, ESP);
+	}
+
+	return Bindings[APattern.Variable];
 }
 
-void CUnreachableCodeElimination::Visit(CForStatement &AStmt)
+void CPeepholeOptimization::Enqueue(CAsmCode::CodeIterator APosition)
 {
-	AStmt.GetBody()->Accept(*this);
+	if (!Queued[APosition - Asm.Begin()]) {
+		Queued[APosition - Asm.Begin()] = true;
+		Worklist.push_back(APosition);
+	}
+}
+
+/******************************************************************************
+ * CLoadStoreOptimization
+ ******************************************************************************/
+
+/*
+ * General purpose registers are tracked by an index shared by the 32-bit and
+ * the 64-bit name, the flags are one more register after them.
+ */
+static const unsigned int TrackedRegisters = 10;
+static const unsigned int StackRegister = 6;
+static const unsigned int FrameRegister = 7;
+static const unsigned int FlagsMask = 1 << TrackedRegisters;
+static const unsigned int AllRegisters = (1 << (TrackedRegisters + 1)) - 1;
+
+static const ERegister NarrowRegisters[] = { EAX, EBX, ECX, EDX, ESI, EDI, ESP, EBP, INVALID_REGISTER, INVALID_REGISTER };
+static const ERegister WideRegisters[] = { RAX, RBX, RCX, RDX, RSI, RDI, RSP, RBP, R8, R9 };
+
+/*
+ * Locations are identified by an area and an offset in it. Globals are areas
+ * of their own, numbered by the interned label.
+ */
+static const int AREA_FRAME = -1;
+static const int AREA_STACK = -2;
+
+static int RegisterIndex(ERegister AReg)
+{
+	switch (AReg) {
+	case EAX:
+	case AX:
+	case RAX:
+		return 0;
+	case EBX:
+	case RBX:
+		return 1;
+	case ECX:
+	case CL:
+	case RCX:
+		return 2;
+	case EDX:
+	case RDX:
+		return 3;
+	case ESI:
+	case RSI:
+		return 4;
+	case EDI:
+	case RDI:
+		return 5;
+	case ESP:
+	case RSP:
+		return StackRegister;
+	case EBP:
+	case RBP:
+		return FrameRegister;
+	case R8:
+		return 8;
+	case R9:
+		return 9;
+	default:
+		return -1;
+	}
 }
 
-void CUnreachableCodeElimination::Visit(CWhileStatement &AStmt)
+static unsigned int RegisterMask(ERegister AReg)
 {
-	AStmt.GetBody()->Accept(*this);
+	int Index = RegisterIndex(AReg);
+	return Index < 0 ? 0 : 1 << Index;
+}
+
+/*
+ * Returns 0 for the registers that are only a part of a tracked one.
+ */
+static unsigned int RegisterWidth(ERegister AReg)
+{
+	if (AReg >= EAX && AReg <= EBP) {
+		return 4;
+	} else if (AReg >= RAX && AReg <= R9) {
+		return 8;
+	}
+
+	return 0;
 }
 
-void CUnreachableCodeElimination::Visit(CDoStatement &AStmt)
+static ERegister RegisterName(unsigned int AIndex, unsigned int AWidth)
 {
-	AStmt.GetBody()->Accept(*this);
+	if (AWidth == 4) {
+		return NarrowRegisters[AIndex];
+	} else if (AWidth == 8) {
+		return WideRegisters[AIndex];
+	}
+
+	return INVALID_REGISTER;
 }
 
-void CUnreachableCodeElimination::Visit(CLabel &AStmt)
+static bool IsStackRegister(ERegister AReg)
 {
-	AStmt.GetNext()->Accept(*this);
+	return AReg == ESP || AReg == RSP;
 }
 
-void CUnreachableCodeElimination::Visit(CCaseLabel &AStmt)
+static bool IsFrameRegister(ERegister AReg)
 {
-	Visit(static_cast<CLabel &>(AStmt));
+	return AReg == EBP || AReg == RBP;
 }
 
-void CUnreachableCodeElimination::Visit(CDefaultCaseLabel &AStmt)
+/*
+ * Registers that are not the stack or frame pointer, whose values are tracked.
+ */
+static bool IsValueRegister(ERegister AReg)
 {
-	Visit(static_cast<CLabel &>(AStmt));
+	int Index = RegisterIndex(AReg);
+	return Index >= 0 && Index != StackRegister && Index != FrameRegister && RegisterWidth(AReg);
 }
 
-void CUnreachableCodeElimination::Visit(CGotoStatement &AStmt)
+static unsigned int AddressMask(const CAsmOperand &AOp)
 {
+	return AOp.IsMem() ? RegisterMask(AOp.Base) | RegisterMask(AOp.Offset) : 0;
 }
 
-void CUnreachableCodeElimination::Visit(CBreakStatement &AStmt)
+static bool IsImmediateLabel(const CAsmOperand &AOp)
 {
+	return AOp.IsLabel() && CAsmCode::GetLabel(AOp.Label)[0] == '$';
 }
 
-void CUnreachableCodeElimination::Visit(CContinueStatement &AStmt)
+static bool IsMemory(const CAsmOperand &AOp)
 {
+	return AOp.IsMem() || (AOp.IsLabel() && !IsImmediateLabel(AOp));
 }
 
-void CUnreachableCodeElimination::Visit(CReturnStatement &AStmt)
+static bool IsStackAdjustment(const CAsmInstruction &AInstruction)
 {
+	return (AInstruction.IsCommand(ADD) || AInstruction.IsCommand(SUB)) && AInstruction.Operands[0].IsImm() &&
+		AInstruction.Operands[1].IsReg() && IsStackRegister(AInstruction.Operands[1].Base);
 }
 
-void CUnreachableCodeElimination::Visit(CSwitchStatement &AStmt)
+static int GetStackAdjustment(const CAsmInstruction &AInstruction)
 {
-	Visit(static_cast<CBlockStatement &>(AStmt));
+	return AInstruction.Mnemonic == ADD ? AInstruction.Operands[0].Value : -AInstruction.Operands[0].Value;
 }
 
-/******************************************************************************
- * CConstantExpressionComputer
- ******************************************************************************/
+CLoadStoreOptimization::CLoadStoreOptimization(CAsmCode &AAsm) : CLowLevelOptimization(AAsm), Graph(AAsm)
+{
+}
 
-void CConstantExpressionComputer::Visit(CUnaryOp &AStmt)
+/*
+ * Values are forwarded block by block first. Pushes and pops, moves to dead
+ * registers and stores to dead locals are then removed using liveness, which
+ * is recomputed after the code changes.
+ */
+const char* CLoadStoreOptimization::GetName() const
 {
-	AStmt.GetArgument()->Accept(*this);
+	return "load and store optimization";
+}
 
-	ETokenType t = AStmt.GetType();
+bool CLoadStoreOptimization::Optimize()
+{
+	bool Optimized = false;
+	bool Paired = false;
 
-	if (t == TOKEN_TYPE_OPERATION_MINUS) {
-		Result = -Result;
-	} else if (t == TOKEN_TYPE_OPERATION_LOGIC_NOT) {
-		Result = !Result;
-	} else if (t == TOKEN_TYPE_OPERATION_BITWISE_NOT) {
-		Result = ~(int)Result;
+	Pointer = Asm.GetTarget() == TARGET_X86_64 ? 8 : 4;
+
+	Graph.Build();
+	FindFrames();
+
+	for (unsigned int i = 0; i < Graph.GetSize(); i++) {
+		Optimized = Forward(Graph.GetBlock(i)) || Optimized;
 	}
-}
 
-void CConstantExpressionComputer::Visit(CBinaryOp &AStmt)
-{
-	AStmt.GetLeft()->Accept(*this);
-	float LHS = Result;
-	AStmt.GetRight()->Accept(*this);
-	float RHS = Result;
+	ComputeLiveness();
 
-	ETokenType t = AStmt.GetType();
+	for (unsigned int i = 0; i < Graph.GetSize(); i++) {
+		Paired = RemovePairs(Graph.GetBlock(i)) || Paired;
+	}
 
-	if (t == TOKEN_TYPE_OPERATION_PLUS) {
-		Result = LHS + RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_MINUS) {
-		Result = LHS - RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_ASTERISK) {
-		Result = LHS * RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_SLASH || t == TOKEN_TYPE_OPERATION_PERCENT) {
-		if (RHS == 0) {
-			throw CParserException("division by zero in constant expression", AStmt.GetPosition());
-		}
+	if (Paired) {
+		ComputeLiveness();
+	}
 
-		if (t == TOKEN_TYPE_OPERATION_SLASH) {
-			Result = LHS / RHS;
-		} else {
-			Result = (int) LHS % (int) RHS;
-		}
-	} else if (t == TOKEN_TYPE_OPERATION_SHIFT_LEFT) {
-		Result = (int) LHS << (int) RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_SHIFT_RIGHT) {
-		Result = (int) LHS >> (int) RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_LESS_THAN) {
-		Result = LHS < RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_LESS_THAN_OR_EQUAL) {
-		Result = LHS <= RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_GREATER_THAN) {
-		Result = LHS > RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_GREATER_THAN_OR_EQUAL) {
-		Result = LHS >= RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_EQUAL) {
-		Result = LHS == RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_NOT_EQUAL) {
-		Result = LHS != RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_LOGIC_AND) {
-		Result = LHS && RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_LOGIC_OR) {
-		Result = LHS || RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_BITWISE_OR) {
-		Result = (int) LHS | (int) RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_BITWISE_XOR) {
-		Result = (int) LHS ^ (int) RHS;
-	} else if (t == TOKEN_TYPE_OPERATION_AMPERSAND) {
-		Result = (int) LHS & (int) RHS;
-	} else if (t == TOKEN_TYPE_SEPARATOR_COMMA) {
-		Result = RHS;
+	for (unsigned int i = 0; i < Graph.GetSize(); i++) {
+		Optimized = RemoveDeadCode(i) || Optimized;
 	}
 
-	if (!AStmt.GetResultType()->IsFloat()) {
-		Result = (int) Result;
+	for (unsigned int i = 0; i < Graph.GetFunctionsCount(); i++) {
+		Optimized = RemoveDeadStores(i) || Optimized;
 	}
+
+	return Optimized || Paired;
 }
 
-void CConstantExpressionComputer::Visit(CConditionalOp &AStmt)
+/*
+ * A function has a frame if it sets the frame pointer, and its frame escapes
+ * if the frame pointer is used as anything but a base register.
+ */
+void CLoadStoreOptimization::FindFrames()
 {
-	AStmt.GetCondition()->Accept(*this);
-	if (Result) {
-		AStmt.GetTrueExpr()->Accept(*this);
+	CAsmCode::CodeIterator Code = Asm.Begin();
+
+	Frames.clear();
+
+	for (unsigned int f = 0; f < Graph.GetFunctionsCount(); f++) {
+		const CAsmFlowGraph::CFunction &Function = Graph.GetFunction(f);
+		CFrame Frame = { false, false, 0, 0 };
+
+		for (unsigned int i = Function.Begin; i < Function.End; i++) {
+			const CAsmInstruction &Instruction = Code[i];
+			const CAsmOperand *Ops = Instruction.Operands;
+
+			if (Instruction.Type != INSTRUCTION_COMMAND) {
+				continue;
+			}
+
+			if (Instruction.Mnemonic == MOV && Ops[0].IsReg() && Ops[1].IsReg()) {
+				if (IsStackRegister(Ops[0].Base) && IsFrameRegister(Ops[1].Base)) {
+					Frame.Frame = true;
+					continue;
+				} else if (IsFrameRegister(Ops[0].Base) && IsStackRegister(Ops[1].Base)) {
+					continue;
+				}
+			}
+
+			if ((Instruction.Mnemonic == PUSH || Instruction.Mnemonic == POP) && Ops[0].IsReg() && IsFrameRegister(Ops[0].Base)) {
+				continue;
+			}
+
+			for (unsigned int j = 0; j < Instruction.OperandsCount; j++) {
+				if ((Ops[j].IsReg() && IsFrameRegister(Ops[j].Base)) || (Ops[j].IsMem() && IsFrameRegister(Ops[j].Offset))) {
+					Frame.Escaped = true;
+				}
+
+				if (!Ops[j].IsMem() || !IsFrameRegister(Ops[j].Base) || Ops[j].Label >= 0) {
+					continue;
+				}
+
+				if (Instruction.Mnemonic == LEA) {
+					Frame.Escaped = true;
+				}
+
+				unsigned int Width = GetWidth(Instruction);
+
+				Frame.Low = min(Frame.Low, Ops[j].Value);
+				Frame.High = max(Frame.High, Ops[j].Value + int(Width ? Width : 16));
+			}
+		}
+
+		Frames.push_back(Frame);
+	}
+}
+
+/*
+ * Registers live at the end of every instruction. Jumps out of the code make
+ * everything live. Each function is solved over its own blocks, last one
+ * first, so a jump to a later function sees the registers live at its target
+ * and any other edge out of the function makes everything live.
+ */
+void CLoadStoreOptimization::ComputeLiveness()
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	CEffects Effects;
+	vector<unsigned int> Uses(Graph.GetSize(), 0);
+	vector<unsigned int> Defs(Graph.GetSize(), 0);
+	bool Changed;
+
+	LiveIn.assign(Graph.GetSize(), 0);
+	LiveOut.assign(Graph.GetSize(), 0);
+
+	for (unsigned int i = 0; i < Graph.GetSize(); i++) {
+		const CAsmFlowGraph::CBlock &Block = Graph.GetBlock(i);
+
+		for (unsigned int j = Block.End; j-- > Block.Begin; ) {
+			GetEffects(Code[j], Effects);
+			Uses[i] = (Uses[i] & ~Effects.Defs) | Effects.Uses;
+			Defs[i] |= Effects.Defs;
+		}
+	}
+
+	for (unsigned int f = Graph.GetFunctionsCount(); f-- > 0; ) {
+		const CAsmFlowGraph::CFunction &Function = Graph.GetFunction(f);
+
+		do {
+			Changed = false;
+
+			for (unsigned int i = Function.LastBlock; i-- > Function.FirstBlock; ) {
+				const CAsmFlowGraph::CBlock &Block = Graph.GetBlock(i);
+				unsigned int Out = Block.Leaves ? AllRegisters : 0;
+
+				for (vector<unsigned int>::const_iterator it = Block.Successors.begin(); it != Block.Successors.end(); ++it) {
+					Out |= *it < Function.FirstBlock ? AllRegisters : LiveIn[*it];
+				}
+
+				unsigned int In = (Out & ~Defs[i]) | Uses[i];
+
+				if (In != LiveIn[i] || Out != LiveOut[i]) {
+					LiveIn[i] = In;
+					LiveOut[i] = Out;
+					Changed = true;
+				}
+			}
+		} while (Changed);
+	}
+
+	Live.assign(Asm.End() - Asm.Begin(), 0);
+
+	for (unsigned int i = 0; i < Graph.GetSize(); i++) {
+		const CAsmFlowGraph::CBlock &Block = Graph.GetBlock(i);
+		unsigned int Alive = LiveOut[i];
+
+		for (unsigned int j = Block.End; j-- > Block.Begin; ) {
+			Live[j] = Alive;
+			GetEffects(Code[j], Effects);
+			Alive = (Alive & ~Effects.Defs) | Effects.Uses;
+		}
+	}
+}
+
+/*
+ * Registers and memory operands that a command reads and writes. A partial
+ * register write also reads the register. Calls read the registers that pass
+ * arguments and clobber all but the stack and frame pointers.
+ */
+void CLoadStoreOptimization::GetEffects(const CAsmInstruction &AInstruction, CEffects &AEffects)
+{
+	const CAsmOperand *Ops = AInstruction.Operands;
+	bool Flags = false;
+
+	AEffects.Uses = AEffects.Defs = 0;
+	AEffects.Reads[0] = AEffects.Reads[1] = false;
+	AEffects.Writes[0] = AEffects.Writes[1] = false;
+	AEffects.Size = 0;
+	AEffects.Call = AEffects.Barrier = false;
+
+	if (AInstruction.Type != INSTRUCTION_COMMAND) {
+		return;
+	}
+
+	switch (AInstruction.Mnemonic) {
+	case MOV:
+	case MOVSLQ:
+	case MOVD:
+	case MOVSS:
+	case MOVDQA:
+	case MOVDQU:
+	case MOVUPS:
+		AEffects.Reads[0] = AEffects.Writes[1] = true;
+		break;
+	case LEA:
+		AEffects.Writes[1] = true;
+		break;
+	case ADD:
+	case SUB:
+	case AND:
+	case OR:
+	case XOR:
+	case SAL:
+	case SAR:
+	case SHR:
+		Flags = true;
+		// fall through
+	case PXOR:
+	case PADDD:
+	case PSUBD:
+	case PAND:
+	case POR:
+	case PUNPCKLDQ:
+	case PUNPCKLQDQ:
+	case PSRLDQ:
+	case PSRLQ:
+	case ADDPS:
+	case SUBPS:
+	case MULPS:
+	case DIVPS:
+		AEffects.Reads[0] = AEffects.Reads[1] = AEffects.Writes[1] = true;
+		if ((AInstruction.Mnemonic == XOR || AInstruction.Mnemonic == PXOR) && Ops[0].IsReg() && Ops[0] == Ops[1]) {
+			AEffects.Reads[0] = AEffects.Reads[1] = false;
+		}
+		// a shift by a zero count leaves the flags
+		if (Ops[0].IsReg() && Ops[0].Base == CL) {
+			AEffects.Uses |= FlagsMask;
+		}
+		break;
+	case IMUL:
+		if (AInstruction.OperandsCount == 2) {
+			AEffects.Reads[0] = AEffects.Reads[1] = AEffects.Writes[1] = true;
+			Flags = true;
+			break;
+		}
+		// fall through
+	case MUL:
+		AEffects.Reads[0] = true;
+		AEffects.Uses |= RegisterMask(EAX);
+		AEffects.Defs |= RegisterMask(EAX) | RegisterMask(EDX);
+		Flags = true;
+		break;
+	case IDIV:
+	case DIV:
+		AEffects.Reads[0] = true;
+		AEffects.Uses |= RegisterMask(EAX) | RegisterMask(EDX);
+		AEffects.Defs |= RegisterMask(EAX) | RegisterMask(EDX);
+		Flags = true;
+		break;
+	case CMP:
+		AEffects.Reads[0] = AEffects.Reads[1] = true;
+		Flags = true;
+		break;
+	case ADC:
+		AEffects.Reads[0] = AEffects.Reads[1] = AEffects.Writes[1] = true;
+		AEffects.Uses |= FlagsMask;
+		Flags = true;
+		break;
+	case INC:
+	case DEC:
+	case NEG:
+		Flags = true;
+		// fall through
+	case NOT:
+		AEffects.Reads[0] = AEffects.Writes[0] = true;
+		break;
+	case PUSH:
+		AEffects.Reads[0] = true;
+		AEffects.Uses |= RegisterMask(ESP);
+		AEffects.Defs |= RegisterMask(ESP);
+		break;
+	case POP:
+		AEffects.Writes[0] = true;
+		AEffects.Uses |= RegisterMask(ESP);
+		AEffects.Defs |= RegisterMask(ESP);
+		break;
+	case CDQ:
+		AEffects.Uses |= RegisterMask(EAX);
+		AEffects.Defs |= RegisterMask(EDX);
+		break;
+	case CLTQ:
+		AEffects.Uses |= RegisterMask(EAX);
+		AEffects.Defs |= RegisterMask(EAX);
+		break;
+	case SAHF:
+		AEffects.Uses |= RegisterMask(EAX);
+		Flags = true;
+		break;
+	case FLD:
+	case FILD:
+	case FADD:
+	case FSUBR:
+	case FMUL:
+	case FDIVR:
+	case FCOMP:
+		AEffects.Reads[0] = true;
+		break;
+	case FSTP:
+	case FISTTP:
+	case FSTSW:
+		AEffects.Writes[0] = true;
+		break;
+	case FCHS:
+	case FLD1:
+	case FTST:
+	case FCOMPP:
+		break;
+	case CALL:
+		AEffects.Call = true;
+		AEffects.Uses = RegisterMask(ECX) | RegisterMask(EDX);
+		if (Pointer == 8) {
+			AEffects.Uses |= RegisterMask(RDI) | RegisterMask(RSI) | RegisterMask(R8) | RegisterMask(R9) | RegisterMask(RAX);
+		}
+		AEffects.Defs = AllRegisters & ~RegisterMask(ESP) & ~RegisterMask(EBP);
+		return;
+	case RET:
+		AEffects.Uses = RegisterMask(EAX) | RegisterMask(ESP) | RegisterMask(EBP);
+		return;
+	case JMP:
+		return;
+	case JE:
+	case JNE:
+	case JL:
+	case JG:
+	case JLE:
+	case JGE:
+	case JA:
+	case JB:
+	case JAE:
+	case JBE:
+		AEffects.Uses = FlagsMask;
+		return;
+	default:
+		AEffects.Barrier = true;
+		AEffects.Uses = AEffects.Defs = AllRegisters;
+		return;
+	}
+
+	if (Flags) {
+		AEffects.Defs |= FlagsMask;
+	}
+
+	for (unsigned int i = 0; i < AInstruction.OperandsCount; i++) {
+		if (!Ops[i].IsReg()) {
+			AEffects.Uses |= AddressMask(Ops[i]);
+			continue;
+		}
+
+		unsigned int Mask = RegisterMask(Ops[i].Base);
+
+		if (AEffects.Reads[i] || (AEffects.Writes[i] && !RegisterWidth(Ops[i].Base))) {
+			AEffects.Uses |= Mask;
+		}
+		if (AEffects.Writes[i]) {
+			AEffects.Defs |= Mask;
+		}
+	}
+
+	AEffects.Size = GetWidth(AInstruction);
+}
+
+/*
+ * Number of bytes a command accesses through its memory operand, 0 if it is
+ * not known.
+ */
+unsigned int CLoadStoreOptimization::GetWidth(const CAsmInstruction &AInstruction)
+{
+	switch (AInstruction.Mnemonic) {
+	case PUSH:
+	case POP:
+		return Pointer;
+	case MOVSLQ:
+	case MOVD:
+	case MOVSS:
+	case FLD:
+	case FILD:
+	case FSTP:
+	case FISTTP:
+	case FADD:
+	case FSUBR:
+	case FMUL:
+	case FDIVR:
+	case FCOMP:
+		return 4;
+	case MOVDQA:
+	case MOVDQU:
+	case MOVUPS:
+	case PXOR:
+	case PADDD:
+	case PSUBD:
+	case PAND:
+	case POR:
+	case PUNPCKLDQ:
+	case PUNPCKLQDQ:
+	case ADDPS:
+	case SUBPS:
+	case MULPS:
+	case DIVPS:
+		return 16;
+	case MOV:
+	case ADD:
+	case ADC:
+	case SUB:
+	case AND:
+	case OR:
+	case XOR:
+	case CMP:
+	case IMUL:
+		for (unsigned int i = 0; i < AInstruction.OperandsCount; i++) {
+			if (AInstruction.Operands[i].IsReg()) {
+				return RegisterWidth(AInstruction.Operands[i].Base);
+			}
+		}
+		return 0;
+	default:
+		return 0;
+	}
+}
+
+/*
+ * Numbers the values of registers and memory locations along the block. Loads
+ * of locations whose value is in a register or is a constant are replaced
+ * with the register or the constant, registers holding addresses of known
+ * locations are folded into memory operands, and moves of a value to where it
+ * already is are removed.
+ */
+bool CLoadStoreOptimization::Forward(const CAsmFlowGraph::CBlock &ABlock)
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	CEffects Effects;
+	bool Changed = false;
+
+	Reset(ABlock);
+
+	for (unsigned int i = ABlock.Begin; i < ABlock.End; i++) {
+		const CAsmInstruction &Instruction = Code[i];
+
+		if (Instruction.Type != INSTRUCTION_COMMAND) {
+			continue;
+		}
+
+		GetEffects(Instruction, Effects);
+
+		if (!Effects.Barrier && !Effects.Call && !CAsmFlowGraph::IsJump(Instruction.Mnemonic)) {
+			CAsmInstruction Rewritten = Instruction;
+			bool Rewrote = false;
+
+			// pop computes a stack pointer based address after the pop
+			for (unsigned int j = 0; j < Rewritten.OperandsCount && Rewritten.Mnemonic != POP; j++) {
+				if (Rewritten.Operands[j].IsMem()) {
+					Rewrote = Fold(Rewritten.Operands[j]) || Rewrote;
+				}
+			}
+
+			Rewrote = Substitute(Rewritten, Effects.Size) || Rewrote;
+
+			if (Rewrote) {
+				Asm.Replace(Code + i, Rewritten);
+				GetEffects(Instruction, Effects);
+				Changed = true;
+			}
+
+			if (Instruction.Mnemonic == MOV) {
+				const CAsmOperand &Target = Instruction.Operands[1];
+				unsigned int Value = Peek(Instruction.Operands[0], Effects.Size);
+				int Area, Offset, Slot;
+				bool Redundant = false;
+
+				if (Value && Target.IsReg()) {
+					int Index = RegisterIndex(Target.Base);
+					Redundant = IsValueRegister(Target.Base) && RegisterValues[Index] == Value && RegisterWidths[Index] == RegisterWidth(Target.Base);
+				} else if (Value && Effects.Size && Classify(Target, Area, Offset) && (Slot = FindSlot(Area, Offset, Effects.Size)) >= 0) {
+					Redundant = Slots[Slot].Value == Value;
+				}
+
+				if (Redundant) {
+					Asm.Remove(Code + i);
+					Changed = true;
+					continue;
+				}
+			}
+		}
+
+		Transfer(Instruction, Effects);
+	}
+
+	return Changed;
+}
+
+void CLoadStoreOptimization::Reset(const CAsmFlowGraph::CBlock &ABlock)
+{
+	Values.assign(1, CValue());
+	Constants.clear();
+	Addresses.clear();
+
+	RegisterValues.assign(TrackedRegisters, 0);
+	RegisterWidths.assign(TrackedRegisters, 0);
+	Copies.assign(TrackedRegisters, -1);
+	Slots.clear();
+
+	Depth = 0;
+	DepthKnown = true;
+	Frame = FrameKnown = Frames[ABlock.Function].Frame;
+}
+
+/*
+ * Finds the location of a memory operand without an index. Stack offsets are
+ * relative to the stack pointer at the start of the block.
+ */
+bool CLoadStoreOptimization::Classify(const CAsmOperand &AOp, int &AArea, int &AOffset)
+{
+	if (AOp.IsLabel()) {
+		if (IsImmediateLabel(AOp)) {
+			return false;
+		}
+
+		AArea = AOp.Label;
+		AOffset = 0;
+		return true;
+	}
+
+	if (!AOp.IsMem() || AOp.Offset != INVALID_REGISTER) {
+		return false;
+	}
+
+	if (AOp.Label >= 0) {
+		if (AOp.Base != INVALID_REGISTER && AOp.Base != RIP) {
+			return false;
+		}
+
+		AArea = AOp.Label;
+		AOffset = AOp.Value;
+		return true;
+	}
+
+	if (IsFrameRegister(AOp.Base) && FrameKnown) {
+		AArea = AREA_FRAME;
+		AOffset = AOp.Value;
+		return true;
+	}
+
+	if (IsStackRegister(AOp.Base) && DepthKnown) {
+		AArea = AREA_STACK;
+		AOffset = AOp.Value + Depth;
+		return true;
+	}
+
+	return false;
+}
+
+/*
+ * Replaces address registers with the registers they were copied from, and a
+ * base register holding the address of a known location with the location.
+ */
+bool CLoadStoreOptimization::Fold(CAsmOperand &AOp)
+{
+	ERegister *Registers[] = { &AOp.Base, &AOp.Offset };
+	bool Folded = false;
+
+	for (unsigned int i = 0; i < 2; i++) {
+		if (!IsValueRegister(*Registers[i])) {
+			continue;
+		}
+
+		int Index = RegisterIndex(*Registers[i]);
+		int Copy = Copies[Index];
+		unsigned int Width = RegisterWidth(*Registers[i]);
+
+		if (Copy >= 0 && RegisterValues[Index] && RegisterValues[Copy] == RegisterValues[Index] &&
+			RegisterWidths[Copy] == Width && RegisterWidths[Index] == Width && RegisterName(Copy, Width) != INVALID_REGISTER) {
+			*Registers[i] = RegisterName(Copy, Width);
+			Folded = true;
+		}
+	}
+
+	if (AOp.Label >= 0 || !IsValueRegister(AOp.Base)) {
+		return Folded;
+	}
+
+	int Index = RegisterIndex(AOp.Base);
+
+	if (!RegisterValues[Index] || RegisterWidths[Index] != RegisterWidth(AOp.Base) || !Values[RegisterValues[Index]].Address) {
+		return Folded;
+	}
+
+	const CValue &Value = Values[RegisterValues[Index]];
+
+	if (Value.Area == AREA_FRAME) {
+		AOp.Base = Pointer == 8 ? RBP : EBP;
+		AOp.Value += Value.Offset;
+	} else if (Value.Area == AREA_STACK) {
+		AOp.Base = Pointer == 8 ? RSP : ESP;
+		AOp.Value += Value.Offset - Depth;
 	} else {
-		AStmt.GetFalseExpr()->Accept(*this);
+		// RIP-relative operands take no index
+		if (Pointer == 8 && AOp.Offset != INVALID_REGISTER) {
+			return Folded;
+		}
+
+		AOp.Base = Pointer == 8 ? RIP : INVALID_REGISTER;
+		AOp.Label = Value.Area;
+		AOp.Value += Value.Offset;
 	}
+
+	return true;
 }
 
-void CConstantExpressionComputer::Visit(CIntegerConst &AStmt)
+/*
+ * Replaces the source operand of a command that can take either a register, a
+ * memory operand or an immediate with a register holding its value or with
+ * the value itself if it is a constant. Register sources are replaced with the
+ * registers they were copied from.
+ */
+bool CLoadStoreOptimization::Substitute(CAsmInstruction &AInstruction, unsigned int AWidth)
+{
+	switch (AInstruction.Mnemonic) {
+	case MOV:
+	case PUSH:
+	case ADD:
+	case SUB:
+	case AND:
+	case OR:
+	case XOR:
+	case CMP:
+	case MOVSLQ:
+		break;
+	case IMUL:
+		if (AInstruction.OperandsCount == 2) {
+			break;
+		}
+		return false;
+	default:
+		return false;
+	}
+
+	CAsmOperand &Source = AInstruction.Operands[0];
+	const CAsmOperand &Target = AInstruction.Operands[1];
+	bool Immediate = AInstruction.Mnemonic == PUSH || (AInstruction.Mnemonic != MOVSLQ && Target.IsReg());
+
+	if (Source.IsReg()) {
+		if (!IsValueRegister(Source.Base) || (AInstruction.OperandsCount == 2 && Source == Target)) {
+			return false;
+		}
+
+		int Index = RegisterIndex(Source.Base);
+		int Copy = Copies[Index];
+		unsigned int Width = RegisterWidth(Source.Base);
+
+		if (Copy < 0 || !RegisterValues[Index] || RegisterValues[Copy] != RegisterValues[Index] ||
+			RegisterWidths[Copy] != Width || RegisterWidths[Index] != Width || RegisterName(Copy, Width) == INVALID_REGISTER) {
+			return false;
+		}
+
+		Source = reg(RegisterName(Copy, Width));
+		return true;
+	}
+
+	if (!IsMemory(Source) || !AWidth) {
+		return false;
+	}
+
+	unsigned int Value = Peek(Source, AWidth);
+
+	if (!Value) {
+		return false;
+	}
+
+	for (unsigned int i = 0; i < TrackedRegisters; i++) {
+		if (i != StackRegister && i != FrameRegister && RegisterValues[i] == Value && RegisterWidths[i] == AWidth &&
+			RegisterName(i, AWidth) != INVALID_REGISTER) {
+			Source = reg(RegisterName(i, AWidth));
+			return true;
+		}
+	}
+
+	if (Values[Value].Constant && Immediate) {
+		Source = imm(Values[Value].Number);
+		return true;
+	}
+
+	return false;
+}
+
+void CLoadStoreOptimization::Transfer(const CAsmInstruction &AInstruction, const CEffects &AEffects)
 {
-	Result = AStmt.GetValue();
+	const CAsmOperand *Ops = AInstruction.Operands;
+	int Area, Offset;
+
+	if (AEffects.Barrier) {
+		RegisterValues.assign(TrackedRegisters, 0);
+		Slots.clear();
+		DepthKnown = FrameKnown = false;
+		return;
+	}
+
+	if (AEffects.Call) {
+		Slots.clear();
+	}
+
+	switch (AInstruction.Mnemonic) {
+	case PUSH:
+		{
+			unsigned int Value = Evaluate(Ops[0], Pointer);
+
+			if (DepthKnown) {
+				Depth -= Pointer;
+				Store(AREA_STACK, Depth, Pointer, Value);
+			}
+		}
+		return;
+	case POP:
+		{
+			unsigned int Value = 0;
+
+			if (DepthKnown) {
+				int Slot = FindSlot(AREA_STACK, Depth, Pointer);
+				Value = Slot < 0 ? 0 : Slots[Slot].Value;
+				Depth += Pointer;
+				Release();
+			}
+
+			Write(Ops[0], Pointer, Value ? Value : NewValue());
+		}
+		return;
+	case ADD:
+	case SUB:
+		if (IsStackAdjustment(AInstruction)) {
+			if (DepthKnown) {
+				Depth += GetStackAdjustment(AInstruction);
+				Release();
+			}
+			return;
+		}
+		break;
+	case MOV:
+		if (Ops[0].IsReg() && Ops[1].IsReg() && IsStackRegister(Ops[0].Base) && IsFrameRegister(Ops[1].Base)) {
+			FrameKnown = true;
+			InvalidateArea(AREA_FRAME);
+			return;
+		}
+
+		Write(Ops[1], AEffects.Size, Evaluate(Ops[0], AEffects.Size));
+
+		if (Ops[0].IsReg() && Ops[1].IsReg() && IsValueRegister(Ops[0].Base) && IsValueRegister(Ops[1].Base) &&
+			RegisterWidth(Ops[0].Base) == RegisterWidth(Ops[1].Base)) {
+			int Source = RegisterIndex(Ops[0].Base);
+			Copies[RegisterIndex(Ops[1].Base)] = Copies[Source] < 0 ? Source : Copies[Source];
+		}
+		return;
+	case LEA:
+		Write(Ops[1], 0, Classify(Ops[0], Area, Offset) ? AddressValue(Area, Offset) : NewValue());
+		return;
+	case XOR:
+		if (Ops[0].IsReg() && Ops[0] == Ops[1] && IsValueRegister(Ops[1].Base)) {
+			Write(Ops[1], 0, ConstantValue(0, RegisterWidth(Ops[1].Base)));
+			return;
+		}
+		break;
+	default:
+		break;
+	}
+
+	for (unsigned int i = 0; i < AInstruction.OperandsCount; i++) {
+		if (AEffects.Writes[i] && IsMemory(Ops[i])) {
+			if (Classify(Ops[i], Area, Offset)) {
+				Invalidate(Area, Offset, AEffects.Size ? AEffects.Size : 16);
+			} else {
+				InvalidateMemory();
+			}
+		}
+	}
+
+	for (unsigned int i = 0; i < TrackedRegisters; i++) {
+		if (!(AEffects.Defs & (1 << i))) {
+			continue;
+		}
+
+		if (i == StackRegister) {
+			DepthKnown = false;
+			InvalidateArea(AREA_STACK);
+		} else if (i == FrameRegister) {
+			FrameKnown = false;
+			InvalidateArea(AREA_FRAME);
+		} else {
+			Forget(i);
+		}
+	}
 }
 
-void CConstantExpressionComputer::Visit(CFloatConst &AStmt)
+/*
+ * Returns the known value of an operand, 0 if there is none.
+ */
+unsigned int CLoadStoreOptimization::Peek(const CAsmOperand &AOp, unsigned int AWidth)
+{
+	int Area, Offset, Slot;
+
+	if (AOp.IsImm()) {
+		return ConstantValue(AOp.Value, AWidth);
+	} else if (IsImmediateLabel(AOp)) {
+		return AddressValue(CAsmCode::Intern(CAsmCode::GetLabel(AOp.Label).substr(1)), 0);
+	} else if (AOp.IsReg()) {
+		int Index = RegisterIndex(AOp.Base);
+		if (!IsValueRegister(AOp.Base) || RegisterWidths[Index] != RegisterWidth(AOp.Base)) {
+			return 0;
+		}
+		return RegisterValues[Index];
+	} else if (AWidth && Classify(AOp, Area, Offset) && (Slot = FindSlot(Area, Offset, AWidth)) >= 0) {
+		return Slots[Slot].Value;
+	}
+
+	return 0;
+}
+
+/*
+ * Returns the value of an operand, giving a new one to a register or a
+ * location whose value is not known, so that its later reads get the same.
+ */
+unsigned int CLoadStoreOptimization::Evaluate(const CAsmOperand &AOp, unsigned int AWidth)
 {
-	Result = AStmt.GetValue();
+	unsigned int Value = Peek(AOp, AWidth);
+	int Area, Offset;
+
+	if (Value) {
+		return Value;
+	}
+
+	Value = NewValue();
+
+	if (AOp.IsReg() && IsValueRegister(AOp.Base)) {
+		Assign(AOp.Base, Value);
+	} else if (AWidth && Classify(AOp, Area, Offset)) {
+		Store(Area, Offset, AWidth, Value);
+	}
+
+	return Value;
 }
 
-void CConstantExpressionComputer::Visit(CCharConst &AStmt)
+void CLoadStoreOptimization::Assign(ERegister AReg, unsigned int AValue)
+{
+	int Index = RegisterIndex(AReg);
+
+	Forget(Index);
+
+	RegisterValues[Index] = AValue;
+	RegisterWidths[Index] = RegisterWidth(AReg);
+}
+
+/*
+ * Forgets the value of a register and that other registers are its copies.
+ */
+void CLoadStoreOptimization::Forget(unsigned int AIndex)
+{
+	RegisterValues[AIndex] = 0;
+	Copies[AIndex] = -1;
+
+	for (unsigned int i = 0; i < TrackedRegisters; i++) {
+		if (Copies[i] == int(AIndex)) {
+			Copies[i] = -1;
+		}
+	}
+}
+
+/*
+ * Records a write of a value of the given size, 0 if it is not known, to a
+ * register or memory.
+ */
+void CLoadStoreOptimization::Write(const CAsmOperand &AOp, unsigned int ASize, unsigned int AValue)
+{
+	int Area, Offset;
+
+	if (AOp.IsReg()) {
+		if (IsStackRegister(AOp.Base)) {
+			DepthKnown = false;
+			InvalidateArea(AREA_STACK);
+		} else if (IsFrameRegister(AOp.Base)) {
+			FrameKnown = false;
+			InvalidateArea(AREA_FRAME);
+		} else if (RegisterIndex(AOp.Base) >= 0) {
+			Assign(AOp.Base, AValue);
+		}
+	} else if (!Classify(AOp, Area, Offset)) {
+		InvalidateMemory();
+	} else if (ASize) {
+		Store(Area, Offset, ASize, AValue);
+	} else {
+		Invalidate(Area, Offset, 16);
+	}
+}
+
+void CLoadStoreOptimization::Store(int AArea, int AOffset, unsigned int ASize, unsigned int AValue)
+{
+	Invalidate(AArea, AOffset, ASize);
+
+	CSlot Slot = { AArea, AOffset, ASize, AValue };
+	Slots.push_back(Slot);
+}
+
+void CLoadStoreOptimization::Invalidate(int AArea, int AOffset, unsigned int ASize)
+{
+	for (unsigned int i = 0; i < Slots.size(); ) {
+		if (Slots[i].Area == AArea && Slots[i].Offset < AOffset + int(ASize) && AOffset < Slots[i].Offset + int(Slots[i].Size)) {
+			Slots[i] = Slots.back();
+			Slots.pop_back();
+		} else {
+			i++;
+		}
+	}
+}
+
+/*
+ * A write through an unknown pointer may change any location but temporaries
+ * pushed below the frame, which have no address.
+ */
+void CLoadStoreOptimization::InvalidateMemory()
+{
+	for (unsigned int i = 0; i < Slots.size(); ) {
+		if (!Frame || Slots[i].Area != AREA_STACK) {
+			Slots[i] = Slots.back();
+			Slots.pop_back();
+		} else {
+			i++;
+		}
+	}
+}
+
+/*
+ * Forgets the locations relative to a stack or frame pointer that changed,
+ * and that the values of their addresses are such.
+ */
+void CLoadStoreOptimization::InvalidateArea(int AArea)
+{
+	for (unsigned int i = 0; i < Slots.size(); ) {
+		if (Slots[i].Area == AArea) {
+			Slots[i] = Slots.back();
+			Slots.pop_back();
+		} else {
+			i++;
+		}
+	}
+
+	for (vector<CValue>::iterator it = Values.begin(); it != Values.end(); ++it) {
+		if (it->Address && it->Area == AArea) {
+			it->Address = false;
+			Addresses.erase(make_pair(it->Area, it->Offset));
+		}
+	}
+}
+
+/*
+ * Forgets the slots below the stack pointer.
+ */
+void CLoadStoreOptimization::Release()
+{
+	for (unsigned int i = 0; i < Slots.size(); ) {
+		if (Slots[i].Area == AREA_STACK && Slots[i].Offset < Depth) {
+			Slots[i] = Slots.back();
+			Slots.pop_back();
+		} else {
+			i++;
+		}
+	}
+}
+
+int CLoadStoreOptimization::FindSlot(int AArea, int AOffset, unsigned int ASize)
+{
+	for (unsigned int i = 0; i < Slots.size(); i++) {
+		if (Slots[i].Area == AArea && Slots[i].Offset == AOffset && Slots[i].Size == ASize) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+unsigned int CLoadStoreOptimization::NewValue()
+{
+	Values.push_back(CValue());
+	return Values.size() - 1;
+}
+
+unsigned int CLoadStoreOptimization::ConstantValue(int AValue, unsigned int AWidth)
+{
+	if (!AWidth) {
+		return 0;
+	}
+
+	pair<int, unsigned int> Key(AValue, AWidth);
+	map<pair<int, unsigned int>, unsigned int>::iterator it = Constants.find(Key);
+
+	if (it != Constants.end()) {
+		return it->second;
+	}
+
+	unsigned int Value = NewValue();
+	Values[Value].Constant = true;
+	Values[Value].Number = AValue;
+
+	return Constants[Key] = Value;
+}
+
+unsigned int CLoadStoreOptimization::AddressValue(int AArea, int AOffset)
+{
+	pair<int, int> Key(AArea, AOffset);
+	map<pair<int, int>, unsigned int>::iterator it = Addresses.find(Key);
+
+	if (it != Addresses.end()) {
+		return it->second;
+	}
+
+	unsigned int Value = NewValue();
+	Values[Value].Address = true;
+	Values[Value].Area = AArea;
+	Values[Value].Offset = AOffset;
+
+	return Addresses[Key] = Value;
+}
+
+/*
+ * Pushes are matched with the pops at the same stack depth.
+ */
+bool CLoadStoreOptimization::RemovePairs(const CAsmFlowGraph::CBlock &ABlock)
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	vector<pair<unsigned int, int> > Pushes;
+	CEffects Effects;
+	int Offset = 0;
+	bool Changed = false;
+
+	for (unsigned int i = ABlock.Begin; i < ABlock.End; i++) {
+		const CAsmInstruction &Instruction = Code[i];
+
+		if (Instruction.Type != INSTRUCTION_COMMAND) {
+			continue;
+		}
+
+		if (Instruction.Mnemonic == PUSH) {
+			Offset -= Pointer;
+			Pushes.push_back(make_pair(i, Offset));
+		} else if (Instruction.Mnemonic == POP) {
+			if (!Pushes.empty() && Pushes.back().second == Offset) {
+				Changed = RemovePair(Pushes.back().first, i) || Changed;
+				Pushes.pop_back();
+			} else {
+				Pushes.clear();
+			}
+			Offset += Pointer;
+		} else if (IsStackAdjustment(Instruction)) {
+			Offset += GetStackAdjustment(Instruction);
+			while (!Pushes.empty() && Pushes.back().second < Offset) {
+				Pushes.pop_back();
+			}
+		} else {
+			GetEffects(Instruction, Effects);
+			if (Effects.Barrier || (Effects.Defs & RegisterMask(ESP))) {
+				Pushes.clear();
+			}
+		}
+	}
+
+	return Changed;
+}
+
+/*
+ * Removes a push and the pop of the same slot if the popped register is dead
+ * or gets the value it had, or else replaces them with a move if the pushed
+ * operand doesn't change in between. Nothing in between may access the slot
+ * or use the stack pointer other than as a base register; the operands above
+ * the slot get one slot closer to the stack pointer.
+ */
+bool CLoadStoreOptimization::RemovePair(unsigned int APush, unsigned int APop)
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	CAsmOperand Source = Code[APush].Operands[0];
+	CAsmOperand Target = Code[APop].Operands[0];
+
+	if (!Target.IsReg() || !IsValueRegister(Target.Base)) {
+		return false;
+	}
+
+	if ((Source.IsReg() && (IsStackRegister(Source.Base) || IsFrameRegister(Source.Base))) ||
+		(Source.IsMem() && (IsStackRegister(Source.Offset) || (IsStackRegister(Source.Base) && Source.Value < 0)))) {
+		return false;
+	}
+
+	unsigned int SourceMask = Source.IsReg() ? RegisterMask(Source.Base) : AddressMask(Source);
+	bool Unchanged = true;
+	int Offset = -int(Pointer);
+	vector<pair<unsigned int, unsigned int> > Adjusted;
+	CEffects Effects;
+
+	for (unsigned int i = APush + 1; i < APop; i++) {
+		const CAsmInstruction &Instruction = Code[i];
+
+		if (Instruction.Type != INSTRUCTION_COMMAND) {
+			continue;
+		}
+
+		GetEffects(Instruction, Effects);
+
+		if (Effects.Call || Effects.Barrier) {
+			return false;
+		}
+
+		if (Effects.Defs & SourceMask) {
+			Unchanged = false;
+		}
+
+		for (unsigned int j = 0; j < Instruction.OperandsCount; j++) {
+			const CAsmOperand &Op = Instruction.Operands[j];
+
+			if (Effects.Writes[j] && !Op.IsReg() && IsMemory(Source)) {
+				Unchanged = false;
+			}
+
+			if (Op.IsReg() && IsStackRegister(Op.Base) && !IsStackAdjustment(Instruction)) {
+				return false;
+			}
+
+			if (!Op.IsMem() || (!IsStackRegister(Op.Base) && !IsStackRegister(Op.Offset))) {
+				continue;
+			}
+
+			if (Op.Offset != INVALID_REGISTER || Instruction.Mnemonic == POP) {
+				return false;
+			}
+
+			int Address = Offset + Op.Value;
+
+			if (Address >= 0) {
+				Adjusted.push_back(make_pair(i, j));
+			} else if (Instruction.Mnemonic == LEA || Address + int(Effects.Size ? Effects.Size : 16) > -int(Pointer)) {
+				return false;
+			}
+		}
+
+		if (Instruction.Mnemonic == PUSH) {
+			Offset -= Pointer;
+		} else if (Instruction.Mnemonic == POP) {
+			Offset += Pointer;
+		} else if (IsStackAdjustment(Instruction)) {
+			Offset += GetStackAdjustment(Instruction);
+		} else if (Effects.Defs & RegisterMask(ESP)) {
+			return false;
+		}
+
+		if (Offset > -int(Pointer)) {
+			return false;
+		}
+	}
+
+	bool Dead = !(Live[APop] & RegisterMask(Target.Base));
+
+	if (!Dead && !Unchanged) {
+		return false;
+	}
+
+	for (vector<pair<unsigned int, unsigned int> >::iterator it = Adjusted.begin(); it != Adjusted.end(); ++it) {
+		Code[it->first].Operands[it->second].Value -= Pointer;
+	}
+
+	Asm.Remove(Code + APush);
+
+	if (Dead || Source == Target) {
+		Asm.Remove(Code + APop);
+	} else {
+		CAsmInstruction Move = Code[APop];
+		Move.Mnemonic = MOV;
+		Move.OperandsCount = 2;
+		Move.Operands[0] = Source;
+		Move.Operands[1] = Target;
+		Asm.Replace(Code + APop, Move);
+	}
+
+	return true;
+}
+
+/*
+ * Removes moves and arithmetic whose destination register and flags are dead.
+ */
+bool CLoadStoreOptimization::RemoveDeadCode(unsigned int ABlock)
+{
+	const CAsmFlowGraph::CBlock &Block = Graph.GetBlock(ABlock);
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	unsigned int Alive = LiveOut[ABlock];
+	CEffects Effects;
+	bool Changed = false;
+
+	for (unsigned int i = Block.End; i-- > Block.Begin; ) {
+		const CAsmInstruction &Instruction = Code[i];
+		bool Removable = false;
+
+		if (Instruction.Type != INSTRUCTION_COMMAND) {
+			continue;
+		}
+
+		GetEffects(Instruction, Effects);
+
+		switch (Instruction.Mnemonic) {
+		case MOV:
+		case LEA:
+		case MOVSLQ:
+		case MOVD:
+		case ADD:
+		case SUB:
+		case AND:
+		case OR:
+		case XOR:
+		case SAL:
+		case SAR:
+		case SHR:
+		case INC:
+		case DEC:
+		case NEG:
+		case NOT:
+			Removable = true;
+			break;
+		case IMUL:
+			Removable = Instruction.OperandsCount == 2;
+			break;
+		default:
+			break;
+		}
+
+		const CAsmOperand &Target = Instruction.Operands[Instruction.OperandsCount - 1];
+
+		if (Removable && Target.IsReg() && IsValueRegister(Target.Base) && !(Effects.Defs & Alive)) {
+			Asm.Remove(Code + i);
+			Changed = true;
+			continue;
+		}
+
+		Alive = (Alive & ~Effects.Defs) | Effects.Uses;
+	}
+
+	return Changed;
+}
+
+/*
+ * Removes stores to locals of a function whose frame doesn't escape that are
+ * not read before they are overwritten or the function returns. Liveness is
+ * tracked per byte of the frame.
+ */
+bool CLoadStoreOptimization::RemoveDeadStores(unsigned int AFunction)
+{
+	const CAsmFlowGraph::CFunction &Function = Graph.GetFunction(AFunction);
+	const CFrame &Frame = Frames[AFunction];
+
+	if (!Frame.Frame || Frame.Escaped || Frame.High <= Frame.Low) {
+		return false;
+	}
+
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	vector<CBitSet> In(Function.LastBlock - Function.FirstBlock, CBitSet(Frame.High - Frame.Low));
+	CBitSet Alive;
+	CEffects Effects;
+	bool Changed;
+
+	do {
+		Changed = false;
+
+		for (unsigned int i = Function.LastBlock; i-- > Function.FirstBlock; ) {
+			const CAsmFlowGraph::CBlock &Block = Graph.GetBlock(i);
+
+			GetFrameLive(Function, i, In, Alive);
+
+			for (unsigned int j = Block.End; j-- > Block.Begin; ) {
+				GetEffects(Code[j], Effects);
+				GetFrameAccess(Frame, Code[j], Effects, Alive);
+			}
+
+			if (Alive != In[i - Function.FirstBlock]) {
+				In[i - Function.FirstBlock] = Alive;
+				Changed = true;
+			}
+		}
+	} while (Changed);
+
+	for (unsigned int i = Function.FirstBlock; i < Function.LastBlock; i++) {
+		const CAsmFlowGraph::CBlock &Block = Graph.GetBlock(i);
+
+		GetFrameLive(Function, i, In, Alive);
+
+		for (unsigned int j = Block.End; j-- > Block.Begin; ) {
+			const CAsmInstruction &Instruction = Code[j];
+			const CAsmOperand &Target = Instruction.Operands[1];
+
+			GetEffects(Instruction, Effects);
+
+			if ((Instruction.IsCommand(MOV) || Instruction.IsCommand(MOVSS) || Instruction.IsCommand(MOVD)) && Effects.Size &&
+				Target.IsMem() && IsFrameRegister(Target.Base) && Target.Offset == INVALID_REGISTER && Target.Label < 0) {
+				bool Dead = Target.Value >= Frame.Low && Target.Value + int(Effects.Size) <= Frame.High;
+
+				for (unsigned int k = 0; Dead && k < Effects.Size; k++) {
+					Dead = !Alive.Get(Target.Value + k - Frame.Low);
+				}
+
+				if (Dead) {
+					Asm.Remove(Code + j);
+					Changed = true;
+					continue;
+				}
+			}
+
+			GetFrameAccess(Frame, Instruction, Effects, Alive);
+		}
+	}
+
+	return Changed;
+}
+
+/*
+ * Frame bytes live at the end of a block, from the ones live at the start of
+ * the blocks of the function, which AIn holds from its first block on.
+ * Everything is live where control leaves the function other than by
+ * returning.
+ */
+void CLoadStoreOptimization::GetFrameLive(const CAsmFlowGraph::CFunction &AFunction, unsigned int ABlock, const vector<CBitSet> &AIn, CBitSet &ALive)
+{
+	const CAsmFlowGraph::CBlock &Block = Graph.GetBlock(ABlock);
+
+	ALive.Resize(AIn[ABlock - AFunction.FirstBlock].GetSize());
+
+	if (Block.Leaves || (Block.Successors.empty() && !Asm.Begin()[Block.End - 1].IsCommand(RET))) {
+		ALive.Fill();
+		return;
+	}
+
+	for (vector<unsigned int>::const_iterator it = Block.Successors.begin(); it != Block.Successors.end(); ++it) {
+		if (Graph.GetBlock(*it).Function != Block.Function) {
+			ALive.Fill();
+			return;
+		}
+		ALive.Union(AIn[*it - AFunction.FirstBlock]);
+	}
+}
+
+/*
+ * Moves frame liveness back over a command. Stores of a known size kill the
+ * bytes they write, reads make them live, and a read with an index makes the
+ * whole frame live. When the frame pointer changes, only the arguments may
+ * still be read, by a function jumped to.
+ */
+void CLoadStoreOptimization::GetFrameAccess(const CFrame &AFrame, const CAsmInstruction &AInstruction, const CEffects &AEffects, CBitSet &ALive)
+{
+	if (AInstruction.Type != INSTRUCTION_COMMAND) {
+		return;
+	}
+
+	if (AEffects.Barrier) {
+		ALive.Fill();
+		return;
+	} else if (AInstruction.Mnemonic == RET) {
+		ALive.Clear();
+		return;
+	} else if (AEffects.Defs & RegisterMask(EBP)) {
+		ALive.Clear();
+		for (int i = max(AFrame.Low, 0); i < AFrame.High; i++) {
+			ALive.Set(i - AFrame.Low);
+		}
+		return;
+	}
+
+	for (unsigned int i = 0; i < AInstruction.OperandsCount; i++) {
+		const CAsmOperand &Op = AInstruction.Operands[i];
+
+		if (!Op.IsMem() || !IsFrameRegister(Op.Base) || Op.Label >= 0 || Op.Offset != INVALID_REGISTER) {
+			continue;
+		}
+
+		if (AEffects.Writes[i] && !AEffects.Reads[i] && AEffects.Size) {
+			for (int j = max(Op.Value, AFrame.Low); j < min(Op.Value + int(AEffects.Size), AFrame.High); j++) {
+				ALive.Reset(j - AFrame.Low);
+			}
+		}
+	}
+
+	for (unsigned int i = 0; i < AInstruction.OperandsCount; i++) {
+		const CAsmOperand &Op = AInstruction.Operands[i];
+
+		if (!Op.IsMem() || !IsFrameRegister(Op.Base) || Op.Label >= 0 || !AEffects.Reads[i]) {
+			continue;
+		}
+
+		if (Op.Offset != INVALID_REGISTER) {
+			ALive.Fill();
+			continue;
+		}
+
+		int Size = AEffects.Size ? AEffects.Size : 16;
+
+		for (int j = max(Op.Value, AFrame.Low); j < min(Op.Value + Size, AFrame.High); j++) {
+			ALive.Set(j - AFrame.Low);
+		}
+	}
+}
+
+/******************************************************************************
+ * CBranchOptimization
+ ******************************************************************************/
+
+CBranchOptimization::CBranchOptimization(CAsmCode &AAsm) : CLowLevelOptimization(AAsm), Graph(AAsm)
+{
+}
+
+const char* CBranchOptimization::GetName() const
+{
+	return "branch optimization";
+}
+
+bool CBranchOptimization::Optimize()
+{
+	bool Optimized = false;
+
+	Graph.Build();
+
+	if (ThreadJumps()) {
+		Graph.Build();
+		Optimized = true;
+	}
+
+	if (RemoveJumps()) {
+		Asm.Compact();
+		Graph.Build();
+		Optimized = true;
+	}
+
+	if (RemoveUnreachable()) {
+		Asm.Compact();
+		Graph.Build();
+		Optimized = true;
+	}
+
+	return RemoveLabels() || Optimized;
+}
+
+/*
+ * Jumps to a block that only jumps further are redirected to where the chain
+ * of such blocks ends.
+ */
+bool CBranchOptimization::ThreadJumps()
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	bool Changed = false;
+
+	for (unsigned int i = 0; i < Graph.GetSize(); i++) {
+		const CAsmInstruction &Jump = Code[Graph.GetBlock(i).End - 1];
+		int Target = Graph.GetTarget(i);
+		int Label;
+
+		if (Target < 0 || Graph.GetBlock(Target).Function != Graph.GetBlock(i).Function) {
+			continue;
+		}
+
+		if ((Label = Resolve(Target)) >= 0 && Label != Jump.Operands[0].Label) {
+			CAsmInstruction Threaded = Jump;
+			Threaded.Operands[0] = label(CAsmCode::GetLabel(Label));
+			Asm.Replace(Code + Graph.GetBlock(i).End - 1, Threaded);
+			Changed = true;
+		}
+	}
+
+	return Changed;
+}
+
+/*
+ * Removes jumps to the next block and conditional jumps over an
+ * unconditional one, which is then replaced by the inverted conditional jump.
+ */
+bool CBranchOptimization::RemoveJumps()
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	bool Changed = false;
+
+	for (unsigned int i = 0; i < Graph.GetSize(); i++) {
+		const CAsmFlowGraph::CBlock &Block = Graph.GetBlock(i);
+		const CAsmInstruction &Jump = Code[Block.End - 1];
+		int Target = Graph.GetTarget(i);
+
+		if (Target < 0) {
+			continue;
+		}
+
+		if (Target == int(i) + 1) {
+			Asm.Remove(Code + Block.End - 1);
+			Changed = true;
+			continue;
+		}
+
+		if (!CAsmFlowGraph::IsConditionalJump(Jump.Mnemonic) || Target != int(i) + 2) {
+			continue;
+		}
+
+		const CAsmFlowGraph::CBlock &Next = Graph.GetBlock(i + 1);
+		int Over = Graph.GetTarget(i + 1);
+
+		// the jump jumped over can be reached only from this block if it has no label
+		if (Next.End != Next.Begin + 1 || !Code[Next.Begin].IsCommand(JMP) || Over < 0 || Graph.GetBlock(Over).Function != Block.Function) {
+			continue;
+		}
+
+		CAsmInstruction Inverted = Jump;
+		Inverted.Mnemonic = CAsmFlowGraph::InvertJump(Jump.Mnemonic);
+		Inverted.Operands[0] = Code[Next.Begin].Operands[0];
+
+		Asm.Replace(Code + Block.End - 1, Inverted);
+		Asm.Remove(Code + Next.Begin);
+		Changed = true;
+		i++;
+	}
+
+	return Changed;
+}
+
+bool CBranchOptimization::RemoveUnreachable()
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	vector<bool> Reachable(Graph.GetSize(), false);
+	vector<unsigned int> Worklist;
+	bool Changed = false;
+
+	for (unsigned int i = 0; i < Graph.GetSize(); i++) {
+		if (Graph.IsEntry(i)) {
+			Reachable[i] = true;
+			Worklist.push_back(i);
+		}
+	}
+
+	while (!Worklist.empty()) {
+		const CAsmFlowGraph::CBlock &Block = Graph.GetBlock(Worklist.back());
+		Worklist.pop_back();
+
+		for (vector<unsigned int>::const_iterator it = Block.Successors.begin(); it != Block.Successors.end(); ++it) {
+			if (!Reachable[*it]) {
+				Reachable[*it] = true;
+				Worklist.push_back(*it);
+			}
+		}
+	}
+
+	for (unsigned int i = 0; i < Graph.GetSize(); i++) {
+		if (Reachable[i]) {
+			continue;
+		}
+
+		for (unsigned int j = Graph.GetBlock(i).Begin; j < Graph.GetBlock(i).End; j++) {
+			Asm.Remove(Code + j);
+		}
+
+		Changed = true;
+	}
+
+	return Changed;
+}
+
+/*
+ * Local labels that nothing refers to are removed, so that the blocks they
+ * separated are merged. Cold labels are kept for the layout.
+ */
+bool CBranchOptimization::RemoveLabels()
+{
+	bool Changed = false;
+
+	for (CAsmCode::CodeIterator it = Asm.Begin(); it != Asm.End(); ++it) {
+		int Label = it->IsLabel() ? it->Operands[0].Label : -1;
+
+		if (Label >= 0 && CAsmCode::GetLabel(Label)[0] == '.' && !Graph.IsReferenced(Label) && !Asm.IsCold(Label)) {
+			Asm.Remove(it);
+			Changed = true;
+		}
+	}
+
+	return Changed;
+}
+
+/*
+ * Whether a block consists only of labels and a jump to a label.
+ */
+bool CBranchOptimization::IsTrivial(unsigned int ABlock)
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	const CAsmFlowGraph::CBlock &Block = Graph.GetBlock(ABlock);
+
+	if (!Code[Block.End - 1].IsCommand(JMP) || !Code[Block.End - 1].Operands[0].IsLabel()) {
+		return false;
+	}
+
+	for (unsigned int i = Block.Begin; i < Block.End - 1; i++) {
+		if (!Code[i].IsLabel()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * Label that a jump to a block can go to instead, past the blocks that only
+ * jump further in the same function. Returns -1 if there is none or if such
+ * blocks form a cycle.
+ */
+int CBranchOptimization::Resolve(unsigned int ABlock)
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	unsigned int Function = Graph.GetBlock(ABlock).Function;
+	unsigned int Block = ABlock;
+	set<unsigned int> Visited;
+	int Label = -1;
+
+	while (IsTrivial(Block)) {
+		int Target = Graph.GetTarget(Block);
+
+		if (!Visited.insert(Block).second) {
+			return -1;
+		} else if (Target < 0 || Graph.GetBlock(Target).Function != Function) {
+			break;
+		}
+
+		Label = Code[Graph.GetBlock(Block).End - 1].Operands[0].Label;
+		Block = Target;
+	}
+
+	return Label;
+}
+
+/******************************************************************************
+ * CBlockLayout
+ ******************************************************************************/
+
+CBlockLayout::CBlockLayout(CAsmCode &AAsm) : CLowLevelOptimization(AAsm), Graph(AAsm)
+{
+}
+
+const char* CBlockLayout::GetName() const
+{
+	return "block layout";
+}
+
+bool CBlockLayout::Optimize()
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	CAsmCode::CodeContainer Result;
+	vector<unsigned int> Order;
+	bool Changed = false;
+
+	Graph.Build();
+
+	Labels.assign(Graph.GetSize(), -1);
+
+	for (unsigned int i = 0; i < Graph.GetSize(); i++) {
+		if (Code[Graph.GetBlock(i).Begin].IsLabel()) {
+			Labels[i] = Code[Graph.GetBlock(i).Begin].Operands[0].Label;
+		}
+	}
+
+	for (unsigned int i = 0; i < Graph.GetFunctionsCount(); i++) {
+		const CAsmFlowGraph::CFunction &Function = Graph.GetFunction(i);
+
+		if (Arrange(Function, Order)) {
+			Emit(Function, Order, Result);
+			Changed = true;
+		} else {
+			Result.insert(Result.end(), Code + Function.Begin, Code + Function.End);
+		}
+	}
+
+	if (Changed) {
+		Asm.Swap(Result);
+	}
+
+	return Changed;
+}
+
+/*
+ * Depth of every block in the natural loops of a function. Back edges are
+ * found by a depth-first search from the entries, and a loop consists of
+ * the blocks that reach the source of a back edge without passing its
+ * target, the header.
+ */
+void CBlockLayout::FindLoops(const CAsmFlowGraph::CFunction &AFunction)
+{
+	unsigned int First = AFunction.FirstBlock;
+	unsigned int Last = AFunction.LastBlock;
+	vector<unsigned int> State(Last - First, 0);
+	vector<pair<unsigned int, unsigned int> > Stack;
+	map<unsigned int, set<unsigned int> > Loops;
+
+	Depths.assign(Last - First, 0);
+	Rotated.assign(Last - First, false);
+	BackEdges.clear();
+
+	for (unsigned int i = First; i < Last; i++) {
+		if (!Graph.IsEntry(i) || State[i - First]) {
+			continue;
+		}
+
+		State[i - First] = 1;
+		Stack.push_back(make_pair(i, 0));
+
+		while (!Stack.empty()) {
+			unsigned int Block = Stack.back().first;
+			const vector<unsigned int> &Successors = Graph.GetBlock(Block).Successors;
+
+			if (Stack.back().second == Successors.size()) {
+				State[Block - First] = 2;
+				Stack.pop_back();
+				continue;
+			}
+
+			unsigned int Successor = Successors[Stack.back().second++];
+
+			if (Successor < First || Successor >= Last) {
+				continue;
+			} else if (State[Successor - First] == 1) {
+				BackEdges.insert(make_pair(Block, Successor));
+			} else if (State[Successor - First] == 0) {
+				State[Successor - First] = 1;
+				Stack.push_back(make_pair(Successor, 0));
+			}
+		}
+	}
+
+	for (set<pair<unsigned int, unsigned int> >::iterator it = BackEdges.begin(); it != BackEdges.end(); ++it) {
+		set<unsigned int> &Loop = Loops[it->second];
+		vector<unsigned int> Worklist;
+
+		Loop.insert(it->second);
+
+		if (Loop.insert(it->first).second) {
+			Worklist.push_back(it->first);
+		}
+
+		while (!Worklist.empty()) {
+			const vector<unsigned int> &Predecessors = Graph.GetBlock(Worklist.back()).Predecessors;
+			Worklist.pop_back();
+
+			for (vector<unsigned int>::const_iterator jt = Predecessors.begin(); jt != Predecessors.end(); ++jt) {
+				if (*jt >= First && *jt < Last && Loop.insert(*jt).second) {
+					Worklist.push_back(*jt);
+				}
+			}
+		}
+
+		const CAsmInstruction &Test = Asm.Begin()[Graph.GetBlock(it->second).End - 1];
+		Rotated[it->second - First] = Test.Type == INSTRUCTION_COMMAND && CAsmFlowGraph::IsConditionalJump(Test.Mnemonic);
+	}
+
+	for (map<unsigned int, set<unsigned int> >::iterator it = Loops.begin(); it != Loops.end(); ++it) {
+		for (set<unsigned int>::iterator jt = it->second.begin(); jt != it->second.end(); ++jt) {
+			Depths[*jt - First]++;
+		}
+	}
+}
+
+/*
+ * Blocks that start with cold labels only, and blocks without labels that
+ * are entered only from a cold block falling through.
+ */
+void CBlockLayout::FindCold(const CAsmFlowGraph::CFunction &AFunction)
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	unsigned int First = AFunction.FirstBlock;
+	unsigned int Last = AFunction.LastBlock;
+
+	Cold.assign(Last - First, false);
+
+	for (unsigned int i = First; i < Last; i++) {
+		const CAsmFlowGraph::CBlock &Block = Graph.GetBlock(i);
+
+		if (!Code[Block.Begin].IsLabel()) {
+			Cold[i - First] = i > First && Cold[i - 1 - First] && Graph.GetFalls(i - 1);
+			continue;
+		}
+
+		Cold[i - First] = true;
+
+		for (unsigned int j = Block.Begin; j < Block.End && Code[j].IsLabel(); j++) {
+			if (!Asm.IsCold(Code[j].Operands[0].Label)) {
+				Cold[i - First] = false;
+			}
+		}
+	}
+}
+
+/*
+ * Chains blocks along the heaviest edges first, never into an entry, never
+ * into a cycle and never between cold and other blocks, and orders the
+ * chains by their first blocks, with the cold ones last. Returns false if
+ * the order doesn't change.
+ */
+bool CBlockLayout::Arrange(const CAsmFlowGraph::CFunction &AFunction, vector<unsigned int> &AOrder)
+{
+	unsigned int First = AFunction.FirstBlock;
+	unsigned int Last = AFunction.LastBlock;
+
+	if (Last - First < 3 || Graph.GetFalls(Last - 1)) {
+		return false;
+	}
+
+	FindLoops(AFunction);
+	FindCold(AFunction);
+
+	vector<CEdge> Edges;
+
+	for (unsigned int i = First; i < Last; i++) {
+		const vector<unsigned int> &Successors = Graph.GetBlock(i).Successors;
+
+		for (vector<unsigned int>::const_iterator it = Successors.begin(); it != Successors.end(); ++it) {
+			if (*it < First || *it >= Last || *it == i || Graph.IsEntry(*it) || Cold[i - First] != Cold[*it - First]) {
+				continue;
+			}
+
+			CEdge Edge = { i, *it, 4 * int(min(Depths[i - First], Depths[*it - First])) };
+
+			// a rotated header doesn't keep its body after it, the latch comes before it instead
+			if (BackEdges.count(make_pair(i, *it)) && Rotated[*it - First]) {
+				Edge.Weight += 2;
+			} else if (*it == i + 1 && !Rotated[i - First]) {
+				Edge.Weight += 1;
+			}
+
+			Edges.push_back(Edge);
+		}
+	}
+
+	stable_sort(Edges.begin(), Edges.end(), IsHeavier);
+
+	vector<int> Next(Last - First, -1);
+	vector<int> Previous(Last - First, -1);
+
+	for (vector<CEdge>::iterator it = Edges.begin(); it != Edges.end(); ++it) {
+		unsigned int Head = it->From;
+
+		if (Next[it->From - First] >= 0 || Previous[it->To - First] >= 0) {
+			continue;
+		}
+
+		while (Previous[Head - First] >= 0) {
+			Head = Previous[Head - First];
+		}
+
+		if (Head != it->To) {
+			Next[it->From - First] = it->To;
+			Previous[it->To - First] = it->From;
+		}
+	}
+
+	AOrder.clear();
+
+	for (unsigned int Pass = 0; Pass < 2; Pass++) {
+		for (unsigned int i = First; i < Last; i++) {
+			if (Cold[i - First] != (Pass == 1)) {
+				continue;
+			}
+
+			for (int Block = Previous[i - First] < 0 ? int(i) : -1; Block >= 0; Block = Next[Block - First]) {
+				AOrder.push_back(Block);
+			}
+		}
+	}
+
+	for (unsigned int i = 0; i < AOrder.size(); i++) {
+		if (AOrder[i] != First + i) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Outputs the blocks of a function in a new order. A jump is added where
+ * the next block of the old order isn't the next one anymore, removed where
+ * its target becomes the next block, and a conditional jump to the next block
+ * is inverted.
+ */
+void CBlockLayout::Emit(const CAsmFlowGraph::CFunction &AFunction, const vector<unsigned int> &AOrder, CAsmCode::CodeContainer &ACode)
+{
+	CAsmCode::CodeIterator Code = Asm.Begin();
+	unsigned int First = AFunction.FirstBlock;
+	unsigned int Last = AFunction.LastBlock;
+	vector<unsigned int> Positions(Last - First);
+
+	for (unsigned int i = 0; i < AOrder.size(); i++) {
+		Positions[AOrder[i] - First] = i;
+	}
+
+	for (unsigned int i = First; i + 1 < Last; i++) {
+		if (Graph.GetFalls(i) && Positions[i + 1 - First] != Positions[i - First] + 1) {
+			GetLabel(i + 1);
+		}
+	}
+
+	for (unsigned int i = 0; i < AOrder.size(); i++) {
+		unsigned int Block = AOrder[i];
+		const CAsmFlowGraph::CBlock &Current = Graph.GetBlock(Block);
+		const CAsmInstruction &Jump = Code[Current.End - 1];
+		int Next = i + 1 < AOrder.size() ? int(AOrder[i + 1]) : -1;
+		int Target = Graph.GetTarget(Block);
+		int Fallthrough = Graph.GetFalls(Block) ? int(Block) + 1 : -1;
+
+		if (!Code[Current.Begin].IsLabel() && Labels[Block] >= 0) {
+			CAsmInstruction Label = CAsmInstruction();
+			Label.Type = INSTRUCTION_LABEL;
+			Label.Operands[0] = label(CAsmCode::GetLabel(Labels[Block]));
+			ACode.push_back(Label);
+		}
+
+		ACode.insert(ACode.end(), Code + Current.Begin, Code + Current.End - 1);
+
+		if (Jump.IsCommand(JMP) && Target >= 0 && Target == Next) {
+			continue;
+		} else if (Fallthrough < 0 || Fallthrough == Next) {
+			ACode.push_back(Jump);
+			continue;
+		}
+
+		CAsmInstruction Branch = Jump;
+
+		if (CAsmFlowGraph::IsConditionalJump(Jump.Mnemonic) && Jump.Type == INSTRUCTION_COMMAND && Target >= 0 && Target == Next) {
+			Branch.Mnemonic = CAsmFlowGraph::InvertJump(Jump.Mnemonic);
+			Branch.Operands[0] = label(CAsmCode::GetLabel(Labels[Fallthrough]));
+			ACode.push_back(Branch);
+			continue;
+		}
+
+		ACode.push_back(Jump);
+
+		Branch = CAsmInstruction();
+		Branch.Type = INSTRUCTION_COMMAND;
+		Branch.Mnemonic = JMP;
+		Branch.OperandsCount = 1;
+		Branch.Operands[0] = label(CAsmCode::GetLabel(Labels[Fallthrough]));
+		ACode.push_back(Branch);
+	}
+}
+
+bool CBlockLayout::IsHeavier(const CEdge &AFirst, const CEdge &ASecond)
+{
+	return AFirst.Weight > ASecond.Weight;
+}
+
+/*
+ * Label at the start of a block, a new one if it has none.
+ */
+int CBlockLayout::GetLabel(unsigned int ABlock)
+{
+	if (Labels[ABlock] < 0) {
+		Labels[ABlock] = CAsmCode::Intern(Asm.GenerateLabel());
+	}
+
+	return Labels[ABlock];
+}
+
+/******************************************************************************
+ * CDeadCodeElimination
+ ******************************************************************************/
+
+CDeadCodeElimination::CDeadCodeElimination(CFunctionSymbol *AFunction) : Function(AFunction), Graph(NULL), Changed(false)
+{
+}
+
+void CDeadCodeElimination::Visit(CUnaryOp &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CBinaryOp &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CConditionalOp &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CFloatConst &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CCharConst &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CStringConst &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CVariable &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CFunction &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CPostfixOp &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CFunctionCall &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CStructAccess &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CIndirectAccess &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CArrayAccess &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CNullStatement &AStmt)
+{
+}
+
+/*
+ * The function body is processed until nothing changes, as removing a
+ * statement can make the statements that compute its operands dead.
+ */
+void CDeadCodeElimination::Visit(CBlockStatement &AStmt)
+{
+	if (Graph) {
+		ProcessBlock(AStmt);
+		return;
+	}
+
+	do {
+		Analyze();
+
+		Changed = false;
+		ProcessBlock(AStmt);
+
+		delete Graph;
+		Graph = NULL;
+	} while (Changed);
+}
+
+void CDeadCodeElimination::Visit(CIfStatement &AStmt)
+{
+	AStmt.SetThenStatement(Keep(AStmt.GetThenStatement()));
+	AStmt.SetElseStatement(Rewrite(AStmt.GetElseStatement()));
+}
+
+void CDeadCodeElimination::Visit(CForStatement &AStmt)
+{
+	if (!AStmt.GetVectorized()) {
+		AStmt.SetBody(Keep(AStmt.GetBody()));
+	}
+}
+
+void CDeadCodeElimination::Visit(CWhileStatement &AStmt)
+{
+	AStmt.SetBody(Keep(AStmt.GetBody()));
+}
+
+void CDeadCodeElimination::Visit(CDoStatement &AStmt)
+{
+	AStmt.SetBody(Keep(AStmt.GetBody()));
+}
+
+void CDeadCodeElimination::Visit(CLabel &AStmt)
+{
+	AStmt.SetNext(Keep(AStmt.GetNext()));
+}
+
+void CDeadCodeElimination::Visit(CCaseLabel &AStmt)
+{
+	Visit(static_cast<CLabel &>(AStmt));
+}
+
+void CDeadCodeElimination::Visit(CDefaultCaseLabel &AStmt)
+{
+	Visit(static_cast<CLabel &>(AStmt));
+}
+
+void CDeadCodeElimination::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CReturnStatement &AStmt)
+{
+}
+
+void CDeadCodeElimination::Visit(CSwitchStatement &AStmt)
+{
+	AStmt.SetBody(Keep(AStmt.GetBody()));
+}
+
+/*
+ * Expression statements are dead if they have no side effects, or if they
+ * only assign to or increment a local variable that isn't live after them.
+ */
+void CDeadCodeElimination::Analyze()
+{
+	Graph = new CControlFlowGraph(Function);
+	Dead.clear();
+
+	CLiveness Liveness(*Graph);
+	CVariableNumbering &Numbering = Graph->GetNumbering();
+	CControlFlowGraph::BlocksContainer &Order = Graph->GetOrder();
+
+	for (CControlFlowGraph::BlocksIterator it = Order.begin(); it != Order.end(); ++it) {
+		CBasicBlock::ElementsContainer &Elements = (*it)->GetElements();
+		CBitSet Live = Liveness.GetOut(*it);
+
+		for (CBasicBlock::ElementsContainer::reverse_iterator el = Elements.rbegin(); el != Elements.rend(); ++el) {
+			if (el->Statement == el->Expression) {
+				CExpression *Expr = el->Expression;
+				CExpression *Target = NULL;
+
+				if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(Expr)) {
+					if (dynamic_cast<CPostfixOp *>(Op) || Op->GetType() == TOKEN_TYPE_OPERATION_INCREMENT || Op->GetType() == TOKEN_TYPE_OPERATION_DECREMENT) {
+						Target = Op->GetArgument();
+					}
+				} else if (CBinaryOp *Op = dynamic_cast<CBinaryOp *>(Expr)) {
+					if (TokenTraits::IsAssignment(Op->GetType())) {
+						Target = Op->GetLeft();
+					}
+				}
+
+				CVariable *Var = dynamic_cast<CVariable *>(Target);
+				int Index = Var ? Numbering.GetIndex(Var->GetSymbol()) : -1;
+
+				if (!HasSideEffects(Expr) || (Index >= 0 && !Numbering.GetEscaped(Index) && !Live.Get(Index))) {
+					Dead.insert(Expr);
+				}
+			}
+
+			Liveness.Transfer(*el, Live);
+		}
+	}
+}
+
+void CDeadCodeElimination::ProcessBlock(CBlockStatement &AStmt)
+{
+	ParentBlocks.push(&AStmt);
+
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ) {
+		CStatement *Stmt = Rewrite(*it);
+
+		if (Stmt) {
+			*it = Stmt;
+			++it;
+		} else {
+			it = AStmt.Erase(it);
+		}
+	}
+
+	ParentBlocks.pop();
+}
+
+/*
+ * Returns the statement to put in place of AStmt, or NULL if it's removed.
+ */
+CStatement* CDeadCodeElimination::Rewrite(CStatement *AStmt)
+{
+	if (!AStmt) {
+		return NULL;
+	}
+
+	if (IsUnreachable(AStmt)) {
+		Remove(AStmt);
+		return NULL;
+	}
+
+	bool Value;
+
+	if (CIfStatement *If = dynamic_cast<CIfStatement *>(AStmt)) {
+		if (CControlFlowGraph::IsConstant(If->GetCondition(), Value)) {
+			CStatement *Taken = Value ? If->GetThenStatement() : If->GetElseStatement();
+			CStatement *Other = Value ? If->GetElseStatement() : If->GetThenStatement();
+
+			if (IsUnreachable(Other)) {
+				If->SetThenStatement(NULL);
+				If->SetElseStatement(NULL);
+
+				Remove(Other);
+				Remove(If);
+
+				return Rewrite(Taken);
+			}
+		}
+	} else if (CWhileStatement *While = dynamic_cast<CWhileStatement *>(AStmt)) {
+		if (CControlFlowGraph::IsConstant(While->GetCondition(), Value) && !Value && IsUnreachable(While->GetBody())) {
+			Remove(While);
+			return NULL;
+		}
+	} else if (CForStatement *For = dynamic_cast<CForStatement *>(AStmt)) {
+		if (For->GetCondition() && CControlFlowGraph::IsConstant(For->GetCondition(), Value) && !Value && IsUnreachable(For->GetBody())) {
+			CExpression *Init = For->GetInit();
+			For->SetInit(NULL);
+
+			Remove(For);
+			return Init;
+		}
+	}
+
+	if (Dead.count(AStmt)) {
+		CExpression *Result = NULL;
+
+		// a dead store still has to evaluate the value if that has side effects
+		CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AStmt);
+
+		if (Op && HasSideEffects(Op->GetRight())) {
+			Result = Op->GetRight();
+			Op->SetRight(NULL);
+		}
+
+		Remove(AStmt);
+		return Result;
+	}
+
+	AStmt->Accept(*this);
+	return AStmt;
+}
+
+/*
+ * Same as Rewrite, but for places where a statement is required.
+ */
+CStatement* CDeadCodeElimination::Keep(CStatement *AStmt)
+{
+	if (dynamic_cast<CNullStatement *>(AStmt)) {
+		return AStmt;
+	}
+
+	CStatement *Result = Rewrite(AStmt);
+	return Result ? Result : new CNullStatement();
+}
+
+void CDeadCodeElimination::Remove(CStatement *AStmt)
+{
+	if (AStmt) {
+		CLoopUnrolling::MoveNestedBlocks(AStmt, ParentBlocks.top(), NULL);
+		delete AStmt;
+		Changed = true;
+	}
+}
+
+/*
+ * A statement is unreachable if no part of it is, case labels are kept as
+ * they are referenced by their switch.
+ */
+bool CDeadCodeElimination::IsUnreachable(CStatement *AStmt)
+{
+	if (!AStmt) {
+		return true;
+	}
+
+	if (dynamic_cast<CCaseLabel *>(AStmt) || dynamic_cast<CDefaultCaseLabel *>(AStmt)) {
+		return false;
+	}
+
+	CBasicBlock *Block = Graph->GetBlock(AStmt);
+
+	if (!Block || Block->GetReachable()) {
+		return false;
+	}
+
+	if (CSwitchStatement *Switch = dynamic_cast<CSwitchStatement *>(AStmt)) {
+		return IsUnreachable(Switch->GetBody());
+	} else if (CBlockStatement *Compound = dynamic_cast<CBlockStatement *>(AStmt)) {
+		for (CBlockStatement::StatementsIterator it = Compound->Begin(); it != Compound->End(); ++it) {
+			if (!IsUnreachable(*it)) {
+				return false;
+			}
+		}
+	} else if (CIfStatement *If = dynamic_cast<CIfStatement *>(AStmt)) {
+		return IsUnreachable(If->GetThenStatement()) && IsUnreachable(If->GetElseStatement());
+	} else if (CForStatement *For = dynamic_cast<CForStatement *>(AStmt)) {
+		return IsUnreachable(For->GetBody());
+	} else if (CSingleConditionLoopStatement *Loop = dynamic_cast<CSingleConditionLoopStatement *>(AStmt)) {
+		return IsUnreachable(Loop->GetBody());
+	} else if (CLabel *Label = dynamic_cast<CLabel *>(AStmt)) {
+		return IsUnreachable(Label->GetNext());
+	}
+
+	return true;
+}
+
+bool CDeadCodeElimination::HasSideEffects(CExpression *AExpr)
+{
+	CAccesses Accesses;
+	CAccessCollector Collector(Graph->GetNumbering(), Accesses);
+	AExpr->Accept(Collector);
+
+	return Accesses.Stores || Accesses.Calls || !Accesses.Defs.empty() || !Accesses.MayDefs.empty();
+}
+
+/******************************************************************************
+ * CConstantExpressionComputer
+ ******************************************************************************/
+
+void CConstantExpressionComputer::Visit(CUnaryOp &AStmt)
+{
+	AStmt.GetArgument()->Accept(*this);
+
+	ETokenType t = AStmt.GetType();
+
+	if (t == TOKEN_TYPE_OPERATION_MINUS) {
+		Result = -Result;
+	} else if (t == TOKEN_TYPE_OPERATION_LOGIC_NOT) {
+		Result = !Result;
+	} else if (t == TOKEN_TYPE_OPERATION_BITWISE_NOT) {
+		Result = ~(int)Result;
+	}
+}
+
+void CConstantExpressionComputer::Visit(CBinaryOp &AStmt)
+{
+	AStmt.GetLeft()->Accept(*this);
+	double LHS = Result;
+	AStmt.GetRight()->Accept(*this);
+	double RHS = Result;
+
+	ETokenType t = AStmt.GetType();
+
+	bool IntOperands = !AStmt.GetLeft()->GetResultType()->IsFloat() && !AStmt.GetRight()->GetResultType()->IsFloat();
+
+	// integer arithmetic wraps around like the generated code does
+	if (IntOperands && (t == TOKEN_TYPE_OPERATION_PLUS || t == TOKEN_TYPE_OPERATION_MINUS || t == TOKEN_TYPE_OPERATION_ASTERISK)) {
+		unsigned int L = (int) LHS;
+		unsigned int R = (int) RHS;
+
+		Result = (int) (t == TOKEN_TYPE_OPERATION_PLUS ? L + R : (t == TOKEN_TYPE_OPERATION_MINUS ? L - R : L * R));
+	} else if (t == TOKEN_TYPE_OPERATION_PLUS) {
+		Result = LHS + RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_MINUS) {
+		Result = LHS - RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_ASTERISK) {
+		Result = LHS * RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_SLASH || t == TOKEN_TYPE_OPERATION_PERCENT) {
+		if (RHS == 0) {
+			throw CParserException("division by zero in constant expression", AStmt.GetPosition());
+		}
+
+		if (t == TOKEN_TYPE_OPERATION_SLASH) {
+			Result = LHS / RHS;
+		} else {
+			Result = (int) LHS % (int) RHS;
+		}
+	} else if (t == TOKEN_TYPE_OPERATION_SHIFT_LEFT) {
+		Result = (int) LHS << (int) RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_SHIFT_RIGHT) {
+		Result = (int) LHS >> (int) RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_LESS_THAN) {
+		Result = LHS < RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_LESS_THAN_OR_EQUAL) {
+		Result = LHS <= RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_GREATER_THAN) {
+		Result = LHS > RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_GREATER_THAN_OR_EQUAL) {
+		Result = LHS >= RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_EQUAL) {
+		Result = LHS == RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_NOT_EQUAL) {
+		Result = LHS != RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_LOGIC_AND) {
+		Result = LHS && RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_LOGIC_OR) {
+		Result = LHS || RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_BITWISE_OR) {
+		Result = (int) LHS | (int) RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_BITWISE_XOR) {
+		Result = (int) LHS ^ (int) RHS;
+	} else if (t == TOKEN_TYPE_OPERATION_AMPERSAND) {
+		Result = (int) LHS & (int) RHS;
+	} else if (t == TOKEN_TYPE_SEPARATOR_COMMA) {
+		Result = RHS;
+	}
+
+	if (!AStmt.GetResultType()->IsFloat()) {
+		Result = (int) Result;
+	}
+}
+
+void CConstantExpressionComputer::Visit(CConditionalOp &AStmt)
+{
+	AStmt.GetCondition()->Accept(*this);
+	if (Result) {
+		AStmt.GetTrueExpr()->Accept(*this);
+	} else {
+		AStmt.GetFalseExpr()->Accept(*this);
+	}
+}
+
+void CConstantExpressionComputer::Visit(CIntegerConst &AStmt)
+{
+	Result = AStmt.GetValue();
+}
+
+void CConstantExpressionComputer::Visit(CFloatConst &AStmt)
+{
+	Result = AStmt.GetValue();
+}
+
+void CConstantExpressionComputer::Visit(CCharConst &AStmt)
+{
+	Result = AStmt.GetValue();
+}
+
+void CConstantExpressionComputer::Visit(CStringConst &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CVariable &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CFunction &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CPostfixOp &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CFunctionCall &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CStructAccess &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CIndirectAccess &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CArrayAccess &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CNullStatement &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CBlockStatement &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CIfStatement &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CForStatement &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CWhileStatement &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CDoStatement &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CLabel &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CCaseLabel &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CDefaultCaseLabel &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CReturnStatement &AStmt)
+{
+}
+
+void CConstantExpressionComputer::Visit(CSwitchStatement &AStmt)
+{
+}
+
+int CConstantExpressionComputer::GetIntResult()
+{
+	return Result;
+}
+
+float CConstantExpressionComputer::GetFloatResult()
+{
+	return Result;
+}
+
+/******************************************************************************
+ * CConstantFolding
+ ******************************************************************************/
+
+void CConstantFolding::Visit(CUnaryOp &AStmt)
+{
+	AStmt.SetArgument(TryFold(AStmt.GetArgument()));
+}
+
+void CConstantFolding::Visit(CBinaryOp &AStmt)
+{
+	AStmt.SetLeft(TryFold(AStmt.GetLeft()));
+	AStmt.SetRight(TryFold(AStmt.GetRight()));
+}
+
+void CConstantFolding::Visit(CConditionalOp &AStmt)
+{
+	AStmt.SetCondition(TryFold(AStmt.GetCondition()));
+	AStmt.SetTrueExpr(TryFold(AStmt.GetTrueExpr()));
+	AStmt.SetFalseExpr(TryFold(AStmt.GetFalseExpr()));
+}
+
+void CConstantFolding::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CConstantFolding::Visit(CFloatConst &AStmt)
+{
+}
+
+void CConstantFolding::Visit(CCharConst &AStmt)
+{
+}
+
+void CConstantFolding::Visit(CStringConst &AStmt)
+{
+}
+
+void CConstantFolding::Visit(CVariable &AStmt)
+{
+}
+
+void CConstantFolding::Visit(CFunction &AStmt)
+{
+}
+
+void CConstantFolding::Visit(CPostfixOp &AStmt)
+{
+	AStmt.SetArgument(TryFold(AStmt.GetArgument()));
+}
+
+void CConstantFolding::Visit(CFunctionCall &AStmt)
+{
+	for (CFunctionCall::ArgumentsReverseIterator it = AStmt.RBegin(); it != AStmt.REnd(); ++it) {
+		*it = TryFold(*it);
+	}
+}
+
+void CConstantFolding::Visit(CStructAccess &AStmt)
+{
+	AStmt.SetStruct(TryFold(AStmt.GetStruct()));
+}
+
+void CConstantFolding::Visit(CIndirectAccess &AStmt)
+{
+	AStmt.SetPointer(TryFold(AStmt.GetPointer()));
+}
+
+void CConstantFolding::Visit(CArrayAccess &AStmt)
+{
+	AStmt.SetLeft(TryFold(AStmt.GetLeft()));
+	AStmt.SetRight(TryFold(AStmt.GetRight()));
+}
+
+void CConstantFolding::Visit(CNullStatement &AStmt)
+{
+}
+
+void CConstantFolding::Visit(CBlockStatement &AStmt)
+{
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		*it = TryFold(*it);
+	}
+}
+
+void CConstantFolding::Visit(CIfStatement &AStmt)
+{
+	AStmt.SetCondition(TryFold(AStmt.GetCondition()));
+	AStmt.SetThenStatement(TryFold(AStmt.GetThenStatement()));
+	AStmt.SetElseStatement(TryFold(AStmt.GetElseStatement()));
+}
+
+void CConstantFolding::Visit(CForStatement &AStmt)
+{
+	AStmt.SetInit(TryFold(AStmt.GetInit()));
+	AStmt.SetCondition(TryFold(AStmt.GetCondition()));
+	AStmt.SetUpdate(TryFold(AStmt.GetUpdate()));
+	AStmt.SetBody(TryFold(AStmt.GetBody()));
+}
+
+void CConstantFolding::Visit(CWhileStatement &AStmt)
+{
+	AStmt.SetCondition(TryFold(AStmt.GetCondition()));
+	AStmt.SetBody(TryFold(AStmt.GetBody()));
+}
+
+void CConstantFolding::Visit(CDoStatement &AStmt)
+{
+	AStmt.SetCondition(TryFold(AStmt.GetCondition()));
+	AStmt.SetBody(TryFold(AStmt.GetBody()));
+}
+
+void CConstantFolding::Visit(CLabel &AStmt)
+{
+	AStmt.SetNext(TryFold(AStmt.GetNext()));
+}
+
+void CConstantFolding::Visit(CCaseLabel &AStmt)
+{
+	Visit(static_cast<CLabel &>(AStmt));
+}
+
+void CConstantFolding::Visit(CDefaultCaseLabel &AStmt)
+{
+	Visit(static_cast<CLabel &>(AStmt));
+}
+
+void CConstantFolding::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CConstantFolding::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CConstantFolding::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CConstantFolding::Visit(CReturnStatement &AStmt)
+{
+	AStmt.SetReturnExpression(TryFold(AStmt.GetReturnExpression()));
+}
+
+void CConstantFolding::Visit(CSwitchStatement &AStmt)
+{
+	AStmt.SetTestExpression(TryFold(AStmt.GetTestExpression()));
+	AStmt.SetBody(TryFold(AStmt.GetBody()));
+}
+
+CExpression* CConstantFolding::TryFold(CStatement *AStmt)
+{
+	CExpression *Expr = static_cast<CExpression *>(AStmt);
+
+	if (!AStmt || !AStmt->IsExpression() || !Expr->IsConst() || Expr->GetType() == TOKEN_TYPE_CONSTANT_STRING) {
+		if (AStmt) {
+			AStmt->Accept(*this);
+		}
+
+		return Expr;
+	}
+
+	Expr->Accept(ConstExprComp);
+
+	CExpression *Result;
+
+	if (Expr->GetResultType()->IsFloat()) {
+		Result = new CFloatConst(CFloatConstToken(ToString(ConstExprComp.GetFloatResult()), Expr->GetPosition()), Expr->GetResultType());
+	} else {
+		Result = new CIntegerConst(CIntegerConstToken(ToString(ConstExprComp.GetIntResult()), Expr->GetPosition()), Expr->GetResultType());
+	}
+	
+	delete AStmt;
+	return Result;
+}
+
+/******************************************************************************
+ * CConstantPropagation
+ ******************************************************************************/
+
+CConstantPropagation::CConstantPropagation(CFunctionSymbol *AFunction) : Function(AFunction), Current(NULL)
+{
+	Analyze();
+}
+
+void CConstantPropagation::Visit(CUnaryOp &AStmt)
+{
+	AStmt.SetArgument(Propagate(AStmt.GetArgument()));
+}
+
+void CConstantPropagation::Visit(CBinaryOp &AStmt)
+{
+	if (!TokenTraits::IsAssignment(AStmt.GetType()) || !dynamic_cast<CVariable *>(AStmt.GetLeft())) {
+		AStmt.SetLeft(Propagate(AStmt.GetLeft()));
+	}
+
+	AStmt.SetRight(Propagate(AStmt.GetRight()));
+}
+
+void CConstantPropagation::Visit(CConditionalOp &AStmt)
+{
+	AStmt.SetCondition(Propagate(AStmt.GetCondition()));
+	AStmt.SetTrueExpr(Propagate(AStmt.GetTrueExpr()));
+	AStmt.SetFalseExpr(Propagate(AStmt.GetFalseExpr()));
+}
+
+void CConstantPropagation::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CConstantPropagation::Visit(CFloatConst &AStmt)
+{
+}
+
+void CConstantPropagation::Visit(CCharConst &AStmt)
+{
+}
+
+void CConstantPropagation::Visit(CStringConst &AStmt)
+{
+}
+
+void CConstantPropagation::Visit(CVariable &AStmt)
+{
+}
+
+void CConstantPropagation::Visit(CFunction &AStmt)
+{
+}
+
+void CConstantPropagation::Visit(CPostfixOp &AStmt)
+{
+	AStmt.SetArgument(Propagate(AStmt.GetArgument()));
+}
+
+void CConstantPropagation::Visit(CFunctionCall &AStmt)
+{
+	for (CFunctionCall::ArgumentsReverseIterator it = AStmt.RBegin(); it != AStmt.REnd(); ++it) {
+		*it = Propagate(*it);
+	}
+}
+
+void CConstantPropagation::Visit(CStructAccess &AStmt)
+{
+	AStmt.SetStruct(Propagate(AStmt.GetStruct()));
+}
+
+void CConstantPropagation::Visit(CIndirectAccess &AStmt)
+{
+	AStmt.SetPointer(Propagate(AStmt.GetPointer()));
+}
+
+void CConstantPropagation::Visit(CArrayAccess &AStmt)
+{
+	AStmt.SetLeft(Propagate(AStmt.GetLeft()));
+	AStmt.SetRight(Propagate(AStmt.GetRight()));
+}
+
+void CConstantPropagation::Visit(CNullStatement &AStmt)
+{
+}
+
+void CConstantPropagation::Visit(CBlockStatement &AStmt)
+{
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		*it = Enter(*it);
+	}
+}
+
+void CConstantPropagation::Visit(CIfStatement &AStmt)
+{
+	AStmt.SetCondition(Enter(AStmt.GetCondition()));
+	AStmt.SetThenStatement(Enter(AStmt.GetThenStatement()));
+	AStmt.SetElseStatement(Enter(AStmt.GetElseStatement()));
+}
+
+void CConstantPropagation::Visit(CForStatement &AStmt)
+{
+	if (AStmt.GetVectorized()) {
+		return;
+	}
+
+	AStmt.SetInit(Enter(AStmt.GetInit()));
+	AStmt.SetCondition(Enter(AStmt.GetCondition()));
+	AStmt.SetUpdate(Enter(AStmt.GetUpdate()));
+	AStmt.SetBody(Enter(AStmt.GetBody()));
+}
+
+void CConstantPropagation::Visit(CWhileStatement &AStmt)
+{
+	AStmt.SetCondition(Enter(AStmt.GetCondition()));
+	AStmt.SetBody(Enter(AStmt.GetBody()));
+}
+
+void CConstantPropagation::Visit(CDoStatement &AStmt)
+{
+	AStmt.SetCondition(Enter(AStmt.GetCondition()));
+	AStmt.SetBody(Enter(AStmt.GetBody()));
+}
+
+void CConstantPropagation::Visit(CLabel &AStmt)
+{
+	AStmt.SetNext(Enter(AStmt.GetNext()));
+}
+
+void CConstantPropagation::Visit(CCaseLabel &AStmt)
+{
+	Visit(static_cast<CLabel &>(AStmt));
+}
+
+void CConstantPropagation::Visit(CDefaultCaseLabel &AStmt)
+{
+	Visit(static_cast<CLabel &>(AStmt));
+}
+
+void CConstantPropagation::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CConstantPropagation::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CConstantPropagation::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CConstantPropagation::Visit(CReturnStatement &AStmt)
+{
+	AStmt.SetReturnExpression(Enter(AStmt.GetReturnExpression()));
+}
+
+void CConstantPropagation::Visit(CSwitchStatement &AStmt)
+{
+	AStmt.SetTestExpression(Enter(AStmt.GetTestExpression()));
+	AStmt.SetBody(Enter(AStmt.GetBody()));
+}
+
+/*
+ * A variable that isn't escaped is known at an element that reads it if every
+ * definition reaching the element assigns it the same integer constant. An
+ * element that also writes the variable is left as it is, as its reads may
+ * see the new value.
+ */
+void CConstantPropagation::Analyze()
+{
+	CControlFlowGraph Graph(Function);
+	CReachingDefinitions Definitions(Graph);
+	CVariableNumbering &Numbering = Graph.GetNumbering();
+	CControlFlowGraph::BlocksContainer &Order = Graph.GetOrder();
+
+	for (CControlFlowGraph::BlocksIterator it = Order.begin(); it != Order.end(); ++it) {
+		CBasicBlock::ElementsContainer &Elements = (*it)->GetElements();
+		CBitSet Reaching = Definitions.GetIn(*it);
+
+		for (unsigned int el = 0; el < Elements.size(); el++) {
+			const CAccesses &Accesses = Elements[el].Accesses;
+			CBinaryOp *Assignment = dynamic_cast<CBinaryOp *>(Elements[el].Expression);
+			CVariable *Target = (Assignment && Assignment->GetType() == TOKEN_TYPE_OPERATION_ASSIGN) ? dynamic_cast<CVariable *>(Assignment->GetLeft()) : NULL;
+
+			for (unsigned int i = 0; i < Accesses.Uses.size(); i++) {
+				unsigned int Variable = Accesses.Uses[i];
+				int Value;
+
+				// a variable that the element assigns is surely read before only
+				// when the element is a single assignment to it
+				unsigned int Defs = count(Accesses.Defs.begin(), Accesses.Defs.end(), Variable);
+
+				if (Numbering.GetEscaped(Variable)
+					|| (Defs && (Defs > 1 || !Target || Target->GetSymbol() != Numbering.GetVariable(Variable)))
+					|| find(Accesses.MayDefs.begin(), Accesses.MayDefs.end(), Variable) != Accesses.MayDefs.end()) {
+					continue;
+				}
+
+				if (GetConstant(Definitions, Reaching, Variable, Value)) {
+					Constants[Elements[el].Expression][Numbering.GetVariable(Variable)] = Value;
+				}
+			}
+
+			Definitions.Transfer(*it, el, Reaching);
+		}
+	}
+}
+
+/*
+ * The value that all of the reaching definitions of a variable assign, the
+ * implicit one at the entry stands for an unknown value.
+ */
+bool CConstantPropagation::GetConstant(CReachingDefinitions &ADefinitions, const CBitSet &AReaching, unsigned int AVariable, int &AValue)
+{
+	CBitSet Reaching = AReaching;
+	Reaching.Intersect(ADefinitions.GetDefinitions(AVariable));
+
+	bool Found = false;
+
+	for (unsigned int i = 0; i < Reaching.GetSize(); i++) {
+		if (!Reaching.Get(i)) {
+			continue;
+		}
+
+		const CReachingDefinitions::CDefinition &Definition = ADefinitions.GetDefinition(i);
+
+		if (i == AVariable || Definition.May) {
+			return false;
+		}
+
+		// the only definition of an element that assigns a constant is its target
+		CBinaryOp *Op = dynamic_cast<CBinaryOp *>(Definition.Block->GetElements()[Definition.Element].Expression);
+
+		if (!Op || Op->GetType() != TOKEN_TYPE_OPERATION_ASSIGN) {
+			return false;
+		}
+
+		CVariable *Var = dynamic_cast<CVariable *>(Op->GetLeft());
+		CIntegerConst *Const = dynamic_cast<CIntegerConst *>(Op->GetRight());
+
+		if (!Var || !Const || !Var->GetResultType()->IsInt() || Var->GetResultType()->GetSize() != Const->GetResultType()->GetSize()) {
+			return false;
+		}
+
+		if (Found && Const->GetValue() != AValue) {
+			return false;
+		}
+
+		AValue = Const->GetValue();
+		Found = true;
+	}
+
+	return Found;
+}
+
+/*
+ * Propagates into a statement, or into an expression that is evaluated as a
+ * whole and so is an element of the control flow graph.
+ */
+CExpression* CConstantPropagation::Enter(CStatement *AStmt)
+{
+	// calls of void functions are elements too
+	if (!dynamic_cast<CExpression *>(AStmt)) {
+		if (AStmt) {
+			AStmt->Accept(*this);
+		}
+
+		return static_cast<CExpression *>(AStmt);
+	}
+
+	map<CExpression *, ConstantsContainer>::iterator it = Constants.find(static_cast<CExpression *>(AStmt));
+	Current = (it != Constants.end()) ? &it->second : NULL;
+
+	CExpression *Result = Propagate(AStmt);
+	Current = NULL;
+
+	return Result;
+}
+
+CExpression* CConstantPropagation::Propagate(CStatement *AStmt)
+{
+	CExpression *Expr = static_cast<CExpression *>(AStmt);
+	CVariable *Var = dynamic_cast<CVariable *>(AStmt);
+
+	if (Var && Current && Current->count(Var->GetSymbol())) {
+		CExpression *Result = CLoopUnrolling::Constant((*Current)[Var->GetSymbol()], Var->GetResultType());
+		delete Var;
+
+		return Result;
+	}
+
+	if (AStmt) {
+		AStmt->Accept(*this);
+	}
+
+	return Expr;
+}
+
+/******************************************************************************
+ * CLoopInvariantHoisting
+ ******************************************************************************/
+
+CLoopInvariantHoisting::CLoopInvariantHoisting() : ProcessingLoop(false)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CUnaryOp &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CBinaryOp &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CConditionalOp &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CFloatConst &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CCharConst &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CStringConst &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CVariable &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CFunction &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CPostfixOp &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CFunctionCall &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CStructAccess &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CIndirectAccess &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CArrayAccess &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CNullStatement &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CBlockStatement &AStmt)
+{
+	if (ProcessingLoop) {
+		CBlockStatement::UsedContainer Used;
+		CBlockStatement::AffectedContainer Affected;
+		CBlockStatement::AffectedContainer StmtAffected;
+
+		CBlockStatement::StatementsIterator pit;
+
+		for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End();) {
+			if (!(*it)->CanBeHoisted()) {
+				++it;
+				continue;
+			}
+
+			Used.clear();
+			Affected.clear();
+			StmtAffected.clear();
+
+			(*it)->GetUsedVariables(Used);
+			(*ParentBlockIterator.top())->GetAffectedVariables(Affected);
+			(*it)->GetAffectedVariables(StmtAffected);
+
+			for (CBlockStatement::AffectedContainer::iterator ait = StmtAffected.begin(); ait != StmtAffected.end(); ++ait) {
+				Affected[ait->first] -= ait->second;
+				if (!Affected[ait->first]) {
+					Affected.erase(ait->first);
+				}
+			}
+
+			bool DoNotAct = false;
+
+			for (CSymbolTable::VariablesIterator vit = AStmt.GetSymbolTable()->VariablesBegin(); vit != AStmt.GetSymbolTable()->VariablesEnd(); ++vit) {
+				if (Used.count(vit->second)) {
+					DoNotAct = true;
+					break;
+				}
+			}
+
+			for (CBlockStatement::AffectedContainer::iterator ait = StmtAffected.begin(); ait != StmtAffected.end(); ++ait) {
+				if (Used.count(ait->first)) {
+					if (Used[ait->first] > ait->second) {
+						DoNotAct = true;
+						break;
+					}
+				}
+			}
+
+			for (CBlockStatement::UsedContainer::iterator uit = Used.begin(); uit != Used.end(); ++uit) {
+				if (Affected.count(uit->first)) {
+					DoNotAct = true;
+					break;
+				}
+			}
+
+			pit = it++;
+
+			if (!DoNotAct) {
+				AStmt.Erase(pit);
+				ParentBlock.top()->Insert(ParentBlockIterator.top(), *pit);
+			}
+		}
+	} else {
+		CBlockStatement::StatementsIterator pit;
+		for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End();) {
+			ParentBlock.push(&AStmt);
+			ParentBlockIterator.push(it);
+
+			pit = it++;
+			(*pit)->Accept(*this);
+
+			ParentBlockIterator.pop();
+			ParentBlock.pop();
+		}
+	}
+}
+
+void CLoopInvariantHoisting::Visit(CIfStatement &AStmt)
+{
+	TryVisit(AStmt.GetThenStatement());
+	TryVisit(AStmt.GetElseStatement());
+}
+
+void CLoopInvariantHoisting::Visit(CForStatement &AStmt)
+{
+	TryVisit(AStmt.GetBody());
+	ProcessLoop(AStmt.GetBody());
+}
+
+void CLoopInvariantHoisting::Visit(CWhileStatement &AStmt)
+{
+	TryVisit(AStmt.GetBody());
+	ProcessLoop(AStmt.GetBody());
+}
+
+void CLoopInvariantHoisting::Visit(CDoStatement &AStmt)
+{
+	TryVisit(AStmt.GetBody());
+	ProcessLoop(AStmt.GetBody());
+}
+
+void CLoopInvariantHoisting::Visit(CLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CLoopInvariantHoisting::Visit(CCaseLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CLoopInvariantHoisting::Visit(CDefaultCaseLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CLoopInvariantHoisting::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CReturnStatement &AStmt)
+{
+}
+
+void CLoopInvariantHoisting::Visit(CSwitchStatement &AStmt)
+{
+	TryVisit(AStmt.GetBody());
+}
+
+void CLoopInvariantHoisting::ProcessLoop(CStatement *ALoopBody)
+{
+	ProcessingLoop = true;
+
+	TryVisit(ALoopBody);
+
+	ProcessingLoop = false;
+}
+
+/******************************************************************************
+ * CInliningCostEstimator
+ ******************************************************************************/
+
+CInliningCostEstimator::CInliningCostEstimator(CBlockStatement *ABody) : Body(ABody), Cost(0), Inlinable(true), Jumps(false), Returns(false), FramedBlocks(0)
+{
+}
+
+void CInliningCostEstimator::Visit(CUnaryOp &AStmt)
+{
+	Cost++;
+	AStmt.GetArgument()->Accept(*this);
+}
+
+void CInliningCostEstimator::Visit(CBinaryOp &AStmt)
+{
+	Cost++;
+	AStmt.GetLeft()->Accept(*this);
+	AStmt.GetRight()->Accept(*this);
+}
+
+void CInliningCostEstimator::Visit(CConditionalOp &AStmt)
+{
+	Cost++;
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetTrueExpr()->Accept(*this);
+	AStmt.GetFalseExpr()->Accept(*this);
+}
+
+void CInliningCostEstimator::Visit(CIntegerConst &AStmt)
+{
+	Cost++;
+}
+
+void CInliningCostEstimator::Visit(CFloatConst &AStmt)
+{
+	Cost++;
+}
+
+void CInliningCostEstimator::Visit(CCharConst &AStmt)
+{
+	Cost++;
+}
+
+void CInliningCostEstimator::Visit(CStringConst &AStmt)
+{
+	Cost++;
+}
+
+void CInliningCostEstimator::Visit(CVariable &AStmt)
+{
+	Cost++;
+}
+
+void CInliningCostEstimator::Visit(CFunction &AStmt)
+{
+	Cost++;
+}
+
+void CInliningCostEstimator::Visit(CPostfixOp &AStmt)
+{
+	Cost++;
+	AStmt.GetArgument()->Accept(*this);
+}
+
+void CInliningCostEstimator::Visit(CFunctionCall &AStmt)
+{
+	Cost++;
+	for (CFunctionCall::ArgumentsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		(*it)->Accept(*this);
+	}
+}
+
+void CInliningCostEstimator::Visit(CStructAccess &AStmt)
+{
+	Cost++;
+	AStmt.GetStruct()->Accept(*this);
+}
+
+void CInliningCostEstimator::Visit(CIndirectAccess &AStmt)
+{
+	Cost++;
+	AStmt.GetPointer()->Accept(*this);
+}
+
+void CInliningCostEstimator::Visit(CArrayAccess &AStmt)
+{
+	Visit(static_cast<CBinaryOp &>(AStmt));
+}
+
+void CInliningCostEstimator::Visit(CNullStatement &AStmt)
+{
+}
+
+void CInliningCostEstimator::Visit(CBlockStatement &AStmt)
+{
+	bool Framed = &AStmt != Body && AStmt.GetSymbolTable()->GetElementsSize() != 0;
+
+	if (Framed) {
+		FramedBlocks++;
+	}
+
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		(*it)->Accept(*this);
+	}
+
+	if (Framed) {
+		FramedBlocks--;
+	}
+}
+
+void CInliningCostEstimator::Visit(CIfStatement &AStmt)
+{
+	Cost++;
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetThenStatement()->Accept(*this);
+	TryVisit(AStmt.GetElseStatement());
+}
+
+void CInliningCostEstimator::Visit(CForStatement &AStmt)
+{
+	Cost++;
+	TryVisit(AStmt.GetInit());
+	TryVisit(AStmt.GetCondition());
+	TryVisit(AStmt.GetUpdate());
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CInliningCostEstimator::Visit(CWhileStatement &AStmt)
+{
+	Cost++;
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CInliningCostEstimator::Visit(CDoStatement &AStmt)
+{
+	Cost++;
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CInliningCostEstimator::Visit(CLabel &AStmt)
+{
+	Inlinable = false;
+	Jumps = true;
+}
+
+void CInliningCostEstimator::Visit(CCaseLabel &AStmt)
+{
+	Inlinable = false;
+	Jumps = true;
+}
+
+void CInliningCostEstimator::Visit(CDefaultCaseLabel &AStmt)
+{
+	Inlinable = false;
+	Jumps = true;
+}
+
+void CInliningCostEstimator::Visit(CGotoStatement &AStmt)
+{
+	Inlinable = false;
+	Jumps = true;
+}
+
+void CInliningCostEstimator::Visit(CBreakStatement &AStmt)
+{
+	Cost++;
+	Jumps = true;
+}
+
+void CInliningCostEstimator::Visit(CContinueStatement &AStmt)
+{
+	Cost++;
+	Jumps = true;
+}
+
+void CInliningCostEstimator::Visit(CReturnStatement &AStmt)
+{
+	// jumping out of a block would skip the release of its locals
+	if (FramedBlocks) {
+		Inlinable = false;
+	}
+
+	Cost++;
+	Returns = true;
+	TryVisit(AStmt.GetReturnExpression());
+}
+
+void CInliningCostEstimator::Visit(CSwitchStatement &AStmt)
+{
+	Inlinable = false;
+}
+
+unsigned int CInliningCostEstimator::GetCost() const
+{
+	return Cost;
+}
+
+bool CInliningCostEstimator::GetInlinable() const
+{
+	return Inlinable;
+}
+
+bool CInliningCostEstimator::GetJumps() const
+{
+	return Jumps;
+}
+
+bool CInliningCostEstimator::GetReturns() const
+{
+	return Returns;
+}
+
+/******************************************************************************
+ * CInlineExpander
+ ******************************************************************************/
+
+CInlineExpander::CInlineExpander(CFunctionSymbol *AFunction, CBlockStatement *AParent, CVariableSymbol *AResult, const string &AEndLabel)
+	: Function(AFunction), ResultVariable(AResult), EndLabel(AEndLabel), EndLabelUsed(false), TailPosition(false), Copy(NULL)
+{
+	Blocks.push(AParent);
+}
+
+void CInlineExpander::Visit(CUnaryOp &AStmt)
+{
+	if (dynamic_cast<CAddressOfOp *>(&AStmt)) {
+		Copy = new CAddressOfOp(CToken(AStmt.GetType(), AStmt.GetName(), AStmt.GetPosition()), CloneExpression(AStmt.GetArgument()));
+		return;
+	}
+
+	CUnaryOp *Op = new CUnaryOp(AStmt);
+	Op->SetArgument(CloneExpression(AStmt.GetArgument()));
+	Copy = Op;
+}
+
+void CInlineExpander::Visit(CBinaryOp &AStmt)
+{
+	CBinaryOp *Op = new CBinaryOp(AStmt);
+	Op->SetLeft(CloneExpression(AStmt.GetLeft()));
+	Op->SetRight(CloneExpression(AStmt.GetRight()));
+	Copy = Op;
+}
+
+void CInlineExpander::Visit(CConditionalOp &AStmt)
+{
+	CConditionalOp *Op = new CConditionalOp(AStmt);
+	Op->SetCondition(CloneExpression(AStmt.GetCondition()));
+	Op->SetTrueExpr(CloneExpression(AStmt.GetTrueExpr()));
+	Op->SetFalseExpr(CloneExpression(AStmt.GetFalseExpr()));
+	Copy = Op;
+}
+
+void CInlineExpander::Visit(CIntegerConst &AStmt)
+{
+	Copy = new CIntegerConst(AStmt);
+}
+
+void CInlineExpander::Visit(CFloatConst &AStmt)
+{
+	Copy = new CFloatConst(AStmt);
+}
+
+void CInlineExpander::Visit(CCharConst &AStmt)
+{
+	Copy = new CCharConst(AStmt);
+}
+
+void CInlineExpander::Visit(CStringConst &AStmt)
+{
+	Copy = new CStringConst(AStmt);
+}
+
+void CInlineExpander::Visit(CVariable &AStmt)
+{
+	CVariableSymbol *Symbol = AStmt.GetSymbol();
+
+	if (Constants.count(Symbol)) {
+		Copy = new CIntegerConst(CIntegerConstToken(ToString(Constants[Symbol]), AStmt.GetPosition()), Symbol->GetType());
+		return;
+	}
+
+	int Offset = Offsets.count(Symbol) ? Offsets[Symbol] : 0;
+
+	if (Symbols.count(Symbol)) {
+		Symbol = Symbols[Symbol];
+	}
+
+	Copy = new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, Symbol->GetName(), AStmt.GetPosition()), Symbol);
+
+	if (Offset) {
+		CIntegerConst *Value = new CIntegerConst(CIntegerConstToken(ToString(Offset), AStmt.GetPosition()), Symbol->GetType());
+		Copy = new CBinaryOp(CToken(TOKEN_TYPE_OPERATION_PLUS, "+", AStmt.GetPosition()), static_cast<CExpression *>(Copy), Value);
+	}
+}
+
+void CInlineExpander::Visit(CFunction &AStmt)
+{
+	Copy = new CFunction(AStmt);
+}
+
+void CInlineExpander::Visit(CPostfixOp &AStmt)
+{
+	CPostfixOp *Op = new CPostfixOp(AStmt);
+	Op->SetArgument(CloneExpression(AStmt.GetArgument()));
+	Copy = Op;
+}
+
+void CInlineExpander::Visit(CFunctionCall &AStmt)
+{
+	CFunctionCall *Call = new CFunctionCall(AStmt);
+
+	for (CFunctionCall::ArgumentsReverseIterator it = Call->RBegin(); it != Call->REnd(); ++it) {
+		*it = CloneExpression(*it);
+	}
+
+	Copy = Call;
+}
+
+void CInlineExpander::Visit(CStructAccess &AStmt)
+{
+	CStructAccess *Access = new CStructAccess(AStmt);
+	Access->SetField(new CVariable(*AStmt.GetField()));
+	Access->SetStruct(CloneExpression(AStmt.GetStruct()));
+	Copy = Access;
+}
+
+void CInlineExpander::Visit(CIndirectAccess &AStmt)
+{
+	CIndirectAccess *Access = new CIndirectAccess(AStmt);
+	Access->SetField(new CVariable(*AStmt.GetField()));
+	Access->SetPointer(CloneExpression(AStmt.GetPointer()));
+	Copy = Access;
+}
+
+void CInlineExpander::Visit(CArrayAccess &AStmt)
+{
+	CArrayAccess *Access = new CArrayAccess(AStmt);
+	Access->SetLeft(CloneExpression(AStmt.GetLeft()));
+	Access->SetRight(CloneExpression(AStmt.GetRight()));
+	Copy = Access;
+}
+
+void CInlineExpander::Visit(CNullStatement &AStmt)
+{
+	Copy = new CNullStatement;
+}
+
+void CInlineExpander::Visit(CBlockStatement &AStmt)
+{
+	CBlockStatement *Block = new CBlockStatement;
+
+	CSymbolTable *SymTable = new CSymbolTable;
+	SymTable->SetCurrentOffset(Blocks.top()->GetSymbolTable()->GetCurrentOffset());
+	Block->SetSymbolTable(SymTable);
+
+	CSymbolTable *OriginalSymTable = AStmt.GetSymbolTable();
+	for (CSymbolTable::VariablesIterator it = OriginalSymTable->VariablesBegin(); it != OriginalSymTable->VariablesEnd(); ++it) {
+		CVariableSymbol *Var = new CVariableSymbol(Function->GetName() + "." + it->second->GetName(), it->second->GetType());
+		SymTable->AddVariable(Var);
+		AddSymbol(it->second, Var);
+	}
+
+	Blocks.top()->AddNestedBlock(Block);
+	Blocks.push(Block);
+
+	bool Tail = TailPosition;
+
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		CBlockStatement::StatementsIterator next = it;
+		TailPosition = Tail && ++next == AStmt.End();
+
+		Block->Add(Clone(*it));
+	}
+
+	TailPosition = Tail;
+
+	Blocks.pop();
+
+	Copy = Block;
+}
+
+void CInlineExpander::Visit(CIfStatement &AStmt)
+{
+	CIfStatement *Stmt = new CIfStatement(AStmt);
+	Stmt->SetCondition(CloneExpression(AStmt.GetCondition()));
+	Stmt->SetThenStatement(Clone(AStmt.GetThenStatement()));
+	Stmt->SetElseStatement(Clone(AStmt.GetElseStatement()));
+	Copy = Stmt;
+}
+
+void CInlineExpander::Visit(CForStatement &AStmt)
+{
+	bool Tail = TailPosition;
+	TailPosition = false;
+
+	CForStatement *Stmt = new CForStatement(AStmt);
+	Stmt->SetInit(CloneExpression(AStmt.GetInit()));
+	Stmt->SetCondition(CloneExpression(AStmt.GetCondition()));
+	Stmt->SetUpdate(CloneExpression(AStmt.GetUpdate()));
+	Stmt->SetBody(Clone(AStmt.GetBody()));
+	Copy = Stmt;
+
+	TailPosition = Tail;
+}
+
+void CInlineExpander::Visit(CWhileStatement &AStmt)
+{
+	bool Tail = TailPosition;
+	TailPosition = false;
+
+	CWhileStatement *Stmt = new CWhileStatement(AStmt);
+	Stmt->SetCondition(CloneExpression(AStmt.GetCondition()));
+	Stmt->SetBody(Clone(AStmt.GetBody()));
+	Copy = Stmt;
+
+	TailPosition = Tail;
+}
+
+void CInlineExpander::Visit(CDoStatement &AStmt)
+{
+	bool Tail = TailPosition;
+	TailPosition = false;
+
+	CDoStatement *Stmt = new CDoStatement(AStmt);
+	Stmt->SetCondition(CloneExpression(AStmt.GetCondition()));
+	Stmt->SetBody(Clone(AStmt.GetBody()));
+	Copy = Stmt;
+
+	TailPosition = Tail;
+}
+
+void CInlineExpander::Visit(CLabel &AStmt)
+{
+	assert(false);	// rejected by CInliningCostEstimator
+}
+
+void CInlineExpander::Visit(CCaseLabel &AStmt)
+{
+	assert(false);	// rejected by CInliningCostEstimator
+}
+
+void CInlineExpander::Visit(CDefaultCaseLabel &AStmt)
+{
+	assert(false);	// rejected by CInliningCostEstimator
+}
+
+void CInlineExpander::Visit(CGotoStatement &AStmt)
+{
+	assert(false);	// rejected by CInliningCostEstimator
+}
+
+void CInlineExpander::Visit(CBreakStatement &AStmt)
+{
+	Copy = new CBreakStatement;
+}
+
+void CInlineExpander::Visit(CContinueStatement &AStmt)
+{
+	Copy = new CContinueStatement;
+}
+
+/*
+ * Return becomes an assignment to the result variable (or just the evaluation
+ * of the expression, when the result is not used) followed by a jump to the
+ * end of the inlined body, unless the end is reached anyway.
+ */
+void CInlineExpander::Visit(CReturnStatement &AStmt)
+{
+	CStatement *Value = NULL;
+
+	if (AStmt.GetReturnExpression()) {
+		Value = CloneExpression(AStmt.GetReturnExpression());
+
+		if (ResultVariable) {
+			Value = Assign(ResultVariable, static_cast<CExpression *>(Value));
+		}
+	}
+
+	if (TailPosition) {
+		Copy = Value ? Value : new CNullStatement;
+		return;
+	}
+
+	EndLabelUsed = true;
+
+	CGotoStatement *Jump = new CGotoStatement(EndLabel);
+
+	if (!Value) {
+		Copy = Jump;
+		return;
+	}
+
+	CBlockStatement *Block = new CBlockStatement;
+
+	CSymbolTable *SymTable = new CSymbolTable;
+	SymTable->SetCurrentOffset(Blocks.top()->GetSymbolTable()->GetCurrentOffset());
+	Block->SetSymbolTable(SymTable);
+
+	Blocks.top()->AddNestedBlock(Block);
+
+	Block->Add(Value);
+	Block->Add(Jump);
+
+	Copy = Block;
+}
+
+void CInlineExpander::Visit(CSwitchStatement &AStmt)
+{
+	assert(false);	// rejected by CInliningCostEstimator
+}
+
+void CInlineExpander::AddSymbol(CVariableSymbol *AOriginal, CVariableSymbol *AReplacement)
+{
+	Symbols[AOriginal] = AReplacement;
+}
+
+void CInlineExpander::AddConstant(CVariableSymbol *AVariable, int AValue)
+{
+	Constants[AVariable] = AValue;
+}
+
+void CInlineExpander::AddOffset(CVariableSymbol *AVariable, int AOffset)
+{
+	Offsets[AVariable] = AOffset;
+}
+
+CExpression* CInlineExpander::CloneExpression(CExpression *AExpr)
+{
+	return static_cast<CExpression *>(Clone(AExpr));
+}
+
+CBlockStatement* CInlineExpander::ExpandBody()
+{
+	TailPosition = true;
+
+	CBlockStatement *Body = static_cast<CBlockStatement *>(Clone(Function->GetBody()));
+
+	if (EndLabelUsed) {
+		Body->Add(new CLabel(EndLabel, new CNullStatement));
+	}
+
+	return Body;
+}
+
+CStatement* CInlineExpander::Clone(CStatement *AStmt)
+{
+	if (!AStmt) {
+		return NULL;
+	}
+
+	AStmt->Accept(*this);
+
+	return Copy;
+}
+
+CExpression* CInlineExpander::Assign(CVariableSymbol *AVariable, CExpression *AValue)
+{
+	CBinaryOp *Op = new CBinaryOp(CToken(TOKEN_TYPE_OPERATION_ASSIGN, "=", AValue->GetPosition()));
+	Op->SetLeft(new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, AVariable->GetName(), CPosition()), AVariable));
+	Op->SetRight(AValue);
+
+	return Op;
+}
+
+/******************************************************************************
+ * CFunctionInlining
+ ******************************************************************************/
+
+CFunctionInlining::CFunctionInlining(CFunctionSymbol *ACaller, unsigned int ALimit, const CProfile *AProfile /*= NULL*/) : Caller(ACaller), Limit(ALimit), Profile(AProfile), LabelsCount(0)
+{
+}
+
+void CFunctionInlining::Visit(CUnaryOp &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CBinaryOp &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CConditionalOp &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CFloatConst &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CCharConst &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CStringConst &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CVariable &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CFunction &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CPostfixOp &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CFunctionCall &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CStructAccess &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CIndirectAccess &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CArrayAccess &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CNullStatement &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CBlockStatement &AStmt)
+{
+	Blocks.push(&AStmt);
+
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		(*it)->Accept(*this);
+		*it = TryInline(*it, &AStmt);
+	}
+
+	Blocks.pop();
+}
+
+void CFunctionInlining::Visit(CIfStatement &AStmt)
+{
+	AStmt.GetThenStatement()->Accept(*this);
+	AStmt.SetThenStatement(TryInline(AStmt.GetThenStatement(), Blocks.top()));
+
+	if (AStmt.GetElseStatement()) {
+		AStmt.GetElseStatement()->Accept(*this);
+		AStmt.SetElseStatement(TryInline(AStmt.GetElseStatement(), Blocks.top()));
+	}
+}
+
+void CFunctionInlining::Visit(CForStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+	AStmt.SetBody(TryInline(AStmt.GetBody(), Blocks.top()));
+}
+
+void CFunctionInlining::Visit(CWhileStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+	AStmt.SetBody(TryInline(AStmt.GetBody(), Blocks.top()));
+}
+
+void CFunctionInlining::Visit(CDoStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+	AStmt.SetBody(TryInline(AStmt.GetBody(), Blocks.top()));
+}
+
+void CFunctionInlining::Visit(CLabel &AStmt)
+{
+	AStmt.GetNext()->Accept(*this);
+	AStmt.SetNext(TryInline(AStmt.GetNext(), Blocks.top()));
+}
+
+void CFunctionInlining::Visit(CCaseLabel &AStmt)
+{
+	Visit(static_cast<CLabel &>(AStmt));
+}
+
+void CFunctionInlining::Visit(CDefaultCaseLabel &AStmt)
+{
+	Visit(static_cast<CLabel &>(AStmt));
+}
+
+void CFunctionInlining::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CReturnStatement &AStmt)
+{
+}
+
+void CFunctionInlining::Visit(CSwitchStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+}
+
+/*
+ * The call evaluated first in a statement is replaced by a block which assigns
+ * the arguments to copies of the parameters, runs a copy of the callee body and
+ * then the statement itself, reading the result from a variable. Calls which
+ * are not evaluated first stay, as the order of side effects must be kept.
+ */
+CStatement* CFunctionInlining::TryInline(CStatement *AStmt, CBlockStatement *AParent)
+{
+	CReturnStatement *Return = dynamic_cast<CReturnStatement *>(AStmt);
+	CIfStatement *If = dynamic_cast<CIfStatement *>(AStmt);
+	CExpression *Expr = NULL;
+
+	if (Return) {
+		Expr = Return->GetReturnExpression();
+	} else if (If) {
+		// the branches end up inside the new block, so they may not jump out of it
+		CInliningCostEstimator Estimator(NULL);
+		If->Accept(Estimator);
+
+		if (!Estimator.GetInlinable() || Estimator.GetJumps()) {
+			return AStmt;
+		}
+
+		Expr = If->GetCondition();
+	} else {
+		Expr = dynamic_cast<CExpression *>(AStmt);
+	}
+
+	CFunctionCall *Call = Expr ? FindCall(Expr) : NULL;
+
+	if (!Call) {
+		return AStmt;
+	}
+
+	CFunctionSymbol *Func = Call->GetFunction();
+	bool Discarded = (Call == AStmt);
+
+	if (Func->GetReturnType()->IsVoid() && !Discarded) {
+		return AStmt;
+	}
+
+	CBlockStatement *Block = new CBlockStatement;
+
+	CSymbolTable *SymTable = new CSymbolTable;
+	SymTable->SetCurrentOffset(AParent->GetSymbolTable()->GetCurrentOffset());
+	Block->SetSymbolTable(SymTable);
+
+	AParent->AddNestedBlock(Block);
+
+	CVariableSymbol *Result = NULL;
+	if (!Discarded) {
+		Result = new CVariableSymbol(Func->GetName() + ".result", Func->GetReturnType());
+		SymTable->AddVariable(Result);
+		Results.insert(Result);
+	}
+
+	CInlineExpander Expander(Func, Block, Result, Func->GetName() + ".end" + ToString(++LabelsCount));
+
+	CFunctionSymbol::ArgumentsOrderContainer *Params = Func->GetArgumentsOrderedList();
+	vector<CVariableSymbol *> Args;
+
+	for (CFunctionSymbol::ArgumentsOrderIterator it = Params->begin(); it != Params->end(); ++it) {
+		CVariableSymbol *Var = new CVariableSymbol(Func->GetName() + "." + (*it)->GetName(), (*it)->GetType());
+		SymTable->AddVariable(Var);
+		Expander.AddSymbol(*it, Var);
+		Args.push_back(Var);
+	}
+
+	vector<CVariableSymbol *>::reverse_iterator vit = Args.rbegin();
+	for (CFunctionCall::ArgumentsReverseIterator it = Call->RBegin(); it != Call->REnd(); ++it, ++vit) {
+		Block->Add(Expander.Assign(*vit, *it));
+		*it = NULL;
+	}
+
+	CBlockStatement *Body = Expander.ExpandBody();
+	Block->Add(Body);
+
+	Expanding.insert(Func);
+	Body->Accept(*this);
+	Expanding.erase(Func);
+
+	if (Discarded) {
+		delete Call;
+		return Block;
+	}
+
+	CVariable *Value = new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, Result->GetName(), Call->GetPosition()), Result);
+
+	if (Return) {
+		Return->SetReturnExpression(ReplaceCall(Expr, Call, Value));
+	} else if (If) {
+		If->SetCondition(ReplaceCall(Expr, Call, Value));
+	} else {
+		AStmt = ReplaceCall(Expr, Call, Value);
+	}
+
+	delete Call;
+
+	Block->Add(TryInline(AStmt, Block));
+
+	return Block;
+}
+
+CFunctionCall* CFunctionInlining::FindCall(CExpression *AExpr)
+{
+	if (CFunctionCall *Call = dynamic_cast<CFunctionCall *>(AExpr)) {
+		// arguments are evaluated starting from the last one
+		for (CFunctionCall::ArgumentsReverseIterator it = Call->RBegin(); it != Call->REnd(); ++it) {
+			if (!IsEvaluated(*it)) {
+				if (CFunctionCall *Nested = FindCall(*it)) {
+					return Nested;
+				}
+				break;
+			}
+		}
+
+		return CanInline(Call->GetFunction(), GetLimit(Call)) ? Call : NULL;
+	}
+
+	if (typeid(*AExpr) == typeid(CBinaryOp)) {
+		CBinaryOp *Op = static_cast<CBinaryOp *>(AExpr);
+		ETokenType OpType = Op->GetType();
+
+		if (OpType == TOKEN_TYPE_OPERATION_ASSIGN) {
+			return dynamic_cast<CVariable *>(Op->GetLeft()) ? FindCall(Op->GetRight()) : NULL;
+		} else if (TokenTraits::IsCompoundAssignment(OpType)) {
+			return NULL;
+		}
+
+		if (CFunctionCall *Call = FindCall(Op->GetLeft())) {
+			return Call;
+		}
+
+		if (OpType == TOKEN_TYPE_OPERATION_LOGIC_AND || OpType == TOKEN_TYPE_OPERATION_LOGIC_OR || !IsEvaluated(Op->GetLeft())) {
+			return NULL;
+		}
+
+		return FindCall(Op->GetRight());
+	}
+
+	if (CConditionalOp *Op = dynamic_cast<CConditionalOp *>(AExpr)) {
+		return FindCall(Op->GetCondition());
+	}
+
+	if (typeid(*AExpr) == typeid(CUnaryOp)) {
+		ETokenType OpType = AExpr->GetType();
+
+		if (OpType != TOKEN_TYPE_OPERATION_INCREMENT && OpType != TOKEN_TYPE_OPERATION_DECREMENT && OpType != TOKEN_TYPE_KEYWORD) {
+			return FindCall(static_cast<CUnaryOp *>(AExpr)->GetArgument());
+		}
+	}
+
+	return NULL;
+}
+
+CExpression* CFunctionInlining::ReplaceCall(CExpression *AExpr, CFunctionCall *ACall, CExpression *AReplacement)
+{
+	if (AExpr == ACall) {
+		return AReplacement;
+	}
+
+	if (CFunctionCall *Call = dynamic_cast<CFunctionCall *>(AExpr)) {
+		for (CFunctionCall::ArgumentsReverseIterator it = Call->RBegin(); it != Call->REnd(); ++it) {
+			*it = ReplaceCall(*it, ACall, AReplacement);
+		}
+	} else if (typeid(*AExpr) == typeid(CBinaryOp)) {
+		CBinaryOp *Op = static_cast<CBinaryOp *>(AExpr);
+		Op->SetLeft(ReplaceCall(Op->GetLeft(), ACall, AReplacement));
+		Op->SetRight(ReplaceCall(Op->GetRight(), ACall, AReplacement));
+	} else if (CConditionalOp *Op = dynamic_cast<CConditionalOp *>(AExpr)) {
+		Op->SetCondition(ReplaceCall(Op->GetCondition(), ACall, AReplacement));
+	} else if (typeid(*AExpr) == typeid(CUnaryOp)) {
+		CUnaryOp *Op = static_cast<CUnaryOp *>(AExpr);
+		Op->SetArgument(ReplaceCall(Op->GetArgument(), ACall, AReplacement));
+	}
+
+	return AExpr;
+}
+
+bool CFunctionInlining::CanInline(CFunctionSymbol *AFunction, unsigned int ALimit)
+{
+	if (AFunction == Caller || Expanding.count(AFunction) || !AFunction->GetBody() || AFunction->GetBuiltIn() || AFunction->GetName() == "main") {
+		return false;
+	}
+
+	CFunctionSymbol::ArgumentsOrderContainer *Params = AFunction->GetArgumentsOrderedList();
+
+	for (CFunctionSymbol::ArgumentsOrderIterator it = Params->begin(); it != Params->end(); ++it) {
+		if (!(*it)->GetType()->IsScalar()) {
+			return false;
+		}
+	}
+
+	CInliningCostEstimator Estimator(AFunction->GetBody());
+	AFunction->GetBody()->Accept(Estimator);
+
+	return Estimator.GetInlinable() && Estimator.GetCost() <= ALimit;
+}
+
+/*
+ * Calls that never ran in the profile aren't worth the growth of the code,
+ * and hot ones may have larger functions inlined.
+ */
+unsigned int CFunctionInlining::GetLimit(CFunctionCall *ACall) const
+{
+	if (!Profile) {
+		return Limit;
+	} else if (Profile->IsCold(ACall, PROFILE_COUNTER_ENTRY)) {
+		return 0;
+	} else if (Profile->IsHot(ACall, PROFILE_COUNTER_ENTRY)) {
+		return 4 * Limit;
+	}
+
+	return Limit;
+}
+
+/*
+ * Constants and results of already inlined calls do not depend on the order
+ * of evaluation, so the calls following them may be inlined as well.
+ */
+bool CFunctionInlining::IsEvaluated(CExpression *AExpr)
+{
+	if (AExpr->IsConst()) {
+		return true;
+	}
+
+	CVariable *Var = dynamic_cast<CVariable *>(AExpr);
+
+	return Var && Results.count(Var->GetSymbol());
+}
+
+/******************************************************************************
+ * CTailCallDetection
+ ******************************************************************************/
+
+CTailCallDetection::CTailCallDetection() : BlockNesting(0), AddressTaken(false)
+{
+}
+
+void CTailCallDetection::Visit(CUnaryOp &AStmt)
+{
+	if (dynamic_cast<CAddressOfOp *>(&AStmt)) {
+		CVariable *Var = dynamic_cast<CVariable *>(AStmt.GetArgument());
+
+		if (!Var || !Var->GetSymbol()->GetGlobal()) {
+			AddressTaken = true;
+		}
+	}
+
+	AStmt.GetArgument()->Accept(*this);
+}
+
+void CTailCallDetection::Visit(CBinaryOp &AStmt)
+{
+	AStmt.GetLeft()->Accept(*this);
+	AStmt.GetRight()->Accept(*this);
+}
+
+void CTailCallDetection::Visit(CConditionalOp &AStmt)
+{
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetTrueExpr()->Accept(*this);
+	AStmt.GetFalseExpr()->Accept(*this);
+}
+
+void CTailCallDetection::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CTailCallDetection::Visit(CFloatConst &AStmt)
+{
+}
+
+void CTailCallDetection::Visit(CCharConst &AStmt)
+{
+}
+
+void CTailCallDetection::Visit(CStringConst &AStmt)
+{
+}
+
+void CTailCallDetection::Visit(CVariable &AStmt)
+{
+	// local arrays are used through their address
+	if (AStmt.GetSymbol()->GetType()->IsArray() && !AStmt.GetSymbol()->GetGlobal()) {
+		AddressTaken = true;
+	}
+}
+
+void CTailCallDetection::Visit(CFunction &AStmt)
+{
+}
+
+void CTailCallDetection::Visit(CPostfixOp &AStmt)
+{
+	AStmt.GetArgument()->Accept(*this);
+}
+
+void CTailCallDetection::Visit(CFunctionCall &AStmt)
+{
+	for (CFunctionCall::ArgumentsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		(*it)->Accept(*this);
+	}
+}
+
+void CTailCallDetection::Visit(CStructAccess &AStmt)
+{
+	CheckDecay(AStmt, AStmt.GetStruct());
+	AStmt.GetStruct()->Accept(*this);
+}
+
+void CTailCallDetection::Visit(CIndirectAccess &AStmt)
+{
+	AStmt.GetPointer()->Accept(*this);
+}
+
+void CTailCallDetection::Visit(CArrayAccess &AStmt)
+{
+	CheckDecay(AStmt, AStmt.GetLeft()->GetResultType()->IsPointer() ? AStmt.GetLeft() : AStmt.GetRight());
+	Visit(static_cast<CBinaryOp &>(AStmt));
+}
+
+void CTailCallDetection::Visit(CNullStatement &AStmt)
+{
+}
+
+/*
+ * A call in a return statement may reuse the frame of the function, unless
+ * an address of something in that frame could be used by the callee.
+ */
+void CTailCallDetection::Visit(CBlockStatement &AStmt)
+{
+	BlockNesting++;
+
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		(*it)->Accept(*this);
+	}
+
+	BlockNesting--;
+
+	if (!BlockNesting && !AddressTaken) {
+		for (vector<CReturnStatement *>::iterator it = Returns.begin(); it != Returns.end(); ++it) {
+			(*it)->SetTailCall(true);
+		}
+	}
+}
+
+void CTailCallDetection::Visit(CIfStatement &AStmt)
+{
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetThenStatement()->Accept(*this);
+	TryVisit(AStmt.GetElseStatement());
+}
+
+void CTailCallDetection::Visit(CForStatement &AStmt)
+{
+	TryVisit(AStmt.GetInit());
+	TryVisit(AStmt.GetCondition());
+	TryVisit(AStmt.GetUpdate());
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CTailCallDetection::Visit(CWhileStatement &AStmt)
+{
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CTailCallDetection::Visit(CDoStatement &AStmt)
+{
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CTailCallDetection::Visit(CLabel &AStmt)
+{
+	AStmt.GetNext()->Accept(*this);
+}
+
+void CTailCallDetection::Visit(CCaseLabel &AStmt)
+{
+	Visit(static_cast<CLabel &>(AStmt));
+}
+
+void CTailCallDetection::Visit(CDefaultCaseLabel &AStmt)
+{
+	Visit(static_cast<CLabel &>(AStmt));
+}
+
+void CTailCallDetection::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CTailCallDetection::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CTailCallDetection::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CTailCallDetection::Visit(CReturnStatement &AStmt)
+{
+	if (dynamic_cast<CFunctionCall *>(AStmt.GetReturnExpression())) {
+		Returns.push_back(&AStmt);
+	}
+
+	TryVisit(AStmt.GetReturnExpression());
+}
+
+void CTailCallDetection::Visit(CSwitchStatement &AStmt)
+{
+	AStmt.GetTestExpression()->Accept(*this);
+	AStmt.GetBody()->Accept(*this);
+}
+
+/*
+ * An array field or element of an aggregate that isn't a global variable
+ * decays to an address that may point into the frame.
+ */
+void CTailCallDetection::CheckDecay(CExpression &AAccess, CExpression *AAggregate)
+{
+	CVariable *Var = dynamic_cast<CVariable *>(AAggregate);
+
+	if (AAccess.GetResultType()->IsArray() && (!Var || !Var->GetSymbol()->GetGlobal())) {
+		AddressTaken = true;
+	}
+}
+
+/******************************************************************************
+ * CInductionVariableAnalyzer
+ ******************************************************************************/
+
+CInductionVariableAnalyzer::CInductionVariableAnalyzer() : AddressOperand(false), Labels(false)
+{
+}
+
+void CInductionVariableAnalyzer::Visit(CUnaryOp &AStmt)
+{
+	if (AStmt.GetType() == TOKEN_TYPE_OPERATION_INCREMENT || AStmt.GetType() == TOKEN_TYPE_OPERATION_DECREMENT) {
+		AddWrite(AStmt.GetArgument());
+	}
+
+	bool Address = AddressOperand;
+	AddressOperand = (dynamic_cast<CAddressOfOp *>(&AStmt) != NULL);
+	AStmt.GetArgument()->Accept(*this);
+	AddressOperand = Address;
+}
+
+void CInductionVariableAnalyzer::Visit(CBinaryOp &AStmt)
+{
+	if (TokenTraits::IsAssignment(AStmt.GetType())) {
+		AddWrite(AStmt.GetLeft());
+	}
+
+	bool Address = AddressOperand;
+	AddressOperand = false;
+	AStmt.GetLeft()->Accept(*this);
+	AStmt.GetRight()->Accept(*this);
+	AddressOperand = Address;
+}
+
+void CInductionVariableAnalyzer::Visit(CConditionalOp &AStmt)
+{
+	bool Address = AddressOperand;
+	AddressOperand = false;
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetTrueExpr()->Accept(*this);
+	AStmt.GetFalseExpr()->Accept(*this);
+	AddressOperand = Address;
+}
+
+void CInductionVariableAnalyzer::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CInductionVariableAnalyzer::Visit(CFloatConst &AStmt)
+{
+}
+
+void CInductionVariableAnalyzer::Visit(CCharConst &AStmt)
+{
+}
+
+void CInductionVariableAnalyzer::Visit(CStringConst &AStmt)
+{
+}
+
+void CInductionVariableAnalyzer::Visit(CVariable &AStmt)
+{
+	Uses[AStmt.GetSymbol()]++;
+
+	if (AddressOperand) {
+		AddressTaken.insert(AStmt.GetSymbol());
+	}
+}
+
+void CInductionVariableAnalyzer::Visit(CFunction &AStmt)
+{
+}
+
+void CInductionVariableAnalyzer::Visit(CPostfixOp &AStmt)
+{
+	AddWrite(AStmt.GetArgument());
+
+	bool Address = AddressOperand;
+	AddressOperand = false;
+	AStmt.GetArgument()->Accept(*this);
+	AddressOperand = Address;
+}
+
+void CInductionVariableAnalyzer::Visit(CFunctionCall &AStmt)
+{
+	bool Address = AddressOperand;
+	AddressOperand = false;
+	for (CFunctionCall::ArgumentsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		(*it)->Accept(*this);
+	}
+	AddressOperand = Address;
+}
+
+void CInductionVariableAnalyzer::Visit(CStructAccess &AStmt)
+{
+	AStmt.GetStruct()->Accept(*this);
+}
+
+void CInductionVariableAnalyzer::Visit(CIndirectAccess &AStmt)
+{
+	bool Address = AddressOperand;
+	AddressOperand = false;
+	AStmt.GetPointer()->Accept(*this);
+	AddressOperand = Address;
+}
+
+void CInductionVariableAnalyzer::Visit(CArrayAccess &AStmt)
+{
+	Accesses.push_back(&AStmt);
+
+	bool Address = AddressOperand;
+
+	// only the address of an array base is taken, a pointer base is just read
+	AddressOperand = Address && AStmt.GetLeft()->GetResultType()->IsArray();
+	AStmt.GetLeft()->Accept(*this);
+	AddressOperand = Address && AStmt.GetRight()->GetResultType()->IsArray();
+	AStmt.GetRight()->Accept(*this);
+
+	AddressOperand = Address;
+}
+
+void CInductionVariableAnalyzer::Visit(CNullStatement &AStmt)
+{
+}
+
+void CInductionVariableAnalyzer::Visit(CBlockStatement &AStmt)
+{
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		(*it)->Accept(*this);
+	}
+}
+
+void CInductionVariableAnalyzer::Visit(CIfStatement &AStmt)
+{
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetThenStatement()->Accept(*this);
+	TryVisit(AStmt.GetElseStatement());
+}
+
+void CInductionVariableAnalyzer::Visit(CForStatement &AStmt)
+{
+	TryVisit(AStmt.GetInit());
+	TryVisit(AStmt.GetCondition());
+	TryVisit(AStmt.GetUpdate());
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CInductionVariableAnalyzer::Visit(CWhileStatement &AStmt)
+{
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CInductionVariableAnalyzer::Visit(CDoStatement &AStmt)
+{
+	AStmt.GetCondition()->Accept(*this);
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CInductionVariableAnalyzer::Visit(CLabel &AStmt)
+{
+	Labels = true;
+	TryVisit(AStmt.GetNext());
+}
+
+void CInductionVariableAnalyzer::Visit(CCaseLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CInductionVariableAnalyzer::Visit(CDefaultCaseLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CInductionVariableAnalyzer::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CInductionVariableAnalyzer::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CInductionVariableAnalyzer::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CInductionVariableAnalyzer::Visit(CReturnStatement &AStmt)
+{
+	TryVisit(AStmt.GetReturnExpression());
+}
+
+void CInductionVariableAnalyzer::Visit(CSwitchStatement &AStmt)
+{
+	AStmt.GetTestExpression()->Accept(*this);
+	AStmt.GetBody()->Accept(*this);
+}
+
+int CInductionVariableAnalyzer::GetWrites(CVariableSymbol *AVariable)
+{
+	return Writes.count(AVariable) ? Writes[AVariable] : 0;
+}
+
+int CInductionVariableAnalyzer::GetUses(CVariableSymbol *AVariable)
+{
+	return Uses.count(AVariable) ? Uses[AVariable] : 0;
+}
+
+bool CInductionVariableAnalyzer::GetAddressTaken(CVariableSymbol *AVariable) const
+{
+	return AddressTaken.count(AVariable) != 0;
+}
+
+bool CInductionVariableAnalyzer::GetLabels() const
+{
+	return Labels;
+}
+
+CInductionVariableAnalyzer::AccessesIterator CInductionVariableAnalyzer::AccessesBegin()
+{
+	return Accesses.begin();
+}
+
+CInductionVariableAnalyzer::AccessesIterator CInductionVariableAnalyzer::AccessesEnd()
+{
+	return Accesses.end();
+}
+
+bool CInductionVariableAnalyzer::GetIncrement(CExpression *AExpr, CVariableSymbol *&AVariable, int &AStep)
+{
+	CVariable *Var = NULL;
+	CIntegerConst *Const = NULL;
+	ETokenType Type = AExpr->GetType();
+
+	if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(AExpr)) {
+		if (Type != TOKEN_TYPE_OPERATION_INCREMENT && Type != TOKEN_TYPE_OPERATION_DECREMENT) {
+			return false;
+		}
+
+		Var = dynamic_cast<CVariable *>(Op->GetArgument());
+		AStep = (Type == TOKEN_TYPE_OPERATION_INCREMENT) ? 1 : -1;
+	} else if (CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AExpr)) {
+		Var = dynamic_cast<CVariable *>(Op->GetLeft());
+		CBinaryOp *Value = dynamic_cast<CBinaryOp *>(Op->GetRight());
+
+		if (Type == TOKEN_TYPE_OPERATION_ASSIGN && Var && Value) {
+			CVariable *Left = dynamic_cast<CVariable *>(Value->GetLeft());
+			CVariable *Right = dynamic_cast<CVariable *>(Value->GetRight());
+
+			Type = Value->GetType();
+
+			if (Left && Left->GetSymbol() == Var->GetSymbol()) {
+				Const = dynamic_cast<CIntegerConst *>(Value->GetRight());
+			} else if (Right && Right->GetSymbol() == Var->GetSymbol() && Type == TOKEN_TYPE_OPERATION_PLUS) {
+				Const = dynamic_cast<CIntegerConst *>(Value->GetLeft());
+			}
+		} else if (Type == TOKEN_TYPE_OPERATION_PLUS_ASSIGN || Type == TOKEN_TYPE_OPERATION_MINUS_ASSIGN) {
+			Const = dynamic_cast<CIntegerConst *>(Op->GetRight());
+			Type = (Type == TOKEN_TYPE_OPERATION_PLUS_ASSIGN) ? TOKEN_TYPE_OPERATION_PLUS : TOKEN_TYPE_OPERATION_MINUS;
+		}
+
+		if (!Const || (Type != TOKEN_TYPE_OPERATION_PLUS && Type != TOKEN_TYPE_OPERATION_MINUS)) {
+			return false;
+		}
+
+		AStep = (Type == TOKEN_TYPE_OPERATION_PLUS) ? Const->GetValue() : -Const->GetValue();
+	}
+
+	if (!Var || AStep == 0) {
+		return false;
+	}
+
+	AVariable = Var->GetSymbol();
+
+	return true;
+}
+
+bool CInductionVariableAnalyzer::IsInvariant(CExpression *AExpr, CInductionVariableAnalyzer &AFunction)
+{
+	if (dynamic_cast<CIntegerConst *>(AExpr)) {
+		return true;
+	}
+
+	if (CVariable *Var = dynamic_cast<CVariable *>(AExpr)) {
+		CVariableSymbol *Symbol = Var->GetSymbol();
+
+		// the address of an array or a structure doesn't change, other
+		// variables must be locals that nothing could modify behind our back
+		if (Symbol->GetType()->IsArray() || Symbol->GetType()->IsStruct()) {
+			return true;
+		}
+
+		return !Symbol->GetGlobal() && !GetWrites(Symbol) && !AFunction.GetAddressTaken(Symbol);
+	}
+
+	if (CArrayAccess *Access = dynamic_cast<CArrayAccess *>(AExpr)) {
+		return Access->GetResultType()->IsArray() && IsInvariant(Access->GetLeft(), AFunction) && IsInvariant(Access->GetRight(), AFunction);
+	}
+
+	if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		return (Access->GetResultType()->IsArray() || Access->GetResultType()->IsStruct()) && IsInvariant(Access->GetStruct(), AFunction);
+	}
+
+	CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AExpr);
+
+	if (Op && typeid(*Op) == typeid(CBinaryOp) && Op->GetResultType()->IsInt() && TokenTraits::IsTrivialOperation(Op->GetType())) {
+		return IsInvariant(Op->GetLeft(), AFunction) && IsInvariant(Op->GetRight(), AFunction);
+	}
+
+	return false;
+}
+
+void CInductionVariableAnalyzer::AddWrite(CExpression *AExpr)
+{
+	if (CVariable *Var = dynamic_cast<CVariable *>(AExpr)) {
+		Writes[Var->GetSymbol()]++;
+	}
+}
+
+/******************************************************************************
+ * CInductionVariableReduction
+ ******************************************************************************/
+
+CInductionVariableReduction::CInductionVariableReduction(CBlockStatement *ABody) : Body(ABody)
+{
+}
+
+void CInductionVariableReduction::Visit(CUnaryOp &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CBinaryOp &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CConditionalOp &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CFloatConst &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CCharConst &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CStringConst &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CVariable &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CFunction &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CPostfixOp &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CFunctionCall &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CStructAccess &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CIndirectAccess &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CArrayAccess &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CNullStatement &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CBlockStatement &AStmt)
+{
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		ParentBlock.push(&AStmt);
+		ParentBlockIterator.push(it);
+
+		(*it)->Accept(*this);
+
+		ParentBlockIterator.pop();
+		ParentBlock.pop();
+	}
+}
+
+void CInductionVariableReduction::Visit(CIfStatement &AStmt)
+{
+	TryVisit(AStmt.GetThenStatement());
+	TryVisit(AStmt.GetElseStatement());
+}
+
+void CInductionVariableReduction::Visit(CForStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+
+	CVariableSymbol *Var;
+	int Step;
+
+	// vectorized loops index their elements with the counter
+	if (!AStmt.GetVectorized() && IsReducible(&AStmt) && AStmt.GetUpdate() && CInductionVariableAnalyzer::GetIncrement(AStmt.GetUpdate(), Var, Step)) {
+		ReduceLoop(&AStmt, &AStmt, Var, Step, NULL, CBlockStatement::StatementsIterator());
+	}
+}
+
+void CInductionVariableReduction::Visit(CWhileStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+	ReduceSingleConditionLoop(AStmt);
+}
+
+void CInductionVariableReduction::Visit(CDoStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+	ReduceSingleConditionLoop(AStmt);
+}
+
+void CInductionVariableReduction::Visit(CLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CInductionVariableReduction::Visit(CCaseLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CInductionVariableReduction::Visit(CDefaultCaseLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CInductionVariableReduction::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CReturnStatement &AStmt)
+{
+}
+
+void CInductionVariableReduction::Visit(CSwitchStatement &AStmt)
+{
+	TryVisit(AStmt.GetBody());
+}
+
+bool CInductionVariableReduction::IsReducible(CStatement *ALoop)
+{
+	// the loop gets wrapped into a new block, so it has to be a statement of a block itself
+	return !ParentBlock.empty() && *ParentBlockIterator.top() == ALoop;
+}
+
+void CInductionVariableReduction::ReduceSingleConditionLoop(CSingleConditionLoopStatement &AStmt)
+{
+	CBlockStatement *LoopBody = dynamic_cast<CBlockStatement *>(AStmt.GetBody());
+
+	if (!IsReducible(&AStmt) || !LoopBody) {
+		return;
+	}
+
+	CVariableSymbol *Var;
+	int Step;
+
+	for (CBlockStatement::StatementsIterator it = LoopBody->Begin(); it != LoopBody->End(); ++it) {
+		CExpression *Expr = dynamic_cast<CExpression *>(*it);
+		if (Expr && CInductionVariableAnalyzer::GetIncrement(Expr, Var, Step) && ReduceLoop(&AStmt, NULL, Var, Step, LoopBody, it)) {
+			return;
+		}
+	}
+}
+
+bool CInductionVariableReduction::ReduceLoop(CStatement *ALoop, CForStatement *AFor, CVariableSymbol *AVariable, int AStep, CBlockStatement *ABody, CBlockStatement::StatementsIterator AIncrement)
+{
+	if (AVariable->GetGlobal() || !AVariable->GetType()->IsInt()) {
+		return false;
+	}
+
+	CInductionVariableAnalyzer Function;
+	Body->Accept(Function);
+
+	CInductionVariableAnalyzer Loop;
+	if (AFor) {
+		if (AFor->GetCondition()) {
+			AFor->GetCondition()->Accept(Loop);
+		}
+		AFor->GetUpdate()->Accept(Loop);
+		AFor->GetBody()->Accept(Loop);
+	} else {
+		ALoop->Accept(Loop);
+	}
+
+	if (Function.GetAddressTaken(AVariable) || Loop.GetWrites(AVariable) != 1 || Loop.GetLabels()) {
+		return false;
+	}
+
+	vector<CCandidate> Candidates;
+	vector<CExpression *> Bases;
+	vector<CTypeSymbol *> ElementTypes;
+
+	for (CInductionVariableAnalyzer::AccessesIterator it = Loop.AccessesBegin(); it != Loop.AccessesEnd(); ++it) {
+		CCandidate Candidate;
+		Candidate.Access = *it;
+
+		if (Candidate.Access->GetLeft()->GetResultType()->IsPointer()) {
+			Candidate.Base = Candidate.Access->GetLeft();
+			Candidate.Index = Candidate.Access->GetRight();
+		} else {
+			Candidate.Base = Candidate.Access->GetRight();
+			Candidate.Index = Candidate.Access->GetLeft();
+		}
+
+		if (!GetIndexOffset(Candidate.Index, AVariable, Candidate.Offset) || !Loop.IsInvariant(Candidate.Base, Function)) {
+			continue;
+		}
+
+		for (Candidate.Group = 0; Candidate.Group < Bases.size(); Candidate.Group++) {
+			if (IsEqual(Bases[Candidate.Group], Candidate.Base)) {
+				break;
+			}
+		}
+
+		if (Candidate.Group == Bases.size()) {
+			Bases.push_back(Candidate.Base);
+			ElementTypes.push_back(Candidate.Access->GetResultType());
+		}
+
+		Candidates.push_back(Candidate);
+	}
+
+	if (Candidates.empty()) {
+		return false;
+	}
+
+	// the counter of a for loop is no longer needed when it only indexes the
+	// reduced accesses and the loop test can compare against a final pointer
+	CBinaryOp *Condition = AFor ? dynamic_cast<CBinaryOp *>(AFor->GetCondition()) : NULL;
+	CExpression *Bound = NULL;
+	bool CounterLeft = false;
+
+	if (Condition && TokenTraits::IsComparisonOperation(Condition->GetType())) {
+		CVariable *Left = dynamic_cast<CVariable *>(Condition->GetLeft());
+		CVariable *Right = dynamic_cast<CVariable *>(Condition->GetRight());
+
+		CounterLeft = Left && Left->GetSymbol() == AVariable;
+		if (CounterLeft || (Right && Right->GetSymbol() == AVariable)) {
+			Bound = CounterLeft ? Condition->GetRight() : Condition->GetLeft();
+		}
+
+		if (Bound && (!Bound->GetResultType()->IsInt() || !Loop.IsInvariant(Bound, Function))) {
+			Bound = NULL;
+		}
+	}
+
+	if (Bound) {
+		CInductionVariableAnalyzer Init, Update;
+		if (AFor->GetInit()) {
+			AFor->GetInit()->Accept(Init);
+		}
+		AFor->GetUpdate()->Accept(Update);
+
+		if (Loop.GetUses(AVariable) != 1 + Update.GetUses(AVariable) + (int) Candidates.size() || Function.GetUses(AVariable) != Loop.GetUses(AVariable) + Init.GetUses(AVariable)) {
+			Bound = NULL;
+		}
+	}
+
+	CBlockStatement *Parent = ParentBlock.top();
+	CBlockStatement *Wrapper = new CBlockStatement;
+
+	CSymbolTable *SymTable = new CSymbolTable;
+	SymTable->SetCurrentOffset(Parent->GetSymbolTable()->GetCurrentOffset());
+	Wrapper->SetSymbolTable(SymTable);
+
+	CPosition Position = Candidates[0].Access->GetPosition();
+	vector<CVariableSymbol *> Pointers;
+
+	for (unsigned int i = 0; i < Bases.size(); i++) {
+		CTypeSymbol *Type = new CPointerSymbol(ElementTypes[i]);
+
+		if (CTypeSymbol *Existing = SymTable->GetType(Type->GetQualifiedName())) {
+			delete Type;
+			Type = Existing;
+		} else {
+			SymTable->AddType(Type);
+		}
+
+		Pointers.push_back(new CVariableSymbol(AVariable->GetName() + "." + ToString(i), Type));
+		SymTable->AddVariable(Pointers.back());
+	}
+
+	CVariableSymbol *End = NULL;
+	if (Bound) {
+		End = new CVariableSymbol(AVariable->GetName() + ".end", Pointers[0]->GetType());
+		SymTable->AddVariable(End);
+	}
+
+	if (AFor && AFor->GetInit()) {
+		Wrapper->Add(AFor->GetInit());
+		AFor->SetInit(NULL);
+	}
+
+	for (unsigned int i = 0; i < Bases.size(); i++) {
+		Wrapper->Add(Assign(Pointers[i], ElementAddress(Bases[i], Variable(AVariable, Position))));
+	}
+
+	for (vector<CCandidate>::iterator it = Candidates.begin(); it != Candidates.end(); ++it) {
+		if (it->Base != Bases[it->Group]) {
+			delete it->Base;
+		}
+		delete it->Index;
+
+		it->Access->SetLeft(Variable(Pointers[it->Group], it->Access->GetPosition()));
+		it->Access->SetRight(new CIntegerConst(CIntegerConstToken(ToString(it->Offset), it->Access->GetPosition()), AVariable->GetType()));
+	}
+
+	if (Bound) {
+		CBinaryOp *Count = new CBinaryOp(CToken(TOKEN_TYPE_OPERATION_MINUS, "-", Position), Bound, Variable(AVariable, Position));
+		Wrapper->Add(Assign(End, ElementAddress(Variable(Pointers[0], Position), Count)));
+
+		delete (CounterLeft ? Condition->GetLeft() : Condition->GetRight());
+		Condition->SetLeft(Variable(CounterLeft ? Pointers[0] : End, Condition->GetPosition()));
+		Condition->SetRight(Variable(CounterLeft ? End : Pointers[0], Condition->GetPosition()));
+	}
+
+	CExpression *Update = NULL;
+	if (AFor) {
+		Update = AFor->GetUpdate();
+		if (Bound) {
+			delete Update;
+			Update = NULL;
+		}
+	}
+
+	CBlockStatement::StatementsIterator InsertPosition = AIncrement;
+	if (ABody) {
+		++InsertPosition;
+	}
+
+	for (unsigned int i = 0; i < Pointers.size(); i++) {
+		CIntegerConst *Step = new CIntegerConst(CIntegerConstToken(ToString(AStep), Position), AVariable->GetType());
+		CExpression *Increment = Assign(Pointers[i], ElementAddress(Variable(Pointers[i], Position), Step));
+
+		if (ABody) {
+			ABody->Insert(InsertPosition, Increment);
+		} else if (Update) {
+			Update = new CBinaryOp(CToken(TOKEN_TYPE_SEPARATOR_COMMA, ",", Update->GetPosition()), Update, Increment);
+		} else {
+			Update = Increment;
+		}
+	}
+
+	if (AFor) {
+		AFor->SetUpdate(Update);
+	}
+
+	Wrapper->Add(ALoop);
+	*ParentBlockIterator.top() = Wrapper;
+
+	MoveNestedBlocks(ALoop, Parent, Wrapper, SymTable->GetElementsSize());
+	Parent->AddNestedBlock(Wrapper);
+
+	return true;
+}
+
+bool CInductionVariableReduction::GetIndexOffset(CExpression *AIndex, CVariableSymbol *AVariable, int &AOffset)
+{
+	if (CVariable *Var = dynamic_cast<CVariable *>(AIndex)) {
+		AOffset = 0;
+		return Var->GetSymbol() == AVariable;
+	}
+
+	CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AIndex);
+
+	if (!Op || (Op->GetType() != TOKEN_TYPE_OPERATION_PLUS && Op->GetType() != TOKEN_TYPE_OPERATION_MINUS)) {
+		return false;
+	}
+
+	CVariable *Var = dynamic_cast<CVariable *>(Op->GetLeft());
+	CIntegerConst *Const = dynamic_cast<CIntegerConst *>(Op->GetRight());
+
+	if (!Var && Op->GetType() == TOKEN_TYPE_OPERATION_PLUS) {
+		Var = dynamic_cast<CVariable *>(Op->GetRight());
+		Const = dynamic_cast<CIntegerConst *>(Op->GetLeft());
+	}
+
+	if (!Var || !Const || Var->GetSymbol() != AVariable) {
+		return false;
+	}
+
+	AOffset = (Op->GetType() == TOKEN_TYPE_OPERATION_PLUS) ? Const->GetValue() : -Const->GetValue();
+
+	return true;
+}
+
+bool CInductionVariableReduction::IsEqual(CExpression *A, CExpression *B)
+{
+	if (typeid(*A) != typeid(*B)) {
+		return false;
+	}
+
+	if (CVariable *Var = dynamic_cast<CVariable *>(A)) {
+		return Var->GetSymbol() == static_cast<CVariable *>(B)->GetSymbol();
+	}
+
+	if (CIntegerConst *Const = dynamic_cast<CIntegerConst *>(A)) {
+		return Const->GetValue() == static_cast<CIntegerConst *>(B)->GetValue();
+	}
+
+	if (CStructAccess *Access = dynamic_cast<CStructAccess *>(A)) {
+		CStructAccess *Other = static_cast<CStructAccess *>(B);
+		return Access->GetField()->GetSymbol() == Other->GetField()->GetSymbol() && IsEqual(Access->GetStruct(), Other->GetStruct());
+	}
+
+	if (CBinaryOp *Op = dynamic_cast<CBinaryOp *>(A)) {
+		CBinaryOp *Other = static_cast<CBinaryOp *>(B);
+		return Op->GetType() == Other->GetType() && IsEqual(Op->GetLeft(), Other->GetLeft()) && IsEqual(Op->GetRight(), Other->GetRight());
+	}
+
+	return false;
+}
+
+CExpression* CInductionVariableReduction::ElementAddress(CExpression *ABase, CExpression *AIndex)
+{
+	CArrayAccess *Access = new CArrayAccess(CToken(TOKEN_TYPE_LEFT_SQUARE_BRACKET, "[", AIndex->GetPosition()), ABase, AIndex);
+	return new CAddressOfOp(CToken(TOKEN_TYPE_OPERATION_AMPERSAND, "&", AIndex->GetPosition()), Access);
+}
+
+CExpression* CInductionVariableReduction::Assign(CVariableSymbol *AVariable, CExpression *AValue)
+{
+	CBinaryOp *Op = new CBinaryOp(CToken(TOKEN_TYPE_OPERATION_ASSIGN, "=", AValue->GetPosition()));
+	Op->SetLeft(Variable(AVariable, AValue->GetPosition()));
+	Op->SetRight(AValue);
+
+	return Op;
+}
+
+CVariable* CInductionVariableReduction::Variable(CVariableSymbol *AVariable, const CPosition &APosition)
+{
+	return new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, AVariable->GetName(), APosition), AVariable);
+}
+
+void CInductionVariableReduction::MoveNestedBlocks(CStatement *AStmt, CBlockStatement *AFrom, CBlockStatement *ATo, size_t AShift)
+{
+	if (!AStmt) {
+		return;
+	}
+
+	if (CSwitchStatement *Switch = dynamic_cast<CSwitchStatement *>(AStmt)) {
+		MoveNestedBlocks(Switch->GetBody(), AFrom, ATo, AShift);
+	} else if (CBlockStatement *Block = dynamic_cast<CBlockStatement *>(AStmt)) {
+		AFrom->RemoveNestedBlock(Block);
+		ATo->AddNestedBlock(Block);
+		ShiftBlock(Block, AShift);
+	} else if (CIfStatement *If = dynamic_cast<CIfStatement *>(AStmt)) {
+		MoveNestedBlocks(If->GetThenStatement(), AFrom, ATo, AShift);
+		MoveNestedBlocks(If->GetElseStatement(), AFrom, ATo, AShift);
+	} else if (CForStatement *For = dynamic_cast<CForStatement *>(AStmt)) {
+		MoveNestedBlocks(For->GetBody(), AFrom, ATo, AShift);
+	} else if (CSingleConditionLoopStatement *Loop = dynamic_cast<CSingleConditionLoopStatement *>(AStmt)) {
+		MoveNestedBlocks(Loop->GetBody(), AFrom, ATo, AShift);
+	} else if (CLabel *Label = dynamic_cast<CLabel *>(AStmt)) {
+		MoveNestedBlocks(Label->GetNext(), AFrom, ATo, AShift);
+	}
+}
+
+void CInductionVariableReduction::ShiftBlock(CBlockStatement *ABlock, size_t AShift)
+{
+	CSymbolTable *SymTable = ABlock->GetSymbolTable();
+
+	for (CSymbolTable::VariablesIterator it = SymTable->VariablesBegin(); it != SymTable->VariablesEnd(); ++it) {
+		it->second->SetOffset(it->second->GetOffset() - (int) AShift);
+	}
+
+	SymTable->SetCurrentOffset(SymTable->GetCurrentOffset() + AShift);
+
+	for (CBlockStatement::NestedBlocksIterator it = ABlock->NestedBlocksBegin(); it != ABlock->NestedBlocksEnd(); ++it) {
+		ShiftBlock(*it, AShift);
+	}
+}
+
+/******************************************************************************
+ * CLoopUnrolling
+ ******************************************************************************/
+
+CLoopUnrolling::CLoopUnrolling(CFunctionSymbol *AFunction, unsigned int ALimit, unsigned int AFactor, const CProfile *AProfile /*= NULL*/) : Function(AFunction), Limit(ALimit), Factor(AFactor), Profile(AProfile)
+{
+}
+
+void CLoopUnrolling::Visit(CUnaryOp &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CBinaryOp &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CConditionalOp &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CFloatConst &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CCharConst &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CStringConst &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CVariable &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CFunction &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CPostfixOp &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CFunctionCall &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CStructAccess &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CIndirectAccess &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CArrayAccess &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CNullStatement &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CBlockStatement &AStmt)
+{
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		ParentBlock.push(&AStmt);
+		ParentBlockIterator.push(it);
+
+		(*it)->Accept(*this);
+
+		ParentBlockIterator.pop();
+		ParentBlock.pop();
+	}
+}
+
+void CLoopUnrolling::Visit(CIfStatement &AStmt)
+{
+	TryVisit(AStmt.GetThenStatement());
+	TryVisit(AStmt.GetElseStatement());
+}
+
+void CLoopUnrolling::Visit(CForStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+
+	// the loop is replaced with a block, so it has to be a statement of a block itself
+	if (!AStmt.GetVectorized() && !ParentBlock.empty() && *ParentBlockIterator.top() == &AStmt) {
+		Unroll(AStmt);
+	}
+}
+
+void CLoopUnrolling::Visit(CWhileStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CLoopUnrolling::Visit(CDoStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CLoopUnrolling::Visit(CLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CLoopUnrolling::Visit(CCaseLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CLoopUnrolling::Visit(CDefaultCaseLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CLoopUnrolling::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CReturnStatement &AStmt)
+{
+}
+
+void CLoopUnrolling::Visit(CSwitchStatement &AStmt)
+{
+	TryVisit(AStmt.GetBody());
+}
+
+/*
+ * A loop "for (i = a; i < n; i += s)" with a constant trip count is replaced
+ * by a copy of its body for every value of i, when the copies fit into the
+ * limit. Otherwise a new loop runs Factor copies of the body per
+ * iteration, and the original loop is left to finish the remaining ones.
+ */
+bool CLoopUnrolling::Unroll(CForStatement &AStmt)
+{
+	CBinaryOp *Init = dynamic_cast<CBinaryOp *>(AStmt.GetInit());
+	CBinaryOp *Condition = dynamic_cast<CBinaryOp *>(AStmt.GetCondition());
+	CVariableSymbol *Var;
+	int Step;
+
+	if (!Init || Init->GetType() != TOKEN_TYPE_OPERATION_ASSIGN || !Condition || !AStmt.GetUpdate()
+		|| !CInductionVariableAnalyzer::GetIncrement(AStmt.GetUpdate(), Var, Step)) {
+		return false;
+	}
+
+	CVariable *Counter = dynamic_cast<CVariable *>(Init->GetLeft());
+	CVariable *Tested = dynamic_cast<CVariable *>(Condition->GetLeft());
+	CExpression *Bound = Condition->GetRight();
+	ETokenType Type = Condition->GetType();
+
+	bool Inclusive = (Type == TOKEN_TYPE_OPERATION_LESS_THAN_OR_EQUAL || Type == TOKEN_TYPE_OPERATION_GREATER_THAN_OR_EQUAL);
+	bool Ascending = (Type == TOKEN_TYPE_OPERATION_LESS_THAN || Type == TOKEN_TYPE_OPERATION_LESS_THAN_OR_EQUAL);
+	bool Descending = (Type == TOKEN_TYPE_OPERATION_GREATER_THAN || Type == TOKEN_TYPE_OPERATION_GREATER_THAN_OR_EQUAL);
+
+	if (!Counter || Counter->GetSymbol() != Var || !Tested || Tested->GetSymbol() != Var || !((Ascending && Step > 0) || (Descending && Step < 0))) {
+		return false;
+	}
+
+	if (Var->GetGlobal() || !Var->GetType()->IsInt() || !Bound->GetResultType()->IsInt()) {
+		return false;
+	}
+
+	CInductionVariableAnalyzer Usage;
+	Function->GetBody()->Accept(Usage);
+
+	CInductionVariableAnalyzer Loop;
+	Condition->Accept(Loop);
+	AStmt.GetUpdate()->Accept(Loop);
+	AStmt.GetBody()->Accept(Loop);
+
+	if (Usage.GetAddressTaken(Var) || Loop.GetWrites(Var) != 1 || !Loop.IsInvariant(Bound, Usage)) {
+		return false;
+	}
+
+	CInliningCostEstimator Estimator(NULL);
+	AStmt.GetBody()->Accept(Estimator);
+
+	if (!Estimator.GetInlinable() || Estimator.GetJumps() || Estimator.GetReturns()) {
+		return false;
+	}
+
+	CIntegerConst *First = dynamic_cast<CIntegerConst *>(Init->GetRight());
+	CIntegerConst *Last = dynamic_cast<CIntegerConst *>(Bound);
+	long long Count = -1;
+
+	if (First && Last) {
+		long long Distance = ((long long) Last->GetValue() - First->GetValue()) * (Step > 0 ? 1 : -1) + (Inclusive ? 1 : 0);
+		long long Stride = Step > 0 ? Step : -(long long) Step;
+
+		Count = Distance > 0 ? (Distance + Stride - 1) / Stride : 0;
+	}
+
+	bool Full = Count >= 0 && Count * Estimator.GetCost() <= Limit;
+
+	if (!Full && (Factor < 2 || Factor * Estimator.GetCost() > Limit)) {
+		return false;
+	}
+
+	// loops that never ran in the profile, or ran too few iterations to get past the remainder, stay as they are
+	unsigned long long Entries, Iterations;
+
+	if (Profile && Profile->GetCount(&AStmt, PROFILE_COUNTER_ENTRY, Entries) && Profile->GetCount(&AStmt, PROFILE_COUNTER_BODY, Iterations)
+		&& (!Entries || (!Full && Iterations < Factor * Entries))) {
+		return false;
+	}
+
+	CBlockStatement *Parent = ParentBlock.top();
+	CBlockStatement *Block = new CBlockStatement;
+
+	CSymbolTable *SymTable = new CSymbolTable;
+	SymTable->SetCurrentOffset(Parent->GetSymbolTable()->GetCurrentOffset());
+	Block->SetSymbolTable(SymTable);
+
+	Parent->AddNestedBlock(Block);
+	*ParentBlockIterator.top() = Block;
+
+	CPosition Position = Condition->GetPosition();
+
+	if (Full) {
+		CInlineExpander Expander(Function, Block, NULL, "");
+
+		for (long long i = 0; i < Count; i++) {
+			Expander.AddConstant(Var, First->GetValue() + i * Step);
+			Block->Add(Expander.Clone(AStmt.GetBody()));
+		}
+
+		Block->Add(Expander.Assign(Var, Constant(First->GetValue() + Count * Step, Var->GetType())));
+
+		MoveNestedBlocks(&AStmt, Parent, NULL);
+		delete &AStmt;
+
+		return true;
+	}
+
+	CBlockStatement *Body = new CBlockStatement;
+
+	CSymbolTable *BodySymTable = new CSymbolTable;
+	BodySymTable->SetCurrentOffset(SymTable->GetCurrentOffset());
+	Body->SetSymbolTable(BodySymTable);
+
+	Block->AddNestedBlock(Body);
+
+	CInlineExpander Expander(Function, Body, NULL, "");
+
+	for (unsigned int i = 0; i < Factor; i++) {
+		Expander.AddOffset(Var, i * Step);
+		Body->Add(Expander.Clone(AStmt.GetBody()));
+	}
+
+	CExpression *Limit = new CBinaryOp(CToken(TOKEN_TYPE_OPERATION_MINUS, "-", Position), Expander.CloneExpression(Bound), Constant((Factor - 1) * Step, Var->GetType()));
+	CExpression *Test = new CBinaryOp(CToken(Type, Condition->GetName(), Position), new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, Var->GetName(), Position), Var), Limit);
+	CExpression *Update = new CBinaryOp(CToken(TOKEN_TYPE_OPERATION_PLUS_ASSIGN, "+=", Position), new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, Var->GetName(), Position), Var), Constant(Factor * Step, Var->GetType()));
+
+	Block->Add(new CForStatement(Init, Test, Update, Body));
+	AStmt.SetInit(NULL);
+	Block->Add(&AStmt);
+
+	MoveNestedBlocks(&AStmt, Parent, Block);
+
+	return true;
+}
+
+CExpression* CLoopUnrolling::Constant(int AValue, CTypeSymbol *AType)
+{
+	return new CIntegerConst(CIntegerConstToken(ToString(AValue), CPosition()), AType);
+}
+
+void CLoopUnrolling::MoveNestedBlocks(CStatement *AStmt, CBlockStatement *AFrom, CBlockStatement *ATo)
+{
+	if (!AStmt) {
+		return;
+	}
+
+	if (CSwitchStatement *Switch = dynamic_cast<CSwitchStatement *>(AStmt)) {
+		MoveNestedBlocks(Switch->GetBody(), AFrom, ATo);
+	} else if (CBlockStatement *Block = dynamic_cast<CBlockStatement *>(AStmt)) {
+		AFrom->RemoveNestedBlock(Block);
+
+		if (ATo) {
+			ATo->AddNestedBlock(Block);
+		}
+	} else if (CIfStatement *If = dynamic_cast<CIfStatement *>(AStmt)) {
+		MoveNestedBlocks(If->GetThenStatement(), AFrom, ATo);
+		MoveNestedBlocks(If->GetElseStatement(), AFrom, ATo);
+	} else if (CForStatement *For = dynamic_cast<CForStatement *>(AStmt)) {
+		MoveNestedBlocks(For->GetBody(), AFrom, ATo);
+	} else if (CSingleConditionLoopStatement *Loop = dynamic_cast<CSingleConditionLoopStatement *>(AStmt)) {
+		MoveNestedBlocks(Loop->GetBody(), AFrom, ATo);
+	} else if (CLabel *Label = dynamic_cast<CLabel *>(AStmt)) {
+		MoveNestedBlocks(Label->GetNext(), AFrom, ATo);
+	}
+}
+
+/******************************************************************************
+ * CLoopVectorization
+ ******************************************************************************/
+
+CLoopVectorization::CLoopVectorization(CFunctionSymbol *AFunction) : Function(AFunction), Counter(NULL)
+{
+}
+
+void CLoopVectorization::Visit(CUnaryOp &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CBinaryOp &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CConditionalOp &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CFloatConst &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CCharConst &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CStringConst &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CVariable &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CFunction &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CPostfixOp &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CFunctionCall &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CStructAccess &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CIndirectAccess &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CArrayAccess &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CNullStatement &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CBlockStatement &AStmt)
+{
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		ParentBlock.push(&AStmt);
+		ParentBlockIterator.push(it);
+
+		(*it)->Accept(*this);
+
+		ParentBlockIterator.pop();
+		ParentBlock.pop();
+	}
+}
+
+void CLoopVectorization::Visit(CIfStatement &AStmt)
+{
+	TryVisit(AStmt.GetThenStatement());
+	TryVisit(AStmt.GetElseStatement());
+}
+
+void CLoopVectorization::Visit(CForStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+
+	// the loop is replaced with a block, so it has to be a statement of a block itself
+	if (!ParentBlock.empty() && *ParentBlockIterator.top() == &AStmt) {
+		Vectorize(AStmt);
+	}
+}
+
+void CLoopVectorization::Visit(CWhileStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CLoopVectorization::Visit(CDoStatement &AStmt)
+{
+	AStmt.GetBody()->Accept(*this);
+}
+
+void CLoopVectorization::Visit(CLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CLoopVectorization::Visit(CCaseLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CLoopVectorization::Visit(CDefaultCaseLabel &AStmt)
+{
+	TryVisit(AStmt.GetNext());
+}
+
+void CLoopVectorization::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CReturnStatement &AStmt)
+{
+}
+
+void CLoopVectorization::Visit(CSwitchStatement &AStmt)
+{
+	TryVisit(AStmt.GetBody());
+}
+
+/*
+ * Collects the assignments a loop body consists of, fails on anything else.
+ */
+bool CLoopVectorization::GetStatements(CStatement *AStmt, StatementsContainer &AStatements)
+{
+	if (dynamic_cast<CNullStatement *>(AStmt)) {
+		return true;
+	}
+
+	if (CBlockStatement *Block = dynamic_cast<CBlockStatement *>(AStmt)) {
+		if (typeid(*Block) != typeid(CBlockStatement) || Block->GetSymbolTable()->VariablesBegin() != Block->GetSymbolTable()->VariablesEnd()) {
+			return false;
+		}
+
+		for (CBlockStatement::StatementsIterator it = Block->Begin(); it != Block->End(); ++it) {
+			if (!GetStatements(*it, AStatements)) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AStmt);
+
+	if (!Op || typeid(*Op) != typeid(CBinaryOp) || !TokenTraits::IsAssignment(Op->GetType())) {
+		return false;
+	}
+
+	AStatements.push_back(Op);
+
+	return true;
+}
+
+/*
+ * Returns the value added to the variable by "s = s + e", "s = e + s" or
+ * "s += e", or NULL for other statements.
+ */
+CExpression* CLoopVectorization::GetReduction(CBinaryOp *AStmt)
+{
+	CVariable *Var = dynamic_cast<CVariable *>(AStmt->GetLeft());
+
+	if (!Var) {
+		return NULL;
+	}
+
+	if (AStmt->GetType() == TOKEN_TYPE_OPERATION_PLUS_ASSIGN) {
+		return AStmt->GetRight();
+	}
+
+	CBinaryOp *Sum = dynamic_cast<CBinaryOp *>(AStmt->GetRight());
+
+	if (AStmt->GetType() != TOKEN_TYPE_OPERATION_ASSIGN || !Sum || typeid(*Sum) != typeid(CBinaryOp) || Sum->GetType() != TOKEN_TYPE_OPERATION_PLUS) {
+		return NULL;
+	}
+
+	CVariable *Left = dynamic_cast<CVariable *>(Sum->GetLeft());
+	CVariable *Right = dynamic_cast<CVariable *>(Sum->GetRight());
+
+	if (Left && Left->GetSymbol() == Var->GetSymbol()) {
+		return Sum->GetRight();
+	} else if (Right && Right->GetSymbol() == Var->GetSymbol()) {
+		return Sum->GetLeft();
+	}
+
+	return NULL;
+}
+
+/*
+ * Returns the operation performed by a compound assignment, when it has a
+ * vector counterpart, TOKEN_TYPE_OPERATION_ASSIGN for a simple assignment
+ * and TOKEN_TYPE_INVALID otherwise.
+ */
+ETokenType CLoopVectorization::GetOperation(ETokenType AType)
+{
+	switch (AType) {
+	case TOKEN_TYPE_OPERATION_ASSIGN:
+		return TOKEN_TYPE_OPERATION_ASSIGN;
+	case TOKEN_TYPE_OPERATION_PLUS_ASSIGN:
+		return TOKEN_TYPE_OPERATION_PLUS;
+	case TOKEN_TYPE_OPERATION_MINUS_ASSIGN:
+		return TOKEN_TYPE_OPERATION_MINUS;
+	case TOKEN_TYPE_OPERATION_ASTERISK_ASSIGN:
+		return TOKEN_TYPE_OPERATION_ASTERISK;
+	case TOKEN_TYPE_OPERATION_SLASH_ASSIGN:
+		return TOKEN_TYPE_OPERATION_SLASH;
+	case TOKEN_TYPE_OPERATION_AMPERSAND_ASSIGN:
+		return TOKEN_TYPE_OPERATION_AMPERSAND;
+	case TOKEN_TYPE_OPERATION_BITWISE_OR_ASSIGN:
+		return TOKEN_TYPE_OPERATION_BITWISE_OR;
+	case TOKEN_TYPE_OPERATION_BITWISE_XOR_ASSIGN:
+		return TOKEN_TYPE_OPERATION_BITWISE_XOR;
+	default:
+		return TOKEN_TYPE_INVALID;
+	}
+}
+
+/*
+ * SSE2 adds, subtracts and does bitwise operations on four ints, and does
+ * the four arithmetic operations on four floats. There is no instruction
+ * multiplying four ints, nor dividing them.
+ */
+bool CLoopVectorization::IsOperation(ETokenType AType, bool AFloat)
+{
+	if (AType == TOKEN_TYPE_OPERATION_PLUS || AType == TOKEN_TYPE_OPERATION_MINUS) {
+		return true;
+	}
+
+	if (AFloat) {
+		return AType == TOKEN_TYPE_OPERATION_ASTERISK || AType == TOKEN_TYPE_OPERATION_SLASH;
+	}
+
+	return AType == TOKEN_TYPE_OPERATION_AMPERSAND || AType == TOKEN_TYPE_OPERATION_BITWISE_OR || AType == TOKEN_TYPE_OPERATION_BITWISE_XOR;
+}
+
+/*
+ * Operands that are the same in all the lanes, they are broadcast to a
+ * register of their own before the loop.
+ */
+bool CLoopVectorization::IsBroadcast(CExpression *AExpr)
+{
+	if (dynamic_cast<CIntegerConst *>(AExpr) || dynamic_cast<CFloatConst *>(AExpr)) {
+		return true;
+	}
+
+	CVariable *Var = dynamic_cast<CVariable *>(AExpr);
+
+	return Var && !Var->GetResultType()->IsArray();
+}
+
+/*
+ * A loop "for (i = a; i < n; i++)", whose body only assigns expressions of
+ * a[i] elements and invariants to elements of arrays, or sums them into int
+ * variables, is replaced by a loop doing Width iterations at once with SSE2
+ * instructions, followed by the original loop for the remaining ones. As
+ * every element is accessed with the counter as its index, iterations of
+ * the vector loop can't depend on each other. Float sums are left alone,
+ * since adding in a different order would change their results.
+ */
+bool CLoopVectorization::Vectorize(CForStatement &AStmt)
+{
+	CBinaryOp *Init = dynamic_cast<CBinaryOp *>(AStmt.GetInit());
+	CBinaryOp *Condition = dynamic_cast<CBinaryOp *>(AStmt.GetCondition());
+	CVariableSymbol *Var;
+	int Step;
+
+	if (!Init || Init->GetType() != TOKEN_TYPE_OPERATION_ASSIGN || !Condition || !AStmt.GetUpdate()
+		|| !CInductionVariableAnalyzer::GetIncrement(AStmt.GetUpdate(), Var, Step) || Step != 1) {
+		return false;
+	}
+
+	CVariable *Initialized = dynamic_cast<CVariable *>(Init->GetLeft());
+	CVariable *Tested = dynamic_cast<CVariable *>(Condition->GetLeft());
+	CExpression *Bound = Condition->GetRight();
+	ETokenType Type = Condition->GetType();
+
+	if (!Initialized || Initialized->GetSymbol() != Var || !Tested || Tested->GetSymbol() != Var
+		|| (Type != TOKEN_TYPE_OPERATION_LESS_THAN && Type != TOKEN_TYPE_OPERATION_LESS_THAN_OR_EQUAL)) {
+		return false;
+	}
+
+	if (Var->GetGlobal() || !Var->GetType()->IsInt() || !Bound->GetResultType()->IsInt()) {
+		return false;
+	}
+
+	CInductionVariableAnalyzer Usage;
+	Function->GetBody()->Accept(Usage);
+
+	CInductionVariableAnalyzer Loop;
+	Condition->Accept(Loop);
+	AStmt.GetUpdate()->Accept(Loop);
+	AStmt.GetBody()->Accept(Loop);
+
+	if (Usage.GetAddressTaken(Var) || Loop.GetWrites(Var) != 1 || !Loop.IsInvariant(Bound, Usage)) {
+		return false;
+	}
+
+	StatementsContainer Statements;
+
+	if (!GetStatements(AStmt.GetBody(), Statements) || Statements.empty()) {
+		return false;
+	}
+
+	Counter = Var;
+
+	int Accumulators = 0;
+	int Broadcasts = 0;
+	int Registers = 0;
+
+	for (StatementsContainer::iterator it = Statements.begin(); it != Statements.end(); ++it) {
+		CExpression *Value = GetReduction(*it);
+		bool Float = false;
+		int Needed;
+
+		if (Value) {
+			CVariableSymbol *Sum = static_cast<CVariable *>((*it)->GetLeft())->GetSymbol();
+			int Uses = ((*it)->GetType() == TOKEN_TYPE_OPERATION_ASSIGN) ? 2 : 1;
+
+			if (Sum->GetGlobal() || !Sum->GetType()->IsInt() || Usage.GetAddressTaken(Sum) || Loop.GetWrites(Sum) != 1 || Loop.GetUses(Sum) != Uses) {
+				return false;
+			}
+
+			Accumulators++;
+
+			if (!(Needed = GetRegisters(Value, Float, Loop, Usage, Broadcasts))) {
+				return false;
+			}
+		} else {
+			Float = (*it)->GetLeft()->GetResultType()->IsFloat();
+			Value = (*it)->GetRight();
+			ETokenType Operation = GetOperation((*it)->GetType());
+
+			if (!IsElement((*it)->GetLeft(), Float) || Operation == TOKEN_TYPE_INVALID || (Operation != TOKEN_TYPE_OPERATION_ASSIGN && !IsOperation(Operation, Float))) {
+				return false;
+			}
+
+			if (!(Needed = GetRegisters(Value, Float, Loop, Usage, Broadcasts))) {
+				return false;
+			}
+
+			// a compound assignment loads the element first
+			if (Operation != TOKEN_TYPE_OPERATION_ASSIGN) {
+				Needed = IsBroadcast(Value) ? 1 : Needed + 1;
+			}
+		}
+
+		Registers = max(Registers, Needed);
+	}
+
+	if (Accumulators + Broadcasts + Registers > 8) {
+		return false;
+	}
+
+	CBlockStatement *Parent = ParentBlock.top();
+	CBlockStatement *Block = new CBlockStatement;
+
+	CSymbolTable *SymTable = new CSymbolTable;
+	SymTable->SetCurrentOffset(Parent->GetSymbolTable()->GetCurrentOffset());
+	Block->SetSymbolTable(SymTable);
+
+	Parent->AddNestedBlock(Block);
+	*ParentBlockIterator.top() = Block;
+
+	CPosition Position = Condition->GetPosition();
+	CInlineExpander Expander(Function, Block, NULL, "");
+
+	CExpression *Limit = new CBinaryOp(CToken(TOKEN_TYPE_OPERATION_MINUS, "-", Position), Expander.CloneExpression(Bound), CLoopUnrolling::Constant(Width - 1, Var->GetType()));
+	CExpression *Test = new CBinaryOp(CToken(Type, Condition->GetName(), Position), new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, Var->GetName(), Position), Var), Limit);
+	CExpression *Update = new CBinaryOp(CToken(TOKEN_TYPE_OPERATION_PLUS_ASSIGN, "+=", Position), new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, Var->GetName(), Position), Var), CLoopUnrolling::Constant(Width, Var->GetType()));
+
+	CForStatement *Vector = new CForStatement(Init, Test, Update, Expander.Clone(AStmt.GetBody()));
+	Vector->SetVectorized(true);
+
+	Block->Add(Vector);
+	AStmt.SetInit(NULL);
+	Block->Add(&AStmt);
+
+	CLoopUnrolling::MoveNestedBlocks(&AStmt, Parent, Block);
+
+	return true;
+}
+
+/*
+ * Returns the number of registers evaluating the expression takes, not
+ * counting the broadcast operands, or 0 if it can't be vectorized.
+ */
+int CLoopVectorization::GetRegisters(CExpression *AExpr, bool AFloat, CInductionVariableAnalyzer &ALoop, CInductionVariableAnalyzer &AFunction, int &ABroadcasts)
+{
+	if (IsElement(AExpr, AFloat)) {
+		return 1;
+	}
+
+	if (IsBroadcast(AExpr)) {
+		if ((AFloat ? !AExpr->GetResultType()->IsFloat() : !AExpr->GetResultType()->IsInt())) {
+			return 0;
+		}
+
+		if (dynamic_cast<CVariable *>(AExpr) && !ALoop.IsInvariant(AExpr, AFunction)) {
+			return 0;
+		}
+
+		ABroadcasts++;
+		return 1;
+	}
+
+	CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AExpr);
+
+	if (!Op || typeid(*Op) != typeid(CBinaryOp) || !IsOperation(Op->GetType(), AFloat)) {
+		return 0;
+	}
+
+	int Left = GetRegisters(Op->GetLeft(), AFloat, ALoop, AFunction, ABroadcasts);
+	int Right = GetRegisters(Op->GetRight(), AFloat, ALoop, AFunction, ABroadcasts);
+
+	if (!Left || !Right) {
+		return 0;
+	}
+
+	// a broadcast right operand is used right from its register
+	return IsBroadcast(Op->GetRight()) ? Left : max(Left, Right + 1);
+}
+
+/*
+ * An int or float element of an array, indexed by the loop counter.
+ */
+bool CLoopVectorization::IsElement(CExpression *AExpr, bool AFloat)
+{
+	CArrayAccess *Access = dynamic_cast<CArrayAccess *>(AExpr);
+
+	if (!Access || (AFloat ? !Access->GetResultType()->IsFloat() : !Access->GetResultType()->IsInt())) {
+		return false;
+	}
+
+	CVariable *Base = dynamic_cast<CVariable *>(Access->GetLeft());
+	CVariable *Index = dynamic_cast<CVariable *>(Access->GetRight());
+
+	return Base && Base->GetResultType()->IsArray() && Index && Index->GetSymbol() == Counter;
+}
+
+/******************************************************************************
+ * CCommonSubexpressionElimination
+ ******************************************************************************/
+
+CCommonSubexpressionElimination::CCommonSubexpressionElimination(CFunctionSymbol *AFunction) : Function(AFunction), Transform(false), Anchored(false), Defining(false)
+{
+	Function->GetBody()->Accept(Usage);
+	Reset();
+}
+
+void CCommonSubexpressionElimination::Visit(CUnaryOp &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CBinaryOp &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CConditionalOp &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CFloatConst &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CCharConst &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CStringConst &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CVariable &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CFunction &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CPostfixOp &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CFunctionCall &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CStructAccess &AStmt)
+{
+}
+
+void CCommonSubexpressionElimination::Visit(CIndirectAccess &AStmt)
 {
-	Result = AStmt.GetValue();
 }
 
-void CConstantExpressionComputer::Visit(CStringConst &AStmt)
+void CCommonSubexpressionElimination::Visit(CArrayAccess &AStmt)
 {
 }
 
-void CConstantExpressionComputer::Visit(CVariable &AStmt)
+void CCommonSubexpressionElimination::Visit(CNullStatement &AStmt)
 {
 }
 
-void CConstantExpressionComputer::Visit(CFunction &AStmt)
+void CCommonSubexpressionElimination::Visit(CBlockStatement &AStmt)
 {
+	// the first walk over the function finds the occurrences that are
+	// computed again later, the second one moves them into temporaries
+	if (&AStmt == Function->GetBody() && !Transform) {
+		ProcessBlock(AStmt);
+		Reset();
+		Transform = true;
+	}
+
+	ProcessBlock(AStmt);
 }
 
-void CConstantExpressionComputer::Visit(CPostfixOp &AStmt)
+void CCommonSubexpressionElimination::Visit(CIfStatement &AStmt)
 {
+	AStmt.SetCondition(ProcessStatement(AStmt.GetCondition(), Anchored));
+
+	VariablesContainer Before = Variables;
+	unsigned int MemoryBefore = Memory;
+
+	AStmt.SetThenStatement(ProcessNested(AStmt.GetThenStatement()));
+
+	VariablesContainer Then = Variables;
+	unsigned int MemoryThen = Memory;
+
+	Variables = Before;
+	Memory = MemoryBefore;
+
+	AStmt.SetElseStatement(ProcessNested(AStmt.GetElseStatement()));
+
+	Merge(Then, MemoryThen);
 }
 
-void CConstantExpressionComputer::Visit(CFunctionCall &AStmt)
+void CCommonSubexpressionElimination::Visit(CForStatement &AStmt)
 {
+	if (AStmt.GetVectorized()) {
+		Kill(&AStmt);
+		return;
+	}
+
+	if (AStmt.GetInit()) {
+		AStmt.SetInit(ProcessStatement(AStmt.GetInit(), Anchored));
+	}
+
+	Kill(&AStmt);
+
+	VariablesContainer Head = Variables;
+	unsigned int MemoryHead = Memory;
+
+	if (AStmt.GetCondition()) {
+		AStmt.SetCondition(ProcessStatement(AStmt.GetCondition(), false));
+	}
+
+	AStmt.SetBody(ProcessNested(AStmt.GetBody()));
+
+	// the update is also reached by continue, so it only relies on what
+	// holds for the whole loop
+	Variables = Head;
+	Memory = MemoryHead;
+
+	if (AStmt.GetUpdate()) {
+		AStmt.SetUpdate(ProcessStatement(AStmt.GetUpdate(), false));
+	}
+
+	Kill(&AStmt);
 }
 
-void CConstantExpressionComputer::Visit(CStructAccess &AStmt)
+void CCommonSubexpressionElimination::Visit(CWhileStatement &AStmt)
 {
+	Kill(&AStmt);
+
+	AStmt.SetCondition(ProcessStatement(AStmt.GetCondition(), false));
+	AStmt.SetBody(ProcessNested(AStmt.GetBody()));
+
+	Kill(&AStmt);
 }
 
-void CConstantExpressionComputer::Visit(CIndirectAccess &AStmt)
+void CCommonSubexpressionElimination::Visit(CDoStatement &AStmt)
 {
+	Kill(&AStmt);
+
+	VariablesContainer Head = Variables;
+	unsigned int MemoryHead = Memory;
+
+	AStmt.SetBody(ProcessNested(AStmt.GetBody()));
+
+	Variables = Head;
+	Memory = MemoryHead;
+
+	AStmt.SetCondition(ProcessStatement(AStmt.GetCondition(), false));
+
+	Kill(&AStmt);
 }
 
-void CConstantExpressionComputer::Visit(CArrayAccess &AStmt)
+void CCommonSubexpressionElimination::Visit(CLabel &AStmt)
 {
+	Barrier();
+	AStmt.SetNext(ProcessNested(AStmt.GetNext()));
 }
 
-void CConstantExpressionComputer::Visit(CNullStatement &AStmt)
+void CCommonSubexpressionElimination::Visit(CCaseLabel &AStmt)
 {
 }
 
-void CConstantExpressionComputer::Visit(CBlockStatement &AStmt)
+void CCommonSubexpressionElimination::Visit(CDefaultCaseLabel &AStmt)
 {
 }
 
-void CConstantExpressionComputer::Visit(CIfStatement &AStmt)
+void CCommonSubexpressionElimination::Visit(CGotoStatement &AStmt)
 {
 }
 
-void CConstantExpressionComputer::Visit(CForStatement &AStmt)
+void CCommonSubexpressionElimination::Visit(CBreakStatement &AStmt)
 {
 }
 
-void CConstantExpressionComputer::Visit(CWhileStatement &AStmt)
+void CCommonSubexpressionElimination::Visit(CContinueStatement &AStmt)
 {
 }
 
-void CConstantExpressionComputer::Visit(CDoStatement &AStmt)
+void CCommonSubexpressionElimination::Visit(CReturnStatement &AStmt)
 {
+	if (AStmt.GetReturnExpression()) {
+		AStmt.SetReturnExpression(ProcessStatement(AStmt.GetReturnExpression(), Anchored));
+	}
 }
 
-void CConstantExpressionComputer::Visit(CLabel &AStmt)
+void CCommonSubexpressionElimination::Visit(CSwitchStatement &AStmt)
 {
+	AStmt.SetTestExpression(ProcessStatement(AStmt.GetTestExpression(), Anchored));
+
+	// the body is entered in the middle, so it is left as it is
+	CInductionVariableAnalyzer Body;
+	AStmt.GetBody()->Accept(Body);
+
+	if (Body.GetLabels()) {
+		Barrier();
+	}
+
+	Kill(AStmt.GetBody());
 }
 
-void CConstantExpressionComputer::Visit(CCaseLabel &AStmt)
+void CCommonSubexpressionElimination::ProcessBlock(CBlockStatement &AStmt)
 {
+	Scopes.push_back(Available);
+	ParentBlock.push(&AStmt);
+
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		ParentBlockIterator.push(it);
+
+		if ((*it)->IsExpression()) {
+			*it = ProcessStatement(static_cast<CExpression *>(*it), true);
+		} else {
+			Anchored = true;
+			(*it)->Accept(*this);
+		}
+
+		ParentBlockIterator.pop();
+	}
+
+	ParentBlock.pop();
+	Available = Scopes.back();
+	Scopes.pop_back();
 }
 
-void CConstantExpressionComputer::Visit(CDefaultCaseLabel &AStmt)
+/*
+ * Processes a statement that is not an element of a block, so nothing can be
+ * computed in front of it.
+ */
+CStatement* CCommonSubexpressionElimination::ProcessNested(CStatement *AStmt)
 {
+	if (!AStmt) {
+		return NULL;
+	}
+
+	if (AStmt->IsExpression()) {
+		return ProcessStatement(static_cast<CExpression *>(AStmt), false);
+	}
+
+	Anchored = false;
+	AStmt->Accept(*this);
+
+	return AStmt;
 }
 
-void CConstantExpressionComputer::Visit(CGotoStatement &AStmt)
-{
+/*
+ * Replaces the subexpressions that are already available and records the new
+ * ones. Only statements whose single side effect is an assignment or a call
+ * at the top are handled, all of their operands see the same values.
+ */
+CExpression* CCommonSubexpressionElimination::ProcessStatement(CExpression *AExpr, bool ADefining)
+{
+	if (!IsSimple(AExpr)) {
+		Kill(AExpr);
+		return AExpr;
+	}
+
+	Defining = ADefining;
+
+	CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AExpr);
+	CUnaryOp *Unary = dynamic_cast<CUnaryOp *>(AExpr);
+
+	if (Op && TokenTraits::IsAssignment(Op->GetType())) {
+		CVariable *Var = dynamic_cast<CVariable *>(Op->GetLeft());
+		bool Copy = Var && Op->GetType() == TOKEN_TYPE_OPERATION_ASSIGN && IsPure(Op->GetRight()) && IsSameType(Var->GetSymbol()->GetType(), Op->GetRight()->GetResultType());
+		unsigned int Value = Copy ? Number(Op->GetRight()) : 0;
+
+		ReplaceOperands(Op->GetLeft());
+		Op->SetRight(Replace(Op->GetRight()));
+
+		if (IsCall(Op->GetRight())) {
+			Memory = Numbers++;
+		}
+
+		if (Var && IsRegister(Var->GetSymbol())) {
+			Variables[Var->GetSymbol()] = Copy ? Value : Numbers++;
+		} else {
+			Memory = Numbers++;
+		}
+	} else if (Unary && (Unary->GetType() == TOKEN_TYPE_OPERATION_INCREMENT || Unary->GetType() == TOKEN_TYPE_OPERATION_DECREMENT)) {
+		CVariable *Var = dynamic_cast<CVariable *>(Unary->GetArgument());
+
+		ReplaceOperands(Unary->GetArgument());
+
+		if (Var && IsRegister(Var->GetSymbol())) {
+			Variables[Var->GetSymbol()] = Numbers++;
+		} else {
+			Memory = Numbers++;
+		}
+	} else {
+		AExpr = Replace(AExpr);
+
+		if (IsCall(AExpr)) {
+			Memory = Numbers++;
+		}
+	}
+
+	Defining = false;
+
+	return AExpr;
 }
 
-void CConstantExpressionComputer::Visit(CBreakStatement &AStmt)
+CExpression* CCommonSubexpressionElimination::Replace(CExpression *AExpr)
 {
+	if (!IsCandidate(AExpr)) {
+		ReplaceOperands(AExpr);
+		return AExpr;
+	}
+
+	unsigned int Value = Number(AExpr);
+
+	if (Available.count(Value)) {
+		unsigned int Occurrence = Available[Value];
+
+		if (!Transform) {
+			Reused.insert(Occurrence);
+			return AExpr;
+		}
+
+		CVariable *Var = new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, Temporaries[Occurrence]->GetName(), AExpr->GetPosition()), Temporaries[Occurrence]);
+		delete AExpr;
+
+		return Var;
+	}
+
+	ReplaceOperands(AExpr);
+
+	if (!Defining) {
+		return AExpr;
+	}
+
+	unsigned int Occurrence = Occurrences++;
+	Available[Value] = Occurrence;
+
+	if (!Transform || !Reused.count(Occurrence)) {
+		return AExpr;
+	}
+
+	// the operands are replaced first, so their own temporaries are assigned
+	// in front of this one
+	CVariableSymbol *Temporary = AddTemporary(ParentBlock.top(), AExpr, "cse." + ToString(Temporaries.size()));
+	Temporaries[Occurrence] = Temporary;
+
+	CBinaryOp *Assignment = new CBinaryOp(CToken(TOKEN_TYPE_OPERATION_ASSIGN, "=", AExpr->GetPosition()));
+	Assignment->SetLeft(new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, Temporary->GetName(), AExpr->GetPosition()), Temporary));
+	Assignment->SetRight(AExpr);
+	ParentBlock.top()->Insert(ParentBlockIterator.top(), Assignment);
+
+	return new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, Temporary->GetName(), AExpr->GetPosition()), Temporary);
 }
 
-void CConstantExpressionComputer::Visit(CContinueStatement &AStmt)
-{
+/*
+ * Replaces the operands of the expression, leaving the expression itself as
+ * it is, e.g. when it is the target of an assignment.
+ */
+void CCommonSubexpressionElimination::ReplaceOperands(CExpression *AExpr)
+{
+	bool Conditional = Defining;
+
+	if (CAddressOfOp *Op = dynamic_cast<CAddressOfOp *>(AExpr)) {
+		ReplaceOperands(Op->GetArgument());
+	} else if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(AExpr)) {
+		Op->SetArgument(Replace(Op->GetArgument()));
+	} else if (CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AExpr)) {
+		Op->SetLeft(Replace(Op->GetLeft()));
+
+		// the right operand of && and || is not always evaluated
+		if (Op->GetType() == TOKEN_TYPE_OPERATION_LOGIC_AND || Op->GetType() == TOKEN_TYPE_OPERATION_LOGIC_OR) {
+			Defining = false;
+		}
+
+		Op->SetRight(Replace(Op->GetRight()));
+	} else if (CConditionalOp *Op = dynamic_cast<CConditionalOp *>(AExpr)) {
+		Op->SetCondition(Replace(Op->GetCondition()));
+
+		Defining = false;
+		Op->SetTrueExpr(Replace(Op->GetTrueExpr()));
+		Op->SetFalseExpr(Replace(Op->GetFalseExpr()));
+	} else if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		ReplaceOperands(Access->GetStruct());
+	} else if (CIndirectAccess *Access = dynamic_cast<CIndirectAccess *>(AExpr)) {
+		Access->SetPointer(Replace(Access->GetPointer()));
+	} else if (CFunctionCall *Call = dynamic_cast<CFunctionCall *>(AExpr)) {
+		for (CFunctionCall::ArgumentsReverseIterator it = Call->RBegin(); it != Call->REnd(); ++it) {
+			*it = Replace(*it);
+		}
+	}
+
+	Defining = Conditional;
 }
 
-void CConstantExpressionComputer::Visit(CReturnStatement &AStmt)
+/*
+ * Adds a variable for the value of an expression to a block, moving the
+ * variables of the nested blocks to make room for it.
+ */
+CVariableSymbol* CCommonSubexpressionElimination::AddTemporary(CBlockStatement *ABlock, CExpression *AExpr, const string &AName)
 {
+	CSymbolTable *SymTable = ABlock->GetSymbolTable();
+	CTypeSymbol *Type = AExpr->GetResultType();
+
+	// the type of an address is owned by its expression
+	if (CPointerSymbol *Pointer = dynamic_cast<CPointerSymbol *>(Type)) {
+		Type = new CPointerSymbol(Pointer->GetRefType());
+
+		if (CTypeSymbol *Existing = SymTable->GetType(Type->GetQualifiedName())) {
+			delete Type;
+			Type = Existing;
+		} else {
+			SymTable->AddType(Type);
+		}
+	}
+
+	CVariableSymbol *Temporary = new CVariableSymbol(AName, Type);
+	SymTable->AddVariable(Temporary);
+
+	for (CBlockStatement::NestedBlocksIterator it = ABlock->NestedBlocksBegin(); it != ABlock->NestedBlocksEnd(); ++it) {
+		CInductionVariableReduction::ShiftBlock(*it, Type->GetSize());
+	}
+
+	return Temporary;
 }
 
-void CConstantExpressionComputer::Visit(CSwitchStatement &AStmt)
+/*
+ * Returns the value number of a pure expression. Loads are numbered together
+ * with the state of memory, which changes on every store and call.
+ */
+unsigned int CCommonSubexpressionElimination::Number(CExpression *AExpr)
 {
+	CTypeSymbol *Type = AExpr->GetResultType();
+
+	if (CVariable *Var = dynamic_cast<CVariable *>(AExpr)) {
+		if (IsRegister(Var->GetSymbol())) {
+			if (!Variables.count(Var->GetSymbol())) {
+				Variables[Var->GetSymbol()] = Numbers++;
+			}
+
+			return Variables[Var->GetSymbol()];
+		}
+	}
+
+	if (IsLoad(AExpr)) {
+		if (Type->IsArray() || Type->IsStruct()) {
+			return Lookup(Address(AExpr));
+		}
+
+		return Lookup("* " + Address(AExpr) + " " + ToString(Memory));
+	}
+
+	if (CAddressOfOp *Op = dynamic_cast<CAddressOfOp *>(AExpr)) {
+		return Lookup(Address(Op->GetArgument()));
+	}
+
+	if (CIntegerConst *Const = dynamic_cast<CIntegerConst *>(AExpr)) {
+		return Lookup("i " + ToString(Const->GetValue()));
+	}
+
+	if (CCharConst *Const = dynamic_cast<CCharConst *>(AExpr)) {
+		return Lookup("i " + ToString((int) Const->GetValue()));
+	}
+
+	if (CFloatConst *Const = dynamic_cast<CFloatConst *>(AExpr)) {
+		float Value = Const->GetValue();
+		return Lookup("f " + ToString(*((int32_t *) &Value)));
+	}
+
+	if (CConditionalOp *Op = dynamic_cast<CConditionalOp *>(AExpr)) {
+		return Lookup("? " + Type->GetQualifiedName() + " " + ToString(Number(Op->GetCondition())) + " " + ToString(Number(Op->GetTrueExpr())) + " " + ToString(Number(Op->GetFalseExpr())));
+	}
+
+	if (CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AExpr)) {
+		if (Op->GetType() == TOKEN_TYPE_SEPARATOR_COMMA) {
+			return Number(Op->GetRight());
+		}
+
+		unsigned int Left = Number(Op->GetLeft());
+		unsigned int Right = Number(Op->GetRight());
+
+		if (TokenTraits::IsTrivialOperation(Op->GetType()) && Op->GetType() != TOKEN_TYPE_OPERATION_MINUS && Left > Right) {
+			swap(Left, Right);
+		}
+
+		return Lookup(ToString(Op->GetType()) + " " + Type->GetQualifiedName() + " " + ToString(Left) + " " + ToString(Right));
+	}
+
+	if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(AExpr)) {
+		return Lookup("u" + ToString(Op->GetType()) + " " + Type->GetQualifiedName() + " " + ToString(Number(Op->GetArgument())));
+	}
+
+	return Numbers++;
 }
 
-int CConstantExpressionComputer::GetIntResult()
+/*
+ * Returns a key that is the same for two lvalues only if they are at the same
+ * address.
+ */
+string CCommonSubexpressionElimination::Address(CExpression *AExpr)
 {
-	return Result;
+	if (CVariable *Var = dynamic_cast<CVariable *>(AExpr)) {
+		return "v " + ToString(Var->GetSymbol());
+	}
+
+	if (CArrayAccess *Access = dynamic_cast<CArrayAccess *>(AExpr)) {
+		bool PointerLeft = Access->GetLeft()->GetResultType()->IsPointer();
+		CExpression *Base = PointerLeft ? Access->GetLeft() : Access->GetRight();
+		CExpression *Index = PointerLeft ? Access->GetRight() : Access->GetLeft();
+
+		return "[ " + Access->GetResultType()->GetQualifiedName() + " " + ToString(Number(Base)) + " " + ToString(Number(Index));
+	}
+
+	if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		return Address(Access->GetStruct()) + " . " + ToString(Access->GetField()->GetSymbol());
+	}
+
+	if (CIndirectAccess *Access = dynamic_cast<CIndirectAccess *>(AExpr)) {
+		return "-> " + ToString(Number(Access->GetPointer())) + " . " + ToString(Access->GetField()->GetSymbol());
+	}
+
+	if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(AExpr)) {
+		return "* " + Op->GetResultType()->GetQualifiedName() + " " + ToString(Number(Op->GetArgument()));
+	}
+
+	return "? " + ToString(Numbers++);
 }
 
-float CConstantExpressionComputer::GetFloatResult()
+unsigned int CCommonSubexpressionElimination::Lookup(const string &AKey)
 {
-	return Result;
-}
+	map<string, unsigned int>::iterator it = Values.find(AKey);
 
-/******************************************************************************
- * CConstantFolding
- ******************************************************************************/
+	if (it != Values.end()) {
+		return it->second;
+	}
 
-void CConstantFolding::Visit(CUnaryOp &AStmt)
-{
-	AStmt.SetArgument(TryFold(AStmt.GetArgument()));
+	return Values[AKey] = Numbers++;
 }
 
-void CConstantFolding::Visit(CBinaryOp &AStmt)
+bool CCommonSubexpressionElimination::IsPure(CExpression *AExpr)
 {
-	AStmt.SetLeft(TryFold(AStmt.GetLeft()));
-	AStmt.SetRight(TryFold(AStmt.GetRight()));
+	if (dynamic_cast<CFunctionCall *>(AExpr) || dynamic_cast<CPostfixOp *>(AExpr)) {
+		return false;
+	}
+
+	if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(AExpr)) {
+		return Op->GetType() != TOKEN_TYPE_OPERATION_INCREMENT && Op->GetType() != TOKEN_TYPE_OPERATION_DECREMENT && IsPure(Op->GetArgument());
+	}
+
+	if (CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AExpr)) {
+		return !TokenTraits::IsAssignment(Op->GetType()) && IsPure(Op->GetLeft()) && IsPure(Op->GetRight());
+	}
+
+	if (CConditionalOp *Op = dynamic_cast<CConditionalOp *>(AExpr)) {
+		return IsPure(Op->GetCondition()) && IsPure(Op->GetTrueExpr()) && IsPure(Op->GetFalseExpr());
+	}
+
+	if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		return IsPure(Access->GetStruct());
+	}
+
+	if (CIndirectAccess *Access = dynamic_cast<CIndirectAccess *>(AExpr)) {
+		return IsPure(Access->GetPointer());
+	}
+
+	return true;
 }
 
-void CConstantFolding::Visit(CConditionalOp &AStmt)
+bool CCommonSubexpressionElimination::IsSimple(CExpression *AExpr)
 {
-	AStmt.SetCondition(TryFold(AStmt.GetCondition()));
-	AStmt.SetTrueExpr(TryFold(AStmt.GetTrueExpr()));
-	AStmt.SetFalseExpr(TryFold(AStmt.GetFalseExpr()));
+	if (IsPure(AExpr) || IsCall(AExpr)) {
+		return true;
+	}
+
+	CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AExpr);
+
+	if (Op && TokenTraits::IsAssignment(Op->GetType())) {
+		return IsPure(Op->GetLeft()) && (IsPure(Op->GetRight()) || IsCall(Op->GetRight()));
+	}
+
+	CUnaryOp *Unary = dynamic_cast<CUnaryOp *>(AExpr);
+
+	return Unary && (Unary->GetType() == TOKEN_TYPE_OPERATION_INCREMENT || Unary->GetType() == TOKEN_TYPE_OPERATION_DECREMENT) && IsPure(Unary->GetArgument());
 }
 
-void CConstantFolding::Visit(CIntegerConst &AStmt)
+/*
+ * A call with pure arguments.
+ */
+bool CCommonSubexpressionElimination::IsCall(CExpression *AExpr)
 {
+	CFunctionCall *Call = dynamic_cast<CFunctionCall *>(AExpr);
+
+	if (!Call) {
+		return false;
+	}
+
+	for (CFunctionCall::ArgumentsIterator it = Call->Begin(); it != Call->End(); ++it) {
+		if (!IsPure(*it)) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
-void CConstantFolding::Visit(CFloatConst &AStmt)
+bool CCommonSubexpressionElimination::IsLoad(CExpression *AExpr)
 {
+	if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(AExpr)) {
+		return Op->GetType() == TOKEN_TYPE_OPERATION_ASTERISK && !dynamic_cast<CAddressOfOp *>(Op);
+	}
+
+	return dynamic_cast<CVariable *>(AExpr) || dynamic_cast<CArrayAccess *>(AExpr) || dynamic_cast<CStructAccess *>(AExpr) || dynamic_cast<CIndirectAccess *>(AExpr);
 }
 
-void CConstantFolding::Visit(CCharConst &AStmt)
+/*
+ * Only the expressions that are more expensive than a load of a temporary are
+ * worth keeping: operations other than comparisons, loads that need an
+ * address computed and addresses of elements.
+ */
+bool CCommonSubexpressionElimination::IsCandidate(CExpression *AExpr)
 {
+	CTypeSymbol *Type = AExpr->GetResultType();
+
+	if (!Type || Type->IsArray() || (!Type->IsInt() && !Type->IsFloat() && !Type->IsPointer())) {
+		return false;
+	}
+
+	if (typeid(*AExpr) == typeid(CBinaryOp)) {
+		CBinaryOp *Op = static_cast<CBinaryOp *>(AExpr);
+		ETokenType Operation = Op->GetType();
+
+		if (!TokenTraits::IsTrivialOperation(Operation) && Operation != TOKEN_TYPE_OPERATION_SLASH && Operation != TOKEN_TYPE_OPERATION_PERCENT
+			&& Operation != TOKEN_TYPE_OPERATION_SHIFT_LEFT && Operation != TOKEN_TYPE_OPERATION_SHIFT_RIGHT) {
+			return false;
+		}
+
+		bool Leaves = (dynamic_cast<CVariable *>(Op->GetLeft()) || dynamic_cast<CConst *>(Op->GetLeft())) && (dynamic_cast<CVariable *>(Op->GetRight()) || dynamic_cast<CConst *>(Op->GetRight()));
+
+		return !Leaves || Operation == TOKEN_TYPE_OPERATION_ASTERISK || Operation == TOKEN_TYPE_OPERATION_SLASH || Operation == TOKEN_TYPE_OPERATION_PERCENT;
+	}
+
+	if (CArrayAccess *Access = dynamic_cast<CArrayAccess *>(AExpr)) {
+		CVariable *Var = dynamic_cast<CVariable *>(Access->GetLeft());
+		return !Var || !Var->GetResultType()->IsArray() || !dynamic_cast<CIntegerConst *>(Access->GetRight());
+	}
+
+	if (CAddressOfOp *Op = dynamic_cast<CAddressOfOp *>(AExpr)) {
+		return !dynamic_cast<CVariable *>(Op->GetArgument());
+	}
+
+	if (typeid(*AExpr) == typeid(CUnaryOp)) {
+		CUnaryOp *Op = static_cast<CUnaryOp *>(AExpr);
+		return Op->GetType() == TOKEN_TYPE_OPERATION_ASTERISK || ((Op->GetType() == TOKEN_TYPE_OPERATION_MINUS || Op->GetType() == TOKEN_TYPE_OPERATION_BITWISE_NOT)
+			&& !dynamic_cast<CVariable *>(Op->GetArgument()) && !dynamic_cast<CConst *>(Op->GetArgument()));
+	}
+
+	if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		return !dynamic_cast<CVariable *>(Access->GetStruct());
+	}
+
+	return dynamic_cast<CIndirectAccess *>(AExpr) != NULL;
 }
 
-void CConstantFolding::Visit(CStringConst &AStmt)
+/*
+ * A scalar local, whose value can only be changed by assignments to it.
+ */
+bool CCommonSubexpressionElimination::IsRegister(CVariableSymbol *AVariable)
 {
+	CTypeSymbol *Type = AVariable->GetType();
+	return !AVariable->GetGlobal() && !Usage.GetAddressTaken(AVariable) && !Type->IsArray() && (Type->IsInt() || Type->IsFloat() || Type->IsPointer());
 }
 
-void CConstantFolding::Visit(CVariable &AStmt)
+bool CCommonSubexpressionElimination::IsSameType(CTypeSymbol *A, CTypeSymbol *B)
 {
+	if (A->IsPointer() || B->IsPointer()) {
+		return A->IsPointer() && B->IsPointer() && !B->IsArray() && A->GetQualifiedName() == B->GetQualifiedName();
+	}
+
+	return (A->IsInt() && B->IsInt()) || (A->IsFloat() && B->IsFloat());
 }
 
-void CConstantFolding::Visit(CFunction &AStmt)
+/*
+ * Gives new numbers to everything the statement can change.
+ */
+void CCommonSubexpressionElimination::Kill(CStatement *AStmt)
 {
+	CInductionVariableAnalyzer Writes;
+	AStmt->Accept(Writes);
+
+	for (VariablesContainer::iterator it = Variables.begin(); it != Variables.end(); ++it) {
+		if (Writes.GetWrites(it->first)) {
+			it->second = Numbers++;
+		}
+	}
+
+	Memory = Numbers++;
 }
 
-void CConstantFolding::Visit(CPostfixOp &AStmt)
+/*
+ * Keeps the numbers that are the same on both paths joining.
+ */
+void CCommonSubexpressionElimination::Merge(const VariablesContainer &AVariables, unsigned int AMemory)
 {
-	AStmt.SetArgument(TryFold(AStmt.GetArgument()));
+	for (VariablesContainer::iterator it = Variables.begin(); it != Variables.end(); ++it) {
+		VariablesContainer::const_iterator Other = AVariables.find(it->first);
+
+		if (Other == AVariables.end() || Other->second != it->second) {
+			it->second = Numbers++;
+		}
+	}
+
+	if (Memory != AMemory) {
+		Memory = Numbers++;
+	}
 }
 
-void CConstantFolding::Visit(CFunctionCall &AStmt)
+/*
+ * A label can be jumped to from anywhere, so nothing computed before it is
+ * known there.
+ */
+void CCommonSubexpressionElimination::Barrier()
 {
-	for (CFunctionCall::ArgumentsReverseIterator it = AStmt.RBegin(); it != AStmt.REnd(); ++it) {
-		*it = TryFold(*it);
+	Available.clear();
+
+	for (vector<AvailableContainer>::iterator it = Scopes.begin(); it != Scopes.end(); ++it) {
+		it->clear();
 	}
-}
 
-void CConstantFolding::Visit(CStructAccess &AStmt)
-{
-	AStmt.SetStruct(TryFold(AStmt.GetStruct()));
+	Variables.clear();
+	Memory = Numbers++;
 }
 
-void CConstantFolding::Visit(CIndirectAccess &AStmt)
+void CCommonSubexpressionElimination::Reset()
 {
-	AStmt.SetPointer(TryFold(AStmt.GetPointer()));
+	Numbers = 0;
+	Memory = Numbers++;
+	Occurrences = 0;
+
+	Variables.clear();
+	Values.clear();
+	Available.clear();
+	Scopes.clear();
 }
 
-void CConstantFolding::Visit(CArrayAccess &AStmt)
+/******************************************************************************
+ * CGlobalSubexpressionElimination
+ ******************************************************************************/
+
+CGlobalSubexpressionElimination::CGlobalSubexpressionElimination(CFunctionSymbol *AFunction) : Function(AFunction), Available(NULL), Transform(false), Count(0)
 {
-	AStmt.SetLeft(TryFold(AStmt.GetLeft()));
-	AStmt.SetRight(TryFold(AStmt.GetRight()));
 }
 
-void CConstantFolding::Visit(CNullStatement &AStmt)
+void CGlobalSubexpressionElimination::Visit(CUnaryOp &AStmt)
 {
+	AStmt.SetArgument(Rewrite(AStmt.GetArgument()));
 }
 
-void CConstantFolding::Visit(CBlockStatement &AStmt)
+void CGlobalSubexpressionElimination::Visit(CBinaryOp &AStmt)
 {
-	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
-		*it = TryFold(*it);
-	}
+	AStmt.SetLeft(Rewrite(AStmt.GetLeft()));
+	AStmt.SetRight(Rewrite(AStmt.GetRight()));
 }
 
-void CConstantFolding::Visit(CIfStatement &AStmt)
+void CGlobalSubexpressionElimination::Visit(CConditionalOp &AStmt)
 {
-	AStmt.SetCondition(TryFold(AStmt.GetCondition()));
-	AStmt.SetThenStatement(TryFold(AStmt.GetThenStatement()));
-	AStmt.SetElseStatement(TryFold(AStmt.GetElseStatement()));
+	AStmt.SetCondition(Rewrite(AStmt.GetCondition()));
+	AStmt.SetTrueExpr(Rewrite(AStmt.GetTrueExpr()));
+	AStmt.SetFalseExpr(Rewrite(AStmt.GetFalseExpr()));
 }
 
-void CConstantFolding::Visit(CForStatement &AStmt)
+void CGlobalSubexpressionElimination::Visit(CIntegerConst &AStmt)
 {
-	AStmt.SetInit(TryFold(AStmt.GetInit()));
-	AStmt.SetCondition(TryFold(AStmt.GetCondition()));
-	AStmt.SetUpdate(TryFold(AStmt.GetUpdate()));
-	AStmt.SetBody(TryFold(AStmt.GetBody()));
 }
 
-void CConstantFolding::Visit(CWhileStatement &AStmt)
+void CGlobalSubexpressionElimination::Visit(CFloatConst &AStmt)
 {
-	AStmt.SetCondition(TryFold(AStmt.GetCondition()));
-	AStmt.SetBody(TryFold(AStmt.GetBody()));
 }
 
-void CConstantFolding::Visit(CDoStatement &AStmt)
+void CGlobalSubexpressionElimination::Visit(CCharConst &AStmt)
 {
-	AStmt.SetCondition(TryFold(AStmt.GetCondition()));
-	AStmt.SetBody(TryFold(AStmt.GetBody()));
 }
 
-void CConstantFolding::Visit(CLabel &AStmt)
+void CGlobalSubexpressionElimination::Visit(CStringConst &AStmt)
 {
-	AStmt.SetNext(TryFold(AStmt.GetNext()));
 }
 
-void CConstantFolding::Visit(CCaseLabel &AStmt)
+void CGlobalSubexpressionElimination::Visit(CVariable &AStmt)
 {
-	Visit(static_cast<CLabel &>(AStmt));
 }
 
-void CConstantFolding::Visit(CDefaultCaseLabel &AStmt)
+void CGlobalSubexpressionElimination::Visit(CFunction &AStmt)
 {
-	Visit(static_cast<CLabel &>(AStmt));
 }
 
-void CConstantFolding::Visit(CGotoStatement &AStmt)
+void CGlobalSubexpressionElimination::Visit(CPostfixOp &AStmt)
 {
+	AStmt.SetArgument(Rewrite(AStmt.GetArgument()));
 }
 
-void CConstantFolding::Visit(CBreakStatement &AStmt)
+void CGlobalSubexpressionElimination::Visit(CFunctionCall &AStmt)
 {
+	for (CFunctionCall::ArgumentsReverseIterator it = AStmt.RBegin(); it != AStmt.REnd(); ++it) {
+		*it = Rewrite(*it);
+	}
 }
 
-void CConstantFolding::Visit(CContinueStatement &AStmt)
+void CGlobalSubexpressionElimination::Visit(CStructAccess &AStmt)
 {
+	AStmt.SetStruct(Rewrite(AStmt.GetStruct()));
 }
 
-void CConstantFolding::Visit(CReturnStatement &AStmt)
+void CGlobalSubexpressionElimination::Visit(CIndirectAccess &AStmt)
 {
-	AStmt.SetReturnExpression(TryFold(AStmt.GetReturnExpression()));
+	AStmt.SetPointer(Rewrite(AStmt.GetPointer()));
 }
 
-void CConstantFolding::Visit(CSwitchStatement &AStmt)
+void CGlobalSubexpressionElimination::Visit(CArrayAccess &AStmt)
 {
-	AStmt.SetTestExpression(TryFold(AStmt.GetTestExpression()));
-	AStmt.SetBody(TryFold(AStmt.GetBody()));
+	AStmt.SetLeft(Rewrite(AStmt.GetLeft()));
+	AStmt.SetRight(Rewrite(AStmt.GetRight()));
 }
 
-CExpression* CConstantFolding::TryFold(CStatement *AStmt)
+void CGlobalSubexpressionElimination::Visit(CNullStatement &AStmt)
 {
-	CExpression *Expr = static_cast<CExpression *>(AStmt);
-
-	if (!AStmt || !AStmt->IsExpression() || !Expr->IsConst() || Expr->GetType() == TOKEN_TYPE_CONSTANT_STRING) {
-		if (AStmt) {
-			AStmt->Accept(*this);
-		}
+}
 
-		return Expr;
+/*
+ * Each round over the function body collects the elements that can be
+ * rewritten, then rewrites the occurrences that the analysis picks among
+ * them, until it picks none.
+ */
+void CGlobalSubexpressionElimination::Visit(CBlockStatement &AStmt)
+{
+	if (&AStmt != Function->GetBody()) {
+		ProcessBlock(AStmt);
+		return;
 	}
 
-	Expr->Accept(ConstExprComp);
-
-	CExpression *Result;
-
-	if (Expr->GetResultType()->IsFloat()) {
-		Result = new CFloatConst(CFloatConstToken(ToString(ConstExprComp.GetFloatResult()), Expr->GetPosition()), Expr->GetResultType());
-	} else {
-		Result = new CIntegerConst(CIntegerConstToken(ToString(ConstExprComp.GetIntResult()), Expr->GetPosition()), Expr->GetResultType());
-	}
-	
-	delete AStmt;
-	return Result;
-}
+	bool Changed;
 
-/******************************************************************************
- * CLoopInvariantHoisting
- ******************************************************************************/
+	do {
+		Transform = false;
+		Roots.clear();
+		ProcessBlock(AStmt);
 
-CLoopInvariantHoisting::CLoopInvariantHoisting() : ProcessingLoop(false)
-{
-}
+		Changed = Analyze();
 
-void CLoopInvariantHoisting::Visit(CUnaryOp &AStmt)
-{
+		if (Changed) {
+			Transform = true;
+			ProcessBlock(AStmt);
+		}
+	} while (Changed);
 }
 
-void CLoopInvariantHoisting::Visit(CBinaryOp &AStmt)
+void CGlobalSubexpressionElimination::Visit(CIfStatement &AStmt)
 {
+	AStmt.SetCondition(Enter(AStmt.GetCondition()));
+	AStmt.SetThenStatement(Enter(AStmt.GetThenStatement()));
+	AStmt.SetElseStatement(Enter(AStmt.GetElseStatement()));
 }
 
-void CLoopInvariantHoisting::Visit(CConditionalOp &AStmt)
+void CGlobalSubexpressionElimination::Visit(CForStatement &AStmt)
 {
-}
+	if (AStmt.GetVectorized()) {
+		return;
+	}
 
-void CLoopInvariantHoisting::Visit(CIntegerConst &AStmt)
-{
+	AStmt.SetInit(Enter(AStmt.GetInit()));
+	AStmt.SetCondition(Enter(AStmt.GetCondition()));
+	AStmt.SetUpdate(Enter(AStmt.GetUpdate()));
+	AStmt.SetBody(Enter(AStmt.GetBody()));
 }
 
-void CLoopInvariantHoisting::Visit(CFloatConst &AStmt)
+void CGlobalSubexpressionElimination::Visit(CWhileStatement &AStmt)
 {
+	AStmt.SetCondition(Enter(AStmt.GetCondition()));
+	AStmt.SetBody(Enter(AStmt.GetBody()));
 }
 
-void CLoopInvariantHoisting::Visit(CCharConst &AStmt)
+void CGlobalSubexpressionElimination::Visit(CDoStatement &AStmt)
 {
+	AStmt.SetCondition(Enter(AStmt.GetCondition()));
+	AStmt.SetBody(Enter(AStmt.GetBody()));
 }
 
-void CLoopInvariantHoisting::Visit(CStringConst &AStmt)
+void CGlobalSubexpressionElimination::Visit(CLabel &AStmt)
 {
+	AStmt.SetNext(Enter(AStmt.GetNext()));
 }
 
-void CLoopInvariantHoisting::Visit(CVariable &AStmt)
+void CGlobalSubexpressionElimination::Visit(CCaseLabel &AStmt)
 {
+	Visit(static_cast<CLabel &>(AStmt));
 }
 
-void CLoopInvariantHoisting::Visit(CFunction &AStmt)
+void CGlobalSubexpressionElimination::Visit(CDefaultCaseLabel &AStmt)
 {
+	Visit(static_cast<CLabel &>(AStmt));
 }
 
-void CLoopInvariantHoisting::Visit(CPostfixOp &AStmt)
+void CGlobalSubexpressionElimination::Visit(CGotoStatement &AStmt)
 {
 }
 
-void CLoopInvariantHoisting::Visit(CFunctionCall &AStmt)
+void CGlobalSubexpressionElimination::Visit(CBreakStatement &AStmt)
 {
 }
 
-void CLoopInvariantHoisting::Visit(CStructAccess &AStmt)
+void CGlobalSubexpressionElimination::Visit(CContinueStatement &AStmt)
 {
 }
 
-void CLoopInvariantHoisting::Visit(CIndirectAccess &AStmt)
+void CGlobalSubexpressionElimination::Visit(CReturnStatement &AStmt)
 {
+	AStmt.SetReturnExpression(Enter(AStmt.GetReturnExpression()));
 }
 
-void CLoopInvariantHoisting::Visit(CArrayAccess &AStmt)
+void CGlobalSubexpressionElimination::Visit(CSwitchStatement &AStmt)
 {
+	AStmt.SetTestExpression(Enter(AStmt.GetTestExpression()));
+	AStmt.SetBody(Enter(AStmt.GetBody()));
 }
 
-void CLoopInvariantHoisting::Visit(CNullStatement &AStmt)
+void CGlobalSubexpressionElimination::ProcessBlock(CBlockStatement &AStmt)
 {
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		*it = Enter(*it);
+	}
 }
 
-void CLoopInvariantHoisting::Visit(CBlockStatement &AStmt)
-{
-	if (ProcessingLoop) {
-		CBlockStatement::UsedContainer Used;
-		CBlockStatement::AffectedContainer Affected;
-		CBlockStatement::AffectedContainer StmtAffected;
+/*
+ * Picks the occurrences to replace in this round: in every element the
+ * outermost one that is available before it and that the element doesn't
+ * change. An element is rewritten for a single expression, so that its
+ * occurrences don't overlap.
+ */
+bool CGlobalSubexpressionElimination::Analyze()
+{
+	CControlFlowGraph Graph(Function);
+	CAvailableExpressions Expressions(Graph);
+	CControlFlowGraph::BlocksContainer &Order = Graph.GetOrder();
+	unsigned int Size = Expressions.GetSize();
+
+	Available = &Expressions;
+
+	Changes.clear();
+	Temporaries.clear();
+	Uses.clear();
+	Generators.clear();
+
+	for (CControlFlowGraph::BlocksIterator it = Order.begin(); it != Order.end(); ++it) {
+		CBasicBlock::ElementsContainer &Elements = (*it)->GetElements();
+		CBitSet In = Expressions.GetIn(*it);
+
+		for (unsigned int el = 0; el < Elements.size(); el++) {
+			CExpression *Root = Elements[el].Expression;
+			CBitSet Gen(Size), Kill(Size);
+			Expressions.GetEffect(Elements[el], Gen, Kill);
+
+			CBitSet Redundant = In;
+			Redundant.Subtract(Kill);
+
+			CExpression *Use = (Roots.count(Root) && !Changes.count(Root) && !Redundant.Empty()) ? Find(Root, Redundant, false) : NULL;
+
+			if (Use) {
+				unsigned int Index = Expressions.GetIndex(Use);
+				CChange Change = { Index, true };
+				set<CBasicBlock *> Visited;
+				GeneratorsContainer Found;
+
+				Changes[Root] = Change;
+
+				if (FindGenerators(*it, el, Index, Visited, Found)) {
+					if (!Temporaries.count(Index)) {
+						Temporaries[Index] = CCommonSubexpressionElimination::AddTemporary(Function->GetBody(), Use, "gcse." + ToString(Count++));
+					}
 
-		CBlockStatement::StatementsIterator pit;
+					Uses[Use] = Temporaries[Index];
+					Change.Use = false;
 
-		for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End();) {
-			if (!(*it)->CanBeHoisted()) {
-				++it;
-				continue;
+					for (GeneratorsContainer::iterator g = Found.begin(); g != Found.end(); ++g) {
+						Changes[g->first] = Change;
+						Generators[g->second] = Temporaries[Index];
+					}
+				} else {
+					Changes.erase(Root);
+				}
 			}
 
-			Used.clear();
-			Affected.clear();
-			StmtAffected.clear();
+			In.Subtract(Kill);
+			In.Union(Gen);
+		}
+	}
 
-			(*it)->GetUsedVariables(Used);
-			(*ParentBlockIterator.top())->GetAffectedVariables(Affected);
-			(*it)->GetAffectedVariables(StmtAffected);
+	Available = NULL;
 
-			for (CBlockStatement::AffectedContainer::iterator ait = StmtAffected.begin(); ait != StmtAffected.end(); ++ait) {
-				Affected[ait->first] -= ait->second;
-				if (!Affected[ait->first]) {
-					Affected.erase(ait->first);
-				}
-			}
+	return !Uses.empty();
+}
 
-			bool DoNotAct = false;
+/*
+ * Collects the occurrences that last compute an expression on the paths
+ * leading to the first AEnd elements of a block. A path through an element
+ * that reads the temporary instead needs no occurrence, the temporary still
+ * has the value after it.
+ */
+bool CGlobalSubexpressionElimination::FindGenerators(CBasicBlock *ABlock, unsigned int AEnd, unsigned int AIndex, set<CBasicBlock *> &AVisited, GeneratorsContainer &AGenerators)
+{
+	CBasicBlock::ElementsContainer &Elements = ABlock->GetElements();
+	unsigned int Size = Available->GetSize();
+
+	for (unsigned int el = AEnd; el-- > 0; ) {
+		CExpression *Root = Elements[el].Expression;
+		map<CExpression *, CChange>::iterator Change = Changes.find(Root);
+		CBitSet Gen(Size), Kill(Size);
+		Available->GetEffect(Elements[el], Gen, Kill);
+
+		if (Change != Changes.end() && Change->second.Index == AIndex && Change->second.Use) {
+			return true;
+		}
 
-			for (CSymbolTable::VariablesIterator vit = AStmt.GetSymbolTable()->VariablesBegin(); vit != AStmt.GetSymbolTable()->VariablesEnd(); ++vit) {
-				if (Used.count(vit->second)) {
-					DoNotAct = true;
-					break;
-				}
+		if (Gen.Get(AIndex)) {
+			if (Change != Changes.end()) {
+				return Change->second.Index == AIndex;
 			}
 
-			for (CBlockStatement::AffectedContainer::iterator ait = StmtAffected.begin(); ait != StmtAffected.end(); ++ait) {
-				if (Used.count(ait->first)) {
-					if (Used[ait->first] > ait->second) {
-						DoNotAct = true;
-						break;
-					}
-				}
-			}
+			CBitSet Indices(Size);
+			Indices.Set(AIndex);
 
-			for (CBlockStatement::UsedContainer::iterator uit = Used.begin(); uit != Used.end(); ++uit) {
-				if (Affected.count(uit->first)) {
-					DoNotAct = true;
-					break;
-				}
+			CExpression *Occurrence = Roots.count(Root) ? Find(Root, Indices, true) : NULL;
+
+			if (!Occurrence) {
+				return false;
 			}
 
-			pit = it++;
+			AGenerators.push_back(make_pair(Root, Occurrence));
+			return true;
+		}
 
-			if (!DoNotAct) {
-				AStmt.Erase(pit);
-				ParentBlock.top()->Insert(ParentBlockIterator.top(), *pit);
-			}
+		if (Kill.Get(AIndex)) {
+			return false;
 		}
-	} else {
-		CBlockStatement::StatementsIterator pit;
-		for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End();) {
-			ParentBlock.push(&AStmt);
-			ParentBlockIterator.push(it);
+	}
 
-			pit = it++;
-			(*pit)->Accept(*this);
+	// only the entry has no predecessors, and nothing is computed before it
+	bool Entered = false;
 
-			ParentBlockIterator.pop();
-			ParentBlock.pop();
+	for (CBasicBlock::BlocksIterator it = ABlock->GetPredecessors().begin(); it != ABlock->GetPredecessors().end(); ++it) {
+		if (!(*it)->GetReachable()) {
+			continue;
+		}
+
+		Entered = true;
+
+		if (AVisited.insert(*it).second && !FindGenerators(*it, (*it)->GetElements().size(), AIndex, AVisited, AGenerators)) {
+			return false;
 		}
 	}
-}
 
-void CLoopInvariantHoisting::Visit(CIfStatement &AStmt)
-{
-	TryVisit(AStmt.GetThenStatement());
-	TryVisit(AStmt.GetElseStatement());
+	return Entered;
 }
 
-void CLoopInvariantHoisting::Visit(CForStatement &AStmt)
+/*
+ * Finds the outermost occurrence of one of the expressions in AIndices whose
+ * value is read, with AAlways set only among the ones evaluated whenever the
+ * element is.
+ */
+CExpression* CGlobalSubexpressionElimination::Find(CExpression *AExpr, const CBitSet &AIndices, bool AAlways, bool AConditional)
 {
-	TryVisit(AStmt.GetBody());
-	ProcessLoop(AStmt.GetBody());
-}
+	int Index = Available->GetIndex(AExpr);
 
-void CLoopInvariantHoisting::Visit(CWhileStatement &AStmt)
-{
-	TryVisit(AStmt.GetBody());
-	ProcessLoop(AStmt.GetBody());
-}
+	if (Index >= 0 && AIndices.Get(Index) && (!AAlways || !AConditional) && CCommonSubexpressionElimination::IsCandidate(AExpr)) {
+		return AExpr;
+	}
 
-void CLoopInvariantHoisting::Visit(CDoStatement &AStmt)
-{
-	TryVisit(AStmt.GetBody());
-	ProcessLoop(AStmt.GetBody());
-}
+	ETokenType Type = AExpr->GetType();
+	CExpression *Result = NULL;
 
-void CLoopInvariantHoisting::Visit(CLabel &AStmt)
-{
-	TryVisit(AStmt.GetNext());
-}
+	if (CConditionalOp *Op = dynamic_cast<CConditionalOp *>(AExpr)) {
+		if (!(Result = Find(Op->GetCondition(), AIndices, AAlways, AConditional)) && !(Result = Find(Op->GetTrueExpr(), AIndices, AAlways, true))) {
+			Result = Find(Op->GetFalseExpr(), AIndices, AAlways, true);
+		}
+	} else if (CBinaryOp *Op = dynamic_cast<CBinaryOp *>(AExpr)) {
+		if (TokenTraits::IsAssignment(Type)) {
+			Result = FindOperands(Op->GetLeft(), AIndices, AAlways, AConditional);
+		} else {
+			Result = Find(Op->GetLeft(), AIndices, AAlways, AConditional);
+		}
 
-void CLoopInvariantHoisting::Visit(CCaseLabel &AStmt)
-{
-	TryVisit(AStmt.GetNext());
-}
+		if (!Result) {
+			Result = Find(Op->GetRight(), AIndices, AAlways, AConditional || Type == TOKEN_TYPE_OPERATION_LOGIC_AND || Type == TOKEN_TYPE_OPERATION_LOGIC_OR);
+		}
+	} else if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(AExpr)) {
+		if (dynamic_cast<CAddressOfOp *>(Op) || dynamic_cast<CPostfixOp *>(Op) || Type == TOKEN_TYPE_OPERATION_INCREMENT || Type == TOKEN_TYPE_OPERATION_DECREMENT) {
+			Result = FindOperands(Op->GetArgument(), AIndices, AAlways, AConditional);
+		} else {
+			Result = Find(Op->GetArgument(), AIndices, AAlways, AConditional);
+		}
+	} else if (CFunctionCall *Call = dynamic_cast<CFunctionCall *>(AExpr)) {
+		for (CFunctionCall::ArgumentsIterator it = Call->Begin(); it != Call->End() && !Result; ++it) {
+			Result = Find(*it, AIndices, AAlways, AConditional);
+		}
+	} else if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		Result = FindOperands(Access->GetStruct(), AIndices, AAlways, AConditional);
+	} else if (CIndirectAccess *Access = dynamic_cast<CIndirectAccess *>(AExpr)) {
+		Result = Find(Access->GetPointer(), AIndices, AAlways, AConditional);
+	}
 
-void CLoopInvariantHoisting::Visit(CDefaultCaseLabel &AStmt)
-{
-	TryVisit(AStmt.GetNext());
+	return Result;
 }
 
-void CLoopInvariantHoisting::Visit(CGotoStatement &AStmt)
+/*
+ * Looks into the operands that locate an lvalue, whose own value isn't read.
+ */
+CExpression* CGlobalSubexpressionElimination::FindOperands(CExpression *AExpr, const CBitSet &AIndices, bool AAlways, bool AConditional)
 {
-}
+	CExpression *Result = NULL;
 
-void CLoopInvariantHoisting::Visit(CBreakStatement &AStmt)
-{
-}
+	if (CArrayAccess *Access = dynamic_cast<CArrayAccess *>(AExpr)) {
+		if (!(Result = Find(Access->GetLeft(), AIndices, AAlways, AConditional))) {
+			Result = Find(Access->GetRight(), AIndices, AAlways, AConditional);
+		}
+	} else if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		Result = FindOperands(Access->GetStruct(), AIndices, AAlways, AConditional);
+	} else if (CIndirectAccess *Access = dynamic_cast<CIndirectAccess *>(AExpr)) {
+		Result = Find(Access->GetPointer(), AIndices, AAlways, AConditional);
+	} else if (CUnaryOp *Op = dynamic_cast<CUnaryOp *>(AExpr)) {
+		Result = Find(Op->GetArgument(), AIndices, AAlways, AConditional);
+	}
 
-void CLoopInvariantHoisting::Visit(CContinueStatement &AStmt)
-{
+	return Result;
 }
 
-void CLoopInvariantHoisting::Visit(CReturnStatement &AStmt)
+/*
+ * Collects or rewrites a statement, or an expression that is evaluated as a
+ * whole and so is an element of the control flow graph.
+ */
+CExpression* CGlobalSubexpressionElimination::Enter(CStatement *AStmt)
 {
-}
+	if (!dynamic_cast<CExpression *>(AStmt)) {
+		if (AStmt) {
+			AStmt->Accept(*this);
+		}
 
-void CLoopInvariantHoisting::Visit(CSwitchStatement &AStmt)
-{
-	TryVisit(AStmt.GetBody());
+		return static_cast<CExpression *>(AStmt);
+	}
+
+	if (!Transform) {
+		Roots.insert(static_cast<CExpression *>(AStmt));
+		return static_cast<CExpression *>(AStmt);
+	}
+
+	return Rewrite(AStmt);
 }
 
-void CLoopInvariantHoisting::ProcessLoop(CStatement *ALoopBody)
+CExpression* CGlobalSubexpressionElimination::Rewrite(CStatement *AStmt)
 {
-	ProcessingLoop = true;
+	CExpression *Expr = static_cast<CExpression *>(AStmt);
 
-	TryVisit(ALoopBody);
+	if (!AStmt) {
+		return NULL;
+	}
 
-	ProcessingLoop = false;
+	OccurrencesContainer::iterator it = Uses.find(Expr);
+
+	if (it != Uses.end()) {
+		CVariable *Var = new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, it->second->GetName(), Expr->GetPosition()), it->second);
+		delete Expr;
+
+		return Var;
+	}
+
+	AStmt->Accept(*this);
+
+	it = Generators.find(Expr);
+
+	if (it != Generators.end()) {
+		CBinaryOp *Assignment = new CBinaryOp(CToken(TOKEN_TYPE_OPERATION_ASSIGN, "=", Expr->GetPosition()));
+		Assignment->SetLeft(new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, it->second->GetName(), Expr->GetPosition()), it->second));
+		Assignment->SetRight(Expr);
+
+		return Assignment;
+	}
+
+	return Expr;
 }
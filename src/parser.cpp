@@ -19,6 +19,7 @@
 #include "parser.h"
 
 #include "optimization.h"
+#include "timereport.h"
 
 /******************************************************************************
  * CTokenStream
@@ -116,6 +117,8 @@ CParser::~CParser()
 
 CGlobalSymbolTable* CParser::ParseTranslationUnit()
 {
+	CTimePhase Phase("parse");
+
 	CSymbol *Sym = NULL;
 
 	while (Token->GetType() != TOKEN_TYPE_EOF) {
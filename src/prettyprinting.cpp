@@ -17,6 +17,7 @@
 */
 
 #include "prettyprinting.h"
+#include "timereport.h"
 
 /******************************************************************************
  * CScanPrettyPrinter
@@ -63,7 +64,12 @@ void CParsePrettyPrinter::Output(ostream &Stream)
 	}
 
 	if (Parameters.ParserMode == PARSER_MODE_EXPRESSION) {
-		CExpression *expr = Parser.ParseExpression();
+		CExpression *expr;
+
+		{
+			CTimePhase Phase("parse");
+			expr = Parser.ParseExpression();
+		}
 
 		if (Parser.GetToken()->GetType() != TOKEN_TYPE_EOF) {
 			throw CParserException("trailing characters", Parser.GetToken()->GetPosition());
@@ -648,7 +654,12 @@ void CStatementTreePrintVisitor::Visit(CIfStatement &AStmt)
 void CStatementTreePrintVisitor::Visit(CForStatement &AStmt)
 {
 	PrintTreeDecoration();
-	PrintName(AStmt);
+
+	if (AStmt.GetVectorized()) {
+		Stream << AStmt.GetName() << "(vectorized)" << endl;
+	} else {
+		PrintName(AStmt);
+	}
 
 	Nesting++;
 	TryVisit(AStmt.GetInit());
@@ -0,0 +1,510 @@
+/*
+	ncc - Nartov C Compiler
+	Copyright 2010-2011  Alexander Nartov
+
+	ncc is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	ncc is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with ncc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "profile.h"
+
+/******************************************************************************
+ * CProfile
+ ******************************************************************************/
+
+CProfile::CProfile() : Maximum(0), Loaded(false)
+{
+}
+
+unsigned int CProfile::Add(CStatement *AStmt, EProfileCounter ACounter)
+{
+	unsigned int Index = Points.size();
+	Points[make_pair(AStmt, ACounter)] = Index;
+	return Index;
+}
+
+unsigned int CProfile::GetSize() const
+{
+	return Points.size();
+}
+
+/*
+ * A profile is the number of counters followed by their values, as written
+ * by the runtime of an instrumented build.
+ */
+void CProfile::Load(const string &AFilename)
+{
+	ifstream Stream(AFilename.c_str());
+	unsigned int Size;
+
+	if (!Stream) {
+		throw CFatalException(EXIT_CODE_PROFILE_ERROR, "can't open profile " + AFilename);
+	}
+
+	if (!(Stream >> Size)) {
+		throw CFatalException(EXIT_CODE_PROFILE_ERROR, "invalid profile " + AFilename);
+	}
+
+	if (Size != Points.size()) {
+		throw CFatalException(EXIT_CODE_PROFILE_ERROR, "profile " + AFilename + " doesn't match the source");
+	}
+
+	Counts.resize(Size);
+
+	for (unsigned int i = 0; i < Size; i++) {
+		if (!(Stream >> Counts[i])) {
+			throw CFatalException(EXIT_CODE_PROFILE_ERROR, "invalid profile " + AFilename);
+		}
+
+		Maximum = max(Maximum, Counts[i]);
+	}
+
+	Loaded = true;
+}
+
+bool CProfile::GetLoaded() const
+{
+	return Loaded;
+}
+
+bool CProfile::GetCount(CStatement *AStmt, EProfileCounter ACounter, unsigned long long &ACount) const
+{
+	map<pair<CStatement *, EProfileCounter>, unsigned int>::const_iterator it = Points.find(make_pair(AStmt, ACounter));
+
+	if (!Loaded || it == Points.end()) {
+		return false;
+	}
+
+	ACount = Counts[it->second];
+	return true;
+}
+
+unsigned long long CProfile::GetMaximum() const
+{
+	return Maximum;
+}
+
+/*
+ * Points executed at least a sixteenth as often as the most frequent one.
+ */
+bool CProfile::IsHot(CStatement *AStmt, EProfileCounter ACounter) const
+{
+	unsigned long long Count;
+	return GetCount(AStmt, ACounter, Count) && Count && Count >= Maximum / 16;
+}
+
+/*
+ * Points that were never executed in the profiled runs.
+ */
+bool CProfile::IsCold(CStatement *AStmt, EProfileCounter ACounter) const
+{
+	unsigned long long Count;
+	return GetCount(AStmt, ACounter, Count) && !Count;
+}
+
+/******************************************************************************
+ * CProfileInstrumentation
+ ******************************************************************************/
+
+CProfileInstrumentation::CProfileInstrumentation(CProfile &AProfile, CGlobalSymbolTable *ASymbols, bool AInstrument)
+	: Profile(AProfile), Symbols(ASymbols), Instrumenting(AInstrument), Counters(NULL), Direct(NULL)
+{
+	if (Instrumenting) {
+		Counters = new CVariableSymbol("__profile_counts", new CArraySymbol(Symbols->GetType("int")));
+		Counters->SetGlobal(true);
+	}
+}
+
+void CProfileInstrumentation::Visit(CUnaryOp &AStmt)
+{
+	AStmt.SetArgument(Wrap(AStmt.GetArgument()));
+}
+
+void CProfileInstrumentation::Visit(CBinaryOp &AStmt)
+{
+	AStmt.SetLeft(Wrap(AStmt.GetLeft()));
+	AStmt.SetRight(Wrap(AStmt.GetRight()));
+}
+
+void CProfileInstrumentation::Visit(CConditionalOp &AStmt)
+{
+	AStmt.SetCondition(Wrap(AStmt.GetCondition()));
+	AStmt.SetTrueExpr(Wrap(AStmt.GetTrueExpr()));
+	AStmt.SetFalseExpr(Wrap(AStmt.GetFalseExpr()));
+}
+
+void CProfileInstrumentation::Visit(CIntegerConst &AStmt)
+{
+}
+
+void CProfileInstrumentation::Visit(CFloatConst &AStmt)
+{
+}
+
+void CProfileInstrumentation::Visit(CCharConst &AStmt)
+{
+}
+
+void CProfileInstrumentation::Visit(CStringConst &AStmt)
+{
+}
+
+void CProfileInstrumentation::Visit(CVariable &AStmt)
+{
+}
+
+void CProfileInstrumentation::Visit(CFunction &AStmt)
+{
+}
+
+void CProfileInstrumentation::Visit(CPostfixOp &AStmt)
+{
+	AStmt.SetArgument(Wrap(AStmt.GetArgument()));
+}
+
+/*
+ * A call that makes up a statement is counted before the statement, others
+ * by a comma expression around the call. Calls of void functions inside
+ * other expressions have no value to put into a comma expression, so they
+ * aren't counted.
+ */
+void CProfileInstrumentation::Visit(CFunctionCall &AStmt)
+{
+	for (CFunctionCall::ArgumentsReverseIterator it = AStmt.RBegin(); it != AStmt.REnd(); ++it) {
+		*it = Wrap(*it);
+	}
+
+	if (&AStmt == Direct && !AStmt.GetFunction()->GetBuiltIn()) {
+		if (CExpression *Counter = Count(&AStmt, PROFILE_COUNTER_ENTRY)) {
+			Pending.push_back(Counter);
+		}
+	}
+}
+
+void CProfileInstrumentation::Visit(CStructAccess &AStmt)
+{
+	AStmt.SetStruct(Wrap(AStmt.GetStruct()));
+}
+
+void CProfileInstrumentation::Visit(CIndirectAccess &AStmt)
+{
+	AStmt.SetPointer(Wrap(AStmt.GetPointer()));
+}
+
+void CProfileInstrumentation::Visit(CArrayAccess &AStmt)
+{
+	AStmt.SetLeft(Wrap(AStmt.GetLeft()));
+	AStmt.SetRight(Wrap(AStmt.GetRight()));
+}
+
+void CProfileInstrumentation::Visit(CNullStatement &AStmt)
+{
+}
+
+/*
+ * The outermost block is a function body, whose counter counts the calls of
+ * the function. Counters of the calls and loops in a statement are inserted
+ * before it.
+ */
+void CProfileInstrumentation::Visit(CBlockStatement &AStmt)
+{
+	CExpression *Entry = Blocks.empty() ? Count(&AStmt, PROFILE_COUNTER_ENTRY) : NULL;
+
+	Blocks.push(&AStmt);
+
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		vector<CStatement *> Outer;
+		Outer.swap(Pending);
+
+		VisitStatement(*it);
+
+		for (vector<CStatement *>::iterator jt = Pending.begin(); jt != Pending.end(); ++jt) {
+			AStmt.Insert(it, *jt);
+		}
+
+		Pending.swap(Outer);
+	}
+
+	Blocks.pop();
+
+	if (Entry) {
+		AStmt.Insert(AStmt.Begin(), Entry);
+	}
+}
+
+void CProfileInstrumentation::Visit(CIfStatement &AStmt)
+{
+	AStmt.SetCondition(Wrap(AStmt.GetCondition()));
+
+	AStmt.SetThenStatement(Prepend(AStmt.GetThenStatement(), Count(&AStmt, PROFILE_COUNTER_THEN)));
+	VisitStatement(AStmt.GetThenStatement());
+
+	AStmt.SetElseStatement(Prepend(AStmt.GetElseStatement(), Count(&AStmt, PROFILE_COUNTER_ELSE)));
+	VisitStatement(AStmt.GetElseStatement());
+}
+
+void CProfileInstrumentation::Visit(CForStatement &AStmt)
+{
+	if (CExpression *Entry = Count(&AStmt, PROFILE_COUNTER_ENTRY)) {
+		Pending.push_back(Entry);
+	}
+
+	AStmt.SetInit(Wrap(AStmt.GetInit()));
+	AStmt.SetCondition(Wrap(AStmt.GetCondition()));
+	AStmt.SetUpdate(Wrap(AStmt.GetUpdate()));
+
+	AStmt.SetBody(Prepend(AStmt.GetBody(), Count(&AStmt, PROFILE_COUNTER_BODY)));
+	VisitStatement(AStmt.GetBody());
+}
+
+void CProfileInstrumentation::Visit(CWhileStatement &AStmt)
+{
+	if (CExpression *Entry = Count(&AStmt, PROFILE_COUNTER_ENTRY)) {
+		Pending.push_back(Entry);
+	}
+
+	AStmt.SetCondition(Wrap(AStmt.GetCondition()));
+
+	AStmt.SetBody(Prepend(AStmt.GetBody(), Count(&AStmt, PROFILE_COUNTER_BODY)));
+	VisitStatement(AStmt.GetBody());
+}
+
+void CProfileInstrumentation::Visit(CDoStatement &AStmt)
+{
+	if (CExpression *Entry = Count(&AStmt, PROFILE_COUNTER_ENTRY)) {
+		Pending.push_back(Entry);
+	}
+
+	AStmt.SetBody(Prepend(AStmt.GetBody(), Count(&AStmt, PROFILE_COUNTER_BODY)));
+	VisitStatement(AStmt.GetBody());
+
+	AStmt.SetCondition(Wrap(AStmt.GetCondition()));
+}
+
+void CProfileInstrumentation::Visit(CLabel &AStmt)
+{
+	if (dynamic_cast<CLabel *>(AStmt.GetNext())) {
+		AStmt.GetNext()->Accept(*this);
+		return;
+	}
+
+	AStmt.SetNext(Enclose(AStmt.GetNext()));
+	VisitStatement(AStmt.GetNext());
+}
+
+/*
+ * Only the last of several labels of the same statement is counted, to
+ * keep the labels next to each other.
+ */
+void CProfileInstrumentation::Visit(CCaseLabel &AStmt)
+{
+	if (dynamic_cast<CLabel *>(AStmt.GetNext())) {
+		AStmt.GetNext()->Accept(*this);
+		return;
+	}
+
+	AStmt.SetNext(Prepend(AStmt.GetNext(), Count(&AStmt, PROFILE_COUNTER_ENTRY)));
+	VisitStatement(AStmt.GetNext());
+}
+
+void CProfileInstrumentation::Visit(CDefaultCaseLabel &AStmt)
+{
+	if (dynamic_cast<CLabel *>(AStmt.GetNext())) {
+		AStmt.GetNext()->Accept(*this);
+		return;
+	}
+
+	AStmt.SetNext(Prepend(AStmt.GetNext(), Count(&AStmt, PROFILE_COUNTER_ENTRY)));
+	VisitStatement(AStmt.GetNext());
+}
+
+void CProfileInstrumentation::Visit(CGotoStatement &AStmt)
+{
+}
+
+void CProfileInstrumentation::Visit(CBreakStatement &AStmt)
+{
+}
+
+void CProfileInstrumentation::Visit(CContinueStatement &AStmt)
+{
+}
+
+void CProfileInstrumentation::Visit(CReturnStatement &AStmt)
+{
+	AStmt.SetReturnExpression(Wrap(AStmt.GetReturnExpression()));
+}
+
+void CProfileInstrumentation::Visit(CSwitchStatement &AStmt)
+{
+	AStmt.SetTestExpression(Wrap(AStmt.GetTestExpression()));
+
+	AStmt.SetBody(Enclose(AStmt.GetBody()));
+	VisitStatement(AStmt.GetBody());
+}
+
+/*
+ * Sizes the counters once all the points are numbered, and makes main pass
+ * them to the runtime, which writes them to the file at exit. Returns the
+ * counters, which have to be output with the other globals. Each counter is
+ * 64 bits wide, a pair of ints with the low one first.
+ */
+CVariableSymbol* CProfileInstrumentation::Register(CFunctionSymbol *AMain, const string &AFilename)
+{
+	static_cast<CArraySymbol *>(Counters->GetType())->SetLength(2 * Profile.GetSize());
+
+	if (!AMain || !AMain->GetBody()) {
+		return Counters;
+	}
+
+	CFunctionSymbol *Init = new CFunctionSymbol("__profile_init", Symbols->GetType("void"));
+	Init->SetArgumentsSymbolTable(new CArgumentsSymbolTable);
+	Init->SetBuiltIn(true);
+
+	const char *Types[] = { "int*", "int", "int*" };
+
+	for (unsigned int i = 0; i < 3; i++) {
+		CVariableSymbol *Arg = new CVariableSymbol("", Symbols->GetType(Types[i]));
+		Init->GetArgumentsSymbolTable()->AddVariable(Arg);
+		Init->AddArgument(Arg);
+	}
+
+	string Filename;
+
+	for (string::const_iterator it = AFilename.begin(); it != AFilename.end(); ++it) {
+		if (*it == '"' || *it == '\\') {
+			Filename += '\\';
+		}
+		Filename += *it;
+	}
+
+	CPosition Position;
+	CFunctionCall *Call = new CFunctionCall(CToken(TOKEN_TYPE_IDENTIFIER, Init->GetName(), Position), Init);
+	Call->AddArgument(new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, Counters->GetName(), Position), Counters));
+	Call->AddArgument(new CIntegerConst(CIntegerConstToken(ToString(Profile.GetSize()), Position), Symbols->GetType("int")));
+	Call->AddArgument(new CStringConst(CToken(TOKEN_TYPE_CONSTANT_STRING, Filename, Position), Symbols->GetType("int*")));
+
+	AMain->GetBody()->Insert(AMain->GetBody()->Begin(), Call);
+
+	return Counters;
+}
+
+/*
+ * Numbers a point, and returns the increment of its counter when
+ * instrumenting, NULL otherwise. The increment is of the low half of the
+ * counter, code generation carries it into the high half.
+ */
+CExpression* CProfileInstrumentation::Count(CStatement *AStmt, EProfileCounter ACounter)
+{
+	unsigned int Index = Profile.Add(AStmt, ACounter);
+
+	if (!Instrumenting) {
+		return NULL;
+	}
+
+	CPosition Position;
+	CVariable *Array = new CVariable(CToken(TOKEN_TYPE_IDENTIFIER, Counters->GetName(), Position), Counters);
+	CIntegerConst *Offset = new CIntegerConst(CIntegerConstToken(ToString(2 * Index), Position), Symbols->GetType("int"));
+	CArrayAccess *Access = new CArrayAccess(CToken(TOKEN_TYPE_LEFT_SQUARE_BRACKET, "[", Position), Array, Offset);
+
+	return new CPostfixOp(CToken(TOKEN_TYPE_OPERATION_INCREMENT, "++", Position), Access);
+}
+
+/*
+ * Puts a counter at the start of a statement in the place of a statement.
+ */
+CStatement* CProfileInstrumentation::Prepend(CStatement *AStmt, CExpression *ACounter)
+{
+	if (!ACounter) {
+		return AStmt;
+	}
+
+	CBlockStatement *Block = static_cast<CBlockStatement *>(Enclose(AStmt ? AStmt : new CNullStatement));
+	Block->Insert(Block->Begin(), ACounter);
+
+	return Block;
+}
+
+/*
+ * When instrumenting, a statement in the place of a statement is made a
+ * block, so that counters can be inserted before the statements inside it.
+ */
+CStatement* CProfileInstrumentation::Enclose(CStatement *AStmt)
+{
+	if (!Instrumenting || !AStmt || typeid(*AStmt) == typeid(CBlockStatement)) {
+		return AStmt;
+	}
+
+	CBlockStatement *Block = new CBlockStatement;
+
+	CSymbolTable *SymTable = new CSymbolTable;
+	SymTable->SetCurrentOffset(Blocks.top()->GetSymbolTable()->GetCurrentOffset());
+	Block->SetSymbolTable(SymTable);
+
+	Blocks.top()->AddNestedBlock(Block);
+
+	Block->Add(AStmt);
+
+	return Block;
+}
+
+/*
+ * Counts a call inside an expression by a comma expression around it.
+ */
+CExpression* CProfileInstrumentation::Wrap(CExpression *AExpr)
+{
+	if (!AExpr) {
+		return NULL;
+	}
+
+	AExpr->Accept(*this);
+
+	CFunctionCall *Call = dynamic_cast<CFunctionCall *>(AExpr);
+
+	if (!Call || Call == Direct || Call->GetFunction()->GetBuiltIn() || !Call->GetResultType()->IsScalar()) {
+		return AExpr;
+	}
+
+	if (CExpression *Counter = Count(Call, PROFILE_COUNTER_ENTRY)) {
+		return new CBinaryOp(CToken(TOKEN_TYPE_SEPARATOR_COMMA, ",", Call->GetPosition()), Counter, Call);
+	}
+
+	return AExpr;
+}
+
+void CProfileInstrumentation::VisitStatement(CStatement *AStmt)
+{
+	if (!AStmt) {
+		return;
+	}
+
+	Direct = GetDirectCall(AStmt);
+	AStmt->Accept(*this);
+}
+
+/*
+ * Call that is the statement itself, its returned value or the value
+ * assigned by it.
+ */
+CFunctionCall* CProfileInstrumentation::GetDirectCall(CStatement *AStmt) const
+{
+	CStatement *Expr = AStmt;
+
+	if (CReturnStatement *Return = dynamic_cast<CReturnStatement *>(AStmt)) {
+		Expr = Return->GetReturnExpression();
+	} else if (typeid(*AStmt) == typeid(CBinaryOp) && static_cast<CBinaryOp *>(AStmt)->GetType() == TOKEN_TYPE_OPERATION_ASSIGN) {
+		Expr = static_cast<CBinaryOp *>(AStmt)->GetRight();
+	}
+
+	return dynamic_cast<CFunctionCall *>(Expr);
+}
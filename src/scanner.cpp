@@ -17,6 +17,7 @@
 */
 
 #include "scanner.h"
+#include "timereport.h"
 
 /******************************************************************************
  * CToken
@@ -214,6 +215,8 @@ const CToken* CScanner::GetToken()
 
 const CToken* CScanner::Next()
 {
+	CTimePhase Phase("scan");
+
 	delete LastToken;
 	LastToken = NULL;
 
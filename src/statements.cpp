@@ -142,6 +142,11 @@ void CBlockStatement::AddNestedBlock(CBlockStatement *ABlock)
 	NestedBlocks.push_back(ABlock);
 }
 
+void CBlockStatement::RemoveNestedBlock(CBlockStatement *ABlock)
+{
+	NestedBlocks.erase(remove(NestedBlocks.begin(), NestedBlocks.end(), ABlock), NestedBlocks.end());
+}
+
 unsigned int CBlockStatement::GetStatementsCount() const
 {
 	return Statements.size();
@@ -248,7 +253,7 @@ void CIfStatement::SetElseStatement(CStatement *AElseStatement)
  ******************************************************************************/
 
 CForStatement::CForStatement(CExpression *AInit /*= NULL*/,  CExpression *ACondition /*= NULL*/, CExpression *AUpdate /*= NULL*/, CStatement *ABody /*= NULL*/)
-	: Init(AInit), Condition(ACondition), Update(AUpdate), Body(ABody)
+	: Init(AInit), Condition(ACondition), Update(AUpdate), Body(ABody), Vectorized(false)
 {
 	Name = "for";
 }
@@ -322,6 +327,16 @@ void CForStatement::SetBody(CStatement *ABody)
 	Body = ABody;
 }
 
+bool CForStatement::GetVectorized() const
+{
+	return Vectorized;
+}
+
+void CForStatement::SetVectorized(bool AVectorized)
+{
+	Vectorized = AVectorized;
+}
+
 /******************************************************************************
  * CSingleConditionLoopStatement
  ******************************************************************************/
@@ -536,7 +551,7 @@ void CContinueStatement::Accept(CStatementVisitor &AVisitor)
  * CReturnStatement
  ******************************************************************************/
 
-CReturnStatement::CReturnStatement(CExpression *AReturnExpression /*= NULL*/) : ReturnExpression(AReturnExpression)
+CReturnStatement::CReturnStatement(CExpression *AReturnExpression /*= NULL*/) : ReturnExpression(AReturnExpression), TailCall(false)
 {
 	Name = "return";
 }
@@ -571,6 +586,16 @@ void CReturnStatement::SetReturnExpression(CExpression *AReturnExpression)
 	ReturnExpression = AReturnExpression;
 }
 
+bool CReturnStatement::GetTailCall() const
+{
+	return TailCall;
+}
+
+void CReturnStatement::SetTailCall(bool ATailCall)
+{
+	TailCall = ATailCall;
+}
+
 /******************************************************************************
  * CSwitchStatement
  ******************************************************************************/
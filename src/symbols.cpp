@@ -172,7 +172,7 @@ unsigned int CSymbolTable::VariablesSize() const
 	return Variables.size();
 }
 
-unsigned int CSymbolTable::GetElementsSize() const
+size_t CSymbolTable::GetElementsSize() const
 {
 	return ElementsSize;
 }
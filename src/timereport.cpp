@@ -0,0 +1,202 @@
+/*
+	ncc - Nartov C Compiler
+	Copyright 2010-2011  Alexander Nartov
+
+	ncc is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	ncc is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with ncc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "timereport.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+#include <sys/time.h>
+
+/******************************************************************************
+ * Allocation counting
+ ******************************************************************************/
+
+static unsigned long long AllocationsCount = 0;
+static unsigned long long AllocatedBytes = 0;
+
+static void* Allocate(size_t ASize)
+{
+	AllocationsCount++;
+	AllocatedBytes += ASize;
+
+	void *Pointer = malloc(ASize ? ASize : 1);
+
+	if (!Pointer) {
+		throw bad_alloc();
+	}
+
+	return Pointer;
+}
+
+void* operator new(size_t ASize)
+{
+	return Allocate(ASize);
+}
+
+void* operator new[](size_t ASize)
+{
+	return Allocate(ASize);
+}
+
+void operator delete(void *APointer) throw()
+{
+	free(APointer);
+}
+
+void operator delete[](void *APointer) throw()
+{
+	free(APointer);
+}
+
+/******************************************************************************
+ * CTimeReport
+ ******************************************************************************/
+
+CTimeReport *CTimeReport::Active = NULL;
+
+CTimeReport::CTimeReport()
+{
+	Start = Last = Sample();
+}
+
+void CTimeReport::Enter(const char *APhase)
+{
+	Charge();
+
+	map<string, unsigned int>::iterator it = Indices.find(APhase);
+	unsigned int Index;
+
+	if (it == Indices.end()) {
+		Index = Phases.size();
+		Indices[APhase] = Index;
+
+		CPhase Phase = {APhase, {0, 0, 0, 0}};
+		Phases.push_back(Phase);
+	} else {
+		Index = it->second;
+	}
+
+	Stack.push_back(Index);
+	Exclude();
+}
+
+void CTimeReport::Leave()
+{
+	Charge();
+	Stack.pop_back();
+}
+
+/*
+ * Phases are listed in the order they were first entered. Time and
+ * allocations outside of any phase only show in the total.
+ */
+void CTimeReport::Output(ostream &Stream, ETimeReportFormat AFormat)
+{
+	Charge();
+
+	CCounters Total = Last;
+	Total.Wall -= Start.Wall;
+	Total.CPU -= Start.CPU;
+	Total.Allocations -= Start.Allocations;
+	Total.Bytes -= Start.Bytes;
+
+	char Line[128];
+
+	if (AFormat == TIME_REPORT_FORMAT_JSON) {
+		Stream << "{\"phases\": [";
+
+		for (unsigned int i = 0; i < Phases.size(); i++) {
+			const CCounters &Counters = Phases[i].Counters;
+			snprintf(Line, sizeof(Line), "\"wall_ms\": %.3f, \"cpu_ms\": %.3f, \"allocations\": %llu, \"bytes\": %llu}", Counters.Wall, Counters.CPU, Counters.Allocations, Counters.Bytes);
+			Stream << (i ? ",\n\t" : "\n\t") << "{\"name\": \"" << Phases[i].Name << "\", " << Line;
+		}
+
+		snprintf(Line, sizeof(Line), "\"wall_ms\": %.3f, \"cpu_ms\": %.3f, \"allocations\": %llu, \"bytes\": %llu}", Total.Wall, Total.CPU, Total.Allocations, Total.Bytes);
+		Stream << "\n], \"total\": {" << Line << "}" << endl;
+		return;
+	}
+
+	snprintf(Line, sizeof(Line), "%-36s %10s %10s %12s %14s", "phase", "wall, ms", "cpu, ms", "allocations", "bytes");
+	Stream << Line << endl;
+
+	for (unsigned int i = 0; i < Phases.size(); i++) {
+		const CCounters &Counters = Phases[i].Counters;
+		snprintf(Line, sizeof(Line), "%-36s %10.3f %10.3f %12llu %14llu", Phases[i].Name.c_str(), Counters.Wall, Counters.CPU, Counters.Allocations, Counters.Bytes);
+		Stream << Line << endl;
+	}
+
+	snprintf(Line, sizeof(Line), "%-36s %10.3f %10.3f %12llu %14llu", "total", Total.Wall, Total.CPU, Total.Allocations, Total.Bytes);
+	Stream << Line << endl;
+}
+
+CTimeReport::CCounters CTimeReport::Sample()
+{
+	timeval Now;
+	gettimeofday(&Now, NULL);
+
+	CCounters Counters = {Now.tv_sec * 1000.0 + Now.tv_usec / 1000.0, clock() * 1000.0 / CLOCKS_PER_SEC, AllocationsCount, AllocatedBytes};
+	return Counters;
+}
+
+/*
+ * Adds what was spent since the last sample to the innermost phase.
+ */
+void CTimeReport::Charge()
+{
+	CCounters Now = Sample();
+
+	if (!Stack.empty()) {
+		CCounters &Counters = Phases[Stack.back()].Counters;
+		Counters.Wall += Now.Wall - Last.Wall;
+		Counters.CPU += Now.CPU - Last.CPU;
+		Counters.Allocations += Now.Allocations - Last.Allocations;
+		Counters.Bytes += Now.Bytes - Last.Bytes;
+	}
+
+	Last = Now;
+}
+
+/*
+ * Leaves out what the report allocates itself for the phases.
+ */
+void CTimeReport::Exclude()
+{
+	Last.Allocations = AllocationsCount;
+	Last.Bytes = AllocatedBytes;
+}
+
+/******************************************************************************
+ * CTimePhase
+ ******************************************************************************/
+
+CTimePhase::CTimePhase(const char *APhase) : Report(CTimeReport::Active)
+{
+	if (Report) {
+		Report->Enter(APhase);
+	}
+}
+
+CTimePhase::~CTimePhase()
+{
+	if (Report) {
+		Report->Leave();
+	}
+}
@@ -0,0 +1,1825 @@
+/*
+	ncc - Nartov C Compiler
+	Copyright 2010-2011  Alexander Nartov
+
+	ncc is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	ncc is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with ncc.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "vm.h"
+#include "timereport.h"
+
+/******************************************************************************
+ * CBytecodeProgram
+ ******************************************************************************/
+
+CBytecodeProgram::CBytecodeProgram() : Data(GuardSize, '\0')
+{
+}
+
+unsigned int CBytecodeProgram::AddFunction(CFunctionSymbol *AFunc)
+{
+	unsigned int Index = Functions.size();
+
+	Functions.push_back(CBytecodeFunction());
+	Functions.back().Name = AFunc->GetName();
+	Functions.back().RegistersCount = 0;
+	Functions.back().FrameSize = 0;
+
+	FunctionIndices[AFunc] = Index;
+
+	return Index;
+}
+
+bool CBytecodeProgram::GetFunctionIndex(CFunctionSymbol *AFunc, unsigned int &AIndex) const
+{
+	map<CFunctionSymbol *, unsigned int>::const_iterator it = FunctionIndices.find(AFunc);
+
+	if (it == FunctionIndices.end()) {
+		return false;
+	}
+
+	AIndex = it->second;
+	return true;
+}
+
+CBytecodeFunction& CBytecodeProgram::GetFunction(unsigned int AIndex)
+{
+	return Functions[AIndex];
+}
+
+unsigned int CBytecodeProgram::GetFunctionsCount() const
+{
+	return Functions.size();
+}
+
+unsigned int CBytecodeProgram::AddStringLiteral(const string &AValue)
+{
+	map<string, unsigned int>::iterator it = StringLiterals.find(AValue);
+
+	if (it != StringLiterals.end()) {
+		return it->second;
+	}
+
+	unsigned int Address = Data.size();
+
+	Data += Unescape(AValue);
+	Data += '\0';
+
+	StringLiterals[AValue] = Address;
+
+	return Address;
+}
+
+/*
+ * Scalars get their initial values, arrays and structs are zeroed, the same
+ * way the code generator lays them out in data and common sections.
+ */
+unsigned int CBytecodeProgram::AddGlobalVariable(CVariableSymbol *AVariable)
+{
+	Data.resize((Data.size() + 3) & ~3, '\0');
+
+	unsigned int Address = Data.size();
+	CTypeSymbol *Type = AVariable->GetType();
+
+	if (Type->IsScalar()) {
+		int Value = (int) AVariable->GetInitValue();
+		float FloatValue = AVariable->GetInitValue();
+
+		if (Type->IsFloat()) {
+			Value = *((int *) &FloatValue);
+		}
+
+		Data.append((const char *) &Value, sizeof(Value));
+	} else {
+		Data.append(Type->GetSize(), '\0');
+	}
+
+	GlobalAddresses[AVariable] = Address;
+
+	return Address;
+}
+
+unsigned int CBytecodeProgram::GetGlobalAddress(CVariableSymbol *AVariable) const
+{
+	map<CVariableSymbol *, unsigned int>::const_iterator it = GlobalAddresses.find(AVariable);
+
+	if (it == GlobalAddresses.end()) {
+		throw logic_error("global variable " + AVariable->GetName() + " has no address");
+	}
+
+	return it->second;
+}
+
+const string& CBytecodeProgram::GetData() const
+{
+	return Data;
+}
+
+/******************************************************************************
+ * CBytecodeGenerationVisitor
+ ******************************************************************************/
+
+static bool IsPure(CExpression *AExpr)
+{
+	if (dynamic_cast<CConst *>(AExpr) || dynamic_cast<CVariable *>(AExpr)) {
+		return true;
+	}
+
+	if (dynamic_cast<CPostfixOp *>(AExpr)) {
+		return false;
+	}
+
+	if (CUnaryOp *UnaryOp = dynamic_cast<CUnaryOp *>(AExpr)) {
+		ETokenType Type = UnaryOp->GetType();
+		return Type != TOKEN_TYPE_OPERATION_INCREMENT && Type != TOKEN_TYPE_OPERATION_DECREMENT && IsPure(UnaryOp->GetArgument());
+	}
+
+	if (CBinaryOp *BinaryOp = dynamic_cast<CBinaryOp *>(AExpr)) {
+		return !TokenTraits::IsAssignment(BinaryOp->GetType()) && IsPure(BinaryOp->GetLeft()) && IsPure(BinaryOp->GetRight());
+	}
+
+	if (CConditionalOp *ConditionalOp = dynamic_cast<CConditionalOp *>(AExpr)) {
+		return IsPure(ConditionalOp->GetCondition()) && IsPure(ConditionalOp->GetTrueExpr()) && IsPure(ConditionalOp->GetFalseExpr());
+	}
+
+	if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		return IsPure(Access->GetStruct());
+	}
+
+	if (CIndirectAccess *Access = dynamic_cast<CIndirectAccess *>(AExpr)) {
+		return IsPure(Access->GetPointer());
+	}
+
+	return false;
+}
+
+static bool Affects(CExpression *AExpr, CVariableSymbol *AVariable)
+{
+	CStatement::AffectedContainer Affected;
+	AExpr->GetAffectedVariables(Affected);
+
+	return Affected.count(AVariable) != 0;
+}
+
+static bool Uses(CExpression *AExpr, CVariableSymbol *AVariable)
+{
+	CStatement::UsedContainer Used;
+	AExpr->GetUsedVariables(Used);
+
+	return Used.count(AVariable) != 0;
+}
+
+static bool IsJump(EOpcode AOp)
+{
+	return AOp >= OPCODE_JMP && AOp <= OPCODE_JGEK;
+}
+
+static int FloatBits(float AValue)
+{
+	return *((int *) &AValue);
+}
+
+CBytecodeGenerationVisitor::CBytecodeGenerationVisitor(CBytecodeProgram &AProgram) : Program(AProgram), Function(NULL), FuncSym(NULL), Target(0), FirstFree(0), VariablesCount(0)
+{
+	IntOperationOp[TOKEN_TYPE_OPERATION_PLUS] = OPCODE_ADD;
+	IntOperationOp[TOKEN_TYPE_OPERATION_MINUS] = OPCODE_SUB;
+	IntOperationOp[TOKEN_TYPE_OPERATION_ASTERISK] = OPCODE_MUL;
+	IntOperationOp[TOKEN_TYPE_OPERATION_SLASH] = OPCODE_DIV;
+	IntOperationOp[TOKEN_TYPE_OPERATION_PERCENT] = OPCODE_MOD;
+	IntOperationOp[TOKEN_TYPE_OPERATION_AMPERSAND] = OPCODE_AND;
+	IntOperationOp[TOKEN_TYPE_OPERATION_BITWISE_OR] = OPCODE_OR;
+	IntOperationOp[TOKEN_TYPE_OPERATION_BITWISE_XOR] = OPCODE_XOR;
+	IntOperationOp[TOKEN_TYPE_OPERATION_SHIFT_LEFT] = OPCODE_SHL;
+	IntOperationOp[TOKEN_TYPE_OPERATION_SHIFT_RIGHT] = OPCODE_SHR;
+
+	FloatOperationOp[TOKEN_TYPE_OPERATION_PLUS] = OPCODE_FADD;
+	FloatOperationOp[TOKEN_TYPE_OPERATION_MINUS] = OPCODE_FSUB;
+	FloatOperationOp[TOKEN_TYPE_OPERATION_ASTERISK] = OPCODE_FMUL;
+	FloatOperationOp[TOKEN_TYPE_OPERATION_SLASH] = OPCODE_FDIV;
+
+	IntJumpOp[TOKEN_TYPE_OPERATION_EQUAL] = OPCODE_JEQ;
+	IntJumpOp[TOKEN_TYPE_OPERATION_NOT_EQUAL] = OPCODE_JNE;
+	IntJumpOp[TOKEN_TYPE_OPERATION_LESS_THAN] = OPCODE_JLT;
+	IntJumpOp[TOKEN_TYPE_OPERATION_GREATER_THAN] = OPCODE_JGT;
+	IntJumpOp[TOKEN_TYPE_OPERATION_LESS_THAN_OR_EQUAL] = OPCODE_JLE;
+	IntJumpOp[TOKEN_TYPE_OPERATION_GREATER_THAN_OR_EQUAL] = OPCODE_JGE;
+
+	UnsignedJumpOp[TOKEN_TYPE_OPERATION_EQUAL] = OPCODE_JEQ;
+	UnsignedJumpOp[TOKEN_TYPE_OPERATION_NOT_EQUAL] = OPCODE_JNE;
+	UnsignedJumpOp[TOKEN_TYPE_OPERATION_LESS_THAN] = OPCODE_JB;
+	UnsignedJumpOp[TOKEN_TYPE_OPERATION_GREATER_THAN] = OPCODE_JA;
+	UnsignedJumpOp[TOKEN_TYPE_OPERATION_LESS_THAN_OR_EQUAL] = OPCODE_JBE;
+	UnsignedJumpOp[TOKEN_TYPE_OPERATION_GREATER_THAN_OR_EQUAL] = OPCODE_JAE;
+
+	FloatJumpOp[TOKEN_TYPE_OPERATION_EQUAL] = OPCODE_FJEQ;
+	FloatJumpOp[TOKEN_TYPE_OPERATION_NOT_EQUAL] = OPCODE_FJNE;
+	FloatJumpOp[TOKEN_TYPE_OPERATION_LESS_THAN] = OPCODE_FJLT;
+	FloatJumpOp[TOKEN_TYPE_OPERATION_GREATER_THAN] = OPCODE_FJGT;
+	FloatJumpOp[TOKEN_TYPE_OPERATION_LESS_THAN_OR_EQUAL] = OPCODE_FJLE;
+	FloatJumpOp[TOKEN_TYPE_OPERATION_GREATER_THAN_OR_EQUAL] = OPCODE_FJGE;
+
+	ConstJumpOp[TOKEN_TYPE_OPERATION_EQUAL] = OPCODE_JEQK;
+	ConstJumpOp[TOKEN_TYPE_OPERATION_NOT_EQUAL] = OPCODE_JNEK;
+	ConstJumpOp[TOKEN_TYPE_OPERATION_LESS_THAN] = OPCODE_JLTK;
+	ConstJumpOp[TOKEN_TYPE_OPERATION_GREATER_THAN] = OPCODE_JGTK;
+	ConstJumpOp[TOKEN_TYPE_OPERATION_LESS_THAN_OR_EQUAL] = OPCODE_JLEK;
+	ConstJumpOp[TOKEN_TYPE_OPERATION_GREATER_THAN_OR_EQUAL] = OPCODE_JGEK;
+
+	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_PLUS_ASSIGN] = TOKEN_TYPE_OPERATION_PLUS;
+	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_MINUS_ASSIGN] = TOKEN_TYPE_OPERATION_MINUS;
+	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_ASTERISK_ASSIGN] = TOKEN_TYPE_OPERATION_ASTERISK;
+	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_SLASH_ASSIGN] = TOKEN_TYPE_OPERATION_SLASH;
+	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_PERCENT_ASSIGN] = TOKEN_TYPE_OPERATION_PERCENT;
+	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_BITWISE_OR_ASSIGN] = TOKEN_TYPE_OPERATION_BITWISE_OR;
+	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_AMPERSAND_ASSIGN] = TOKEN_TYPE_OPERATION_AMPERSAND;
+	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_BITWISE_XOR_ASSIGN] = TOKEN_TYPE_OPERATION_BITWISE_XOR;
+	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_SHIFT_LEFT_ASSIGN] = TOKEN_TYPE_OPERATION_SHIFT_LEFT;
+	CompoundAssignmentOp[TOKEN_TYPE_OPERATION_SHIFT_RIGHT_ASSIGN] = TOKEN_TYPE_OPERATION_SHIFT_RIGHT;
+
+	InvertedJump[OPCODE_JZ] = OPCODE_JNZ;
+	InvertedJump[OPCODE_JNZ] = OPCODE_JZ;
+	InvertedJump[OPCODE_FJZ] = OPCODE_FJNZ;
+	InvertedJump[OPCODE_FJNZ] = OPCODE_FJZ;
+	InvertedJump[OPCODE_JEQ] = OPCODE_JNE;
+	InvertedJump[OPCODE_JNE] = OPCODE_JEQ;
+	InvertedJump[OPCODE_JLT] = OPCODE_JGE;
+	InvertedJump[OPCODE_JGE] = OPCODE_JLT;
+	InvertedJump[OPCODE_JGT] = OPCODE_JLE;
+	InvertedJump[OPCODE_JLE] = OPCODE_JGT;
+	InvertedJump[OPCODE_JB] = OPCODE_JAE;
+	InvertedJump[OPCODE_JAE] = OPCODE_JB;
+	InvertedJump[OPCODE_JA] = OPCODE_JBE;
+	InvertedJump[OPCODE_JBE] = OPCODE_JA;
+	InvertedJump[OPCODE_FJEQ] = OPCODE_FJNE;
+	InvertedJump[OPCODE_FJNE] = OPCODE_FJEQ;
+	InvertedJump[OPCODE_FJLT] = OPCODE_FJGE;
+	InvertedJump[OPCODE_FJGE] = OPCODE_FJLT;
+	InvertedJump[OPCODE_FJGT] = OPCODE_FJLE;
+	InvertedJump[OPCODE_FJLE] = OPCODE_FJGT;
+	InvertedJump[OPCODE_JEQK] = OPCODE_JNEK;
+	InvertedJump[OPCODE_JNEK] = OPCODE_JEQK;
+	InvertedJump[OPCODE_JLTK] = OPCODE_JGEK;
+	InvertedJump[OPCODE_JGEK] = OPCODE_JLTK;
+	InvertedJump[OPCODE_JGTK] = OPCODE_JLEK;
+	InvertedJump[OPCODE_JLEK] = OPCODE_JGTK;
+}
+
+/*
+ * Jumps are generated to labels, which are resolved to offsets from the next
+ * instruction once the function is complete.
+ */
+void CBytecodeGenerationVisitor::Generate(CFunctionSymbol *AFunc)
+{
+	unsigned int Index;
+
+	if (!Program.GetFunctionIndex(AFunc, Index)) {
+		throw logic_error("function " + AFunc->GetName() + " isn't in the program");
+	}
+
+	Function = &Program.GetFunction(Index);
+	FuncSym = AFunc;
+
+	VariableRegisters.clear();
+	VariableOffsets.clear();
+	Labels.clear();
+	UserLabels.clear();
+	CaseLabels.clear();
+	FirstFree = 0;
+
+	CBlockStatement *Body = AFunc->GetBody();
+
+	CInductionVariableAnalyzer Usage;
+	Body->Accept(Usage);
+
+	CFunctionSymbol::ArgumentsOrderContainer *Arguments = AFunc->GetArgumentsOrderedList();
+
+	for (CFunctionSymbol::ArgumentsOrderIterator it = Arguments->begin(); it != Arguments->end(); ++it) {
+		int Register = AllocateRegister();
+
+		if ((*it)->GetType()->IsScalar() && !Usage.GetAddressTaken(*it)) {
+			VariableRegisters[*it] = Register;
+		} else {
+			AllocateFrameVariable(*it);
+			Add(OPCODE_STOREF, Register, VariableOffsets[*it]);
+		}
+	}
+
+	AllocateVariables(Body, Usage);
+	VariablesCount = FirstFree;
+
+	for (CBlockStatement::StatementsIterator it = Body->Begin(); it != Body->End(); ++it) {
+		GenerateStatement(*it);
+	}
+
+	Add(OPCODE_RETV);
+
+	for (unsigned int i = 0; i < Function->Code.size(); i++) {
+		CInstruction &Instruction = Function->Code[i];
+
+		if (IsJump(Instruction.Op)) {
+			Instruction.C = Labels[Instruction.C] - (i + 1);
+		}
+	}
+}
+
+void CBytecodeGenerationVisitor::Visit(CUnaryOp &AStmt)
+{
+	ETokenType OpType = AStmt.GetType();
+	CExpression *Arg = AStmt.GetArgument();
+
+	if (OpType == TOKEN_TYPE_OPERATION_AMPERSAND) {
+		LoadAddress(SelectAddress(Arg), Target);
+	} else if (OpType == TOKEN_TYPE_KEYWORD && AStmt.GetName() == "sizeof") {
+		Add(OPCODE_LOADK, Target, Arg->GetResultType()->GetSize());
+	} else if (OpType == TOKEN_TYPE_OPERATION_LOGIC_NOT) {
+		GenerateConditionValue(&AStmt);
+	} else if (OpType == TOKEN_TYPE_OPERATION_INCREMENT || OpType == TOKEN_TYPE_OPERATION_DECREMENT) {
+		bool Increment = (OpType == TOKEN_TYPE_OPERATION_INCREMENT);
+		CAddress Address;
+
+		if (Arg->GetResultType()->IsFloat()) {
+			// the argument is read before its address is taken
+			if (IsPure(Arg)) {
+				Address = SelectAddress(Arg);
+				Load(Address, Target);
+			} else {
+				GenerateValue(Arg, Target);
+				Address = SelectAddress(Arg);
+			}
+
+			int One = AllocateRegister();
+			Add(OPCODE_LOADK, One, FloatBits(1.0f));
+			Add(Increment ? OPCODE_FADD : OPCODE_FSUB, Target, Target, One);
+			Store(Address, Target);
+		} else {
+			Address = SelectAddress(Arg);
+
+			if (Address.Type == ADDRESS_VARIABLE) {
+				Add(OPCODE_ADDK, Address.Base, Address.Base, Increment ? 1 : -1);
+				Add(OPCODE_MOVE, Target, Address.Base);
+				return;
+			}
+
+			if (IsPure(Arg)) {
+				Load(Address, Target);
+			} else {
+				PinAddress(Address);
+				GenerateValue(Arg, Target);
+			}
+
+			Add(OPCODE_ADDK, Target, Target, Increment ? 1 : -1);
+			Store(Address, Target);
+		}
+	} else {
+		GenerateValue(Arg, Target);
+
+		if (Arg->GetResultType()->IsFloat()) {
+			if (OpType == TOKEN_TYPE_OPERATION_MINUS) {
+				Add(OPCODE_FNEG, Target, Target);
+			}
+		} else if (OpType == TOKEN_TYPE_OPERATION_ASTERISK) {
+			Add(OPCODE_LOAD, Target, Target, 0);
+		} else if (OpType == TOKEN_TYPE_OPERATION_MINUS) {
+			Add(OPCODE_NEG, Target, Target);
+		} else if (OpType == TOKEN_TYPE_OPERATION_BITWISE_NOT) {
+			Add(OPCODE_NOT, Target, Target);
+		}
+	}
+}
+
+/*
+ * Like the code generator, compound assignments store the result in the
+ * common type of the operands, and pointer arithmetic is not scaled.
+ */
+void CBytecodeGenerationVisitor::Visit(CBinaryOp &AStmt)
+{
+	ETokenType OpType = AStmt.GetType();
+	CExpression *Left = AStmt.GetLeft();
+	CExpression *Right = AStmt.GetRight();
+
+	if (OpType == TOKEN_TYPE_OPERATION_ASSIGN) {
+		CAddress Address = SelectAddress(Left);
+
+		if (Address.Type == ADDRESS_VARIABLE) {
+			// the value goes straight into the variable unless the right side still needs the old one after that
+			CVariableSymbol *Variable = static_cast<CVariable *>(Left)->GetSymbol();
+			int Value = IsPure(Right) || !Uses(Right, Variable) ? Address.Base : AllocateRegister();
+
+			GenerateValue(Right, Value);
+			PerformConversion(Left->GetResultType(), Right->GetResultType(), Value);
+
+			Add(OPCODE_MOVE, Address.Base, Value);
+			Add(OPCODE_MOVE, Target, Address.Base);
+		} else {
+			if (!IsPure(Right)) {
+				PinAddress(Address);
+			}
+
+			GenerateValue(Right, Target);
+			PerformConversion(Left->GetResultType(), Right->GetResultType(), Target);
+
+			Store(Address, Target);
+		}
+	} else if (OpType == TOKEN_TYPE_SEPARATOR_COMMA) {
+		GenerateValue(Left, AllocateRegister());
+		GenerateValue(Right, Target);
+	} else if (TokenTraits::IsComparisonOperation(OpType) || OpType == TOKEN_TYPE_OPERATION_LOGIC_AND || OpType == TOKEN_TYPE_OPERATION_LOGIC_OR) {
+		GenerateConditionValue(&AStmt);
+	} else {
+		CTypeSymbol *Common = AStmt.GetCommonRealType();
+		bool Float = Common->IsFloat();
+		CIntegerConst *Const = dynamic_cast<CIntegerConst *>(Right);
+		int Result = Target;
+		int LeftValue;
+		CAddress Address;
+
+		if (TokenTraits::IsCompoundAssignment(OpType)) {
+			OpType = CompoundAssignmentOp[OpType];
+			Address = SelectAddress(Left);
+
+			if (Address.Type == ADDRESS_VARIABLE) {
+				LeftValue = Address.Base;
+				Result = Address.Base;
+
+				if (Affects(Right, static_cast<CVariable *>(Left)->GetSymbol())) {
+					LeftValue = AllocateRegister();
+					Add(OPCODE_MOVE, LeftValue, Address.Base);
+				}
+			} else {
+				if (!IsPure(Left) || !IsPure(Right)) {
+					PinAddress(Address);
+				}
+
+				LeftValue = AllocateRegister();
+
+				if (IsPure(Left)) {
+					Load(Address, LeftValue);
+				} else {
+					GenerateValue(Left, LeftValue);
+				}
+			}
+
+			if (NeedsConversion(Common, Left->GetResultType()) && LeftValue < VariablesCount) {
+				int Copy = AllocateRegister();
+				Add(OPCODE_MOVE, Copy, LeftValue);
+				LeftValue = Copy;
+			}
+
+			PerformConversion(Common, Left->GetResultType(), LeftValue);
+		} else {
+			LeftValue = GenerateConvertedOperand(Left, Common, Right);
+		}
+
+		if (!Float && Const && (OpType == TOKEN_TYPE_OPERATION_PLUS || OpType == TOKEN_TYPE_OPERATION_MINUS)) {
+			Add(OPCODE_ADDK, Result, LeftValue, OpType == TOKEN_TYPE_OPERATION_PLUS ? Const->GetValue() : -Const->GetValue());
+		} else {
+			GenerateArithmetic(OpType, Float, Result, LeftValue, GenerateConvertedOperand(Right, Common));
+		}
+
+		if (TokenTraits::IsCompoundAssignment(AStmt.GetType())) {
+			if (Address.Type == ADDRESS_VARIABLE) {
+				Add(OPCODE_MOVE, Target, Result);
+			} else {
+				Store(Address, Result);
+			}
+		}
+	}
+}
+
+void CBytecodeGenerationVisitor::Visit(CConditionalOp &AStmt)
+{
+	int ElseLabel = GenerateLabel();
+	int EndLabel = GenerateLabel();
+
+	GenerateCondition(AStmt.GetCondition(), ElseLabel, false);
+
+	GenerateValue(AStmt.GetTrueExpr(), Target);
+	Add(OPCODE_JMP, 0, 0, EndLabel);
+
+	AddLabel(ElseLabel);
+	GenerateValue(AStmt.GetFalseExpr(), Target);
+
+	AddLabel(EndLabel);
+}
+
+void CBytecodeGenerationVisitor::Visit(CIntegerConst &AStmt)
+{
+	Add(OPCODE_LOADK, Target, AStmt.GetValue());
+}
+
+void CBytecodeGenerationVisitor::Visit(CFloatConst &AStmt)
+{
+	Add(OPCODE_LOADK, Target, FloatBits(AStmt.GetValue()));
+}
+
+void CBytecodeGenerationVisitor::Visit(CCharConst &AStmt)
+{
+	Add(OPCODE_LOADK, Target, AStmt.GetValue());
+}
+
+void CBytecodeGenerationVisitor::Visit(CStringConst &AStmt)
+{
+	Add(OPCODE_LOADK, Target, Program.AddStringLiteral(AStmt.GetValue()));
+}
+
+void CBytecodeGenerationVisitor::Visit(CVariable &AStmt)
+{
+	LoadValue(SelectAddress(&AStmt), AStmt.GetResultType(), Target);
+}
+
+void CBytecodeGenerationVisitor::Visit(CFunction &AStmt)
+{
+}
+
+void CBytecodeGenerationVisitor::Visit(CPostfixOp &AStmt)
+{
+	CExpression *Arg = AStmt.GetArgument();
+	bool Increment = (AStmt.GetType() == TOKEN_TYPE_OPERATION_INCREMENT);
+	CAddress Address;
+
+	if (IsPure(Arg)) {
+		Address = SelectAddress(Arg);
+		Load(Address, Target);
+	} else {
+		GenerateValue(Arg, Target);
+		Address = SelectAddress(Arg);
+	}
+
+	int Result = Address.Type == ADDRESS_VARIABLE ? Address.Base : AllocateRegister();
+
+	if (Arg->GetResultType()->IsFloat()) {
+		int One = AllocateRegister();
+		Add(OPCODE_LOADK, One, FloatBits(1.0f));
+		Add(Increment ? OPCODE_FADD : OPCODE_FSUB, Result, Target, One);
+	} else {
+		Add(OPCODE_ADDK, Result, Target, Increment ? 1 : -1);
+	}
+
+	Store(Address, Result);
+}
+
+/*
+ * Arguments are evaluated from the last one into the registers the callee's
+ * frame starts at, which is above every register in use.
+ */
+void CBytecodeGenerationVisitor::Visit(CFunctionCall &AStmt)
+{
+	CFunctionSymbol *Func = AStmt.GetFunction();
+	CFunctionSymbol::ArgumentsOrderContainer *FormalArgs = Func->GetArgumentsOrderedList();
+
+	int First = FirstFree;
+	for (unsigned int i = 0; i < max(AStmt.GetArgumentsCount(), 1U); i++) {
+		AllocateRegister();
+	}
+
+	CFunctionCall::ArgumentsReverseIterator ait;
+	CFunctionSymbol::ArgumentsReverseOrderIterator fit;
+	int Register = First + AStmt.GetArgumentsCount() - 1;
+
+	for (ait = AStmt.RBegin(), fit = FormalArgs->rbegin(); ait != AStmt.REnd() && fit != FormalArgs->rend(); ++ait, ++fit, --Register) {
+		GenerateValue(*ait, Register);
+		PerformConversion((*fit)->GetType(), (*ait)->GetResultType(), Register);
+	}
+
+	unsigned int Index;
+
+	if (Program.GetFunctionIndex(Func, Index)) {
+		Add(OPCODE_CALL, First, Index);
+	} else if (Func->GetName() == "__print_int") {
+		Add(OPCODE_NATIVE, First, NATIVE_HOOK_PRINT_INT);
+	} else if (Func->GetName() == "__print_float") {
+		Add(OPCODE_NATIVE, First, NATIVE_HOOK_PRINT_FLOAT);
+	} else if (Func->GetName() == "printf") {
+		Add(OPCODE_NATIVE, First, NATIVE_HOOK_PRINTF);
+	} else {
+		throw CFatalException(EXIT_CODE_NOT_IMPLEMENTED, "function " + Func->GetName() + " isn't defined, so it can't be run");
+	}
+
+	Add(OPCODE_MOVE, Target, First);
+}
+
+void CBytecodeGenerationVisitor::Visit(CStructAccess &AStmt)
+{
+	LoadValue(SelectAddress(&AStmt), AStmt.GetResultType(), Target);
+}
+
+void CBytecodeGenerationVisitor::Visit(CIndirectAccess &AStmt)
+{
+	LoadValue(SelectAddress(&AStmt), AStmt.GetResultType(), Target);
+}
+
+void CBytecodeGenerationVisitor::Visit(CArrayAccess &AStmt)
+{
+	LoadValue(SelectElementAddress(AStmt), AStmt.GetResultType(), Target);
+}
+
+void CBytecodeGenerationVisitor::Visit(CNullStatement &AStmt)
+{
+}
+
+void CBytecodeGenerationVisitor::Visit(CBlockStatement &AStmt)
+{
+	for (CBlockStatement::StatementsIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		GenerateStatement(*it);
+	}
+}
+
+void CBytecodeGenerationVisitor::Visit(CIfStatement &AStmt)
+{
+	int ElseLabel = GenerateLabel();
+	int EndLabel = GenerateLabel();
+
+	GenerateCondition(AStmt.GetCondition(), ElseLabel, false);
+
+	GenerateStatement(AStmt.GetThenStatement());
+
+	if (AStmt.GetElseStatement()) {
+		Add(OPCODE_JMP, 0, 0, EndLabel);
+	}
+
+	AddLabel(ElseLabel);
+	GenerateStatement(AStmt.GetElseStatement());
+
+	AddLabel(EndLabel);
+}
+
+/*
+ * Loops test their condition at the bottom, so an iteration takes a single
+ * jump.
+ */
+void CBytecodeGenerationVisitor::Visit(CForStatement &AStmt)
+{
+	int StartLabel = GenerateLabel();
+	int ContinueLabel = GenerateLabel();
+	int ConditionLabel = GenerateLabel();
+	int EndLabel = GenerateLabel();
+
+	GenerateStatement(AStmt.GetInit());
+
+	Add(OPCODE_JMP, 0, 0, ConditionLabel);
+	AddLabel(StartLabel);
+
+	BreakLabels.push(EndLabel);
+	ContinueLabels.push(ContinueLabel);
+
+	GenerateStatement(AStmt.GetBody());
+
+	BreakLabels.pop();
+	ContinueLabels.pop();
+
+	AddLabel(ContinueLabel);
+	GenerateStatement(AStmt.GetUpdate());
+
+	AddLabel(ConditionLabel);
+
+	if (AStmt.GetCondition()) {
+		GenerateCondition(AStmt.GetCondition(), StartLabel, true);
+	} else {
+		Add(OPCODE_JMP, 0, 0, StartLabel);
+	}
+
+	AddLabel(EndLabel);
+}
+
+void CBytecodeGenerationVisitor::Visit(CWhileStatement &AStmt)
+{
+	int StartLabel = GenerateLabel();
+	int ConditionLabel = GenerateLabel();
+	int EndLabel = GenerateLabel();
+
+	Add(OPCODE_JMP, 0, 0, ConditionLabel);
+	AddLabel(StartLabel);
+
+	BreakLabels.push(EndLabel);
+	ContinueLabels.push(ConditionLabel);
+
+	GenerateStatement(AStmt.GetBody());
+
+	BreakLabels.pop();
+	ContinueLabels.pop();
+
+	AddLabel(ConditionLabel);
+	GenerateCondition(AStmt.GetCondition(), StartLabel, true);
+
+	AddLabel(EndLabel);
+}
+
+void CBytecodeGenerationVisitor::Visit(CDoStatement &AStmt)
+{
+	int StartLabel = GenerateLabel();
+	int ContinueLabel = GenerateLabel();
+	int EndLabel = GenerateLabel();
+
+	AddLabel(StartLabel);
+
+	BreakLabels.push(EndLabel);
+	ContinueLabels.push(ContinueLabel);
+
+	GenerateStatement(AStmt.GetBody());
+
+	BreakLabels.pop();
+	ContinueLabels.pop();
+
+	AddLabel(ContinueLabel);
+	GenerateCondition(AStmt.GetCondition(), StartLabel, true);
+
+	AddLabel(EndLabel);
+}
+
+void CBytecodeGenerationVisitor::Visit(CLabel &AStmt)
+{
+	AddLabel(GetUserLabel(AStmt.GetName()));
+
+	GenerateStatement(AStmt.GetNext());
+}
+
+void CBytecodeGenerationVisitor::Visit(CCaseLabel &AStmt)
+{
+	AddLabel(CaseLabels[&AStmt]);
+
+	GenerateStatement(AStmt.GetNext());
+}
+
+void CBytecodeGenerationVisitor::Visit(CDefaultCaseLabel &AStmt)
+{
+	AddLabel(CaseLabels[&AStmt]);
+
+	GenerateStatement(AStmt.GetNext());
+}
+
+void CBytecodeGenerationVisitor::Visit(CGotoStatement &AStmt)
+{
+	Add(OPCODE_JMP, 0, 0, GetUserLabel(AStmt.GetLabelName()));
+}
+
+void CBytecodeGenerationVisitor::Visit(CBreakStatement &AStmt)
+{
+	Add(OPCODE_JMP, 0, 0, BreakLabels.top());
+}
+
+void CBytecodeGenerationVisitor::Visit(CContinueStatement &AStmt)
+{
+	Add(OPCODE_JMP, 0, 0, ContinueLabels.top());
+}
+
+void CBytecodeGenerationVisitor::Visit(CReturnStatement &AStmt)
+{
+	if (AStmt.GetReturnExpression()) {
+		int Top = FirstFree;
+
+		Add(OPCODE_RET, GenerateConvertedOperand(AStmt.GetReturnExpression(), FuncSym->GetReturnType()));
+
+		FirstFree = Top;
+	} else {
+		Add(OPCODE_RETV);
+	}
+}
+
+void CBytecodeGenerationVisitor::Visit(CSwitchStatement &AStmt)
+{
+	int Top = FirstFree;
+	int Test = GenerateOperand(AStmt.GetTestExpression());
+
+	for (CSwitchStatement::CasesIterator it = AStmt.Begin(); it != AStmt.End(); ++it) {
+		int CaseLabel = GenerateLabel();
+		CaseLabels[it->second] = CaseLabel;
+
+		Add(OPCODE_JEQK, Test, it->second->GetValue(), CaseLabel);
+	}
+
+	FirstFree = Top;
+
+	int EndLabel = GenerateLabel();
+
+	if (AStmt.GetDefaultCase()) {
+		int DefaultLabel = GenerateLabel();
+		CaseLabels[AStmt.GetDefaultCase()] = DefaultLabel;
+
+		Add(OPCODE_JMP, 0, 0, DefaultLabel);
+	} else {
+		Add(OPCODE_JMP, 0, 0, EndLabel);
+	}
+
+	BreakLabels.push(EndLabel);
+
+	GenerateStatement(AStmt.GetBody());
+
+	BreakLabels.pop();
+
+	AddLabel(EndLabel);
+}
+
+void CBytecodeGenerationVisitor::AllocateVariables(CBlockStatement *ABlock, CInductionVariableAnalyzer &AUsage)
+{
+	if (CSymbolTable *SymTable = ABlock->GetSymbolTable()) {
+		for (CSymbolTable::VariablesIterator it = SymTable->VariablesBegin(); it != SymTable->VariablesEnd(); ++it) {
+			if (it->second->GetType()->IsScalar() && !AUsage.GetAddressTaken(it->second)) {
+				VariableRegisters[it->second] = AllocateRegister();
+			} else {
+				AllocateFrameVariable(it->second);
+			}
+		}
+	}
+
+	for (CBlockStatement::NestedBlocksIterator it = ABlock->NestedBlocksBegin(); it != ABlock->NestedBlocksEnd(); ++it) {
+		AllocateVariables(*it, AUsage);
+	}
+}
+
+void CBytecodeGenerationVisitor::AllocateFrameVariable(CVariableSymbol *AVariable)
+{
+	VariableOffsets[AVariable] = Function->FrameSize;
+	Function->FrameSize += (AVariable->GetType()->GetSize() + 3) & ~3;
+}
+
+int CBytecodeGenerationVisitor::AllocateRegister()
+{
+	int Register = FirstFree++;
+
+	if ((unsigned int) FirstFree > Function->RegistersCount) {
+		Function->RegistersCount = FirstFree;
+	}
+
+	return Register;
+}
+
+void CBytecodeGenerationVisitor::Add(EOpcode AOp, int A /*= 0*/, int B /*= 0*/, int C /*= 0*/)
+{
+	if (AOp == OPCODE_MOVE && A == B) {
+		return;
+	}
+
+	CInstruction Instruction = {AOp, A, B, C};
+	Function->Code.push_back(Instruction);
+}
+
+int CBytecodeGenerationVisitor::GenerateLabel()
+{
+	Labels.push_back(-1);
+	return Labels.size() - 1;
+}
+
+void CBytecodeGenerationVisitor::AddLabel(int ALabel)
+{
+	Labels[ALabel] = Function->Code.size();
+}
+
+int CBytecodeGenerationVisitor::GetUserLabel(const string &AName)
+{
+	map<string, int>::iterator it = UserLabels.find(AName);
+
+	if (it != UserLabels.end()) {
+		return it->second;
+	}
+
+	return UserLabels[AName] = GenerateLabel();
+}
+
+/*
+ * Evaluates an expression into a register, releasing the temporaries it used.
+ */
+void CBytecodeGenerationVisitor::GenerateValue(CExpression *AExpr, int ARegister)
+{
+	int SavedTarget = Target;
+	int Top = FirstFree;
+
+	Target = ARegister;
+	AExpr->Accept(*this);
+
+	Target = SavedTarget;
+	FirstFree = Top;
+}
+
+/*
+ * Returns the register of an operand: the one of a register variable, unless
+ * the expression evaluated after it changes the variable, or a new temporary.
+ */
+int CBytecodeGenerationVisitor::GenerateOperand(CExpression *AExpr, CExpression *ALater /*= NULL*/)
+{
+	if (CVariable *Var = dynamic_cast<CVariable *>(AExpr)) {
+		map<CVariableSymbol *, int>::iterator it = VariableRegisters.find(Var->GetSymbol());
+
+		if (it != VariableRegisters.end() && !(ALater && Affects(ALater, Var->GetSymbol()))) {
+			return it->second;
+		}
+	}
+
+	int Register = AllocateRegister();
+	GenerateValue(AExpr, Register);
+
+	return Register;
+}
+
+int CBytecodeGenerationVisitor::GenerateConvertedOperand(CExpression *AExpr, CTypeSymbol *AType, CExpression *ALater /*= NULL*/)
+{
+	if (!NeedsConversion(AType, AExpr->GetResultType())) {
+		return GenerateOperand(AExpr, ALater);
+	}
+
+	int Register = AllocateRegister();
+	GenerateValue(AExpr, Register);
+	PerformConversion(AType, AExpr->GetResultType(), Register);
+
+	return Register;
+}
+
+void CBytecodeGenerationVisitor::GenerateCondition(CExpression *ACondition, int ALabel, bool AJumpIfTrue)
+{
+	CUnaryOp *UnaryOp = dynamic_cast<CUnaryOp *>(ACondition);
+	CBinaryOp *BinaryOp = dynamic_cast<CBinaryOp *>(ACondition);
+	CIntegerConst *IntConst = dynamic_cast<CIntegerConst *>(ACondition);
+	int Top = FirstFree;
+
+	if (UnaryOp && UnaryOp->GetType() == TOKEN_TYPE_OPERATION_LOGIC_NOT) {
+		GenerateCondition(UnaryOp->GetArgument(), ALabel, !AJumpIfTrue);
+
+	} else if (BinaryOp && (BinaryOp->GetType() == TOKEN_TYPE_OPERATION_LOGIC_AND || BinaryOp->GetType() == TOKEN_TYPE_OPERATION_LOGIC_OR)) {
+		bool IsAnd = (BinaryOp->GetType() == TOKEN_TYPE_OPERATION_LOGIC_AND);
+
+		if (IsAnd == AJumpIfTrue) {
+			int SkipLabel = GenerateLabel();
+			GenerateCondition(BinaryOp->GetLeft(), SkipLabel, !AJumpIfTrue);
+			GenerateCondition(BinaryOp->GetRight(), ALabel, AJumpIfTrue);
+			AddLabel(SkipLabel);
+		} else {
+			GenerateCondition(BinaryOp->GetLeft(), ALabel, AJumpIfTrue);
+			GenerateCondition(BinaryOp->GetRight(), ALabel, AJumpIfTrue);
+		}
+
+	} else if (BinaryOp && TokenTraits::IsComparisonOperation(BinaryOp->GetType())) {
+		CTypeSymbol *Common = BinaryOp->GetCommonRealType();
+		CIntegerConst *RightConst = dynamic_cast<CIntegerConst *>(BinaryOp->GetRight());
+		EOpcode Jump;
+
+		int Left = GenerateConvertedOperand(BinaryOp->GetLeft(), Common, BinaryOp->GetRight());
+		int Right;
+
+		if (Common->IsFloat()) {
+			Right = GenerateConvertedOperand(BinaryOp->GetRight(), Common);
+			Jump = FloatJumpOp[BinaryOp->GetType()];
+		} else if (RightConst && !Common->IsPointer()) {
+			Right = RightConst->GetValue();
+			Jump = ConstJumpOp[BinaryOp->GetType()];
+		} else {
+			Right = GenerateOperand(BinaryOp->GetRight());
+			// pointers are compared as unsigned, as the code generator does
+			Jump = Common->IsPointer() ? UnsignedJumpOp[BinaryOp->GetType()] : IntJumpOp[BinaryOp->GetType()];
+		}
+
+		Add(AJumpIfTrue ? Jump : InvertedJump[Jump], Left, Right, ALabel);
+
+	} else if (IntConst) {
+		if ((IntConst->GetValue() != 0) == AJumpIfTrue) {
+			Add(OPCODE_JMP, 0, 0, ALabel);
+		}
+
+	} else {
+		int Value = GenerateOperand(ACondition);
+		EOpcode Jump = ACondition->GetResultType()->IsFloat() ? OPCODE_FJNZ : OPCODE_JNZ;
+
+		Add(AJumpIfTrue ? Jump : InvertedJump[Jump], Value, 0, ALabel);
+	}
+
+	FirstFree = Top;
+}
+
+void CBytecodeGenerationVisitor::GenerateConditionValue(CExpression *ACondition)
+{
+	int FalseLabel = GenerateLabel();
+	int EndLabel = GenerateLabel();
+
+	GenerateCondition(ACondition, FalseLabel, false);
+
+	Add(OPCODE_LOADK, Target, 1);
+	Add(OPCODE_JMP, 0, 0, EndLabel);
+	AddLabel(FalseLabel);
+	Add(OPCODE_LOADK, Target, 0);
+	AddLabel(EndLabel);
+}
+
+/*
+ * The value of an expression statement is dropped. An assignment to a
+ * register variable is evaluated right into the variable.
+ */
+void CBytecodeGenerationVisitor::GenerateStatement(CStatement *AStmt)
+{
+	if (!AStmt) {
+		return;
+	}
+
+	CExpression *Expr = dynamic_cast<CExpression *>(AStmt);
+
+	if (!Expr) {
+		AStmt->Accept(*this);
+		return;
+	}
+
+	CExpression *LValue = NULL;
+	int Top = FirstFree;
+
+	if (CBinaryOp *BinaryOp = dynamic_cast<CBinaryOp *>(Expr)) {
+		if (TokenTraits::IsAssignment(BinaryOp->GetType())) {
+			LValue = BinaryOp->GetLeft();
+		}
+	} else if (CUnaryOp *UnaryOp = dynamic_cast<CUnaryOp *>(Expr)) {
+		if (UnaryOp->GetType() == TOKEN_TYPE_OPERATION_INCREMENT || UnaryOp->GetType() == TOKEN_TYPE_OPERATION_DECREMENT) {
+			LValue = UnaryOp->GetArgument();
+		}
+	}
+
+	int Register = -1;
+
+	if (CVariable *Var = dynamic_cast<CVariable *>(LValue)) {
+		map<CVariableSymbol *, int>::iterator it = VariableRegisters.find(Var->GetSymbol());
+
+		if (it != VariableRegisters.end()) {
+			Register = it->second;
+		}
+	}
+
+	GenerateValue(Expr, Register < 0 ? AllocateRegister() : Register);
+
+	FirstFree = Top;
+}
+
+CBytecodeGenerationVisitor::CAddress CBytecodeGenerationVisitor::SelectAddress(CExpression *AExpr)
+{
+	CAddress Address = {ADDRESS_POINTER, 0, 0, 0};
+
+	if (CVariable *Var = dynamic_cast<CVariable *>(AExpr)) {
+		CVariableSymbol *Symbol = Var->GetSymbol();
+
+		if (Symbol->GetGlobal()) {
+			Address.Type = ADDRESS_ABSOLUTE;
+			Address.Offset = Program.GetGlobalAddress(Symbol);
+		} else if (VariableRegisters.count(Symbol)) {
+			Address.Type = ADDRESS_VARIABLE;
+			Address.Base = VariableRegisters[Symbol];
+		} else {
+			if (!VariableOffsets.count(Symbol)) {
+				AllocateFrameVariable(Symbol);
+			}
+
+			Address.Type = ADDRESS_FRAME;
+			Address.Offset = VariableOffsets[Symbol];
+		}
+
+		return Address;
+	}
+
+	if (CStructAccess *Access = dynamic_cast<CStructAccess *>(AExpr)) {
+		return AddOffset(SelectAddress(Access->GetStruct()), Access->GetField()->GetSymbol()->GetOffset());
+	}
+
+	if (CIndirectAccess *Access = dynamic_cast<CIndirectAccess *>(AExpr)) {
+		Address.Base = GenerateOperand(Access->GetPointer());
+		Address.Offset = Access->GetField()->GetSymbol()->GetOffset();
+		return Address;
+	}
+
+	if (CArrayAccess *Access = dynamic_cast<CArrayAccess *>(AExpr)) {
+		return SelectElementAddress(*Access);
+	}
+
+	CUnaryOp *UnaryOp = dynamic_cast<CUnaryOp *>(AExpr);
+
+	if (UnaryOp && UnaryOp->GetType() == TOKEN_TYPE_OPERATION_ASTERISK) {
+		Address.Base = GenerateOperand(UnaryOp->GetArgument());
+		return Address;
+	}
+
+	throw logic_error("expression has no address");
+}
+
+/*
+ * Elements of 4 bytes are addressed by the index itself, others by the byte
+ * offset computed from it.
+ */
+CBytecodeGenerationVisitor::CAddress CBytecodeGenerationVisitor::SelectElementAddress(CArrayAccess &AExpr)
+{
+	CExpression *Base = AExpr.GetLeft();
+	CExpression *Index = AExpr.GetRight();
+
+	if (!Base->GetResultType()->IsPointer()) {
+		swap(Base, Index);
+	}
+
+	int Size = AExpr.GetElementSize();
+	bool Array = Base->GetResultType()->IsArray();
+	CAddress Address = {ADDRESS_POINTER, 0, 0, 0};
+
+	if (CIntegerConst *Const = dynamic_cast<CIntegerConst *>(Index)) {
+		if (Array) {
+			return AddOffset(SelectAddress(Base), Const->GetValue() * Size);
+		}
+
+		Address.Base = GenerateOperand(Base);
+		Address.Offset = Const->GetValue() * Size;
+		return Address;
+	}
+
+	if (Array) {
+		CAddress BaseAddress = SelectAddress(Base);
+
+		if (BaseAddress.Type == ADDRESS_POINTER && BaseAddress.Offset == 0) {
+			Address.Base = BaseAddress.Base;
+		} else {
+			Address.Base = AllocateRegister();
+			LoadAddress(BaseAddress, Address.Base);
+		}
+	} else {
+		Address.Base = GenerateOperand(Base, Index);
+	}
+
+	int IndexRegister = GenerateOperand(Index);
+
+	if (Size == 4) {
+		Address.Type = ADDRESS_INDEXED;
+		Address.Index = IndexRegister;
+		return Address;
+	}
+
+	int Element = AllocateRegister();
+
+	if (Size == 1) {
+		Add(OPCODE_ADD, Element, Address.Base, IndexRegister);
+	} else {
+		Add(OPCODE_MULK, Element, IndexRegister, Size);
+		Add(OPCODE_ADD, Element, Address.Base, Element);
+	}
+
+	Address.Base = Element;
+	return Address;
+}
+
+CBytecodeGenerationVisitor::CAddress CBytecodeGenerationVisitor::AddOffset(CAddress AAddress, int AOffset)
+{
+	if (AOffset == 0) {
+		return AAddress;
+	}
+
+	if (AAddress.Type == ADDRESS_VARIABLE) {
+		throw logic_error("register variable has no address");
+	}
+
+	if (AAddress.Type == ADDRESS_INDEXED) {
+		int Register = AllocateRegister();
+		LoadAddress(AAddress, Register);
+
+		AAddress.Type = ADDRESS_POINTER;
+		AAddress.Base = Register;
+	}
+
+	AAddress.Offset += AOffset;
+	return AAddress;
+}
+
+/*
+ * Copies the register variables an address is computed from, so that the
+ * address doesn't change when code evaluated before its use assigns them.
+ */
+void CBytecodeGenerationVisitor::PinAddress(CAddress &AAddress)
+{
+	if (AAddress.Type != ADDRESS_POINTER && AAddress.Type != ADDRESS_INDEXED) {
+		return;
+	}
+
+	if (AAddress.Base < VariablesCount) {
+		int Register = AllocateRegister();
+		Add(OPCODE_MOVE, Register, AAddress.Base);
+		AAddress.Base = Register;
+	}
+
+	if (AAddress.Type == ADDRESS_INDEXED && AAddress.Index < VariablesCount) {
+		int Register = AllocateRegister();
+		Add(OPCODE_MOVE, Register, AAddress.Index);
+		AAddress.Index = Register;
+	}
+}
+
+void CBytecodeGenerationVisitor::Load(const CAddress &AAddress, int ARegister)
+{
+	switch (AAddress.Type) {
+	case ADDRESS_VARIABLE:
+		Add(OPCODE_MOVE, ARegister, AAddress.Base);
+		break;
+	case ADDRESS_FRAME:
+		Add(OPCODE_LOADF, ARegister, AAddress.Offset);
+		break;
+	case ADDRESS_ABSOLUTE:
+		Add(OPCODE_LOADA, ARegister, AAddress.Offset);
+		break;
+	case ADDRESS_POINTER:
+		Add(OPCODE_LOAD, ARegister, AAddress.Base, AAddress.Offset);
+		break;
+	case ADDRESS_INDEXED:
+		Add(OPCODE_LOADX, ARegister, AAddress.Base, AAddress.Index);
+		break;
+	}
+}
+
+void CBytecodeGenerationVisitor::Store(const CAddress &AAddress, int ARegister)
+{
+	switch (AAddress.Type) {
+	case ADDRESS_VARIABLE:
+		Add(OPCODE_MOVE, AAddress.Base, ARegister);
+		break;
+	case ADDRESS_FRAME:
+		Add(OPCODE_STOREF, ARegister, AAddress.Offset);
+		break;
+	case ADDRESS_ABSOLUTE:
+		Add(OPCODE_STOREA, ARegister, AAddress.Offset);
+		break;
+	case ADDRESS_POINTER:
+		Add(OPCODE_STORE, ARegister, AAddress.Base, AAddress.Offset);
+		break;
+	case ADDRESS_INDEXED:
+		Add(OPCODE_STOREX, ARegister, AAddress.Base, AAddress.Index);
+		break;
+	}
+}
+
+void CBytecodeGenerationVisitor::LoadAddress(const CAddress &AAddress, int ARegister)
+{
+	switch (AAddress.Type) {
+	case ADDRESS_VARIABLE:
+		throw logic_error("register variable has no address");
+	case ADDRESS_FRAME:
+		Add(OPCODE_ADDRF, ARegister, AAddress.Offset);
+		break;
+	case ADDRESS_ABSOLUTE:
+		Add(OPCODE_LOADK, ARegister, AAddress.Offset);
+		break;
+	case ADDRESS_POINTER:
+		if (AAddress.Offset) {
+			Add(OPCODE_ADDK, ARegister, AAddress.Base, AAddress.Offset);
+		} else {
+			Add(OPCODE_MOVE, ARegister, AAddress.Base);
+		}
+		break;
+	case ADDRESS_INDEXED:
+		int Offset = AllocateRegister();
+		Add(OPCODE_MULK, Offset, AAddress.Index, 4);
+		Add(OPCODE_ADD, ARegister, AAddress.Base, Offset);
+		break;
+	}
+}
+
+/*
+ * An array operand stands for the address of its first element.
+ */
+void CBytecodeGenerationVisitor::LoadValue(const CAddress &AAddress, CTypeSymbol *AType, int ARegister)
+{
+	if (AType->IsArray()) {
+		LoadAddress(AAddress, ARegister);
+	} else {
+		Load(AAddress, ARegister);
+	}
+}
+
+void CBytecodeGenerationVisitor::GenerateArithmetic(ETokenType AOp, bool AFloat, int AResult, int ALeft, int ARight)
+{
+	map<ETokenType, EOpcode> &Ops = AFloat ? FloatOperationOp : IntOperationOp;
+	map<ETokenType, EOpcode>::iterator it = Ops.find(AOp);
+
+	if (it == Ops.end()) {
+		throw logic_error("operation has no bytecode");
+	}
+
+	Add(it->second, AResult, ALeft, ARight);
+}
+
+bool CBytecodeGenerationVisitor::NeedsConversion(CTypeSymbol *LHS, CTypeSymbol *RHS) const
+{
+	return (LHS->IsInt() && RHS->IsFloat()) || (LHS->IsFloat() && RHS->IsInt());
+}
+
+void CBytecodeGenerationVisitor::PerformConversion(CTypeSymbol *LHS, CTypeSymbol *RHS, int ARegister)
+{
+	if (LHS->IsInt() && RHS->IsFloat()) {
+		Add(OPCODE_FTOI, ARegister, ARegister);
+	} else if (LHS->IsFloat() && RHS->IsInt()) {
+		Add(OPCODE_ITOF, ARegister, ARegister);
+	}
+}
+
+/******************************************************************************
+ * CVirtualMachine
+ ******************************************************************************/
+
+CVirtualMachine::CVirtualMachine(CParser &AParser, const CCompilerParameters &AParameters) : Parser(AParser), Parameters(AParameters), Stream(NULL)
+{
+}
+
+/*
+ * Returns the value main returns, which becomes the exit code.
+ */
+int CVirtualMachine::Run(ostream &AStream)
+{
+	CGlobalSymbolTable *SymTable = Parser.ParseTranslationUnit();
+
+	unsigned int Main;
+
+	{
+		CTimePhase Phase("bytecode generation");
+
+		for (CGlobalSymbolTable::VariablesIterator it = SymTable->VariablesBegin(); it != SymTable->VariablesEnd(); ++it) {
+			Program.AddGlobalVariable(it->second);
+		}
+
+		for (CGlobalSymbolTable::FunctionsIterator it = SymTable->FunctionsBegin(); it != SymTable->FunctionsEnd(); ++it) {
+			if (it->second->GetBody()) {
+				Program.AddFunction(it->second);
+			}
+		}
+
+		CFunctionSymbol *MainSym = SymTable->GetFunction("main");
+
+		if (!MainSym || !Program.GetFunctionIndex(MainSym, Main)) {
+			throw CFatalException(EXIT_CODE_NOT_IMPLEMENTED, "program has no main function to run");
+		}
+
+		CBytecodeGenerationVisitor Generator(Program);
+
+		for (CGlobalSymbolTable::FunctionsIterator it = SymTable->FunctionsBegin(); it != SymTable->FunctionsEnd(); ++it) {
+			if (it->second->GetBody()) {
+				Generator.Generate(it->second);
+			}
+		}
+	}
+
+	const string &Data = Program.GetData();
+
+	StackBase = (Data.size() + 15) & ~15;
+
+	Memory.assign(StackBase + InitialStackSize, '\0');
+	copy(Data.begin(), Data.end(), Memory.begin());
+
+	Registers.resize(InitialRegistersSize);
+
+	Stream = &AStream;
+
+	int Result;
+
+	{
+		CTimePhase Phase("execution");
+		Result = Execute(Main);
+		Flush();
+	}
+
+	return Result;
+}
+
+#ifdef __GNUC__
+#define VM_CASE(AOp) Handler_##AOp:
+#define VM_NEXT() I = Ip++; goto *Handlers[I->Op]
+#else
+#define VM_CASE(AOp) case AOp:
+#define VM_NEXT() goto Dispatch
+#endif
+
+#define VM_CHECK(AAddress) if ((AAddress) - CBytecodeProgram::GuardSize > Limit) RuntimeError("invalid memory access at address " + ToString(AAddress))
+#define VM_MEMORY(AAddress) (*((CValue *) (M + (AAddress))))
+
+/*
+ * Interprets the program starting from a function. With GCC every handler
+ * jumps to the next one through a table of label addresses, otherwise the
+ * handlers are the cases of a switch in a loop.
+ */
+int CVirtualMachine::Execute(unsigned int AMain)
+{
+#ifdef __GNUC__
+	static const void *Handlers[OPCODES_COUNT] = {
+		&&Handler_OPCODE_MOVE, &&Handler_OPCODE_LOADK, &&Handler_OPCODE_ADD, &&Handler_OPCODE_ADDK,
+		&&Handler_OPCODE_SUB, &&Handler_OPCODE_MUL, &&Handler_OPCODE_MULK, &&Handler_OPCODE_DIV,
+		&&Handler_OPCODE_MOD, &&Handler_OPCODE_AND, &&Handler_OPCODE_OR, &&Handler_OPCODE_XOR,
+		&&Handler_OPCODE_SHL, &&Handler_OPCODE_SHR, &&Handler_OPCODE_NEG, &&Handler_OPCODE_NOT,
+		&&Handler_OPCODE_FADD, &&Handler_OPCODE_FSUB, &&Handler_OPCODE_FMUL, &&Handler_OPCODE_FDIV,
+		&&Handler_OPCODE_FNEG, &&Handler_OPCODE_ITOF, &&Handler_OPCODE_FTOI, &&Handler_OPCODE_LOAD,
+		&&Handler_OPCODE_STORE, &&Handler_OPCODE_LOADX, &&Handler_OPCODE_STOREX, &&Handler_OPCODE_LOADF,
+		&&Handler_OPCODE_STOREF, &&Handler_OPCODE_LOADA, &&Handler_OPCODE_STOREA, &&Handler_OPCODE_ADDRF,
+		&&Handler_OPCODE_JMP, &&Handler_OPCODE_JZ, &&Handler_OPCODE_JNZ, &&Handler_OPCODE_FJZ,
+		&&Handler_OPCODE_FJNZ, &&Handler_OPCODE_JEQ, &&Handler_OPCODE_JNE, &&Handler_OPCODE_JLT,
+		&&Handler_OPCODE_JGT, &&Handler_OPCODE_JLE, &&Handler_OPCODE_JGE, &&Handler_OPCODE_JB,
+		&&Handler_OPCODE_JA, &&Handler_OPCODE_JBE, &&Handler_OPCODE_JAE, &&Handler_OPCODE_FJEQ,
+		&&Handler_OPCODE_FJNE, &&Handler_OPCODE_FJLT, &&Handler_OPCODE_FJGT, &&Handler_OPCODE_FJLE,
+		&&Handler_OPCODE_FJGE, &&Handler_OPCODE_JEQK, &&Handler_OPCODE_JNEK, &&Handler_OPCODE_JLTK,
+		&&Handler_OPCODE_JGTK, &&Handler_OPCODE_JLEK, &&Handler_OPCODE_JGEK, &&Handler_OPCODE_CALL,
+		&&Handler_OPCODE_NATIVE, &&Handler_OPCODE_RET, &&Handler_OPCODE_RETV,
+	};
+#endif
+
+	vector<CCallFrame> Calls;
+
+	char *M = &Memory[0];
+	unsigned int MemorySize = Memory.size();
+	unsigned int Limit = MemorySize - CBytecodeProgram::GuardSize - sizeof(CValue);
+
+	const CBytecodeFunction &MainFunction = Program.GetFunction(AMain);
+	unsigned int Frame = StackBase;
+	unsigned int StackTop = Frame + MainFunction.FrameSize;
+
+	if (MainFunction.RegistersCount > Registers.size() || StackTop > MemorySize) {
+		Grow(MainFunction.RegistersCount, StackTop);
+
+		M = &Memory[0];
+		MemorySize = Memory.size();
+		Limit = MemorySize - CBytecodeProgram::GuardSize - sizeof(CValue);
+	}
+
+	CValue *R = &Registers[0];
+	CValue *RegistersEnd = R + Registers.size();
+
+	const CInstruction *Ip = &MainFunction.Code[0];
+	const CInstruction *I;
+
+#ifdef __GNUC__
+	VM_NEXT();
+#else
+Dispatch:
+	I = Ip++;
+	switch (I->Op) {
+#endif
+
+	VM_CASE(OPCODE_MOVE)
+		R[I->A] = R[I->B];
+		VM_NEXT();
+	VM_CASE(OPCODE_LOADK)
+		R[I->A].Int = I->B;
+		VM_NEXT();
+	VM_CASE(OPCODE_ADD)
+		R[I->A].Unsigned = R[I->B].Unsigned + R[I->C].Unsigned;
+		VM_NEXT();
+	VM_CASE(OPCODE_ADDK)
+		R[I->A].Unsigned = R[I->B].Unsigned + (unsigned int) I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_SUB)
+		R[I->A].Unsigned = R[I->B].Unsigned - R[I->C].Unsigned;
+		VM_NEXT();
+	VM_CASE(OPCODE_MUL)
+		R[I->A].Unsigned = R[I->B].Unsigned * R[I->C].Unsigned;
+		VM_NEXT();
+	VM_CASE(OPCODE_MULK)
+		R[I->A].Unsigned = R[I->B].Unsigned * (unsigned int) I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_DIV)
+		if (R[I->C].Int == 0) {
+			RuntimeError("division by zero");
+		} else if (R[I->C].Int == -1 && R[I->B].Int == INT_MIN) {
+			RuntimeError("integer division overflow");
+		}
+		R[I->A].Int = R[I->B].Int / R[I->C].Int;
+		VM_NEXT();
+	VM_CASE(OPCODE_MOD)
+		if (R[I->C].Int == 0) {
+			RuntimeError("division by zero");
+		} else if (R[I->C].Int == -1 && R[I->B].Int == INT_MIN) {
+			RuntimeError("integer division overflow");
+		}
+		R[I->A].Int = R[I->B].Int % R[I->C].Int;
+		VM_NEXT();
+	VM_CASE(OPCODE_AND)
+		R[I->A].Unsigned = R[I->B].Unsigned & R[I->C].Unsigned;
+		VM_NEXT();
+	VM_CASE(OPCODE_OR)
+		R[I->A].Unsigned = R[I->B].Unsigned | R[I->C].Unsigned;
+		VM_NEXT();
+	VM_CASE(OPCODE_XOR)
+		R[I->A].Unsigned = R[I->B].Unsigned ^ R[I->C].Unsigned;
+		VM_NEXT();
+	VM_CASE(OPCODE_SHL)
+		R[I->A].Unsigned = R[I->B].Unsigned << (R[I->C].Unsigned & 31);
+		VM_NEXT();
+	VM_CASE(OPCODE_SHR)
+		R[I->A].Int = R[I->B].Int >> (R[I->C].Unsigned & 31);
+		VM_NEXT();
+	VM_CASE(OPCODE_NEG)
+		R[I->A].Unsigned = 0U - R[I->B].Unsigned;
+		VM_NEXT();
+	VM_CASE(OPCODE_NOT)
+		R[I->A].Unsigned = ~R[I->B].Unsigned;
+		VM_NEXT();
+	VM_CASE(OPCODE_FADD)
+		R[I->A].Float = R[I->B].Float + R[I->C].Float;
+		VM_NEXT();
+	VM_CASE(OPCODE_FSUB)
+		R[I->A].Float = R[I->B].Float - R[I->C].Float;
+		VM_NEXT();
+	VM_CASE(OPCODE_FMUL)
+		R[I->A].Float = R[I->B].Float * R[I->C].Float;
+		VM_NEXT();
+	VM_CASE(OPCODE_FDIV)
+		R[I->A].Float = R[I->B].Float / R[I->C].Float;
+		VM_NEXT();
+	VM_CASE(OPCODE_FNEG)
+		R[I->A].Float = -R[I->B].Float;
+		VM_NEXT();
+	VM_CASE(OPCODE_ITOF)
+		R[I->A].Float = (float) R[I->B].Int;
+		VM_NEXT();
+	VM_CASE(OPCODE_FTOI)
+		// values out of range give the integer indefinite, as fisttp does
+		if (R[I->B].Float > -2147483904.0f && R[I->B].Float < 2147483648.0f) {
+			R[I->A].Int = (int) R[I->B].Float;
+		} else {
+			R[I->A].Int = INT_MIN;
+		}
+		VM_NEXT();
+	VM_CASE(OPCODE_LOAD) {
+		unsigned int Address = R[I->B].Unsigned + (unsigned int) I->C;
+		VM_CHECK(Address);
+		R[I->A] = VM_MEMORY(Address);
+		VM_NEXT();
+	}
+	VM_CASE(OPCODE_STORE) {
+		unsigned int Address = R[I->B].Unsigned + (unsigned int) I->C;
+		VM_CHECK(Address);
+		VM_MEMORY(Address) = R[I->A];
+		VM_NEXT();
+	}
+	VM_CASE(OPCODE_LOADX) {
+		unsigned int Address = R[I->B].Unsigned + 4 * R[I->C].Unsigned;
+		VM_CHECK(Address);
+		R[I->A] = VM_MEMORY(Address);
+		VM_NEXT();
+	}
+	VM_CASE(OPCODE_STOREX) {
+		unsigned int Address = R[I->B].Unsigned + 4 * R[I->C].Unsigned;
+		VM_CHECK(Address);
+		VM_MEMORY(Address) = R[I->A];
+		VM_NEXT();
+	}
+	VM_CASE(OPCODE_LOADF)
+		R[I->A] = VM_MEMORY(Frame + I->B);
+		VM_NEXT();
+	VM_CASE(OPCODE_STOREF)
+		VM_MEMORY(Frame + I->B) = R[I->A];
+		VM_NEXT();
+	VM_CASE(OPCODE_LOADA)
+		R[I->A] = VM_MEMORY(I->B);
+		VM_NEXT();
+	VM_CASE(OPCODE_STOREA)
+		VM_MEMORY(I->B) = R[I->A];
+		VM_NEXT();
+	VM_CASE(OPCODE_ADDRF)
+		R[I->A].Unsigned = Frame + I->B;
+		VM_NEXT();
+	VM_CASE(OPCODE_JMP)
+		Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JZ)
+		if (R[I->A].Int == 0) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JNZ)
+		if (R[I->A].Int != 0) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_FJZ)
+		if (R[I->A].Float == 0.0f) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_FJNZ)
+		if (R[I->A].Float != 0.0f) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JEQ)
+		if (R[I->A].Int == R[I->B].Int) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JNE)
+		if (R[I->A].Int != R[I->B].Int) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JLT)
+		if (R[I->A].Int < R[I->B].Int) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JGT)
+		if (R[I->A].Int > R[I->B].Int) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JLE)
+		if (R[I->A].Int <= R[I->B].Int) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JGE)
+		if (R[I->A].Int >= R[I->B].Int) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JB)
+		if (R[I->A].Unsigned < R[I->B].Unsigned) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JA)
+		if (R[I->A].Unsigned > R[I->B].Unsigned) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JBE)
+		if (R[I->A].Unsigned <= R[I->B].Unsigned) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JAE)
+		if (R[I->A].Unsigned >= R[I->B].Unsigned) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_FJEQ)
+		if (R[I->A].Float == R[I->B].Float) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_FJNE)
+		if (R[I->A].Float != R[I->B].Float) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_FJLT)
+		if (R[I->A].Float < R[I->B].Float) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_FJGT)
+		if (R[I->A].Float > R[I->B].Float) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_FJLE)
+		if (R[I->A].Float <= R[I->B].Float) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_FJGE)
+		if (R[I->A].Float >= R[I->B].Float) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JEQK)
+		if (R[I->A].Int == I->B) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JNEK)
+		if (R[I->A].Int != I->B) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JLTK)
+		if (R[I->A].Int < I->B) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JGTK)
+		if (R[I->A].Int > I->B) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JLEK)
+		if (R[I->A].Int <= I->B) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_JGEK)
+		if (R[I->A].Int >= I->B) Ip += I->C;
+		VM_NEXT();
+	VM_CASE(OPCODE_CALL) {
+		const CBytecodeFunction &Callee = Program.GetFunction(I->B);
+		CCallFrame Call = {Ip, (unsigned int) (R - &Registers[0]), Frame};
+		Calls.push_back(Call);
+
+		R += I->A;
+		Frame = StackTop;
+		StackTop += Callee.FrameSize;
+
+		if (R + Callee.RegistersCount > RegistersEnd || StackTop > MemorySize) {
+			unsigned int Base = R - &Registers[0];
+			Grow(Base + Callee.RegistersCount, StackTop);
+
+			M = &Memory[0];
+			MemorySize = Memory.size();
+			Limit = MemorySize - CBytecodeProgram::GuardSize - sizeof(CValue);
+
+			R = &Registers[0] + Base;
+			RegistersEnd = &Registers[0] + Registers.size();
+		}
+
+		Ip = &Callee.Code[0];
+		VM_NEXT();
+	}
+	VM_CASE(OPCODE_NATIVE)
+		CallNative((ENativeHook) I->B, R + I->A);
+		VM_NEXT();
+	VM_CASE(OPCODE_RET)
+		R[0] = R[I->A];
+
+		if (Calls.empty()) {
+			return R[0].Int;
+		}
+
+		StackTop = Frame;
+		Ip = Calls.back().Return;
+		R = &Registers[0] + Calls.back().Registers;
+		Frame = Calls.back().Frame;
+		Calls.pop_back();
+		VM_NEXT();
+	VM_CASE(OPCODE_RETV)
+		R[0].Int = 0;
+
+		if (Calls.empty()) {
+			return 0;
+		}
+
+		StackTop = Frame;
+		Ip = Calls.back().Return;
+		R = &Registers[0] + Calls.back().Registers;
+		Frame = Calls.back().Frame;
+		Calls.pop_back();
+		VM_NEXT();
+
+#ifndef __GNUC__
+	default:
+		break;
+	}
+#endif
+
+	throw logic_error("invalid bytecode operation");
+}
+
+#undef VM_CASE
+#undef VM_NEXT
+#undef VM_CHECK
+#undef VM_MEMORY
+
+/*
+ * The stack memory and the registers start small and are doubled as calls
+ * need more of them, up to StackSize and RegistersSize.
+ */
+void CVirtualMachine::Grow(unsigned int ARegistersSize, unsigned int AMemorySize)
+{
+	if (ARegistersSize > RegistersSize || AMemorySize > StackBase + StackSize) {
+		RuntimeError("stack overflow");
+	}
+
+	if (ARegistersSize > Registers.size()) {
+		Registers.resize(min(max(2 * (unsigned int) Registers.size(), ARegistersSize), (unsigned int) RegistersSize));
+	}
+
+	if (AMemorySize > Memory.size()) {
+		Memory.resize(min(max(2 * (unsigned int) Memory.size() - StackBase, AMemorySize), StackBase + StackSize), '\0');
+	}
+}
+
+/*
+ * The hooks print the way the builtins and printf of the C library do; only
+ * format strings without conversions are supported by printf.
+ */
+void CVirtualMachine::CallNative(ENativeHook AHook, CValue *AArguments)
+{
+	char Text[64];
+	int Length;
+
+	switch (AHook) {
+	case NATIVE_HOOK_PRINT_INT:
+		Length = snprintf(Text, sizeof(Text), "%d\n", AArguments[0].Int);
+		Write(Text, Length);
+		break;
+
+	case NATIVE_HOOK_PRINT_FLOAT:
+		Length = snprintf(Text, sizeof(Text), "%f\n", (double) AArguments[0].Float);
+
+		if (Length >= (int) sizeof(Text)) {
+			string Long(Length + 1, '\0');
+			snprintf(&Long[0], Long.size(), "%f\n", (double) AArguments[0].Float);
+			Write(Long.c_str(), Length);
+		} else {
+			Write(Text, Length);
+		}
+		break;
+
+	case NATIVE_HOOK_PRINTF: {
+		unsigned int Address = AArguments[0].Unsigned;
+		unsigned int Count = 0;
+
+		for (;; Address++) {
+			if (Address < CBytecodeProgram::GuardSize || Address >= Memory.size()) {
+				RuntimeError("invalid memory access at address " + ToString(Address));
+			}
+
+			char c = Memory[Address];
+
+			if (c == '\0') {
+				break;
+			}
+
+			if (c == '%') {
+				if (Address + 1 >= Memory.size() || Memory[Address + 1] != '%') {
+					RuntimeError("printf conversions are not supported");
+				}
+
+				Address++;
+			}
+
+			Write(&c, 1);
+			Count++;
+		}
+
+		AArguments[0].Unsigned = Count;
+		break;
+	}
+	}
+}
+
+void CVirtualMachine::Write(const char *AText, unsigned int ALength)
+{
+	Output.append(AText, ALength);
+
+	if (Output.size() >= 65536) {
+		Flush();
+	}
+}
+
+void CVirtualMachine::Flush()
+{
+	Stream->write(Output.data(), Output.size());
+	Output.clear();
+}
+
+void CVirtualMachine::RuntimeError(const string &AMessage)
+{
+	Flush();
+	throw CFatalException(EXIT_CODE_RUNTIME_ERROR, "runtime error: " + AMessage);
+}
@@ -0,0 +1,30 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$8, %esp
+	xor	%eax, %eax
+	mov	%eax, -8(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L1
+.L4:
+	mov	-4(%ebp), %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -8(%ebp)
+	mov	%ebx, %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+.L1:
+	mov	-4(%ebp), %eax
+	cmp	$10, %eax
+	jl	.L4
+	mov	-8(%ebp), %eax
+	add	$8, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
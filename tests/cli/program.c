@@ -0,0 +1,11 @@
+int main()
+{
+	int i, s;
+
+	s = 0;
+	for (i = 0; i < 10; i++) {
+		s = s + i;
+	}
+
+	return s;
+}
@@ -0,0 +1,77 @@
+int calls;
+
+int check(int x)
+{
+	calls++;
+	return x;
+}
+
+float checkf(float x)
+{
+	calls++;
+	return x;
+}
+
+int main()
+{
+	int a;
+	int i;
+	float f;
+
+	calls = 0;
+	__print_int(check(0) && check(1));
+	__print_int(calls);
+
+	calls = 0;
+	__print_int(check(1) || check(0));
+	__print_int(calls);
+
+	calls = 0;
+	__print_int(check(1) && check(0) || check(2));
+	__print_int(calls);
+
+	calls = 0;
+	__print_int(!(check(0) || check(0)) && check(3));
+	__print_int(calls);
+
+	calls = 0;
+	__print_int(checkf(0.0) && check(1));
+	__print_int(checkf(-1.5) || check(1));
+	__print_int(calls);
+
+	a = 0;
+	i = 0;
+	while (i < 10 && a != 7) {
+		a = a + 1;
+		i++;
+	}
+	__print_int(i);
+
+	f = 2.5;
+	if (f > 2.0 && !(f >= 3.0)) {
+		__print_int(1);
+	} else {
+		__print_int(0);
+	}
+
+	if (!f) {
+		__print_int(0);
+	} else if (f <= 2.5 || check(0)) {
+		__print_int(1);
+	}
+
+	i = 10;
+	do {
+		i--;
+	} while (i > 3 && !(i == 5));
+	__print_int(i);
+
+	for (i = 0; !(i >= 4 || i == -1); i++) {
+		__print_int(i < 2 ? i : -i);
+	}
+
+	__print_int(a > 5 ? check(10) : check(20));
+	__print_int(calls);
+
+	return calls;
+}
@@ -0,0 +1,61 @@
+struct point
+{
+	int x;
+	int y;
+};
+
+int weigh(int a, int b, int c)
+{
+	return a + b * 10 + c * 100;
+}
+
+float scale(float a, int b, float c)
+{
+	return a * b + c;
+}
+
+int fib(int n)
+{
+	if (n < 2) {
+		return n;
+	}
+	return fib(n - 1) + fib(n - 2);
+}
+
+int triple(int a)
+{
+	int t;
+	t = a * 2;
+	{
+		int u;
+		u = t + a;
+		return u;
+	}
+}
+
+int project(struct point *p, int k)
+{
+	return p->x * k + p->y;
+}
+
+int seven()
+{
+	return 7;
+}
+
+int main()
+{
+	struct point p;
+	p.x = 3;
+	p.y = 4;
+
+	__print_int(weigh(1, 2, 3));
+	__print_float(scale(1.5, 4, 0.25));
+	__print_int(fib(15));
+	__print_int(triple(5));
+	__print_int(project(&p, 5));
+	__print_int(weigh(fib(5), triple(1), weigh(1, 1, 1)));
+	__print_int(seven());
+
+	return weigh(1, 2, 0);
+}
@@ -0,0 +1,177 @@
+struct node { int value; struct node *next; };
+
+struct node nodes[10];
+
+struct pair { int tag; int items[4]; };
+
+int gcd(int a, int b)
+{
+	if (b == 0) {
+		return a;
+	}
+
+	return gcd(b, a % b);
+}
+
+int sum(int n, int acc)
+{
+	int t;
+
+	if (n == 0) {
+		return acc;
+	}
+
+	t = acc + n;
+
+	{
+		int u;
+		u = n - 1;
+		return sum(u, t);
+	}
+}
+
+int length(struct node *p, int n)
+{
+	if (!p) {
+		return n;
+	}
+
+	return length(p->next, n + 1);
+}
+
+float fsum(int n, float acc)
+{
+	if (n == 0) {
+		return acc;
+	}
+
+	return fsum(n - 1, acc + 0.5);
+}
+
+int is_even(int n);
+
+int is_odd(int n)
+{
+	if (n == 0) {
+		return 0;
+	}
+
+	return is_even(n - 1);
+}
+
+int is_even(int n)
+{
+	if (n == 0) {
+		return 1;
+	}
+
+	return is_odd(n - 1);
+}
+
+int five(int a, int b, int c, int d, int e)
+{
+	return a + b * 2 + c * 3 + d * 4 + e * 5;
+}
+
+int wide(int a)
+{
+	return five(a, a, a, a, a);
+}
+
+int deref(int *p, int n)
+{
+	int x;
+
+	x = *p + 1;
+
+	if (n == 0) {
+		return x;
+	}
+
+	return deref(&x, n - 1);
+}
+
+float tofloat(int n)
+{
+	return n;
+}
+
+int conv(int n)
+{
+	return tofloat(n);
+}
+
+int count(int n)
+{
+	int i;
+
+	if (n == 0) {
+		return 0;
+	}
+
+	for (i = 0; i < 3; i++) {
+		if (i == 1) {
+			return count(n - 1);
+		}
+	}
+
+	return -1;
+}
+
+int total(int *p, int n)
+{
+	int i, t;
+
+	t = 0;
+
+	{
+		int scratch[8];
+
+		for (i = 0; i < 8; i++) {
+			scratch[i] = -1;
+		}
+
+		for (i = 0; i < n; i++) {
+			t = t + p[i] + scratch[i] + 1;
+		}
+
+		return t;
+	}
+}
+
+int fields(int n)
+{
+	int i;
+
+	{
+		struct pair s;
+
+		for (i = 0; i < 4; i++) {
+			s.items[i] = n + i * 10;
+		}
+
+		return total(s.items, 4);
+	}
+}
+
+int main()
+{
+	int i;
+
+	for (i = 0; i < 9; i++) {
+		nodes[i].next = &nodes[i + 1];
+	}
+
+	__print_int(gcd(1071, 462));
+	__print_int(sum(100000, 0));
+	__print_int(length(&nodes[0], 0));
+	__print_float(fsum(1000, 0.0));
+	__print_int(is_even(100001));
+	__print_int(wide(1));
+	__print_int(deref(&i, 5));
+	__print_int(conv(7));
+	__print_int(count(100000));
+	__print_int(fields(4));
+
+	return gcd(12, 18);
+}
@@ -0,0 +1,136 @@
+int g;
+
+int find(int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		int sq;
+		sq = i * i;
+
+		if (sq > 50) {
+			int r;
+			r = i;
+			return r;
+		}
+	}
+
+	return -1;
+}
+
+int skip(int n)
+{
+	int i;
+	int s = 0;
+
+	for (i = 0; i < n; i++) {
+		int t;
+		t = i % 3;
+
+		if (t == 0) {
+			continue;
+		}
+
+		s = s + t;
+	}
+
+	return s;
+}
+
+int search(int n)
+{
+	int i;
+	int j;
+
+	for (i = 0; i < n; i++) {
+		int a;
+		a = i * 10;
+
+		for (j = 0; j < n; j++) {
+			int b;
+			b = a + j;
+
+			if (b == 57) {
+				goto found;
+			}
+		}
+	}
+
+	i = 0;
+	j = -1;
+
+found:
+	return i * 100 + j;
+}
+
+int choose(int x)
+{
+	int r = 0;
+
+	switch (x) {
+	case 1:
+		r = 10;
+		break;
+	case 2:
+		{
+			int k;
+			k = x * 7;
+			r = k;
+			break;
+		}
+	default:
+		r = -1;
+	}
+
+	return r;
+}
+
+int pick(int x, int y)
+{
+	int z;
+	z = x > y ? x - y : (y > 100 ? y : x + y);
+	return z * 2;
+}
+
+int main()
+{
+	int i;
+	int total = 0;
+
+	for (i = 0; i < 1000000; i++) {
+		int w;
+		w = i & 7;
+
+		if (w != 3) {
+			continue;
+		}
+
+		total++;
+
+		while (1) {
+			int v;
+			v = w;
+			if (v == 3) {
+				break;
+			}
+		}
+	}
+
+	if (total > 0)
+		g = total;
+	else
+		g = 1;
+
+	__print_int(g);
+	__print_int(find(100));
+	__print_int(skip(10));
+	__print_int(search(10));
+	__print_int(choose(1));
+	__print_int(choose(2));
+	__print_int(choose(5));
+	__print_int(pick(5, 3));
+	__print_int(pick(1, 300));
+	__print_int(pick(1, 3));
+
+	return 0;
+}
@@ -0,0 +1,62 @@
+int classify(int x)
+{
+	switch (x % 3) {
+		int a;
+		int b;
+	case 0:
+		a = x * 2;
+		b = a + 1;
+		return a + b;
+	case 1:
+		a = x;
+		b = classify(x + 2);
+		return a * 1000 + b;
+	default:
+		return -x;
+	}
+}
+
+int overlay(int n)
+{
+	int s = 0;
+	int i;
+
+	for (i = 0; i < n; i++) {
+		if (i % 2) {
+			int a[4];
+			int j;
+
+			for (j = 0; j < 4; j++) {
+				a[j] = i + j;
+			}
+
+			s = s + a[0] + a[3];
+		} else {
+			int b;
+			float f;
+
+			b = i * 3;
+			f = b;
+			s = s + f;
+		}
+	}
+
+	{
+		int c;
+		c = s / 2;
+		s = s + c;
+	}
+
+	return s;
+}
+
+int main()
+{
+	__print_int(classify(3));
+	__print_int(classify(4));
+	__print_int(classify(5));
+	__print_int(overlay(10));
+	__print_int(overlay(1));
+
+	return 0;
+}
@@ -0,0 +1,88 @@
+struct point {
+	int x;
+	int y;
+	float w;
+};
+
+struct point points[8];
+int grid[4][5];
+struct pair {
+	int a;
+	int b;
+} pairs[16];
+
+struct shape {
+	int id;
+	struct point corners[4];
+};
+
+int sum_corners(struct shape *s)
+{
+	int i;
+	int r = 0;
+
+	for (i = 0; i < 4; i++) {
+		r = r + s->corners[i].x * 10 + s->corners[i].y;
+	}
+
+	return r + s->corners[3].x;
+}
+
+int main()
+{
+	int i;
+	int j;
+	int local[6];
+	struct shape sh;
+	struct point *p;
+	int *q;
+
+	for (i = 0; i < 8; i++) {
+		points[i].x = i;
+		points[i].y = i * i;
+		points[i].w = i / 2.0;
+	}
+
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 5; j++) {
+			grid[i][j] = i * 10 + j;
+		}
+	}
+
+	for (i = 0; i < 16; i++) {
+		pairs[i].a = i * 3;
+		pairs[i].b = pairs[i].a + 1;
+	}
+
+	for (i = 0; i < 6; i++) {
+		local[i] = 100 - i;
+	}
+
+	for (i = 0; i < 4; i++) {
+		sh.corners[i].x = i + 1;
+		sh.corners[i].y = 2 * i;
+	}
+
+	p = points;
+	q = local;
+
+	__print_int(points[5].y);
+	__print_float(points[3].w);
+	__print_int(points[2].x + points[7].y);
+	__print_int(grid[3][4]);
+	__print_int(grid[2][1]);
+	__print_int(pairs[15].a + pairs[i - 2].b);
+	__print_int(local[5] + local[0]);
+	__print_int(2[local]);
+	__print_int(p[6].y);
+	__print_int((&points[1])->x + (&p[4])->y);
+	__print_int(q[i - 1]);
+	__print_int(sum_corners(&sh));
+
+	i = 3;
+	j = 2;
+	grid[i][j] = grid[i - 1][j + 1] + grid[1][2];
+	__print_int(grid[3][2]);
+
+	return 0;
+}
@@ -0,0 +1,325 @@
+int divisors[28];
+int factors[22];
+int errors;
+int checksum;
+void check(int x)
+{
+	int k;
+	k = 0;
+	if (x / 1 != x / divisors[k] || x % 1 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 1 + x % 1;
+	k++;
+	if (x != -2147483647 - 1) {
+		if (x / -1 != x / divisors[k] || x % -1 != x % divisors[k]) {
+			errors++;
+		}
+		checksum = checksum + x / -1 + x % -1;
+	}
+	k++;
+	if (x / 2 != x / divisors[k] || x % 2 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 2 + x % 2;
+	k++;
+	if (x / -2 != x / divisors[k] || x % -2 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / -2 + x % -2;
+	k++;
+	if (x / 3 != x / divisors[k] || x % 3 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 3 + x % 3;
+	k++;
+	if (x / -3 != x / divisors[k] || x % -3 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / -3 + x % -3;
+	k++;
+	if (x / 4 != x / divisors[k] || x % 4 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 4 + x % 4;
+	k++;
+	if (x / 5 != x / divisors[k] || x % 5 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 5 + x % 5;
+	k++;
+	if (x / 6 != x / divisors[k] || x % 6 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 6 + x % 6;
+	k++;
+	if (x / 7 != x / divisors[k] || x % 7 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 7 + x % 7;
+	k++;
+	if (x / -7 != x / divisors[k] || x % -7 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / -7 + x % -7;
+	k++;
+	if (x / 8 != x / divisors[k] || x % 8 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 8 + x % 8;
+	k++;
+	if (x / 10 != x / divisors[k] || x % 10 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 10 + x % 10;
+	k++;
+	if (x / 12 != x / divisors[k] || x % 12 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 12 + x % 12;
+	k++;
+	if (x / 16 != x / divisors[k] || x % 16 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 16 + x % 16;
+	k++;
+	if (x / -16 != x / divisors[k] || x % -16 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / -16 + x % -16;
+	k++;
+	if (x / 25 != x / divisors[k] || x % 25 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 25 + x % 25;
+	k++;
+	if (x / 100 != x / divisors[k] || x % 100 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 100 + x % 100;
+	k++;
+	if (x / 125 != x / divisors[k] || x % 125 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 125 + x % 125;
+	k++;
+	if (x / 641 != x / divisors[k] || x % 641 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 641 + x % 641;
+	k++;
+	if (x / 1000 != x / divisors[k] || x % 1000 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 1000 + x % 1000;
+	k++;
+	if (x / 1024 != x / divisors[k] || x % 1024 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 1024 + x % 1024;
+	k++;
+	if (x / 65536 != x / divisors[k] || x % 65536 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 65536 + x % 65536;
+	k++;
+	if (x / 7777 != x / divisors[k] || x % 7777 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 7777 + x % 7777;
+	k++;
+	if (x / 1000000007 != x / divisors[k] || x % 1000000007 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 1000000007 + x % 1000000007;
+	k++;
+	if (x / 2147483647 != x / divisors[k] || x % 2147483647 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 2147483647 + x % 2147483647;
+	k++;
+	if (x / -2147483647 != x / divisors[k] || x % -2147483647 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / -2147483647 + x % -2147483647;
+	k++;
+	if (x / 1073741824 != x / divisors[k] || x % 1073741824 != x % divisors[k]) {
+		errors++;
+	}
+	checksum = checksum + x / 1073741824 + x % 1073741824;
+	k++;
+	k = 0;
+	if (x * 0 != x * factors[k] || 0 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 1 != x * factors[k] || 1 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * -1 != x * factors[k] || -1 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 2 != x * factors[k] || 2 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 3 != x * factors[k] || 3 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 5 != x * factors[k] || 5 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 9 != x * factors[k] || 9 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 10 != x * factors[k] || 10 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 15 != x * factors[k] || 15 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 17 != x * factors[k] || 17 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 24 != x * factors[k] || 24 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 31 != x * factors[k] || 31 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 33 != x * factors[k] || 33 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 40 != x * factors[k] || 40 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * -5 != x * factors[k] || -5 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * -12 != x * factors[k] || -12 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 63 != x * factors[k] || 63 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 65 != x * factors[k] || 65 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 72 != x * factors[k] || 72 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 1000 != x * factors[k] || 1000 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 65535 != x * factors[k] || 65535 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+	if (x * 2147483647 != x * factors[k] || 2147483647 * x != x * factors[k]) {
+		errors++;
+	}
+	k++;
+}
+
+int main()
+{
+	int i;
+	int x;
+
+	divisors[0] = 1;
+	divisors[1] = -1;
+	divisors[2] = 2;
+	divisors[3] = -2;
+	divisors[4] = 3;
+	divisors[5] = -3;
+	divisors[6] = 4;
+	divisors[7] = 5;
+	divisors[8] = 6;
+	divisors[9] = 7;
+	divisors[10] = -7;
+	divisors[11] = 8;
+	divisors[12] = 10;
+	divisors[13] = 12;
+	divisors[14] = 16;
+	divisors[15] = -16;
+	divisors[16] = 25;
+	divisors[17] = 100;
+	divisors[18] = 125;
+	divisors[19] = 641;
+	divisors[20] = 1000;
+	divisors[21] = 1024;
+	divisors[22] = 65536;
+	divisors[23] = 7777;
+	divisors[24] = 1000000007;
+	divisors[25] = 2147483647;
+	divisors[26] = -2147483647;
+	divisors[27] = 1073741824;
+	factors[0] = 0;
+	factors[1] = 1;
+	factors[2] = -1;
+	factors[3] = 2;
+	factors[4] = 3;
+	factors[5] = 5;
+	factors[6] = 9;
+	factors[7] = 10;
+	factors[8] = 15;
+	factors[9] = 17;
+	factors[10] = 24;
+	factors[11] = 31;
+	factors[12] = 33;
+	factors[13] = 40;
+	factors[14] = -5;
+	factors[15] = -12;
+	factors[16] = 63;
+	factors[17] = 65;
+	factors[18] = 72;
+	factors[19] = 1000;
+	factors[20] = 65535;
+	factors[21] = 2147483647;
+
+	for (i = -70000; i <= 70000; i++) {
+		check(i);
+	}
+
+	x = 1;
+	for (i = 0; i < 100000; i++) {
+		x = x * 1103515245 + 12345;
+		check(x);
+	}
+
+	check(2147483647);
+	check(2147483646);
+	check(-2147483647);
+	check(-2147483647 - 1);
+	check(1073741824);
+	check(-1073741824);
+
+	x = 100;
+	x *= 7;
+	x /= -3;
+	x %= 16;
+
+	__print_int(errors);
+	__print_int(checksum);
+	__print_int(x);
+
+	return 0;
+}
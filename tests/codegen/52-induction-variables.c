@@ -0,0 +1,185 @@
+struct point {
+	int x;
+	int y;
+};
+
+struct table {
+	int n;
+	int v[12];
+};
+
+int a[20];
+struct point pts[10];
+int m[5][6];
+struct table t;
+
+int sum(int *p, int n)
+{
+	int i, s;
+
+	s = 0;
+	for (i = 0; i < n; i++) {
+		s = s + p[i];
+	}
+
+	return s;
+}
+
+int reversed(int *p, int n)
+{
+	int s;
+
+	s = 0;
+	for (n = n - 1; n >= 0; n--) {
+		s = s * 3 + p[n];
+	}
+
+	return s;
+}
+
+int blocks(int n)
+{
+	int b[16];
+	int i, s;
+
+	i = 0;
+	while (i < 16) {
+		int x;
+		int y;
+
+		x = i * i;
+		y = x - n;
+		b[i] = y;
+		i++;
+		switch (i % 3) {
+		case 0:
+			{
+				int z;
+				z = b[i - 1] * 2;
+				b[i - 1] = z;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	s = 0;
+	for (i = 0; i < 16; i++) {
+		int w[2];
+		w[0] = b[i];
+		w[1] = i;
+		s = s * 5 + w[0] - w[1];
+	}
+
+	return s;
+}
+
+int skipped(int n)
+{
+	int i, s;
+
+	s = 0;
+	for (i = 0; i < n; i++) {
+		if (a[i] % 7 == 0) {
+			goto next;
+		}
+		s = s + a[i];
+next:
+		s = s + 1;
+	}
+
+	return s;
+}
+
+int main()
+{
+	int i, j, k, s;
+	int b[20];
+	float f[8];
+
+	for (i = 0; i < 20; i++) {
+		a[i] = i * 3;
+		b[i] = a[i] + 1;
+	}
+
+	for (i = 1; i < 19; i = i + 1) {
+		b[i] = a[i - 1] + a[i + 1] + b[i];
+	}
+
+	for (i = 0; i < 20; i++) {
+		__print_int(b[i]);
+	}
+
+	s = 0;
+	for (i = 19; i >= 0; i -= 2) {
+		s = s * 3 + b[i];
+	}
+	__print_int(s);
+
+	for (i = 0; i < 10; i++) {
+		pts[i].x = i;
+		pts[i].y = i * i;
+	}
+
+	s = 0;
+	for (i = 0; i < 10; i++) {
+		int p;
+		p = pts[i].x * pts[i].y;
+		s = s + p;
+	}
+	__print_int(s);
+
+	for (i = 0; i < 5; i++) {
+		for (j = 0; j < 6; j++) {
+			m[i][j] = i * 10 + j;
+		}
+	}
+
+	s = 0;
+	for (i = 0; i < 5; i++) {
+		for (j = 0; j < 6; j++) {
+			s = s * 7 + m[i][j];
+		}
+	}
+	__print_int(s);
+
+	t.n = 12;
+	for (i = 0; i < t.n; i++) {
+		t.v[i] = 100 - i;
+	}
+	__print_int(sum(t.v, t.n));
+
+	i = 0;
+	while (i < 8) {
+		f[i] = i * 0.5;
+		i++;
+	}
+
+	i = 0;
+	do {
+		__print_float(f[i]);
+		i += 3;
+	} while (i < 8);
+
+	k = 0;
+	for (j = 0; j < 20; j++) {
+		if (a[j] > 30) {
+			break;
+		}
+		if (j % 2) {
+			continue;
+		}
+		k = k + a[j];
+	}
+	__print_int(k);
+	__print_int(j);
+
+	__print_int(sum(b, 20));
+	__print_int(sum(&b[5], 10));
+	__print_int(reversed(b, 20));
+	__print_int(blocks(7));
+	__print_int(skipped(20));
+
+	return 0;
+}
@@ -0,0 +1,95 @@
+int a[32];
+int b[32];
+
+int dot(int *x, int *y, int n)
+{
+	int i, s;
+
+	s = 0;
+	for (i = 0; i < n; i++) {
+		s = s + x[i] * y[i];
+	}
+
+	return s;
+}
+
+int stride(int n)
+{
+	int i, s;
+
+	s = 0;
+	for (i = n; i >= 0; i -= 3) {
+		s = s * 2 + a[i];
+	}
+
+	return s * 100 + i;
+}
+
+int inclusive(int first, int last)
+{
+	int i, s;
+
+	s = 0;
+	for (i = first; i <= last; i = i + 2) {
+		int t;
+		t = a[i] - i;
+		s = s + t * t;
+	}
+
+	return s;
+}
+
+int main()
+{
+	int i, j, s;
+	int m[4][4];
+
+	for (i = 0; i < 32; i++) {
+		a[i] = i * 7 % 11;
+		b[i] = 31 - i;
+	}
+
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 4; j++) {
+			m[i][j] = i * 4 + j;
+		}
+	}
+
+	s = 0;
+	for (i = 3; i >= 0; i--) {
+		for (j = 0; j <= 3; j += 2) {
+			s = s * 3 + m[i][j];
+		}
+	}
+	__print_int(s);
+	__print_int(i);
+	__print_int(j);
+
+	for (i = 10; i < 5; i++) {
+		s = 0;
+	}
+	__print_int(i);
+
+	for (i = 0; i < 7; i += 2) {
+		__print_int(a[i] + b[i + 1]);
+	}
+	__print_int(i);
+
+	for (s = 0; s <= 6; s++) {
+		__print_int(dot(a, b, s));
+	}
+
+	__print_int(dot(a, b, 32));
+	__print_int(dot(&a[3], &b[5], 17));
+
+	for (s = -1; s < 9; s++) {
+		__print_int(stride(s));
+	}
+
+	__print_int(inclusive(0, 0));
+	__print_int(inclusive(1, 20));
+	__print_int(inclusive(3, 30));
+	__print_int(inclusive(5, 2));
+
+	return 0;
+}
@@ -0,0 +1,139 @@
+int a[19];
+int b[19];
+int c[19];
+float x[19];
+float y[19];
+
+void add(int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		a[i] = b[i] + c[i];
+	}
+}
+
+int sum(int first, int last)
+{
+	int i, s;
+
+	s = 0;
+	for (i = first; i <= last; i++) {
+		s = s + a[i];
+	}
+
+	return s;
+}
+
+void scale(int n, float k)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		x[i] = x[i] * k;
+	}
+}
+
+int mixed(int n, int m)
+{
+	int i, s, t;
+
+	s = 1;
+	t = 2;
+	for (i = 0; i < n; i = i + 1) {
+		c[i] = (a[i] - b[i]) ^ (m | b[i] & 12);
+		s += c[i] - 1;
+		b[i] -= a[i];
+		t = c[i] + t;
+	}
+
+	return s * 1000 + t;
+}
+
+void axpy(int n, float k, float m)
+{
+	int i;
+
+	for (i = 1; i < n; i++) {
+		y[i] += k * x[i] - x[i] / m;
+	}
+}
+
+int local(int n)
+{
+	int i, s;
+	int d[10];
+
+	for (i = 0; i < 10; i++) {
+		d[i] = i * 3;
+	}
+
+	s = 0;
+	for (i = 0; i < n; i++) {
+		d[i] = d[i] + 7;
+		s = d[i] + s;
+	}
+
+	return s;
+}
+
+void print()
+{
+	int i;
+
+	for (i = 0; i < 19; i++) {
+		__print_int(a[i] + b[i] * 100 + c[i] * 10000);
+	}
+}
+
+void printf_x()
+{
+	int i;
+
+	for (i = 0; i < 19; i++) {
+		__print_float(x[i] + y[i] * 100.0);
+	}
+}
+
+int main()
+{
+	int i;
+
+	for (i = 0; i < 19; i++) {
+		b[i] = i * 5 % 7;
+		c[i] = i % 4;
+		x[i] = i * 0.25;
+		y[i] = 1.0 - i;
+	}
+
+	add(19);
+	print();
+	add(3);
+	add(0);
+	add(-5);
+	print();
+
+	__print_int(sum(0, 18));
+	__print_int(sum(2, 8));
+	__print_int(sum(5, 5));
+	__print_int(sum(6, 5));
+	__print_int(sum(1, 16));
+
+	scale(19, 2.0);
+	scale(6, -0.5);
+	printf_x();
+
+	__print_int(mixed(19, 5));
+	__print_int(mixed(7, 3));
+	print();
+
+	axpy(19, 3.0, 1.5);
+	axpy(3, -1.0, 0.75);
+	printf_x();
+
+	__print_int(local(10));
+	__print_int(local(7));
+	__print_int(local(1));
+
+	return sum(0, 3) % 100;
+}
@@ -0,0 +1,109 @@
+int steps;
+
+int collatz(int n)
+{
+	int k;
+	k = 0;
+	while (n != 1) {
+		if (n % 2 == 0) {
+			n = n / 2;
+		} else {
+			n = 3 * n + 1;
+		}
+		k++;
+	}
+	return k;
+}
+
+int chain(int x)
+{
+	if (x < 0) {
+		goto negative;
+	}
+	if (x == 0) {
+		goto zero;
+	}
+	goto positive;
+
+negative:
+	goto done_negative;
+zero:
+	goto done_zero;
+positive:
+	goto done_positive;
+
+done_negative:
+	return -1;
+done_zero:
+	return 0;
+done_positive:
+	return 1;
+}
+
+int search(int limit)
+{
+	int i, j, found;
+	found = 0;
+	for (i = 2; i < limit; i++) {
+		for (j = 2; j * j <= i; j++) {
+			if (i % j == 0) {
+				break;
+			}
+		}
+		if (j * j <= i) {
+			continue;
+		}
+		found++;
+		steps = steps + collatz(i);
+	}
+	return found;
+}
+
+float halve(float x)
+{
+	int n;
+	n = 0;
+	while (x > 1.0) {
+		x = x / 2.0;
+		n++;
+	}
+	do {
+		x = x * 3.0;
+		n++;
+	} while (!(x >= 10.0));
+	steps = steps + n;
+	return x;
+}
+
+int main()
+{
+	int i, s;
+
+	__print_int(search(50));
+	__print_int(steps);
+
+	s = 0;
+	for (i = -3; i <= 3; i++) {
+		s = s * 3 + chain(i) + 1;
+	}
+	__print_int(s);
+
+	__print_float(halve(100.0));
+	__print_int(steps);
+
+	i = 0;
+	do {
+		i = i + 7;
+		if (i % 5 == 0) {
+			continue;
+		}
+		if (i > 60) {
+			break;
+		}
+		s = s - i;
+	} while (i < 100);
+	__print_int(s);
+	__print_int(i);
+
+	return s % 7;
+}
@@ -0,0 +1,7 @@
+.data
+.text
+.globl	main
+main:
+	mov	$7, %rax
+	ret
+.end
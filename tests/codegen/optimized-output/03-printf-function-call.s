@@ -0,0 +1,20 @@
+.data
+.SL1:
+	.string	"testing...\n"
+.text
+.globl	main
+main:
+	lea	.SL1(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	ret
+.end
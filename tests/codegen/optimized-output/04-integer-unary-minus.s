@@ -0,0 +1,17 @@
+.data
+.text
+.globl	main
+main:
+	push	$-5
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	ret
+.end
@@ -0,0 +1,7 @@
+.data
+.text
+.globl	main
+main:
+	mov	$15, %rax
+	ret
+.end
@@ -0,0 +1,13 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$4, %rsp
+	mov	$5, %rax
+	add	$4, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
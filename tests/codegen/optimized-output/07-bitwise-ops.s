@@ -0,0 +1,73 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$4, %rsp
+	mov	$-6, %rax
+	mov	%eax, -4(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$7, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$4, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$3, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$4, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
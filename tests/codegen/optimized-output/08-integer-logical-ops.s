@@ -0,0 +1,133 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$4, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$4, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
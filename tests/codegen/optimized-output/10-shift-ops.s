@@ -0,0 +1,73 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	push	$12
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$16
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$8
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$14
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$7
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
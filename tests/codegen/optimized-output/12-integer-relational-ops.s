@@ -0,0 +1,238 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	$-2, %rax
+	mov	%eax, -4(%rbp)
+	cmp	$5, %eax
+	jge	.L1
+	mov	$1, %eax
+	jmp	.L2
+.L1:
+	xor	%eax, %eax
+.L2:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	cmp	$5, %eax
+	jle	.L3
+	mov	$1, %eax
+	jmp	.L4
+.L3:
+	xor	%eax, %eax
+.L4:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	cmp	$5, %eax
+	jge	.L5
+	mov	$1, %eax
+	jmp	.L6
+.L5:
+	xor	%eax, %eax
+.L6:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	cmp	$5, %eax
+	jle	.L7
+	mov	$1, %eax
+	jmp	.L8
+.L7:
+	xor	%eax, %eax
+.L8:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	cmp	$5, %eax
+	jg	.L9
+	mov	$1, %eax
+	jmp	.L10
+.L9:
+	xor	%eax, %eax
+.L10:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	cmp	$5, %eax
+	jl	.L11
+	mov	$1, %eax
+	jmp	.L12
+.L11:
+	xor	%eax, %eax
+.L12:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	cmp	$5, %eax
+	jg	.L13
+	mov	$1, %eax
+	jmp	.L14
+.L13:
+	xor	%eax, %eax
+.L14:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	cmp	$5, %eax
+	jl	.L15
+	mov	$1, %eax
+	jmp	.L16
+.L15:
+	xor	%eax, %eax
+.L16:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
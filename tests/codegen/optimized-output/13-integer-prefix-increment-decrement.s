@@ -0,0 +1,152 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	$4, %rax
+	mov	%eax, -4(%rbp)
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	pop	%rbx
+	add	$1, %eax
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	pop	%rbx
+	add	$1, %eax
+	mov	%eax, (%rbx)
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$-2, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	pop	%rbx
+	sub	$1, %eax
+	mov	%eax, (%rbx)
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	pop	%rbx
+	sub	$1, %eax
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	pop	%rbx
+	sub	$1, %eax
+	mov	%eax, (%rbx)
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
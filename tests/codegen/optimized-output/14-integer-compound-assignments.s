@@ -0,0 +1,194 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$4, %rsp
+	mov	$5, %rax
+	mov	%eax, -4(%rbp)
+	mov	$3, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	sub	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	mov	%ebx, %ecx
+	sal	%cl, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655766, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$3, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$5, %rbx
+	or	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$31, %rbx
+	xor	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$8, %rbx
+	and	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	mov	%ebx, %ecx
+	sar	%cl, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$4, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
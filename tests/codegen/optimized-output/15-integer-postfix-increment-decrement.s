@@ -0,0 +1,156 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	$4, %rax
+	mov	%eax, -4(%rbp)
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	mov	%eax, -8(%rbp)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$-2, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	sub	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	sub	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	sub	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
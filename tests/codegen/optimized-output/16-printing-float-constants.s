@@ -0,0 +1,27 @@
+.data
+.text
+.globl	main
+main:
+	push	$1049247089
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	push	$1095069860
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	ret
+.end
@@ -0,0 +1,27 @@
+.data
+.text
+.globl	main
+main:
+	push	$-1061850972
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	push	$1082046546
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	ret
+.end
@@ -0,0 +1,24 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$4, %rsp
+	mov	$1091703931, %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$4, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,85 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	$1083179008, %rax
+	mov	%eax, -4(%rbp)
+	mov	$1093926912, %rax
+	mov	%eax, -8(%rbp)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fsubr	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fdivr	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
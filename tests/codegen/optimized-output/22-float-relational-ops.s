@@ -0,0 +1,435 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	$-1072483533, %rax
+	mov	%eax, -4(%rbp)
+	mov	$1086115021, %rax
+	mov	%eax, -8(%rbp)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jae	.L1
+	mov	$1, %eax
+	jmp	.L2
+.L1:
+	xor	%eax, %eax
+.L2:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jbe	.L3
+	mov	$1, %eax
+	jmp	.L4
+.L3:
+	xor	%eax, %eax
+.L4:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1086115021
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jae	.L5
+	mov	$1, %eax
+	jmp	.L6
+.L5:
+	xor	%eax, %eax
+.L6:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1086115021
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jbe	.L7
+	mov	$1, %eax
+	jmp	.L8
+.L7:
+	xor	%eax, %eax
+.L8:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$-1072483533
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jae	.L9
+	mov	$1, %eax
+	jmp	.L10
+.L9:
+	xor	%eax, %eax
+.L10:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$-1072483533
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jbe	.L11
+	mov	$1, %eax
+	jmp	.L12
+.L11:
+	xor	%eax, %eax
+.L12:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	ja	.L13
+	mov	$1, %eax
+	jmp	.L14
+.L13:
+	xor	%eax, %eax
+.L14:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jb	.L15
+	mov	$1, %eax
+	jmp	.L16
+.L15:
+	xor	%eax, %eax
+.L16:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1086115021
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	ja	.L17
+	mov	$1, %eax
+	jmp	.L18
+.L17:
+	xor	%eax, %eax
+.L18:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1086115021
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jb	.L19
+	mov	$1, %eax
+	jmp	.L20
+.L19:
+	xor	%eax, %eax
+.L20:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$-1072483533
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	ja	.L21
+	mov	$1, %eax
+	jmp	.L22
+.L21:
+	xor	%eax, %eax
+.L22:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$-1072483533
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jb	.L23
+	mov	$1, %eax
+	jmp	.L24
+.L23:
+	xor	%eax, %eax
+.L24:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$1089889894, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	$1089889894, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jae	.L25
+	mov	$1, %eax
+	jmp	.L26
+.L25:
+	xor	%eax, %eax
+.L26:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jbe	.L27
+	mov	$1, %eax
+	jmp	.L28
+.L27:
+	xor	%eax, %eax
+.L28:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	ja	.L29
+	mov	$1, %eax
+	jmp	.L30
+.L29:
+	xor	%eax, %eax
+.L30:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jb	.L31
+	mov	$1, %eax
+	jmp	.L32
+.L31:
+	xor	%eax, %eax
+.L32:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
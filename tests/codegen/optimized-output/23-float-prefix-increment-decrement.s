@@ -0,0 +1,168 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	$1082948321, %rax
+	mov	%eax, -4(%rbp)
+	push	%rax
+	fld1
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	(%rsp), %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	mov	%eax, -8(%rbp)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld1
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	(%rsp), %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld1
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	(%rsp), %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$-1073376920, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld1
+	fsubr	(%rsp)
+	fstp	(%rsp)
+	mov	(%rsp), %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld1
+	fsubr	(%rsp)
+	fstp	(%rsp)
+	mov	(%rsp), %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld1
+	fsubr	(%rsp)
+	fstp	(%rsp)
+	mov	(%rsp), %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,99 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$4, %rsp
+	mov	$1085276160, %rax
+	mov	%eax, -4(%rbp)
+	push	%rax
+	push	$1080033280
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	mov	%eax, -4(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1082549862
+	fld	(%rsp)
+	add	$8, %rsp
+	fsubr	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1073741824
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1067030938
+	fld	(%rsp)
+	add	$8, %rsp
+	fdivr	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$4, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
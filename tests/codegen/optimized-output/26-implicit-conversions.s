@@ -0,0 +1,89 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	$1080641454, %rax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	fld	(%rsp)
+	fisttpl	(%rsp)
+	pop	%rax
+	mov	%eax, -4(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$975
+	fildl	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	fisttpl	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,82 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$28, %rsp
+	lea	-12(%rbp), %rax
+	mov	%rax, -8(%rbp)
+	mov	$7, %rax
+	mov	%eax, -12(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	$10, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	lea	-16(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-8(%rbp), %rax
+	mov	(%rax), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	lea	-28(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-28(%rbp), %rax
+	push	%rax
+	mov	$1113676841, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-24(%rbp), %rax
+	mov	(%rax), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$28, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
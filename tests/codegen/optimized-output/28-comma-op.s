@@ -0,0 +1,82 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$24, %rsp
+	mov	$5, %rax
+	mov	%eax, -4(%rbp)
+	mov	$6, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	mov	%rax, %rbx
+	mov	$6, %rax
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	mov	%ebx, %eax
+	mov	%ebx, -12(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	$1083598438, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	$1091777331, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-24(%rbp), %rax
+	push	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fsubr	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fsubr	(%rsp)
+	fstp	(%rsp)
+	pop	%rbx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$24, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
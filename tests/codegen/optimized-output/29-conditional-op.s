@@ -0,0 +1,89 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	push	$2
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$3
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	$1087037768, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L1
+	push	$7
+	jmp	.L2
+.L1:
+	push	$9
+.L2:
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L3
+	push	$1083179008
+	jmp	.L4
+.L3:
+	push	$1066192077
+.L4:
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,41 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$188, %rsp
+	mov	$8, %rax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-92(%rbp), %rax
+	push	%rax
+	mov	$1082046546, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-92(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$188, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,71 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	mov	$5, %rax
+	mov	%eax, -8(%rbp)
+	mov	$1081207685, %rax
+	mov	%eax, -4(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	$99, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
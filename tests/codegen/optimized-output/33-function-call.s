@@ -0,0 +1,284 @@
+.data
+.SL1:
+	.string	"a() called\n"
+.SL2:
+	.string	"b() called\n"
+.SL3:
+	.string	"c() called\n"
+.SL4:
+	.string	"d() called\n"
+.text
+.globl	a
+a:
+	lea	.SL1(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	ret
+.globl	b
+b:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	lea	.SL2(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	c
+c:
+	lea	.SL3(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	mov	$10, %rax
+	ret
+.globl	d
+d:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	movss	%xmm0, -8(%rbp)
+	lea	.SL4(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$5
+	fildl	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	movd	%eax, %xmm0
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$12, %rsp
+	lea	.SL1(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	lea	.SL2(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	push	$42
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	.SL3(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	push	$10
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	.SL3(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	push	$15
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	$1056964608, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	.SL4(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$5
+	fildl	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	.SL3(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	lea	-12(%rbp), %rax
+	push	%rax
+	push	$10
+	fildl	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	.SL4(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	printf
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	push	$5
+	fildl	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$12, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,209 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$2
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$3
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$4
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L1
+.L15:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+.L1:
+	mov	-4(%rbp), %eax
+	cmp	$997, %eax
+	jg	.L2
+	jmp	.L15
+.L16:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+.L2:
+	mov	-4(%rbp), %eax
+	cmp	$1000, %eax
+	jle	.L16
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L7
+.L17:
+	mov	-4(%rbp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+.L7:
+	mov	-4(%rbp), %eax
+	cmp	$100, %eax
+	jle	.L17
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-4(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L12
+.L18:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+.L12:
+	mov	-4(%rbp), %eax
+	cmp	$10, %eax
+	jl	.L18
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,107 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	jmp	.L1
+.L9:
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	pop	%rbx
+	add	$1, %eax
+	mov	%eax, (%rbx)
+.L1:
+	mov	-4(%rbp), %eax
+	cmp	$5, %eax
+	jl	.L9
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+.L3:
+	mov	-4(%rbp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	cmp	$999, %eax
+	jle	.L3
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$-1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L7
+.L10:
+	mov	-4(%rbp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+.L7:
+	mov	-4(%rbp), %eax
+	cmp	$9, %eax
+	jl	.L10
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,78 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$4, %rsp
+	mov	$1, %rdx
+	mov	$1, %eax
+	cmp	%eax, %edx
+	jne	.L3
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+.L3:
+	mov	$1, %rdx
+	mov	$1, %eax
+	cmp	%eax, %edx
+	je	.L4
+	mov	$2, %eax
+	cmp	%eax, %edx
+	je	.L5
+	jmp	.L6
+.L4:
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+.L5:
+.L6:
+	mov	$45, %rdx
+	mov	$1, %eax
+	cmp	%eax, %edx
+	cmp	%eax, %edx
+	je	.L10
+	mov	$2, %eax
+	cmp	%eax, %edx
+.L10:
+	push	$999
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	$45, %rdx
+	push	$999
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$4, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
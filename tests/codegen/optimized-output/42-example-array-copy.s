@@ -0,0 +1,1135 @@
+.data
+.text
+.globl	array_copy
+array_copy:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$44, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	mov	%rdx, -24(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -28(%rbp)
+	cltq
+	lea	(%rdi, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	mov	-28(%rbp), %eax
+	cltq
+	lea	(%rsi, %rax, 4), %rax
+	mov	%rax, -44(%rbp)
+	jmp	.L1
+.L19:
+	mov	-36(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-44(%rbp), %rbx
+	mov	(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-44(%rbp), %rbx
+	mov	4(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-36(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-44(%rbp), %rbx
+	mov	8(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-36(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-44(%rbp), %rbx
+	mov	12(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -28(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -36(%rbp)
+	mov	-44(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -44(%rbp)
+.L1:
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L19
+	mov	-28(%rbp), %eax
+	mov	-8(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	mov	-28(%rbp), %eax
+	mov	-16(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -44(%rbp)
+	jmp	.L4
+.L20:
+	mov	-36(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-44(%rbp), %rbx
+	mov	(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -28(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+	pop	%rax
+	mov	-44(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -44(%rbp)
+.L4:
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L20
+	add	$44, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$84, %rsp
+	lea	-20(%rbp), %rax
+	mov	%rax, -48(%rbp)
+	lea	-40(%rbp), %rax
+	mov	%rax, -56(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	mov	$1, %rax
+	mov	%eax, -16(%rbp)
+	mov	$2, %rax
+	mov	%eax, -12(%rbp)
+	mov	$3, %rax
+	mov	%eax, -8(%rbp)
+	mov	$4, %rax
+	mov	%eax, -4(%rbp)
+	lea	-40(%rbp), %rax
+	mov	%rax, -68(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -40(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -36(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -32(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -28(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	mov	%eax, -40(%rbp)
+	mov	-16(%rbp), %eax
+	mov	%eax, -36(%rbp)
+	mov	-12(%rbp), %eax
+	mov	%eax, -32(%rbp)
+	mov	-8(%rbp), %eax
+	mov	%eax, -28(%rbp)
+	mov	-4(%rbp), %eax
+	mov	%eax, -24(%rbp)
+	mov	-40(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	16(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-68(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	16(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-56(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-56(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	4(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-56(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	8(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-56(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	12(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-56(%rbp), %rbx
+	lea	16(%rbx), %rax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	16(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-68(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	16(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-68(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	16(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-36(%rbp), %rax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	4(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-32(%rbp), %rax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	8(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-28(%rbp), %rax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	12(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	16(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-68(%rbp), %rax
+	push	%rax
+	mov	-56(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	16(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-68(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	16(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-76(%rbp), %rax
+	push	%rax
+	lea	-20(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-68(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	4(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	8(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	12(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	16(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	16(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-68(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	16(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-68(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	16(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-76(%rbp), %rax
+	push	%rax
+	mov	-48(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-68(%rbp), %rax
+	push	%rax
+	mov	-56(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	4(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	8(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	12(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	16(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	16(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-68(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	16(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-68(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	16(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-76(%rbp), %rax
+	push	%rax
+	lea	-20(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-68(%rbp), %rax
+	push	%rax
+	mov	-56(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	4(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	8(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	12(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-68(%rbp), %rbx
+	lea	16(%rbx), %rax
+	push	%rax
+	mov	-76(%rbp), %rbx
+	mov	16(%rbx), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-68(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-68(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-68(%rbp), %rbx
+	mov	16(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$84, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	print_array
+print_array:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$28, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	cltq
+	lea	(%rdi, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L7
+.L21:
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-28(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-28(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-28(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-28(%rbp), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L7:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L21
+	mov	-20(%rbp), %eax
+	mov	-8(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L10
+.L22:
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	lea	-28(%rbp), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	pop	%rax
+.L10:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L22
+	add	$28, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	reset_array
+reset_array:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$28, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	cltq
+	lea	(%rdi, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L13
+.L23:
+	mov	-28(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -28(%rbp)
+.L13:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L23
+	mov	-20(%rbp), %eax
+	mov	-8(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L16
+.L24:
+	mov	-28(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	pop	%rax
+.L16:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L24
+	add	$28, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
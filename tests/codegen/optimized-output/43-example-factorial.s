@@ -0,0 +1,289 @@
+.data
+.text
+.globl	factorial_loop
+factorial_loop:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	$1, %rax
+	mov	%eax, -16(%rbp)
+	mov	$2, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L1
+.L9:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+.L1:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jg	.L2
+	jmp	.L9
+.L10:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L2:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jle	.L10
+	mov	-16(%rbp), %eax
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	factorial_recursive
+factorial_recursive:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	cmp	$1, %eax
+	jg	.L7
+	mov	$1, %rax
+	jmp	.RLfactorial_recursive
+.L7:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	factorial_recursive
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+.RLfactorial_recursive:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$4
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	factorial_recursive
+	pop	%rsp
+	add	$8, %rsp
+	lea	(%rax, %rax, 4), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$6
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	factorial_recursive
+	pop	%rsp
+	add	$8, %rsp
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	sal	$1, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	sal	$2, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	sal	$1, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	sal	$2, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	sal	$1, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
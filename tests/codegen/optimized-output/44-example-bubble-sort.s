@@ -0,0 +1,195 @@
+.data
+.text
+.globl	bubble_sort
+bubble_sort:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$64, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	mov	$1, %rax
+	mov	%eax, -28(%rbp)
+	mov	-16(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	jmp	.L1
+.L11:
+	mov	-36(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	4(%rbx), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jbe	.L7
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -60(%rbp)
+	lea	(%rbx), %rax
+	mov	%rax, -52(%rbp)
+	mov	(%rax), %eax
+	mov	%eax, -64(%rbp)
+	mov	-60(%rbp), %rax
+	mov	(%rax), %eax
+	mov	-52(%rbp), %rbx
+	mov	%eax, (%rbx)
+	mov	-64(%rbp), %eax
+	mov	-60(%rbp), %rbx
+	mov	%eax, (%rbx)
+	xor	%rax, %rax
+	mov	%eax, -28(%rbp)
+.L7:
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+.L4:
+	mov	-44(%rbp), %rbx
+	mov	-36(%rbp), %rax
+	cmp	%rbx, %rax
+	jb	.L11
+	mov	-28(%rbp), %eax
+	cmp	$0, %eax
+	jne	.L2
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	sub	$1, %eax
+	mov	%eax, -20(%rbp)
+	pop	%rax
+.L1:
+	mov	-20(%rbp), %eax
+	cmp	$0, %eax
+	jle	.L2
+	xor	%rax, %rax
+	mov	%eax, -24(%rbp)
+	mov	-8(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	-36(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -44(%rbp)
+	jmp	.L4
+.L2:
+	add	$64, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$24, %rsp
+	mov	$1083388723, %rax
+	mov	%eax, -20(%rbp)
+	mov	$1102944666, %rax
+	mov	%eax, -16(%rbp)
+	mov	$-1062207488, %rax
+	mov	%eax, -12(%rbp)
+	mov	$1089680179, %rax
+	mov	%eax, -8(%rbp)
+	mov	$1077516698, %rax
+	mov	%eax, -4(%rbp)
+	push	$5
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	xor	%eax, %eax
+	call	bubble_sort
+	pop	%rsp
+	add	$16, %rsp
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$24, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	swap
+swap:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	mov	%rsi, -16(%rbp)
+	mov	(%rdi), %eax
+	mov	%eax, -20(%rbp)
+	mov	(%rsi), %eax
+	mov	%eax, (%rdi)
+	mov	-20(%rbp), %eax
+	mov	-16(%rbp), %rbx
+	mov	%eax, (%rbx)
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,384 @@
+.data
+.text
+.globl	fib
+fib:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	cmp	$2, %eax
+	jge	.L1
+	mov	-8(%rbp), %eax
+	jmp	.RLfib
+.L1:
+	mov	-8(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	fib
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$2, %rbx
+	sub	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	fib
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+.RLfib:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$40, %rsp
+	mov	$3, %rax
+	mov	%eax, -8(%rbp)
+	mov	$4, %rax
+	mov	%eax, -4(%rbp)
+	mov	$321, %rax
+	mov	%eax, -12(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	$1048576000, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	$1069547520, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$4
+	fildl	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-12(%rbp), %rax
+	push	%rax
+	push	$14
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	fib
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	push	$13
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	fib
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$5
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	triple
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-20(%rbp), %rax
+	push	%rax
+	lea	-8(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	mov	(%rbx), %eax
+	lea	(%rax, %rax, 4), %rax
+	push	%rax
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	$111, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-36(%rbp), %rax
+	push	%rax
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	triple
+	pop	%rsp
+	add	$8, %rsp
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-32(%rbp), %rax
+	push	%rax
+	push	$5
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	fib
+	pop	%rsp
+	add	$8, %rsp
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-28(%rbp), %rax
+	push	%rax
+	mov	-32(%rbp), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	sal	$1, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-40(%rbp), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$7
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	$21, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	add	$40, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	project
+project:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rsi, -16(%rbp)
+	mov	(%rdi), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	4(%rdi), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	scale
+scale:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$24, %rsp
+	movss	%xmm0, -8(%rbp)
+	mov	%rdi, -16(%rbp)
+	movss	%xmm1, -24(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	movd	%eax, %xmm0
+	add	$24, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	seven
+seven:
+	mov	$7, %rax
+	ret
+.globl	triple
+triple:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	sal	$1, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	weigh
+weigh:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$24, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	mov	%rdx, -24(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	sal	$1, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	add	$24, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
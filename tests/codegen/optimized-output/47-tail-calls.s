@@ -0,0 +1,1005 @@
+.data
+.comm	nodes,120
+.text
+.globl	conv
+conv:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	fisttpl	(%rsp)
+	pop	%rax
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	count
+count:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$12, %rsp
+	mov	%rdi, -8(%rbp)
+	jmp	.TLcount
+.L40:
+	xor	%rax, %rax
+	jmp	.RLcount
+.L6:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L3:
+	mov	-12(%rbp), %eax
+	cmp	$3, %eax
+	jge	.L4
+	mov	-12(%rbp), %eax
+	cmp	$1, %eax
+	jne	.L6
+	mov	-8(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	mov	%eax, -8(%rbp)
+.TLcount:
+	mov	-8(%rbp), %eax
+	cmp	$0, %eax
+	je	.L40
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L3
+.L4:
+	mov	$-1, %rax
+.RLcount:
+	add	$12, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	deref
+deref:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	mov	(%rdi), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-16(%rbp), %eax
+	cmp	$0, %eax
+	jne	.L8
+	mov	-20(%rbp), %eax
+	jmp	.RLderef
+.L8:
+	mov	-16(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	push	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	xor	%eax, %eax
+	call	deref
+	pop	%rsp
+	add	$16, %rsp
+.RLderef:
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	fields
+fields:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$32, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	xor	%rbx, %rbx
+	add	%ebx, %eax
+	mov	%eax, -28(%rbp)
+	mov	-8(%rbp), %eax
+	mov	$10, %rbx
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-8(%rbp), %eax
+	mov	$20, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-8(%rbp), %eax
+	mov	$30, %rbx
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	push	$4
+	lea	-28(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	xor	%eax, %eax
+	call	total
+	pop	%rsp
+	add	$16, %rsp
+	add	$32, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	five
+five:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$40, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	mov	%rdx, -24(%rbp)
+	mov	%rcx, -32(%rbp)
+	mov	%r8, -40(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	sal	$1, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %eax
+	sal	$2, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-40(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	add	$40, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	fsum
+fsum:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	movss	%xmm0, -16(%rbp)
+	jmp	.TLfsum
+.L10:
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$1056964608
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	-8(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	pop	%rax
+	mov	%eax, -16(%rbp)
+.TLfsum:
+	mov	-8(%rbp), %eax
+	cmp	$0, %eax
+	jne	.L10
+	mov	-16(%rbp), %eax
+	movd	%eax, %xmm0
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	gcd
+gcd:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	jmp	.TLgcd
+.L12:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%eax, -8(%rbp)
+	pop	%rax
+	mov	%eax, -16(%rbp)
+.TLgcd:
+	mov	-16(%rbp), %eax
+	cmp	$0, %eax
+	jne	.L12
+	mov	-8(%rbp), %eax
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	is_even
+is_even:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	cmp	$0, %eax
+	jne	.L14
+	mov	$1, %rax
+	jmp	.RLis_even
+.L14:
+	mov	-8(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	cmp	$0, %eax
+	jne	.L16
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.CLis_even_is_odd.end1
+.L16:
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	is_even
+	pop	%rsp
+	add	$8, %rsp
+	pop	%rbx
+	mov	%eax, (%rbx)
+.CLis_even_is_odd.end1:
+	mov	-12(%rbp), %eax
+.RLis_even:
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	is_odd
+is_odd:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	cmp	$0, %eax
+	jne	.L18
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.L18:
+	mov	-8(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	mov	(%rax), %rdi
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	xor	%eax, %eax
+	jmp	is_even
+.globl	length
+length:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	jmp	.TLlength
+.L20:
+	mov	-16(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %rbx
+	mov	4(%rbx), %rax
+	mov	%rax, -8(%rbp)
+	pop	%rax
+	mov	%eax, -16(%rbp)
+.TLlength:
+	mov	-8(%rbp), %rax
+	cmp	$0, %rax
+	jne	.L20
+	mov	-16(%rbp), %eax
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$36, %rsp
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	jmp	.L22
+.L41:
+	mov	-4(%rbp), %eax
+	lea	nodes(%rip), %rbx
+	imul	$12, %eax
+	cltq
+	lea	4(%rbx, %rax, 1), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	lea	nodes(%rip), %rbx
+	imul	$12, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+.L22:
+	mov	-4(%rbp), %eax
+	cmp	$9, %eax
+	jl	.L41
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$147
+	push	$462
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	xor	%eax, %eax
+	call	gcd
+	pop	%rsp
+	add	$16, %rsp
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	push	$100000
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	xor	%eax, %eax
+	call	sum
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-16(%rbp), %rax
+	push	%rax
+	lea	nodes(%rip), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-16(%rbp), %rax
+	cmp	$0, %rax
+	jne	.L25
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	jmp	.CLmain_length.end2
+.L25:
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$1
+	mov	-16(%rbp), %rbx
+	push	4(%rbx)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	xor	%eax, %eax
+	call	length
+	pop	%rsp
+	add	$16, %rsp
+	pop	%rbx
+	mov	%eax, (%rbx)
+.CLmain_length.end2:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-16(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$1056964608
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	push	$999
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	movss	8(%rax), %xmm0
+	mov	$1, %eax
+	call	fsum
+	pop	%rsp
+	add	$16, %rsp
+	movd	%xmm0, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	push	$100001
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	is_even
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-36(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-32(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-28(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	sal	$1, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-28(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %eax
+	sal	$2, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-16(%rbp), %rax
+	push	%rax
+	lea	-4(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %rax
+	mov	(%rax), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$4
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	xor	%eax, %eax
+	call	deref
+	pop	%rsp
+	add	$16, %rsp
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$7
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	conv
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-16(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L27
+.L30:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -16(%rbp)
+	pop	%rax
+.L27:
+	mov	-16(%rbp), %eax
+	cmp	$3, %eax
+	jge	.L28
+	mov	-16(%rbp), %eax
+	cmp	$1, %eax
+	jne	.L30
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$99999
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	count
+	pop	%rsp
+	add	$8, %rsp
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.CLmain_count.end7
+.L28:
+	mov	$-1, %rax
+	mov	%eax, -8(%rbp)
+.CLmain_count.end7:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$4
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	fields
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$12
+	push	$18
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	xor	%eax, %eax
+	call	gcd
+	pop	%rsp
+	add	$16, %rsp
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	add	$36, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	sum
+sum:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$24, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	jmp	.TLsum
+.L32:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-8(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	mov	%eax, -8(%rbp)
+	pop	%rax
+	mov	%eax, -16(%rbp)
+.TLsum:
+	mov	-8(%rbp), %eax
+	cmp	$0, %eax
+	jne	.L32
+	mov	-16(%rbp), %eax
+	add	$24, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	tofloat
+tofloat:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	movd	%eax, %xmm0
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	total
+total:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$72, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -24(%rbp)
+	mov	$-1, %rax
+	mov	%eax, -56(%rbp)
+	mov	$-1, %rax
+	mov	%eax, -52(%rbp)
+	mov	$-1, %rax
+	mov	%eax, -48(%rbp)
+	mov	$-1, %rax
+	mov	%eax, -44(%rbp)
+	mov	$-1, %rax
+	mov	%eax, -40(%rbp)
+	mov	$-1, %rax
+	mov	%eax, -36(%rbp)
+	mov	$-1, %rax
+	mov	%eax, -32(%rbp)
+	mov	$-1, %rax
+	mov	%eax, -28(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	cltq
+	lea	(%rdi, %rax, 4), %rax
+	mov	%rax, -64(%rbp)
+	mov	-20(%rbp), %eax
+	cltq
+	lea	-56(%rbp, %rax, 4), %rax
+	mov	%rax, -72(%rbp)
+	jmp	.L34
+.L42:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-64(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-72(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	push	%rax
+	mov	-64(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-72(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	push	%rax
+	mov	-64(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-72(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	push	%rax
+	mov	-64(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-72(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-64(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -64(%rbp)
+	mov	-72(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -72(%rbp)
+.L34:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L42
+	mov	-20(%rbp), %eax
+	mov	-8(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -64(%rbp)
+	mov	-20(%rbp), %eax
+	cltq
+	lea	-56(%rbp, %rax, 4), %rax
+	mov	%rax, -72(%rbp)
+	jmp	.L37
+.L43:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-64(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-72(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-64(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -64(%rbp)
+	pop	%rax
+	mov	-72(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -72(%rbp)
+.L37:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L43
+	mov	-24(%rbp), %eax
+	add	$72, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	wide
+wide:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$32, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	mov	%eax, -32(%rbp)
+	mov	%eax, -28(%rbp)
+	mov	%eax, -24(%rbp)
+	mov	%eax, -20(%rbp)
+	push	%rax
+	mov	-20(%rbp), %eax
+	sal	$1, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-28(%rbp), %eax
+	sal	$2, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	add	$32, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
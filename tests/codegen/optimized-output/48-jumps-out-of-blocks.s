@@ -0,0 +1,538 @@
+.data
+g:
+	.long	0
+.text
+.globl	choose
+choose:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	mov	%rax, %rdx
+	mov	$1, %eax
+	cmp	%eax, %edx
+	je	.L1
+	mov	$2, %eax
+	cmp	%eax, %edx
+	je	.L2
+	mov	$-1, %rax
+	mov	%eax, -12(%rbp)
+.L4:
+	mov	-12(%rbp), %eax
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.L1:
+	mov	$10, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L4
+.L2:
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	mov	%eax, -12(%rbp)
+	jmp	.L4
+.globl	find
+find:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L5
+.L8:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L5:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jge	.L6
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	cmp	$50, %eax
+	jle	.L8
+	mov	-12(%rbp), %eax
+	jmp	.RLfind
+.L6:
+	mov	$-1, %rax
+.RLfind:
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$28, %rsp
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	jmp	.L10
+.L12:
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+.L10:
+	mov	-4(%rbp), %eax
+	cmp	$1000000, %eax
+	jge	.L11
+	mov	-4(%rbp), %eax
+	mov	$7, %rbx
+	and	%ebx, %eax
+	mov	%eax, -12(%rbp)
+	cmp	$3, %eax
+	jne	.L12
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	pop	%rax
+.L15:
+	mov	-12(%rbp), %eax
+	mov	%eax, -16(%rbp)
+	cmp	$3, %eax
+	jne	.L15
+	jmp	.L12
+.L11:
+	mov	-8(%rbp), %eax
+	cmp	$0, %eax
+	jle	.L19
+	mov	-8(%rbp), %eax
+	mov	%eax, g(%rip)
+	jmp	.L20
+.L19:
+	mov	$1, %rax
+	mov	%eax, g(%rip)
+.L20:
+	mov	g(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$100
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	find
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L21
+.L43:
+	mov	-20(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655766, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$3, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%ebx, -28(%rbp)
+	cmp	$0, %eax
+	je	.L23
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-28(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+.L23:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	pop	%rax
+.L21:
+	mov	-20(%rbp), %eax
+	cmp	$10, %eax
+	jl	.L43
+	mov	-24(%rbp), %eax
+	mov	%eax, -12(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$10
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	search
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	choose
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$2
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	choose
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$5
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	choose
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	$2, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %eax
+	sal	$1, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	$300, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %eax
+	sal	$1, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	$4, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %eax
+	sal	$1, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$28, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	pick
+pick:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jle	.L26
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	jmp	.L27
+.L26:
+	mov	-16(%rbp), %eax
+	cmp	$100, %eax
+	jle	.L28
+	mov	-16(%rbp), %eax
+	push	%rax
+	jmp	.L29
+.L28:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+.L29:
+.L27:
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %eax
+	sal	$1, %eax
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	search
+search:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$24, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L30
+.L44:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	cmp	$57, %eax
+	je	.CLsearch_found
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -16(%rbp)
+	pop	%rax
+.L33:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L44
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L30:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jge	.L31
+	mov	-12(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	sal	$1, %eax
+	mov	%eax, -20(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	jmp	.L33
+.L31:
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	mov	$-1, %rax
+	mov	%eax, -16(%rbp)
+.CLsearch_found:
+	mov	-12(%rbp), %eax
+	imul	$100, %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	add	$24, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	skip
+skip:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L38
+.L45:
+	mov	-12(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655766, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$3, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%ebx, -20(%rbp)
+	cmp	$0, %eax
+	je	.L40
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+.L40:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L38:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L45
+	mov	-16(%rbp), %eax
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,276 @@
+.data
+.text
+.globl	classify
+classify:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655766, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$3, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rdx
+	xor	%eax, %eax
+	cmp	%eax, %edx
+	je	.L1
+	mov	$1, %eax
+	cmp	%eax, %edx
+	je	.L2
+	mov	-8(%rbp), %eax
+	neg	%eax
+.RLclassify:
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.L1:
+	mov	-8(%rbp), %eax
+	sal	$1, %eax
+	mov	%eax, -12(%rbp)
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	jmp	.RLclassify
+.L2:
+	mov	-8(%rbp), %eax
+	mov	%eax, -12(%rbp)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	classify
+	pop	%rsp
+	add	$8, %rsp
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	imul	$1000, %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	jmp	.RLclassify
+.globl	main
+main:
+	push	$3
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	classify
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$4
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	classify
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$5
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	classify
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$10
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	overlay
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	overlay
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	ret
+.globl	overlay
+overlay:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$36, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	jmp	.L5
+.L8:
+	mov	-16(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	mov	%eax, -24(%rbp)
+	mov	-12(%rbp), %eax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	fisttpl	(%rsp)
+	pop	%rax
+	mov	%eax, -12(%rbp)
+.L9:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -16(%rbp)
+	pop	%rax
+.L5:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jge	.L6
+	mov	-16(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	and	$-2, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	cmp	$0, %eax
+	je	.L8
+	mov	-16(%rbp), %eax
+	xor	%rbx, %rbx
+	add	%ebx, %eax
+	mov	%eax, -32(%rbp)
+	mov	-16(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+	jmp	.L9
+.L6:
+	mov	-12(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	sar	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	%ebx, %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	add	$36, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,532 @@
+.data
+.comm	grid,80
+.comm	pairs,128
+.comm	points,96
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$124, %rsp
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	points(%rip), %rbx
+	imul	$12, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	mov	%rax, -112(%rbp)
+	jmp	.L1
+.L19:
+	mov	-112(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-112(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-112(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	push	$1073741824
+	fld	(%rsp)
+	add	$8, %rsp
+	fdivr	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-112(%rbp), %rbx
+	lea	12(%rbx), %rax
+	mov	%rax, -112(%rbp)
+	pop	%rax
+.L1:
+	mov	-4(%rbp), %eax
+	cmp	$8, %eax
+	jl	.L19
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	grid(%rip), %rbx
+	imul	$20, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	mov	%rax, -112(%rbp)
+	jmp	.L4
+.L20:
+	mov	-112(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	sal	$1, %eax
+	mov	%eax, -104(%rbp)
+	xor	%rbx, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-112(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-104(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-112(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-104(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-112(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-104(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-112(%rbp), %rbx
+	lea	16(%rbx), %rax
+	push	%rax
+	mov	-104(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-112(%rbp), %rbx
+	lea	20(%rbx), %rax
+	mov	%rax, -112(%rbp)
+	pop	%rax
+.L4:
+	mov	-4(%rbp), %eax
+	cmp	$4, %eax
+	jl	.L20
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	pairs(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 8), %rax
+	mov	%rax, -112(%rbp)
+	jmp	.L7
+.L21:
+	mov	-112(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-112(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-112(%rbp), %rbx
+	lea	8(%rbx), %rax
+	mov	%rax, -112(%rbp)
+	pop	%rax
+.L7:
+	mov	-4(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L21
+	mov	$100, %rax
+	mov	%eax, -32(%rbp)
+	mov	$99, %rax
+	mov	%eax, -28(%rbp)
+	mov	$98, %rax
+	mov	%eax, -24(%rbp)
+	mov	$97, %rax
+	mov	%eax, -20(%rbp)
+	mov	$96, %rax
+	mov	%eax, -16(%rbp)
+	mov	$95, %rax
+	mov	%eax, -12(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	imul	$12, %eax
+	cltq
+	lea	-80(%rbp, %rax, 1), %rax
+	mov	%rax, -112(%rbp)
+	jmp	.L10
+.L22:
+	mov	-112(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-112(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	sal	$1, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-112(%rbp), %rbx
+	lea	12(%rbx), %rax
+	mov	%rax, -112(%rbp)
+	pop	%rax
+.L10:
+	mov	-4(%rbp), %eax
+	cmp	$4, %eax
+	jl	.L22
+	lea	points(%rip), %rax
+	mov	%rax, -92(%rbp)
+	lea	-32(%rbp), %rax
+	mov	%rax, -100(%rbp)
+	mov	points+64(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	points+44(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	points+24(%rip), %eax
+	push	%rax
+	mov	points+88(%rip), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	grid+76(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	grid+44(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	pairs+120(%rip), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	sub	%ebx, %eax
+	lea	pairs(%rip), %rbx
+	cltq
+	mov	4(%rbx, %rax, 8), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-92(%rbp), %rbx
+	mov	76(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	points+12(%rip), %eax
+	push	%rax
+	mov	-92(%rbp), %rbx
+	lea	48(%rbx), %rax
+	mov	4(%rax), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	mov	-100(%rbp), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-116(%rbp), %rax
+	push	%rax
+	lea	-84(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-124(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-120(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L13
+.L23:
+	mov	-124(%rbp), %eax
+	push	%rax
+	mov	-116(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-120(%rbp), %eax
+	pop	%rbx
+	imul	$12, %eax
+	cltq
+	mov	(%rbx, %rax, 1), %eax
+	lea	(%rax, %rax, 4), %rax
+	sal	$1, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-116(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-120(%rbp), %eax
+	pop	%rbx
+	imul	$12, %eax
+	cltq
+	mov	4(%rbx, %rax, 1), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -124(%rbp)
+	mov	-120(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -120(%rbp)
+	pop	%rax
+.L13:
+	mov	-120(%rbp), %eax
+	cmp	$4, %eax
+	jl	.L23
+	mov	-124(%rbp), %eax
+	push	%rax
+	mov	-116(%rbp), %rbx
+	mov	40(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -108(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	grid+68(%rip), %rax
+	push	%rax
+	mov	grid+52(%rip), %eax
+	push	%rax
+	mov	grid+28(%rip), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	grid+68(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$124, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	sum_corners
+sum_corners:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L16
+.L24:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	pop	%rbx
+	imul	$12, %eax
+	cltq
+	mov	(%rbx, %rax, 1), %eax
+	lea	(%rax, %rax, 4), %rax
+	sal	$1, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	pop	%rbx
+	imul	$12, %eax
+	cltq
+	mov	4(%rbx, %rax, 1), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L16:
+	mov	-12(%rbp), %eax
+	cmp	$4, %eax
+	jl	.L24
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %rbx
+	mov	40(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
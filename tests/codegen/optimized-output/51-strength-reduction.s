@@ -0,0 +1,3686 @@
+.data
+checksum:
+	.long	0
+.comm	divisors,112
+errors:
+	.long	0
+.comm	factors,88
+.text
+.globl	check
+check:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$408, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	mov	-8(%rbp), %eax
+	mov	%eax, -16(%rbp)
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	divisors(%rip), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L3
+	xor	%eax, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	divisors(%rip), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L1
+.L3:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L1:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	xor	%eax, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	cmp	$-2147483648, %eax
+	je	.L4
+	mov	-8(%rbp), %eax
+	neg	%eax
+	mov	%eax, -404(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -408(%rbp)
+	mov	-404(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-408(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L8
+	xor	%eax, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-408(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L6
+.L8:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L6:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-404(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	xor	%eax, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+.L4:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	sar	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L11
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	and	$-2, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L9
+.L11:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L9:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	and	$-2, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	sar	$1, %eax
+	neg	%eax
+	mov	%eax, -28(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -32(%rbp)
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L14
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	and	$-2, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L12
+.L14:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L12:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-28(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	and	$-2, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655766, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -36(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -40(%rbp)
+	mov	-36(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-40(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L17
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655766, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$3, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-40(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L15
+.L17:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L15:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655766, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$3, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655765, %eax
+	imul	%ebx
+	sub	%ebx, %edx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -44(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -48(%rbp)
+	mov	-44(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-48(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L20
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655765, %eax
+	imul	%ebx
+	sub	%ebx, %edx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$-3, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-48(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L18
+.L20:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L18:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-44(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655765, %eax
+	imul	%ebx
+	sub	%ebx, %edx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$-3, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$30, %eax
+	add	%ebx, %eax
+	sar	$2, %eax
+	mov	%eax, -52(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -56(%rbp)
+	mov	-52(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-56(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L23
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$30, %eax
+	add	%ebx, %eax
+	and	$-4, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-56(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L21
+.L23:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L21:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-52(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$30, %eax
+	add	%ebx, %eax
+	and	$-4, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -60(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -64(%rbp)
+	mov	-60(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-64(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L26
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$5, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-64(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L24
+.L26:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L24:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-60(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$5, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$715827883, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -68(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -72(%rbp)
+	mov	-68(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-72(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L29
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$715827883, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$6, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-72(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L27
+.L29:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L27:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-68(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$715827883, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$6, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -76(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -80(%rbp)
+	mov	-76(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-80(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L32
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-80(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L30
+.L32:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L30:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-76(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1840700269, %eax
+	imul	%ebx
+	sub	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -84(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -88(%rbp)
+	mov	-84(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-88(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L35
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1840700269, %eax
+	imul	%ebx
+	sub	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$-7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-88(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L33
+.L35:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L33:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-84(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1840700269, %eax
+	imul	%ebx
+	sub	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$-7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$29, %eax
+	add	%ebx, %eax
+	sar	$3, %eax
+	mov	%eax, -92(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -96(%rbp)
+	mov	-92(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L38
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$29, %eax
+	add	%ebx, %eax
+	and	$-8, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L36
+.L38:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L36:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-92(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$29, %eax
+	add	%ebx, %eax
+	and	$-8, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -100(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -104(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-104(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L41
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$10, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-104(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L39
+.L41:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L39:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-100(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$10, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$715827883, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -108(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -112(%rbp)
+	mov	-108(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L44
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$715827883, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$12, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L42
+.L44:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L42:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-108(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$715827883, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$12, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$28, %eax
+	add	%ebx, %eax
+	sar	$4, %eax
+	mov	%eax, -116(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -120(%rbp)
+	mov	-116(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-120(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L47
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$28, %eax
+	add	%ebx, %eax
+	and	$-16, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-120(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L45
+.L47:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L45:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-116(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$28, %eax
+	add	%ebx, %eax
+	and	$-16, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$28, %eax
+	add	%ebx, %eax
+	sar	$4, %eax
+	neg	%eax
+	mov	%eax, -124(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -128(%rbp)
+	mov	-124(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-128(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L50
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$28, %eax
+	add	%ebx, %eax
+	and	$-16, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-128(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L48
+.L50:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L48:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-124(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$28, %eax
+	add	%ebx, %eax
+	and	$-16, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1374389535, %eax
+	imul	%ebx
+	sar	$3, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -132(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -136(%rbp)
+	mov	-132(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-136(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L53
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1374389535, %eax
+	imul	%ebx
+	sar	$3, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$25, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-136(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L51
+.L53:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L51:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-132(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1374389535, %eax
+	imul	%ebx
+	sar	$3, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$25, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1374389535, %eax
+	imul	%ebx
+	sar	$5, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -140(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -144(%rbp)
+	mov	-140(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-144(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L56
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1374389535, %eax
+	imul	%ebx
+	sar	$5, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$100, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-144(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L54
+.L56:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L54:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-140(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1374389535, %eax
+	imul	%ebx
+	sar	$5, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$100, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$274877907, %eax
+	imul	%ebx
+	sar	$3, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -148(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -152(%rbp)
+	mov	-148(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-152(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L59
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$274877907, %eax
+	imul	%ebx
+	sar	$3, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$125, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-152(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L57
+.L59:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L57:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-148(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$274877907, %eax
+	imul	%ebx
+	sar	$3, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$125, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$6700417, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -156(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -160(%rbp)
+	mov	-156(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-160(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L62
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$6700417, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$641, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-160(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L60
+.L62:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L60:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-156(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$6700417, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$641, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$274877907, %eax
+	imul	%ebx
+	sar	$6, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -164(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -168(%rbp)
+	mov	-164(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-168(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L65
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$274877907, %eax
+	imul	%ebx
+	sar	$6, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$1000, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-168(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L63
+.L65:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L63:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-164(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$274877907, %eax
+	imul	%ebx
+	sar	$6, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$1000, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$22, %eax
+	add	%ebx, %eax
+	sar	$10, %eax
+	mov	%eax, -172(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -176(%rbp)
+	mov	-172(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-176(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L68
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$22, %eax
+	add	%ebx, %eax
+	and	$-1024, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-176(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L66
+.L68:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L66:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-172(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$22, %eax
+	add	%ebx, %eax
+	and	$-1024, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$16, %eax
+	add	%ebx, %eax
+	sar	$16, %eax
+	mov	%eax, -180(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -184(%rbp)
+	mov	-180(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-184(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L71
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$16, %eax
+	add	%ebx, %eax
+	and	$-65536, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-184(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L69
+.L71:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L69:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-180(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$16, %eax
+	add	%ebx, %eax
+	and	$-65536, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$565519675, %eax
+	imul	%ebx
+	sar	$10, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -188(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -192(%rbp)
+	mov	-188(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-192(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L74
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$565519675, %eax
+	imul	%ebx
+	sar	$10, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7777, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-192(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L72
+.L74:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L72:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-188(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$565519675, %eax
+	imul	%ebx
+	sar	$10, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7777, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1152921497, %eax
+	imul	%ebx
+	sar	$28, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -196(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -200(%rbp)
+	mov	-196(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-200(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L77
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1152921497, %eax
+	imul	%ebx
+	sar	$28, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$1000000007, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-200(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L75
+.L77:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L75:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-196(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1152921497, %eax
+	imul	%ebx
+	sar	$28, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$1000000007, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1073741825, %eax
+	imul	%ebx
+	sar	$29, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -204(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -208(%rbp)
+	mov	-204(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-208(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L80
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1073741825, %eax
+	imul	%ebx
+	sar	$29, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$2147483647, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-208(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L78
+.L80:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L78:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-204(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1073741825, %eax
+	imul	%ebx
+	sar	$29, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$2147483647, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$-1073741825, %eax
+	imul	%ebx
+	sar	$29, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	mov	%eax, -212(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -216(%rbp)
+	mov	-212(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-216(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L83
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$-1073741825, %eax
+	imul	%ebx
+	sar	$29, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$-2147483647, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-216(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L81
+.L83:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L81:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-212(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$-1073741825, %eax
+	imul	%ebx
+	sar	$29, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$-2147483647, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$2, %eax
+	add	%ebx, %eax
+	sar	$30, %eax
+	mov	%eax, -220(%rbp)
+	mov	-12(%rbp), %eax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -224(%rbp)
+	mov	-220(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-224(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L86
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$2, %eax
+	add	%ebx, %eax
+	and	$-1073741824, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-224(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L84
+.L86:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L84:
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-220(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$2, %eax
+	add	%ebx, %eax
+	and	$-1073741824, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, checksum(%rip)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	xor	%eax, %eax
+	mov	%eax, -228(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	factors(%rip), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -232(%rbp)
+	xor	%eax, %eax
+	push	%rax
+	mov	-232(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L89
+	mov	-228(%rbp), %eax
+	push	%rax
+	mov	-232(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L87
+.L89:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L87:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, -236(%rbp)
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -240(%rbp)
+	mov	-236(%rbp), %eax
+	push	%rax
+	mov	-240(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L92
+	mov	-236(%rbp), %eax
+	push	%rax
+	mov	-240(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L90
+.L92:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L90:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	neg	%eax
+	mov	%eax, -244(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -248(%rbp)
+	mov	-244(%rbp), %eax
+	push	%rax
+	mov	-248(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L95
+	mov	-244(%rbp), %eax
+	push	%rax
+	mov	-248(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L93
+.L95:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L93:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	sal	$1, %eax
+	mov	%eax, -252(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -256(%rbp)
+	mov	-252(%rbp), %eax
+	push	%rax
+	mov	-256(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L98
+	mov	-252(%rbp), %eax
+	push	%rax
+	mov	-256(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L96
+.L98:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L96:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	mov	%eax, -260(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -264(%rbp)
+	mov	-260(%rbp), %eax
+	push	%rax
+	mov	-264(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L101
+	mov	-260(%rbp), %eax
+	push	%rax
+	mov	-264(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L99
+.L101:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L99:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	mov	%eax, -268(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -272(%rbp)
+	mov	-268(%rbp), %eax
+	push	%rax
+	mov	-272(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L104
+	mov	-268(%rbp), %eax
+	push	%rax
+	mov	-272(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L102
+.L104:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L102:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 8), %rax
+	mov	%eax, -276(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -280(%rbp)
+	mov	-276(%rbp), %eax
+	push	%rax
+	mov	-280(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L107
+	mov	-276(%rbp), %eax
+	push	%rax
+	mov	-280(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L105
+.L107:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L105:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	sal	$1, %eax
+	mov	%eax, -284(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -288(%rbp)
+	mov	-284(%rbp), %eax
+	push	%rax
+	mov	-288(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L110
+	mov	-284(%rbp), %eax
+	push	%rax
+	mov	-288(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L108
+.L110:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L108:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$4, %eax
+	sub	%ebx, %eax
+	mov	%eax, -292(%rbp)
+	mov	%ebx, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -296(%rbp)
+	mov	-292(%rbp), %eax
+	push	%rax
+	mov	-296(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L113
+	mov	-292(%rbp), %eax
+	push	%rax
+	mov	-296(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L111
+.L113:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L111:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$4, %eax
+	add	%ebx, %eax
+	mov	%eax, -300(%rbp)
+	mov	%ebx, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -304(%rbp)
+	mov	-300(%rbp), %eax
+	push	%rax
+	mov	-304(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L116
+	mov	-300(%rbp), %eax
+	push	%rax
+	mov	-304(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L114
+.L116:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L114:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	sal	$3, %eax
+	mov	%eax, -308(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -312(%rbp)
+	mov	-308(%rbp), %eax
+	push	%rax
+	mov	-312(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L119
+	mov	-308(%rbp), %eax
+	push	%rax
+	mov	-312(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L117
+.L119:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L117:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$5, %eax
+	sub	%ebx, %eax
+	mov	%eax, -316(%rbp)
+	mov	%ebx, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -320(%rbp)
+	mov	-316(%rbp), %eax
+	push	%rax
+	mov	-320(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L122
+	mov	-316(%rbp), %eax
+	push	%rax
+	mov	-320(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L120
+.L122:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L120:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$5, %eax
+	add	%ebx, %eax
+	mov	%eax, -324(%rbp)
+	mov	%ebx, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -328(%rbp)
+	mov	-324(%rbp), %eax
+	push	%rax
+	mov	-328(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L125
+	mov	-324(%rbp), %eax
+	push	%rax
+	mov	-328(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L123
+.L125:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L123:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	sal	$3, %eax
+	mov	%eax, -332(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -336(%rbp)
+	mov	-332(%rbp), %eax
+	push	%rax
+	mov	-336(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L128
+	mov	-332(%rbp), %eax
+	push	%rax
+	mov	-336(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L126
+.L128:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L126:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	neg	%eax
+	mov	%eax, -340(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -344(%rbp)
+	mov	-340(%rbp), %eax
+	push	%rax
+	mov	-344(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L131
+	mov	-340(%rbp), %eax
+	push	%rax
+	mov	-344(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L129
+.L131:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L129:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	sal	$2, %eax
+	neg	%eax
+	mov	%eax, -348(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -352(%rbp)
+	mov	-348(%rbp), %eax
+	push	%rax
+	mov	-352(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L134
+	mov	-348(%rbp), %eax
+	push	%rax
+	mov	-352(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L132
+.L134:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L132:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$6, %eax
+	sub	%ebx, %eax
+	mov	%eax, -356(%rbp)
+	mov	%ebx, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -360(%rbp)
+	mov	-356(%rbp), %eax
+	push	%rax
+	mov	-360(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L137
+	mov	-356(%rbp), %eax
+	push	%rax
+	mov	-360(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L135
+.L137:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L135:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$6, %eax
+	add	%ebx, %eax
+	mov	%eax, -364(%rbp)
+	mov	%ebx, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -368(%rbp)
+	mov	-364(%rbp), %eax
+	push	%rax
+	mov	-368(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L140
+	mov	-364(%rbp), %eax
+	push	%rax
+	mov	-368(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L138
+.L140:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L138:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 8), %rax
+	sal	$3, %eax
+	mov	%eax, -372(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -376(%rbp)
+	mov	-372(%rbp), %eax
+	push	%rax
+	mov	-376(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L143
+	mov	-372(%rbp), %eax
+	push	%rax
+	mov	-376(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L141
+.L143:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L141:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	imul	$1000, %eax
+	mov	%eax, -380(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -384(%rbp)
+	mov	-380(%rbp), %eax
+	push	%rax
+	mov	-384(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L146
+	mov	-380(%rbp), %eax
+	push	%rax
+	mov	-384(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L144
+.L146:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L144:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$16, %eax
+	sub	%ebx, %eax
+	mov	%eax, -388(%rbp)
+	mov	%ebx, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -392(%rbp)
+	mov	-388(%rbp), %eax
+	push	%rax
+	mov	-392(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L149
+	mov	-388(%rbp), %eax
+	push	%rax
+	mov	-392(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L147
+.L149:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L147:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$31, %eax
+	sub	%ebx, %eax
+	mov	%eax, -396(%rbp)
+	mov	%ebx, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -400(%rbp)
+	mov	-396(%rbp), %eax
+	push	%rax
+	mov	-400(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L152
+	mov	-396(%rbp), %eax
+	push	%rax
+	mov	-400(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L150
+.L152:
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, errors(%rip)
+	pop	%rax
+.L150:
+	add	$408, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	$1, %rax
+	mov	%eax, divisors(%rip)
+	mov	$-1, %rax
+	mov	%eax, divisors+4(%rip)
+	mov	$2, %rax
+	mov	%eax, divisors+8(%rip)
+	mov	$-2, %rax
+	mov	%eax, divisors+12(%rip)
+	mov	$3, %rax
+	mov	%eax, divisors+16(%rip)
+	mov	$-3, %rax
+	mov	%eax, divisors+20(%rip)
+	mov	$4, %rax
+	mov	%eax, divisors+24(%rip)
+	mov	$5, %rax
+	mov	%eax, divisors+28(%rip)
+	mov	$6, %rax
+	mov	%eax, divisors+32(%rip)
+	mov	$7, %rax
+	mov	%eax, divisors+36(%rip)
+	mov	$-7, %rax
+	mov	%eax, divisors+40(%rip)
+	mov	$8, %rax
+	mov	%eax, divisors+44(%rip)
+	mov	$10, %rax
+	mov	%eax, divisors+48(%rip)
+	mov	$12, %rax
+	mov	%eax, divisors+52(%rip)
+	mov	$16, %rax
+	mov	%eax, divisors+56(%rip)
+	mov	$-16, %rax
+	mov	%eax, divisors+60(%rip)
+	mov	$25, %rax
+	mov	%eax, divisors+64(%rip)
+	mov	$100, %rax
+	mov	%eax, divisors+68(%rip)
+	mov	$125, %rax
+	mov	%eax, divisors+72(%rip)
+	mov	$641, %rax
+	mov	%eax, divisors+76(%rip)
+	mov	$1000, %rax
+	mov	%eax, divisors+80(%rip)
+	mov	$1024, %rax
+	mov	%eax, divisors+84(%rip)
+	mov	$65536, %rax
+	mov	%eax, divisors+88(%rip)
+	mov	$7777, %rax
+	mov	%eax, divisors+92(%rip)
+	mov	$1000000007, %rax
+	mov	%eax, divisors+96(%rip)
+	mov	$2147483647, %rax
+	mov	%eax, divisors+100(%rip)
+	mov	$-2147483647, %rax
+	mov	%eax, divisors+104(%rip)
+	mov	$1073741824, %rax
+	mov	%eax, divisors+108(%rip)
+	xor	%rax, %rax
+	mov	%eax, factors(%rip)
+	mov	$1, %rax
+	mov	%eax, factors+4(%rip)
+	mov	$-1, %rax
+	mov	%eax, factors+8(%rip)
+	mov	$2, %rax
+	mov	%eax, factors+12(%rip)
+	mov	$3, %rax
+	mov	%eax, factors+16(%rip)
+	mov	$5, %rax
+	mov	%eax, factors+20(%rip)
+	mov	$9, %rax
+	mov	%eax, factors+24(%rip)
+	mov	$10, %rax
+	mov	%eax, factors+28(%rip)
+	mov	$15, %rax
+	mov	%eax, factors+32(%rip)
+	mov	$17, %rax
+	mov	%eax, factors+36(%rip)
+	mov	$24, %rax
+	mov	%eax, factors+40(%rip)
+	mov	$31, %rax
+	mov	%eax, factors+44(%rip)
+	mov	$33, %rax
+	mov	%eax, factors+48(%rip)
+	mov	$40, %rax
+	mov	%eax, factors+52(%rip)
+	mov	$-5, %rax
+	mov	%eax, factors+56(%rip)
+	mov	$-12, %rax
+	mov	%eax, factors+60(%rip)
+	mov	$63, %rax
+	mov	%eax, factors+64(%rip)
+	mov	$65, %rax
+	mov	%eax, factors+68(%rip)
+	mov	$72, %rax
+	mov	%eax, factors+72(%rip)
+	mov	$1000, %rax
+	mov	%eax, factors+76(%rip)
+	mov	$65535, %rax
+	mov	%eax, factors+80(%rip)
+	mov	$2147483647, %rax
+	mov	%eax, factors+84(%rip)
+	mov	$-70000, %rax
+	mov	%eax, -4(%rbp)
+	jmp	.L153
+.L165:
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+.L153:
+	mov	-4(%rbp), %eax
+	cmp	$69997, %eax
+	jg	.L154
+	jmp	.L165
+.L166:
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+.L154:
+	mov	-4(%rbp), %eax
+	cmp	$70000, %eax
+	jle	.L166
+	mov	$1, %rax
+	mov	%eax, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	jmp	.L159
+.L167:
+	mov	-8(%rbp), %eax
+	imul	$1103515245, %eax
+	mov	$12345, %rbx
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	imul	$1103515245, %eax
+	mov	$12345, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	imul	$1103515245, %eax
+	mov	$12345, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	imul	$1103515245, %eax
+	mov	$12345, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+.L159:
+	mov	-4(%rbp), %eax
+	cmp	$99997, %eax
+	jge	.L160
+	jmp	.L167
+.L168:
+	mov	-8(%rbp), %eax
+	imul	$1103515245, %eax
+	mov	$12345, %rbx
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+.L160:
+	mov	-4(%rbp), %eax
+	cmp	$100000, %eax
+	jl	.L168
+	push	$2147483647
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	push	$2147483646
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	push	$-2147483647
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	push	$-2147483648
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	push	$1073741824
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	push	$-1073741824
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	check
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	$100, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655765, %eax
+	imul	%ebx
+	sub	%ebx, %edx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$28, %eax
+	add	%ebx, %eax
+	and	$-16, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,1963 @@
+.data
+.comm	a,80
+.comm	m,120
+.comm	pts,80
+.comm	t,52
+.text
+.globl	blocks
+blocks:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$100, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -76(%rbp)
+	cltq
+	lea	-72(%rbp, %rax, 4), %rax
+	mov	%rax, -88(%rbp)
+	jmp	.L1
+.L116:
+	mov	-76(%rbp), %eax
+	push	%rax
+	mov	-76(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -92(%rbp)
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -96(%rbp)
+	mov	-88(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-96(%rbp), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-76(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -76(%rbp)
+	pop	%rax
+	mov	-88(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -88(%rbp)
+	mov	-76(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1431655766, %eax
+	imul	%ebx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$3, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rdx
+	xor	%eax, %eax
+	cmp	%eax, %edx
+	je	.L117
+.L1:
+	mov	-76(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L116
+	xor	%rax, %rax
+	mov	%eax, -80(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -76(%rbp)
+	cltq
+	lea	-72(%rbp, %rax, 4), %rax
+	mov	%rax, -88(%rbp)
+	jmp	.L6
+.L117:
+	mov	-88(%rbp), %rbx
+	mov	-4(%rbx), %eax
+	sal	$1, %eax
+	mov	%eax, -100(%rbp)
+	lea	-4(%rbx), %rax
+	push	%rax
+	mov	-100(%rbp), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L1
+.L118:
+	mov	-88(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%eax, -96(%rbp)
+	mov	-76(%rbp), %eax
+	mov	%eax, -92(%rbp)
+	mov	-80(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-92(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -80(%rbp)
+	mov	-76(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -76(%rbp)
+	mov	-88(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -88(%rbp)
+	pop	%rax
+.L6:
+	mov	-76(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L118
+	mov	-80(%rbp), %eax
+	add	$100, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$164, %rsp
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -140(%rbp)
+	mov	-4(%rbp), %eax
+	cltq
+	lea	-96(%rbp, %rax, 4), %rax
+	mov	%rax, -148(%rbp)
+	jmp	.L9
+.L119:
+	mov	-140(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-148(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-140(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-148(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-140(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-148(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-140(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-148(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -140(%rbp)
+	mov	-148(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -148(%rbp)
+.L9:
+	mov	-4(%rbp), %eax
+	cmp	$17, %eax
+	jl	.L119
+	mov	-4(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -140(%rbp)
+	mov	-4(%rbp), %eax
+	cltq
+	lea	-96(%rbp, %rax, 4), %rax
+	mov	%rax, -148(%rbp)
+	jmp	.L12
+.L120:
+	mov	-140(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-148(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -140(%rbp)
+	pop	%rax
+	mov	-148(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -148(%rbp)
+.L12:
+	mov	-4(%rbp), %eax
+	cmp	$20, %eax
+	jl	.L120
+	mov	$1, %rax
+	mov	%eax, -4(%rbp)
+	cltq
+	lea	-96(%rbp, %rax, 4), %rax
+	mov	%rax, -140(%rbp)
+	mov	-4(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -148(%rbp)
+	jmp	.L15
+.L121:
+	mov	-140(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-148(%rbp), %rbx
+	mov	-4(%rbx), %eax
+	push	%rax
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -140(%rbp)
+	mov	-148(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -148(%rbp)
+.L15:
+	mov	-4(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L121
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	cltq
+	lea	-96(%rbp, %rax, 4), %rax
+	mov	%rax, -140(%rbp)
+	jmp	.L18
+.L122:
+	mov	-140(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-140(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-140(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-140(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-140(%rbp), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L18:
+	mov	-4(%rbp), %eax
+	cmp	$17, %eax
+	jl	.L122
+	mov	-4(%rbp), %eax
+	cltq
+	lea	-96(%rbp, %rax, 4), %rax
+	mov	%rax, -140(%rbp)
+	jmp	.L21
+.L123:
+	mov	-140(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	lea	-140(%rbp), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	pop	%rax
+.L21:
+	mov	-4(%rbp), %eax
+	cmp	$20, %eax
+	jl	.L123
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	mov	$19, %rax
+	mov	%eax, -4(%rbp)
+	cltq
+	lea	-96(%rbp, %rax, 4), %rax
+	mov	%rax, -140(%rbp)
+	jmp	.L24
+.L124:
+	mov	-16(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	mov	-8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	mov	-16(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	mov	-24(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-4(%rbp), %eax
+	mov	$-8, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	-32(%rbx), %rax
+	mov	%rax, -140(%rbp)
+.L24:
+	mov	-4(%rbp), %eax
+	cmp	$6, %eax
+	jge	.L124
+	mov	-4(%rbp), %eax
+	cltq
+	lea	-96(%rbp, %rax, 4), %rax
+	mov	%rax, -140(%rbp)
+	jmp	.L27
+.L125:
+	mov	-16(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	sub	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	-8(%rbx), %rax
+	mov	%rax, -140(%rbp)
+.L27:
+	mov	-4(%rbp), %eax
+	cmp	$0, %eax
+	jge	.L125
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-140(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	lea	pts(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 8), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L30
+.L126:
+	mov	-140(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-140(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-140(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-140(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-140(%rbp), %rbx
+	lea	16(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-140(%rbp), %rbx
+	lea	20(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-140(%rbp), %rbx
+	lea	24(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-140(%rbp), %rbx
+	lea	28(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	32(%rbx), %rax
+	mov	%rax, -140(%rbp)
+.L30:
+	mov	-4(%rbp), %eax
+	cmp	$7, %eax
+	jl	.L126
+	mov	-4(%rbp), %eax
+	lea	pts(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 8), %rax
+	mov	%rax, -140(%rbp)
+	jmp	.L33
+.L127:
+	mov	-140(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-140(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	8(%rbx), %rax
+	mov	%rax, -140(%rbp)
+	pop	%rax
+.L33:
+	mov	-4(%rbp), %eax
+	cmp	$10, %eax
+	jl	.L127
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	pts(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 8), %rax
+	mov	%rax, -140(%rbp)
+	jmp	.L36
+.L128:
+	mov	-140(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -144(%rbp)
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-144(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-140(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -144(%rbp)
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-144(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-140(%rbp), %rbx
+	mov	16(%rbx), %eax
+	push	%rax
+	mov	20(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -144(%rbp)
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-144(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-140(%rbp), %rbx
+	mov	24(%rbx), %eax
+	push	%rax
+	mov	28(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -144(%rbp)
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-144(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	32(%rbx), %rax
+	mov	%rax, -140(%rbp)
+.L36:
+	mov	-4(%rbp), %eax
+	cmp	$7, %eax
+	jl	.L128
+	mov	-4(%rbp), %eax
+	lea	pts(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 8), %rax
+	mov	%rax, -140(%rbp)
+	jmp	.L39
+.L129:
+	mov	-140(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -144(%rbp)
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-144(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	8(%rbx), %rax
+	mov	%rax, -140(%rbp)
+	pop	%rax
+.L39:
+	mov	-4(%rbp), %eax
+	cmp	$10, %eax
+	jl	.L129
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-140(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	lea	m(%rip), %rbx
+	imul	$24, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L42
+.L130:
+	mov	-148(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	sal	$1, %eax
+	mov	%eax, -132(%rbp)
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-148(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-132(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-148(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-132(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-148(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-132(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	mov	-148(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -148(%rbp)
+.L45:
+	mov	-8(%rbp), %eax
+	cmp	$3, %eax
+	jl	.L130
+	mov	-140(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -148(%rbp)
+	jmp	.L48
+.L131:
+	mov	-148(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	sal	$1, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	mov	-148(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -148(%rbp)
+	pop	%rax
+.L48:
+	mov	-8(%rbp), %eax
+	cmp	$6, %eax
+	jl	.L131
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	24(%rbx), %rax
+	mov	%rax, -140(%rbp)
+	pop	%rax
+.L42:
+	mov	-4(%rbp), %eax
+	cmp	$5, %eax
+	jge	.L43
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -148(%rbp)
+	jmp	.L45
+.L43:
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	m(%rip), %rbx
+	imul	$24, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	mov	%rax, -140(%rbp)
+	jmp	.L51
+.L132:
+	mov	-16(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	push	%rax
+	mov	-148(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	push	%rax
+	mov	-148(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	push	%rax
+	mov	-148(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	push	%rax
+	mov	-148(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	mov	-148(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -148(%rbp)
+.L54:
+	mov	-8(%rbp), %eax
+	cmp	$3, %eax
+	jl	.L132
+	mov	-140(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -148(%rbp)
+	jmp	.L57
+.L133:
+	mov	-16(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	push	%rax
+	mov	-148(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	mov	-148(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -148(%rbp)
+	pop	%rax
+.L57:
+	mov	-8(%rbp), %eax
+	cmp	$6, %eax
+	jl	.L133
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	24(%rbx), %rax
+	mov	%rax, -140(%rbp)
+	pop	%rax
+.L51:
+	mov	-4(%rbp), %eax
+	cmp	$5, %eax
+	jge	.L52
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -148(%rbp)
+	jmp	.L54
+.L52:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	t(%rip), %rax
+	push	%rax
+	mov	$12, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-4(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-140(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	lea	t+4(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L60
+.L134:
+	mov	-140(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%rax, %rbx
+	mov	$100, %rax
+	sub	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -140(%rbp)
+	pop	%rax
+.L60:
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	t(%rip), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L134
+	mov	t(%rip), %eax
+	mov	%eax, -148(%rbp)
+	lea	t+4(%rip), %rax
+	mov	%rax, -144(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -156(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -152(%rbp)
+	mov	-144(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -164(%rbp)
+	jmp	.L63
+.L135:
+	mov	-156(%rbp), %eax
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	mov	-152(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -152(%rbp)
+	mov	-164(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -164(%rbp)
+.L63:
+	mov	-152(%rbp), %eax
+	push	%rax
+	mov	-148(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L135
+	mov	-152(%rbp), %eax
+	mov	-144(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -164(%rbp)
+	jmp	.L66
+.L136:
+	mov	-156(%rbp), %eax
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	mov	-152(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -152(%rbp)
+	mov	-164(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -164(%rbp)
+	pop	%rax
+.L66:
+	mov	-152(%rbp), %eax
+	push	%rax
+	mov	-148(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L136
+	mov	-156(%rbp), %eax
+	mov	%eax, -136(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-140(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	cltq
+	lea	-128(%rbp, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L69
+.L137:
+	mov	-140(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	push	$1056964608
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+	mov	-140(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -140(%rbp)
+.L69:
+	mov	-4(%rbp), %eax
+	cmp	$8, %eax
+	jl	.L137
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	cltq
+	lea	-128(%rbp, %rax, 4), %rax
+	mov	%rax, -140(%rbp)
+.L71:
+	mov	-140(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-140(%rbp), %rax
+	push	%rax
+	mov	-140(%rbp), %rbx
+	lea	12(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	mov	-4(%rbp), %eax
+	cmp	$8, %eax
+	jl	.L71
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -140(%rbp)
+	jmp	.L74
+.L138:
+	mov	-140(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%eax, -144(%rbp)
+	cmp	$30, %eax
+	jg	.L75
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	and	$-2, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	cmp	$0, %eax
+	jne	.L76
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-144(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+.L76:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	mov	-140(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -140(%rbp)
+	pop	%rax
+.L74:
+	mov	-8(%rbp), %eax
+	cmp	$20, %eax
+	jl	.L138
+.L75:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-144(%rbp), %rax
+	push	%rax
+	lea	-96(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-156(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-152(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-164(%rbp), %rax
+	push	%rax
+	mov	-152(%rbp), %eax
+	mov	-144(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L81
+.L139:
+	mov	-156(%rbp), %eax
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	mov	-152(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -152(%rbp)
+	mov	-164(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -164(%rbp)
+.L81:
+	mov	-152(%rbp), %eax
+	cmp	$17, %eax
+	jl	.L139
+	mov	-152(%rbp), %eax
+	mov	-144(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -164(%rbp)
+	jmp	.L84
+.L140:
+	mov	-156(%rbp), %eax
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	mov	-152(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -152(%rbp)
+	mov	-164(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -164(%rbp)
+	pop	%rax
+.L84:
+	mov	-152(%rbp), %eax
+	cmp	$20, %eax
+	jl	.L140
+	mov	-156(%rbp), %eax
+	mov	%eax, -136(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-144(%rbp), %rax
+	push	%rax
+	lea	-76(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-156(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-152(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-164(%rbp), %rax
+	push	%rax
+	mov	-152(%rbp), %eax
+	mov	-144(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L87
+.L141:
+	mov	-156(%rbp), %eax
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	mov	-152(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -152(%rbp)
+	mov	-164(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -164(%rbp)
+.L87:
+	mov	-152(%rbp), %eax
+	cmp	$7, %eax
+	jl	.L141
+	mov	-152(%rbp), %eax
+	mov	-144(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -164(%rbp)
+	jmp	.L90
+.L142:
+	mov	-156(%rbp), %eax
+	push	%rax
+	mov	-164(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -156(%rbp)
+	mov	-152(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -152(%rbp)
+	mov	-164(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -164(%rbp)
+	pop	%rax
+.L90:
+	mov	-152(%rbp), %eax
+	cmp	$10, %eax
+	jl	.L142
+	mov	-156(%rbp), %eax
+	mov	%eax, -136(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-144(%rbp), %rax
+	push	%rax
+	lea	-96(%rbp), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-152(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-148(%rbp), %rax
+	push	%rax
+	mov	$19, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-160(%rbp), %rax
+	push	%rax
+	mov	-148(%rbp), %eax
+	mov	-144(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L93
+.L143:
+	mov	-152(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-160(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -152(%rbp)
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-160(%rbp), %rbx
+	mov	-4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -152(%rbp)
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-160(%rbp), %rbx
+	mov	-8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -152(%rbp)
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-160(%rbp), %rbx
+	mov	-12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -152(%rbp)
+	mov	-148(%rbp), %eax
+	mov	$-4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -148(%rbp)
+	mov	-160(%rbp), %rbx
+	lea	-16(%rbx), %rax
+	mov	%rax, -160(%rbp)
+.L93:
+	mov	-148(%rbp), %eax
+	cmp	$3, %eax
+	jge	.L143
+	mov	-148(%rbp), %eax
+	mov	-144(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -160(%rbp)
+	jmp	.L96
+.L144:
+	mov	-152(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-160(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -152(%rbp)
+	mov	-148(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	sub	$1, %eax
+	mov	%eax, -148(%rbp)
+	mov	-160(%rbp), %rbx
+	lea	-4(%rbx), %rax
+	mov	%rax, -160(%rbp)
+	pop	%rax
+.L96:
+	mov	-148(%rbp), %eax
+	cmp	$0, %eax
+	jge	.L144
+	mov	-152(%rbp), %eax
+	mov	%eax, -136(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$7
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	blocks
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$20
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	skipped
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$164, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	reversed
+reversed:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$28, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	mov	-16(%rbp), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	cltq
+	lea	(%rdi, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L99
+.L145:
+	mov	-20(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	-4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	-8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	-12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-16(%rbp), %eax
+	mov	$-4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	-16(%rbx), %rax
+	mov	%rax, -28(%rbp)
+.L99:
+	mov	-16(%rbp), %eax
+	cmp	$3, %eax
+	jge	.L145
+	mov	-16(%rbp), %eax
+	mov	-8(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L102
+.L146:
+	mov	-20(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	sub	$1, %eax
+	mov	%eax, -16(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	-4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	pop	%rax
+.L102:
+	mov	-16(%rbp), %eax
+	cmp	$0, %eax
+	jge	.L146
+	mov	-20(%rbp), %eax
+	add	$28, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	skipped
+skipped:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L105
+.L147:
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%eax, -20(%rbp)
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	cmp	$0, %eax
+	je	.CLskipped_next
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+.CLskipped_next:
+	mov	-16(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L105:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L147
+	mov	-16(%rbp), %eax
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	sum
+sum:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$32, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -24(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	cltq
+	lea	(%rdi, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L110
+.L148:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -32(%rbp)
+.L110:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L148
+	mov	-20(%rbp), %eax
+	mov	-8(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L113
+.L149:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -32(%rbp)
+	pop	%rax
+.L113:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L149
+	mov	-24(%rbp), %eax
+	add	$32, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
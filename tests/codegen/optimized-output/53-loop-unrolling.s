@@ -0,0 +1,1824 @@
+.data
+.comm	a,128
+.comm	b,128
+.text
+.globl	dot
+dot:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$48, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	mov	%rdx, -24(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -32(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -28(%rbp)
+	cltq
+	lea	(%rdi, %rax, 4), %rax
+	mov	%rax, -40(%rbp)
+	mov	-28(%rbp), %eax
+	cltq
+	lea	(%rsi, %rax, 4), %rax
+	mov	%rax, -48(%rbp)
+	jmp	.L1
+.L73:
+	mov	-32(%rbp), %eax
+	push	%rax
+	mov	-40(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-40(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-40(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-40(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -32(%rbp)
+	mov	-28(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -28(%rbp)
+	mov	-40(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -40(%rbp)
+	mov	-48(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -48(%rbp)
+.L1:
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L73
+	mov	-28(%rbp), %eax
+	mov	-8(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -40(%rbp)
+	mov	-28(%rbp), %eax
+	mov	-16(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -48(%rbp)
+	jmp	.L4
+.L74:
+	mov	-32(%rbp), %eax
+	push	%rax
+	mov	-40(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-48(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -32(%rbp)
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -28(%rbp)
+	mov	-40(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -40(%rbp)
+	pop	%rax
+	mov	-48(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -48(%rbp)
+.L4:
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L74
+	mov	-32(%rbp), %eax
+	add	$48, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	inclusive
+inclusive:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$36, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -24(%rbp)
+	mov	-8(%rbp), %eax
+	mov	%eax, -20(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L7
+.L75:
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -36(%rbp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-32(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -36(%rbp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-32(%rbp), %rbx
+	mov	16(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -36(%rbp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-32(%rbp), %rbx
+	mov	24(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	$6, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -36(%rbp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	mov	$8, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	32(%rbx), %rax
+	mov	%rax, -32(%rbp)
+.L7:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	$6, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jle	.L75
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L10
+.L76:
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -36(%rbp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	push	%rax
+	mov	-36(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	8(%rbx), %rax
+	mov	%rax, -32(%rbp)
+.L10:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jle	.L76
+	mov	-24(%rbp), %eax
+	add	$36, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$128, %rsp
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -88(%rbp)
+	mov	-4(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -96(%rbp)
+	jmp	.L13
+.L77:
+	mov	-88(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	$780903145, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$11, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-96(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%rax, %rbx
+	mov	$31, %rax
+	sub	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-88(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	$780903145, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$11, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-96(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	mov	$31, %rax
+	sub	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-88(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	$780903145, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$11, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-96(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	mov	$31, %rax
+	sub	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-88(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	$780903145, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$11, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-96(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	mov	$31, %rax
+	sub	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	mov	-88(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -88(%rbp)
+	mov	-96(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -96(%rbp)
+.L13:
+	mov	-4(%rbp), %eax
+	cmp	$29, %eax
+	jl	.L77
+	mov	-4(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -88(%rbp)
+	mov	-4(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -96(%rbp)
+	jmp	.L16
+.L78:
+	mov	-88(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%eax, %ebx
+	sal	$3, %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	$780903145, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$11, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-96(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%rax, %rbx
+	mov	$31, %rax
+	sub	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-88(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -88(%rbp)
+	pop	%rax
+	mov	-96(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -96(%rbp)
+.L16:
+	mov	-4(%rbp), %eax
+	cmp	$32, %eax
+	jl	.L78
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	imul	$16, %eax
+	cltq
+	lea	-76(%rbp, %rax, 1), %rax
+	mov	%rax, -88(%rbp)
+	jmp	.L19
+.L79:
+	mov	-88(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	sal	$2, %eax
+	mov	%eax, -80(%rbp)
+	xor	%rbx, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-88(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-80(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-88(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-80(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-88(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-80(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	$4, %rax
+	mov	%eax, -8(%rbp)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-88(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -88(%rbp)
+	pop	%rax
+.L19:
+	mov	-4(%rbp), %eax
+	cmp	$4, %eax
+	jl	.L79
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	mov	$3, %rax
+	mov	%eax, -4(%rbp)
+	imul	$16, %eax
+	cltq
+	lea	-76(%rbp, %rax, 1), %rax
+	mov	%rax, -88(%rbp)
+	jmp	.L22
+.L80:
+	mov	-12(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-88(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-88(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+	mov	$4, %rax
+	mov	%eax, -8(%rbp)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	sub	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-88(%rbp), %rbx
+	lea	-16(%rbx), %rax
+	mov	%rax, -88(%rbp)
+	pop	%rax
+.L22:
+	mov	-4(%rbp), %eax
+	cmp	$0, %eax
+	jge	.L80
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$10, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	a(%rip), %eax
+	push	%rax
+	mov	b+4(%rip), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	a+8(%rip), %eax
+	push	%rax
+	mov	b+12(%rip), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	a+16(%rip), %eax
+	push	%rax
+	mov	b+20(%rip), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	a+24(%rip), %eax
+	push	%rax
+	mov	b+28(%rip), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$8, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-12(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L25
+.L81:
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-108(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -108(%rbp)
+	mov	-120(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -120(%rbp)
+	mov	-128(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -128(%rbp)
+.L28:
+	mov	-108(%rbp), %eax
+	push	%rax
+	mov	-104(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L81
+	mov	-108(%rbp), %eax
+	mov	-92(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -120(%rbp)
+	mov	-108(%rbp), %eax
+	mov	-100(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -128(%rbp)
+	jmp	.L31
+.L82:
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-108(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -108(%rbp)
+	mov	-120(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -120(%rbp)
+	pop	%rax
+	mov	-128(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -128(%rbp)
+.L31:
+	mov	-108(%rbp), %eax
+	push	%rax
+	mov	-104(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L82
+	mov	-112(%rbp), %eax
+	mov	%eax, -84(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L25:
+	mov	-12(%rbp), %eax
+	cmp	$6, %eax
+	jg	.L26
+	mov	-12(%rbp), %eax
+	mov	%eax, -104(%rbp)
+	lea	b(%rip), %rax
+	mov	%rax, -100(%rbp)
+	lea	a(%rip), %rax
+	mov	%rax, -92(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -112(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -108(%rbp)
+	mov	-92(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -120(%rbp)
+	mov	-108(%rbp), %eax
+	mov	-100(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -128(%rbp)
+	jmp	.L28
+.L26:
+	lea	b(%rip), %rax
+	mov	%rax, -100(%rbp)
+	lea	a(%rip), %rax
+	mov	%rax, -92(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -112(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -108(%rbp)
+	mov	-92(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -120(%rbp)
+	mov	-108(%rbp), %eax
+	mov	-100(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -128(%rbp)
+	jmp	.L34
+.L83:
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-108(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -108(%rbp)
+	mov	-120(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -120(%rbp)
+	mov	-128(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -128(%rbp)
+.L34:
+	mov	-108(%rbp), %eax
+	cmp	$29, %eax
+	jl	.L83
+	mov	-108(%rbp), %eax
+	mov	-92(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -120(%rbp)
+	mov	-108(%rbp), %eax
+	mov	-100(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -128(%rbp)
+	jmp	.L37
+.L84:
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-108(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -108(%rbp)
+	mov	-120(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -120(%rbp)
+	pop	%rax
+	mov	-128(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -128(%rbp)
+.L37:
+	mov	-108(%rbp), %eax
+	cmp	$32, %eax
+	jl	.L84
+	mov	-112(%rbp), %eax
+	mov	%eax, -84(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-100(%rbp), %rax
+	push	%rax
+	lea	b+20(%rip), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-92(%rbp), %rax
+	push	%rax
+	lea	a+12(%rip), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-112(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-108(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-120(%rbp), %rax
+	push	%rax
+	mov	-108(%rbp), %eax
+	mov	-92(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-128(%rbp), %rax
+	push	%rax
+	mov	-108(%rbp), %eax
+	mov	-100(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L40
+.L85:
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-108(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -108(%rbp)
+	mov	-120(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -120(%rbp)
+	mov	-128(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -128(%rbp)
+.L40:
+	mov	-108(%rbp), %eax
+	cmp	$14, %eax
+	jl	.L85
+	mov	-108(%rbp), %eax
+	mov	-92(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -120(%rbp)
+	mov	-108(%rbp), %eax
+	mov	-100(%rbp), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -128(%rbp)
+	jmp	.L43
+.L86:
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-120(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-128(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-108(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -108(%rbp)
+	mov	-120(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -120(%rbp)
+	pop	%rax
+	mov	-128(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -128(%rbp)
+.L43:
+	mov	-108(%rbp), %eax
+	cmp	$17, %eax
+	jl	.L86
+	mov	-112(%rbp), %eax
+	mov	%eax, -84(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	$-1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L46
+.L87:
+	mov	-96(%rbp), %eax
+	sal	$1, %eax
+	push	%rax
+	mov	-104(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -96(%rbp)
+	sal	$1, %eax
+	push	%rax
+	mov	-104(%rbp), %rbx
+	mov	-12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -96(%rbp)
+	sal	$1, %eax
+	push	%rax
+	mov	-104(%rbp), %rbx
+	mov	-24(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -96(%rbp)
+	sal	$1, %eax
+	push	%rax
+	mov	-104(%rbp), %rbx
+	mov	-36(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -96(%rbp)
+	mov	-92(%rbp), %eax
+	mov	$-12, %rbx
+	add	%ebx, %eax
+	mov	%eax, -92(%rbp)
+	mov	-104(%rbp), %rbx
+	lea	-48(%rbx), %rax
+	mov	%rax, -104(%rbp)
+.L49:
+	mov	-92(%rbp), %eax
+	cmp	$9, %eax
+	jge	.L87
+	mov	-92(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -104(%rbp)
+	jmp	.L52
+.L88:
+	mov	-96(%rbp), %eax
+	sal	$1, %eax
+	push	%rax
+	mov	-104(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -96(%rbp)
+	mov	-92(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%eax, -92(%rbp)
+	mov	-104(%rbp), %rbx
+	lea	-12(%rbx), %rax
+	mov	%rax, -104(%rbp)
+.L52:
+	mov	-92(%rbp), %eax
+	cmp	$0, %eax
+	jge	.L88
+	mov	-96(%rbp), %eax
+	imul	$100, %eax
+	push	%rax
+	mov	-92(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -84(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L46:
+	mov	-12(%rbp), %eax
+	cmp	$9, %eax
+	jge	.L47
+	mov	-12(%rbp), %eax
+	mov	%eax, -88(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -96(%rbp)
+	mov	-88(%rbp), %eax
+	mov	%eax, -92(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -104(%rbp)
+	jmp	.L49
+.L47:
+	xor	%rax, %rax
+	mov	%eax, -100(%rbp)
+	mov	a(%rip), %eax
+	xor	%rbx, %rbx
+	sub	%ebx, %eax
+	mov	%eax, -104(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-104(%rbp), %eax
+	push	%rax
+	mov	-104(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -100(%rbp)
+	mov	%eax, -84(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-100(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-96(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-108(%rbp), %rax
+	push	%rax
+	mov	-96(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L55
+.L89:
+	mov	-108(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -100(%rbp)
+	mov	-108(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -100(%rbp)
+	mov	-108(%rbp), %rbx
+	mov	16(%rbx), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -100(%rbp)
+	mov	-108(%rbp), %rbx
+	mov	24(%rbx), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	$6, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -100(%rbp)
+	mov	-96(%rbp), %eax
+	mov	$8, %rbx
+	add	%ebx, %eax
+	mov	%eax, -96(%rbp)
+	mov	-108(%rbp), %rbx
+	lea	32(%rbx), %rax
+	mov	%rax, -108(%rbp)
+.L55:
+	mov	-96(%rbp), %eax
+	cmp	$14, %eax
+	jle	.L89
+	mov	-96(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -108(%rbp)
+	jmp	.L58
+.L90:
+	mov	-108(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -100(%rbp)
+	mov	-96(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%eax, -96(%rbp)
+	mov	-108(%rbp), %rbx
+	lea	8(%rbx), %rax
+	mov	%rax, -108(%rbp)
+.L58:
+	mov	-96(%rbp), %eax
+	cmp	$20, %eax
+	jle	.L90
+	mov	-100(%rbp), %eax
+	mov	%eax, -84(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-100(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-96(%rbp), %rax
+	push	%rax
+	mov	$3, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-108(%rbp), %rax
+	push	%rax
+	mov	-96(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L61
+.L91:
+	mov	-108(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -100(%rbp)
+	mov	-108(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -100(%rbp)
+	mov	-108(%rbp), %rbx
+	mov	16(%rbx), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -100(%rbp)
+	mov	-108(%rbp), %rbx
+	mov	24(%rbx), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	$6, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -100(%rbp)
+	mov	-96(%rbp), %eax
+	mov	$8, %rbx
+	add	%ebx, %eax
+	mov	%eax, -96(%rbp)
+	mov	-108(%rbp), %rbx
+	lea	32(%rbx), %rax
+	mov	%rax, -108(%rbp)
+.L61:
+	mov	-96(%rbp), %eax
+	cmp	$24, %eax
+	jle	.L91
+	mov	-96(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -108(%rbp)
+	jmp	.L64
+.L92:
+	mov	-108(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-96(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -112(%rbp)
+	mov	-100(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	push	%rax
+	mov	-112(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -100(%rbp)
+	mov	-96(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%eax, -96(%rbp)
+	mov	-108(%rbp), %rbx
+	lea	8(%rbx), %rax
+	mov	%rax, -108(%rbp)
+.L64:
+	mov	-96(%rbp), %eax
+	cmp	$30, %eax
+	jle	.L92
+	mov	-100(%rbp), %eax
+	mov	%eax, -84(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-100(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-84(%rbp), %rax
+	push	%rax
+	mov	-100(%rbp), %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-84(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$128, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	stride
+stride:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$24, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	mov	%eax, -12(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	jmp	.L67
+.L93:
+	mov	-16(%rbp), %eax
+	sal	$1, %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	sal	$1, %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	-12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	sal	$1, %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	-24(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	sal	$1, %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	-36(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	mov	$-12, %rbx
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+	mov	-24(%rbp), %rbx
+	lea	-48(%rbx), %rax
+	mov	%rax, -24(%rbp)
+.L67:
+	mov	-12(%rbp), %eax
+	cmp	$9, %eax
+	jge	.L93
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	jmp	.L70
+.L94:
+	mov	-16(%rbp), %eax
+	sal	$1, %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%eax, -12(%rbp)
+	mov	-24(%rbp), %rbx
+	lea	-12(%rbx), %rax
+	mov	%rax, -24(%rbp)
+.L70:
+	mov	-12(%rbp), %eax
+	cmp	$0, %eax
+	jge	.L94
+	mov	-16(%rbp), %eax
+	imul	$100, %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	add	$24, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,3566 @@
+.data
+.comm	a,76
+.comm	b,76
+.comm	c,76
+.comm	x,76
+.comm	y,76
+.text
+.globl	add
+add:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$36, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L1
+.L152:
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm0
+	mov	-12(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	%xmm0, (%rbx, %rax, 4)
+	mov	-12(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+.L1:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L152
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	mov	-12(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	jmp	.L3
+.L153:
+	mov	-20(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-36(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	mov	-20(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -20(%rbp)
+	pop	%rax
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+.L3:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L153
+	add	$36, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	axpy
+axpy:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$48, %rsp
+	mov	%rdi, -8(%rbp)
+	movss	%xmm0, -16(%rbp)
+	movss	%xmm1, -24(%rbp)
+	mov	$1, %rax
+	mov	%eax, -28(%rbp)
+	mov	-16(%rbp), %eax
+	movd	%eax, %xmm0
+	punpckldq	%xmm0, %xmm0
+	punpcklqdq	%xmm0, %xmm0
+	mov	-24(%rbp), %eax
+	movd	%eax, %xmm1
+	punpckldq	%xmm1, %xmm1
+	punpcklqdq	%xmm1, %xmm1
+	jmp	.L6
+.L154:
+	mov	-28(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm2
+	movdqa	%xmm0, %xmm3
+	mov	-28(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm4
+	mulps	%xmm4, %xmm3
+	mov	-28(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm4
+	divps	%xmm1, %xmm4
+	subps	%xmm4, %xmm3
+	addps	%xmm3, %xmm2
+	mov	-28(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	movups	%xmm2, (%rbx, %rax, 4)
+	mov	-28(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -28(%rbp)
+.L6:
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L154
+	mov	-28(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	mov	-28(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -44(%rbp)
+	jmp	.L8
+.L155:
+	mov	-36(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%eax, -48(%rbp)
+	mov	-44(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-48(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	mov	-48(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fdivr	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fsubr	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -28(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+	pop	%rax
+	mov	-44(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -44(%rbp)
+.L8:
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L155
+	add	$48, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	local
+local:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$64, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	cltq
+	lea	-56(%rbp, %rax, 4), %rax
+	mov	%rax, -64(%rbp)
+	jmp	.L11
+.L156:
+	mov	-64(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-64(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-64(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-64(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+	mov	-64(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -64(%rbp)
+.L11:
+	mov	-12(%rbp), %eax
+	cmp	$7, %eax
+	jl	.L156
+	mov	-12(%rbp), %eax
+	cltq
+	lea	-56(%rbp, %rax, 4), %rax
+	mov	%rax, -64(%rbp)
+	jmp	.L14
+.L157:
+	mov	-64(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	mov	-64(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -64(%rbp)
+	pop	%rax
+.L14:
+	mov	-12(%rbp), %eax
+	cmp	$10, %eax
+	jl	.L157
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	pxor	%xmm0, %xmm0
+	mov	$7, %rax
+	movd	%eax, %xmm1
+	punpckldq	%xmm1, %xmm1
+	punpcklqdq	%xmm1, %xmm1
+	jmp	.L17
+.L158:
+	mov	-12(%rbp), %eax
+	cltq
+	movdqu	-56(%rbp, %rax, 4), %xmm2
+	paddd	%xmm1, %xmm2
+	mov	-12(%rbp), %eax
+	cltq
+	movdqu	%xmm2, -56(%rbp, %rax, 4)
+	mov	-12(%rbp), %eax
+	cltq
+	movdqu	-56(%rbp, %rax, 4), %xmm2
+	paddd	%xmm2, %xmm0
+	mov	-12(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+.L17:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L158
+	movdqa	%xmm0, %xmm2
+	psrldq	$8, %xmm2
+	paddd	%xmm2, %xmm0
+	movdqa	%xmm0, %xmm2
+	psrlq	$32, %xmm2
+	paddd	%xmm2, %xmm0
+	movd	%xmm0, %eax
+	add	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	cltq
+	lea	-56(%rbp, %rax, 4), %rax
+	mov	%rax, -64(%rbp)
+	jmp	.L19
+.L159:
+	mov	-64(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	mov	$7, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-64(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	mov	-64(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -64(%rbp)
+	pop	%rax
+.L19:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L159
+	mov	-16(%rbp), %eax
+	add	$64, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$40, %rsp
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -12(%rbp)
+	mov	-4(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	mov	-4(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	mov	-4(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	jmp	.L22
+.L160:
+	mov	-12(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	lea	(%rax, %rax, 4), %rax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$30, %eax
+	add	%ebx, %eax
+	and	$-4, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	push	$1048576000
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-36(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	push	$1065353216
+	mov	-4(%rbp), %eax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fsubr	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-12(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -12(%rbp)
+	pop	%rax
+	mov	-20(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -20(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+.L22:
+	mov	-4(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L160
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L25
+.L161:
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm0
+	mov	-12(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	%xmm0, (%rbx, %rax, 4)
+	mov	-12(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+.L25:
+	mov	-12(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L161
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	mov	-12(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	jmp	.L27
+.L162:
+	mov	-20(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-36(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	mov	-20(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -20(%rbp)
+	pop	%rax
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+.L27:
+	mov	-12(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L162
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	mov	-8(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L30
+.L163:
+	mov	-16(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	4(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	4(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	8(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	8(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	12(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	12(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-32(%rbp), %rax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L30:
+	mov	-8(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L163
+	mov	-8(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	mov	-8(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L33
+.L164:
+	mov	-16(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	pop	%rax
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-32(%rbp), %rax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L33:
+	mov	-8(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L164
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L36
+.L165:
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm0
+	mov	-12(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	%xmm0, (%rbx, %rax, 4)
+	mov	-12(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+.L36:
+	mov	-12(%rbp), %eax
+	cmp	$0, %eax
+	jl	.L165
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	mov	-12(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	jmp	.L38
+.L166:
+	mov	-20(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-36(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	mov	-20(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -20(%rbp)
+	pop	%rax
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+.L38:
+	mov	-12(%rbp), %eax
+	cmp	$3, %eax
+	jl	.L166
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L41
+.L167:
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm0
+	mov	-12(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	%xmm0, (%rbx, %rax, 4)
+	mov	-12(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+.L41:
+	mov	-12(%rbp), %eax
+	cmp	$-3, %eax
+	jl	.L167
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	mov	-12(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	jmp	.L43
+.L168:
+	mov	-20(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-36(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	mov	-20(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -20(%rbp)
+	pop	%rax
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+.L43:
+	mov	-12(%rbp), %eax
+	cmp	$0, %eax
+	jl	.L168
+	mov	$-5, %rax
+	mov	%eax, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L46
+.L169:
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm0
+	mov	-12(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	%xmm0, (%rbx, %rax, 4)
+	mov	-12(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+.L46:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L169
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	mov	-12(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	jmp	.L48
+.L170:
+	mov	-20(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-36(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	mov	-20(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -20(%rbp)
+	pop	%rax
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+.L48:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L170
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	mov	-8(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L51
+.L171:
+	mov	-16(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	4(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	4(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	8(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	8(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	12(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	12(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-32(%rbp), %rax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L51:
+	mov	-8(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L171
+	mov	-8(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	mov	-8(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L54
+.L172:
+	mov	-16(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	pop	%rax
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-32(%rbp), %rax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L54:
+	mov	-8(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L172
+	xor	%rax, %rax
+	mov	%eax, -24(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	pxor	%xmm0, %xmm0
+	jmp	.L57
+.L173:
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+.L57:
+	mov	-20(%rbp), %eax
+	cmp	$15, %eax
+	jle	.L173
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	paddd	%xmm1, %xmm0
+	movdqa	%xmm0, %xmm1
+	psrlq	$32, %xmm1
+	paddd	%xmm1, %xmm0
+	movd	%xmm0, %eax
+	add	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L59
+.L174:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -32(%rbp)
+	pop	%rax
+.L59:
+	mov	-20(%rbp), %eax
+	cmp	$18, %eax
+	jle	.L174
+	mov	-24(%rbp), %eax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	$2, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	pxor	%xmm0, %xmm0
+	jmp	.L62
+.L175:
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+.L62:
+	mov	-20(%rbp), %eax
+	cmp	$5, %eax
+	jle	.L175
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	paddd	%xmm1, %xmm0
+	movdqa	%xmm0, %xmm1
+	psrlq	$32, %xmm1
+	paddd	%xmm1, %xmm0
+	movd	%xmm0, %eax
+	add	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L64
+.L176:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -32(%rbp)
+	pop	%rax
+.L64:
+	mov	-20(%rbp), %eax
+	cmp	$8, %eax
+	jle	.L176
+	mov	-24(%rbp), %eax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	$5, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	pxor	%xmm0, %xmm0
+	jmp	.L67
+.L177:
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+.L67:
+	mov	-20(%rbp), %eax
+	cmp	$2, %eax
+	jle	.L177
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	paddd	%xmm1, %xmm0
+	movdqa	%xmm0, %xmm1
+	psrlq	$32, %xmm1
+	paddd	%xmm1, %xmm0
+	movd	%xmm0, %eax
+	add	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L69
+.L178:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -32(%rbp)
+	pop	%rax
+.L69:
+	mov	-20(%rbp), %eax
+	cmp	$5, %eax
+	jle	.L178
+	mov	-24(%rbp), %eax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	$6, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	pxor	%xmm0, %xmm0
+	jmp	.L72
+.L179:
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+.L72:
+	mov	-20(%rbp), %eax
+	cmp	$2, %eax
+	jle	.L179
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	paddd	%xmm1, %xmm0
+	movdqa	%xmm0, %xmm1
+	psrlq	$32, %xmm1
+	paddd	%xmm1, %xmm0
+	movd	%xmm0, %eax
+	add	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L74
+.L180:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -32(%rbp)
+	pop	%rax
+.L74:
+	mov	-20(%rbp), %eax
+	cmp	$5, %eax
+	jle	.L180
+	mov	-24(%rbp), %eax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	pxor	%xmm0, %xmm0
+	jmp	.L77
+.L181:
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+.L77:
+	mov	-20(%rbp), %eax
+	cmp	$13, %eax
+	jle	.L181
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	paddd	%xmm1, %xmm0
+	movdqa	%xmm0, %xmm1
+	psrlq	$32, %xmm1
+	paddd	%xmm1, %xmm0
+	movd	%xmm0, %eax
+	add	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L79
+.L182:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -32(%rbp)
+	pop	%rax
+.L79:
+	mov	-20(%rbp), %eax
+	cmp	$16, %eax
+	jle	.L182
+	mov	-24(%rbp), %eax
+	mov	%eax, -8(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	$1073741824, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-12(%rbp), %eax
+	movd	%eax, %xmm0
+	punpckldq	%xmm0, %xmm0
+	punpcklqdq	%xmm0, %xmm0
+	jmp	.L82
+.L183:
+	mov	-16(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm1
+	mulps	%xmm0, %xmm1
+	mov	-16(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	%xmm1, (%rbx, %rax, 4)
+	mov	-16(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+.L82:
+	mov	-16(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L183
+	mov	-16(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	jmp	.L84
+.L184:
+	mov	-24(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -16(%rbp)
+	mov	-24(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -24(%rbp)
+	pop	%rax
+.L84:
+	mov	-16(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L184
+	mov	$-1090519040, %rax
+	mov	%eax, -12(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	movd	%eax, %xmm0
+	punpckldq	%xmm0, %xmm0
+	punpcklqdq	%xmm0, %xmm0
+	jmp	.L87
+.L185:
+	mov	-16(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm1
+	mulps	%xmm0, %xmm1
+	mov	-16(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	%xmm1, (%rbx, %rax, 4)
+	mov	-16(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+.L87:
+	mov	-16(%rbp), %eax
+	cmp	$3, %eax
+	jl	.L185
+	mov	-16(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	jmp	.L89
+.L186:
+	mov	-24(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -16(%rbp)
+	mov	-24(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -24(%rbp)
+	pop	%rax
+.L89:
+	mov	-16(%rbp), %eax
+	cmp	$6, %eax
+	jl	.L186
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	jmp	.L92
+.L187:
+	mov	-16(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L92:
+	mov	-8(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L187
+	mov	-8(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	jmp	.L95
+.L188:
+	mov	-16(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	pop	%rax
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L95:
+	mov	-8(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L188
+	push	$5
+	push	$19
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	xor	%eax, %eax
+	call	mixed
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$3
+	push	$7
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	xor	%eax, %eax
+	call	mixed
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-32(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L98
+.L189:
+	mov	-16(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	4(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	4(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	8(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	8(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	12(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	12(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-32(%rbp), %rax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L98:
+	mov	-8(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L189
+	mov	-8(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	mov	-8(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L101
+.L190:
+	mov	-16(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	pop	%rax
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-32(%rbp), %rax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L101:
+	mov	-8(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L190
+	mov	$1069547520, %rax
+	mov	%eax, -16(%rbp)
+	mov	$1077936128, %rax
+	mov	%eax, -12(%rbp)
+	mov	$1, %rax
+	mov	%eax, -20(%rbp)
+	mov	-12(%rbp), %eax
+	movd	%eax, %xmm0
+	punpckldq	%xmm0, %xmm0
+	punpcklqdq	%xmm0, %xmm0
+	mov	-16(%rbp), %eax
+	movd	%eax, %xmm1
+	punpckldq	%xmm1, %xmm1
+	punpcklqdq	%xmm1, %xmm1
+	jmp	.L104
+.L191:
+	mov	-20(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm2
+	movdqa	%xmm0, %xmm3
+	mov	-20(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm4
+	mulps	%xmm4, %xmm3
+	mov	-20(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm4
+	divps	%xmm1, %xmm4
+	subps	%xmm4, %xmm3
+	addps	%xmm3, %xmm2
+	mov	-20(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	movups	%xmm2, (%rbx, %rax, 4)
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+.L104:
+	mov	-20(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L191
+	mov	-20(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	mov	-20(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	jmp	.L106
+.L192:
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%eax, -40(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-40(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	mov	-40(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fdivr	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fsubr	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	pop	%rax
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+.L106:
+	mov	-20(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L192
+	mov	$1061158912, %rax
+	mov	%eax, -16(%rbp)
+	mov	$-1082130432, %rax
+	mov	%eax, -12(%rbp)
+	mov	$1, %rax
+	mov	%eax, -20(%rbp)
+	mov	-12(%rbp), %eax
+	movd	%eax, %xmm0
+	punpckldq	%xmm0, %xmm0
+	punpcklqdq	%xmm0, %xmm0
+	mov	-16(%rbp), %eax
+	movd	%eax, %xmm1
+	punpckldq	%xmm1, %xmm1
+	punpcklqdq	%xmm1, %xmm1
+	jmp	.L109
+.L193:
+	mov	-20(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm2
+	movdqa	%xmm0, %xmm3
+	mov	-20(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm4
+	mulps	%xmm4, %xmm3
+	mov	-20(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm4
+	divps	%xmm1, %xmm4
+	subps	%xmm4, %xmm3
+	addps	%xmm3, %xmm2
+	mov	-20(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	movups	%xmm2, (%rbx, %rax, 4)
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+.L109:
+	mov	-20(%rbp), %eax
+	cmp	$0, %eax
+	jl	.L193
+	mov	-20(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	mov	-20(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	jmp	.L111
+.L194:
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%eax, -40(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-40(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	mov	-40(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fdivr	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fsubr	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	pop	%rax
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+.L111:
+	mov	-20(%rbp), %eax
+	cmp	$3, %eax
+	jl	.L194
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	jmp	.L114
+.L195:
+	mov	-16(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-16(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L114:
+	mov	-8(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L195
+	mov	-8(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -16(%rbp)
+	mov	-8(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	jmp	.L117
+.L196:
+	mov	-16(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	pop	%rax
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L117:
+	mov	-8(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L196
+	push	$10
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	local
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$7
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	local
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	local
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	pxor	%xmm0, %xmm0
+	jmp	.L120
+.L197:
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+.L120:
+	mov	-20(%rbp), %eax
+	cmp	$0, %eax
+	jle	.L197
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	paddd	%xmm1, %xmm0
+	movdqa	%xmm0, %xmm1
+	psrlq	$32, %xmm1
+	paddd	%xmm1, %xmm0
+	movd	%xmm0, %eax
+	add	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L122
+.L198:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -32(%rbp)
+	pop	%rax
+.L122:
+	mov	-20(%rbp), %eax
+	cmp	$3, %eax
+	jle	.L198
+	mov	-24(%rbp), %eax
+	mov	%eax, -8(%rbp)
+	mov	%eax, %ebx
+	mov	$1374389535, %eax
+	imul	%ebx
+	sar	$5, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$100, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	add	$40, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	mixed
+mixed:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$56, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	mov	$1, %rax
+	mov	%eax, -24(%rbp)
+	mov	$2, %rax
+	mov	%eax, -28(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	pxor	%xmm0, %xmm0
+	pxor	%xmm1, %xmm1
+	mov	-16(%rbp), %eax
+	movd	%eax, %xmm2
+	punpckldq	%xmm2, %xmm2
+	punpcklqdq	%xmm2, %xmm2
+	mov	$12, %rax
+	movd	%eax, %xmm3
+	punpckldq	%xmm3, %xmm3
+	punpcklqdq	%xmm3, %xmm3
+	mov	$1, %rax
+	movd	%eax, %xmm4
+	punpckldq	%xmm4, %xmm4
+	punpcklqdq	%xmm4, %xmm4
+	jmp	.L125
+.L199:
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm5
+	mov	-20(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm6
+	psubd	%xmm6, %xmm5
+	movdqa	%xmm2, %xmm6
+	mov	-20(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm7
+	pand	%xmm3, %xmm7
+	por	%xmm7, %xmm6
+	pxor	%xmm6, %xmm5
+	mov	-20(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	movdqu	%xmm5, (%rbx, %rax, 4)
+	mov	-20(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm5
+	psubd	%xmm4, %xmm5
+	paddd	%xmm5, %xmm0
+	mov	-20(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm5
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm6
+	psubd	%xmm6, %xmm5
+	mov	-20(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	movdqu	%xmm5, (%rbx, %rax, 4)
+	mov	-20(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm5
+	paddd	%xmm5, %xmm1
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+.L125:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L199
+	movdqa	%xmm0, %xmm5
+	psrldq	$8, %xmm5
+	paddd	%xmm5, %xmm0
+	movdqa	%xmm0, %xmm5
+	psrlq	$32, %xmm5
+	paddd	%xmm5, %xmm0
+	movd	%xmm0, %eax
+	add	%eax, -24(%rbp)
+	movdqa	%xmm1, %xmm5
+	psrldq	$8, %xmm5
+	paddd	%xmm5, %xmm1
+	movdqa	%xmm1, %xmm5
+	psrlq	$32, %xmm5
+	paddd	%xmm5, %xmm1
+	movd	%xmm1, %eax
+	add	%eax, -28(%rbp)
+	mov	-20(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -36(%rbp)
+	mov	-20(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -44(%rbp)
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -52(%rbp)
+	jmp	.L127
+.L200:
+	mov	-36(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%eax, -56(%rbp)
+	mov	-44(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-52(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-56(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-56(%rbp), %eax
+	mov	$12, %rbx
+	and	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	or	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	xor	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-44(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	$1, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-52(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-44(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-28(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -28(%rbp)
+	mov	-20(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-36(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -36(%rbp)
+	mov	-44(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -44(%rbp)
+	mov	-52(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -52(%rbp)
+.L127:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L200
+	mov	-24(%rbp), %eax
+	imul	$1000, %eax
+	push	%rax
+	mov	-28(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	add	$56, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	print
+print:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$28, %rsp
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -12(%rbp)
+	mov	-4(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	mov	-4(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L130
+.L201:
+	mov	-12(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-12(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	mov	4(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	4(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-12(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	mov	8(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	8(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-12(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	mov	12(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	12(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	-12(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-28(%rbp), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L130:
+	mov	-4(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L201
+	mov	-4(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -12(%rbp)
+	mov	-4(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	mov	-4(%rbp), %eax
+	lea	c(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L133
+.L202:
+	mov	-12(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$100, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	mov	(%rbx), %eax
+	imul	$10000, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	-12(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	pop	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-28(%rbp), %rax
+	push	%rax
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L133:
+	mov	-4(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L202
+	add	$28, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	printf_x
+printf_x:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -12(%rbp)
+	mov	-4(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	jmp	.L136
+.L203:
+	mov	-12(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-12(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-12(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-12(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	-12(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	lea	16(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L136:
+	mov	-4(%rbp), %eax
+	cmp	$16, %eax
+	jl	.L203
+	mov	-4(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -12(%rbp)
+	mov	-4(%rbp), %eax
+	lea	y(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	jmp	.L139
+.L204:
+	mov	-12(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	push	$1120403456
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	-12(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	pop	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	-20(%rbp), %rbx
+	lea	4(%rbx), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+.L139:
+	mov	-4(%rbp), %eax
+	cmp	$19, %eax
+	jl	.L204
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	scale
+scale:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$28, %rsp
+	mov	%rdi, -8(%rbp)
+	movss	%xmm0, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	mov	-16(%rbp), %eax
+	movd	%eax, %xmm0
+	punpckldq	%xmm0, %xmm0
+	punpcklqdq	%xmm0, %xmm0
+	jmp	.L142
+.L205:
+	mov	-20(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	(%rbx, %rax, 4), %xmm1
+	mulps	%xmm0, %xmm1
+	mov	-20(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	movups	%xmm1, (%rbx, %rax, 4)
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+.L142:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L205
+	mov	-20(%rbp), %eax
+	lea	x(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L144
+.L206:
+	mov	-28(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	pop	%rax
+.L144:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L206
+	add	$28, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	sum
+sum:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$32, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -24(%rbp)
+	mov	-8(%rbp), %eax
+	mov	%eax, -20(%rbp)
+	pxor	%xmm0, %xmm0
+	jmp	.L147
+.L207:
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	movdqu	(%rbx, %rax, 4), %xmm1
+	paddd	%xmm1, %xmm0
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+.L147:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jle	.L207
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	paddd	%xmm1, %xmm0
+	movdqa	%xmm0, %xmm1
+	psrlq	$32, %xmm1
+	paddd	%xmm1, %xmm0
+	movd	%xmm0, %eax
+	add	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L149
+.L208:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -32(%rbp)
+	pop	%rax
+.L149:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jle	.L208
+	mov	-24(%rbp), %eax
+	add	$32, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,629 @@
+.data
+steps:
+	.long	0
+.text
+.globl	chain
+chain:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	cmp	$0, %eax
+	jl	.CLchain_done_negative
+	mov	-8(%rbp), %eax
+	cmp	$0, %eax
+	jne	.CLchain_done_positive
+	xor	%rax, %rax
+	jmp	.RLchain
+.CLchain_done_negative:
+	mov	$-1, %rax
+	jmp	.RLchain
+.CLchain_done_positive:
+	mov	$1, %rax
+.RLchain:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	collatz
+collatz:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$12, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L5
+.L7:
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+.L8:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L5:
+	mov	-8(%rbp), %eax
+	cmp	$1, %eax
+	je	.L6
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	and	$-2, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	cmp	$0, %eax
+	jne	.L7
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	sar	$1, %eax
+	mov	%eax, -8(%rbp)
+	jmp	.L8
+.L6:
+	mov	-12(%rbp), %eax
+	add	$12, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	halve
+halve:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$12, %rsp
+	movss	%xmm0, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L9
+.L42:
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1073741824
+	fld	(%rsp)
+	add	$8, %rsp
+	fdivr	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	mov	%eax, -8(%rbp)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L9:
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1065353216
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	ja	.L42
+.L11:
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1077936128
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	mov	%eax, -8(%rbp)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1092616192
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jb	.L11
+	mov	steps(%rip), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, steps(%rip)
+	mov	-8(%rbp), %eax
+	movd	%eax, %xmm0
+	add	$12, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	push	$50
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	search
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	steps(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$-3, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L14
+.L43:
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	chain
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	chain
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	chain
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	chain
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+.L14:
+	mov	-4(%rbp), %eax
+	cmp	$0, %eax
+	jg	.L15
+	jmp	.L43
+.L44:
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	chain
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+.L15:
+	mov	-4(%rbp), %eax
+	cmp	$3, %eax
+	jle	.L44
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	$1120403456, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L20
+.L45:
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$1073741824
+	fld	(%rsp)
+	add	$8, %rsp
+	fdivr	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	mov	%eax, -16(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	pop	%rax
+.L20:
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$1065353216
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	ja	.L45
+.L22:
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$1077936128
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	mov	%eax, -16(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	pop	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$1092616192
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jb	.L22
+	mov	steps(%rip), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, steps(%rip)
+	mov	-16(%rbp), %eax
+	mov	%eax, -12(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	pop	%rsp
+	add	$8, %rsp
+	mov	steps(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L25
+.L46:
+	mov	-4(%rbp), %eax
+	cmp	$60, %eax
+	jg	.L26
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	sub	%ebx, %eax
+	mov	%eax, -8(%rbp)
+.L27:
+	mov	-4(%rbp), %eax
+	cmp	$100, %eax
+	jge	.L26
+.L25:
+	mov	-4(%rbp), %eax
+	mov	$7, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$5, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	cmp	$0, %eax
+	je	.L27
+	jmp	.L46
+.L26:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	search
+search:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$24, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	mov	$2, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L32
+.L47:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	cmp	$0, %eax
+	je	.L36
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -16(%rbp)
+	pop	%rax
+.L35:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jle	.L47
+.L36:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jle	.L34
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	pop	%rax
+	lea	steps(%rip), %rax
+	push	%rax
+	mov	steps(%rip), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	collatz
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+.L34:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L32:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jge	.L33
+	mov	$2, %rax
+	mov	%eax, -16(%rbp)
+	jmp	.L35
+.L33:
+	mov	-20(%rbp), %eax
+	add	$24, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,16 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$0, %rsp
+	push	$7
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$0, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
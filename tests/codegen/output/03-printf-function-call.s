@@ -0,0 +1,32 @@
+.data
+.SL1:
+	.string	"testing...\n"
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$0, %rsp
+	lea	.SL1(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	printf
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$0, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,30 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$0, %rsp
+	push	$5
+	pop	%rax
+	neg	%eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$0, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,18 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$0, %rsp
+	push	$15
+	pop	%rax
+	push	%rax
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$0, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
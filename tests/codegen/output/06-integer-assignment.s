@@ -0,0 +1,24 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$4, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$5
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	$5
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$4, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
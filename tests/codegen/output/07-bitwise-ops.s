@@ -0,0 +1,123 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$4, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$5
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	not	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$5
+	push	$2
+	pop	%rbx
+	pop	%rax
+	or	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$6
+	push	$5
+	pop	%rbx
+	pop	%rax
+	and	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$5
+	push	$6
+	pop	%rbx
+	pop	%rax
+	xor	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$4, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,125 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$7
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$3
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,156 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$3
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$2
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	mov	%ebx, %ecx
+	sal	%cl, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$4
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	mov	%ebx, %ecx
+	sal	%cl, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$4
+	push	$1
+	pop	%rbx
+	pop	%rax
+	mov	%ebx, %ecx
+	sal	%cl, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$28
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$1
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	mov	%ebx, %ecx
+	sar	%cl, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rbx
+	pop	%rax
+	mov	%ebx, %ecx
+	sar	%cl, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$8
+	push	$3
+	pop	%rbx
+	pop	%rax
+	mov	%ebx, %ecx
+	sar	%cl, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
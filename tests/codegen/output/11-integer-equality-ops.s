@@ -0,0 +1,368 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$5
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$5
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L1
+	mov	$1, %eax
+	jmp	.L2
+.L1:
+	mov	$0, %eax
+.L2:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L3
+	mov	$1, %eax
+	jmp	.L4
+.L3:
+	mov	$0, %eax
+.L4:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$5, %eax
+	jne	.L5
+	mov	$1, %eax
+	jmp	.L6
+.L5:
+	mov	$0, %eax
+.L6:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$5, %eax
+	je	.L7
+	mov	$1, %eax
+	jmp	.L8
+.L7:
+	mov	$0, %eax
+.L8:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$5
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L9
+	mov	$1, %eax
+	jmp	.L10
+.L9:
+	mov	$0, %eax
+.L10:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$5
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L11
+	mov	$1, %eax
+	jmp	.L12
+.L11:
+	mov	$0, %eax
+.L12:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$3
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$4
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L13
+	mov	$1, %eax
+	jmp	.L14
+.L13:
+	mov	$0, %eax
+.L14:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L15
+	mov	$1, %eax
+	jmp	.L16
+.L15:
+	mov	$0, %eax
+.L16:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L17
+	mov	$1, %eax
+	jmp	.L18
+.L17:
+	mov	$0, %eax
+.L18:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L19
+	mov	$1, %eax
+	jmp	.L20
+.L19:
+	mov	$0, %eax
+.L20:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L21
+	mov	$1, %eax
+	jmp	.L22
+.L21:
+	mov	$0, %eax
+.L22:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$4
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L23
+	mov	$1, %eax
+	jmp	.L24
+.L23:
+	mov	$0, %eax
+.L24:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$5
+	pop	%rax
+	cmp	$5, %eax
+	jne	.L25
+	mov	$1, %eax
+	jmp	.L26
+.L25:
+	mov	$0, %eax
+.L26:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$5
+	pop	%rax
+	cmp	$5, %eax
+	je	.L27
+	mov	$1, %eax
+	jmp	.L28
+.L27:
+	mov	$0, %eax
+.L28:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
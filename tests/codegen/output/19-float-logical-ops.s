@@ -0,0 +1,432 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$4, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$1089260749
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	jne	.L1
+	mov	$1, %eax
+	jmp	.L2
+.L1:
+	mov	$0, %eax
+.L2:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	jne	.L3
+	mov	$1, %eax
+	jmp	.L4
+.L3:
+	mov	$0, %eax
+.L4:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L5
+	push	$1092930765
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L5
+	mov	$1, %eax
+	jmp	.L6
+.L5:
+	mov	$0, %eax
+.L6:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$1092930765
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L7
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L7
+	mov	$1, %eax
+	jmp	.L8
+.L7:
+	mov	$0, %eax
+.L8:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$1085695590
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L9
+	push	$1092930765
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L9
+	mov	$1, %eax
+	jmp	.L10
+.L9:
+	mov	$0, %eax
+.L10:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$1092930765
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L11
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L11
+	mov	$1, %eax
+	jmp	.L12
+.L11:
+	mov	$0, %eax
+.L12:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L13
+	push	$0
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L13
+	mov	$1, %eax
+	jmp	.L14
+.L13:
+	mov	$0, %eax
+.L14:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L15
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L15
+	mov	$1, %eax
+	jmp	.L16
+.L15:
+	mov	$0, %eax
+.L16:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	jne	.L19
+	push	$0
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L17
+.L19:
+	mov	$1, %eax
+	jmp	.L18
+.L17:
+	mov	$0, %eax
+.L18:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	jne	.L22
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L20
+.L22:
+	mov	$1, %eax
+	jmp	.L21
+.L20:
+	mov	$0, %eax
+.L21:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	jne	.L25
+	push	$0
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L23
+.L25:
+	mov	$1, %eax
+	jmp	.L24
+.L23:
+	mov	$0, %eax
+.L24:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	jne	.L28
+	mov	-4(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L26
+.L28:
+	mov	$1, %eax
+	jmp	.L27
+.L26:
+	mov	$0, %eax
+.L27:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$4, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,124 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$28, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	push	$7
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	-8(%rbp)
+	pop	%rax
+	mov	(%rax), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-16(%rbp), %rax
+	push	%rax
+	push	$10
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	lea	-16(%rbp), %rax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	-8(%rbp)
+	pop	%rax
+	mov	(%rax), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	lea	-28(%rbp), %rax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-28(%rbp), %rax
+	push	%rax
+	push	$1113676841
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	-24(%rbp)
+	pop	%rax
+	mov	(%rax), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-28(%rbp), %rax
+	push	%rax
+	pop	%rax
+	mov	(%rax), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$28, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,116 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$188, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$8
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-184(%rbp), %rax
+	push	%rax
+	push	$2
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-188(%rbp), %rax
+	push	%rax
+	push	$1
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	$1
+	mov	-184(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rax
+	imul	$32, %eax
+	cltq
+	lea	-180(%rbp, %rax, 1), %rax
+	push	%rax
+	mov	-188(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 8), %rax
+	push	%rax
+	push	$1082046546
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	$1
+	mov	-184(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rax
+	imul	$32, %eax
+	cltq
+	lea	-180(%rbp, %rax, 1), %rax
+	push	%rax
+	mov	-188(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 8), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$188, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
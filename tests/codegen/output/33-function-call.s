@@ -0,0 +1,273 @@
+.data
+.SL1:
+	.string	"a() called\n"
+.SL2:
+	.string	"b() called\n"
+.SL3:
+	.string	"c() called\n"
+.SL4:
+	.string	"d() called\n"
+.text
+.globl	a
+a:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$0, %rsp
+	lea	.SL1(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	printf
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+.RLa:
+	add	$0, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	b
+b:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	lea	.SL2(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	printf
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+.RLb:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	c
+c:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$0, %rsp
+	lea	.SL3(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	printf
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	push	$10
+	pop	%rax
+	jmp	.RLc
+.RLc:
+	add	$0, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	d
+d:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	movss	%xmm0, -8(%rbp)
+	lea	.SL4(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	printf
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$5
+	fildl	(%rsp)
+	fstp	(%rsp)
+	fld	(%rsp)
+	add	$8, %rsp
+	fmul	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	push	%rax
+	pop	%rax
+	movd	%eax, %xmm0
+	jmp	.RLd
+.RLd:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$0, %rsp
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	$0, %eax
+	call	a
+	add	$0, %rsp
+	pop	%rsp
+	add	$0, %rsp
+	push	$42
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	b
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	$0, %eax
+	call	c
+	add	$0, %rsp
+	pop	%rsp
+	add	$0, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	$0, %eax
+	call	c
+	add	$0, %rsp
+	pop	%rsp
+	add	$0, %rsp
+	push	%rax
+	push	$5
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$1056964608
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	d
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	movd	%xmm0, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	$0, %eax
+	call	c
+	add	$0, %rsp
+	pop	%rsp
+	add	$0, %rsp
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	d
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	movd	%xmm0, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$0, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
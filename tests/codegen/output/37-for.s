@@ -0,0 +1,246 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L1:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$5, %eax
+	jge	.L2
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+.L3:
+	mov	-4(%rbp), %eax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L1
+.L2:
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$1
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L4:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$1000, %eax
+	jg	.L5
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L6:
+	mov	-4(%rbp), %eax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L4
+.L5:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+.L7:
+	jmp	.L8
+	push	$999
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	jmp	.L8
+.L9:
+	jmp	.L7
+.L8:
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L10:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$100, %eax
+	jle	.L13
+	jmp	.L11
+	jmp	.L14
+.L13:
+.L14:
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	inc	%eax
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L12:
+	jmp	.L10
+.L11:
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L15:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$10, %eax
+	jge	.L16
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	jmp	.L17
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L17:
+	mov	-4(%rbp), %eax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L15
+.L16:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
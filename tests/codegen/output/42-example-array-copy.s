@@ -0,0 +1,600 @@
+.data
+.text
+.globl	array_copy
+array_copy:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$28, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	mov	%rdx, -24(%rbp)
+	lea	-28(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L1:
+	mov	-28(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jge	.L2
+	push	-8(%rbp)
+	mov	-28(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	push	%rax
+	push	-16(%rbp)
+	mov	-28(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L3:
+	mov	-28(%rbp), %eax
+	push	%rax
+	lea	-28(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L1
+.L2:
+.RLarray_copy:
+	add	$28, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$60, %rsp
+	lea	-48(%rbp), %rax
+	push	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-56(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-60(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L4:
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$5, %eax
+	jge	.L5
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cltq
+	lea	-20(%rbp, %rax, 4), %rax
+	push	%rax
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L6:
+	mov	-60(%rbp), %eax
+	push	%rax
+	lea	-60(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L4
+.L5:
+	push	$5
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	reset_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	lea	-60(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L7:
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$5, %eax
+	jge	.L8
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cltq
+	lea	-40(%rbp, %rax, 4), %rax
+	push	%rax
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cltq
+	mov	-20(%rbp, %rax, 4), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L9:
+	mov	-60(%rbp), %eax
+	push	%rax
+	lea	-60(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L7
+.L8:
+	push	$5
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	print_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	$5
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	reset_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	lea	-60(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L10:
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$5, %eax
+	jge	.L11
+	push	-56(%rbp)
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	push	%rax
+	push	-48(%rbp)
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L12:
+	mov	-60(%rbp), %eax
+	push	%rax
+	lea	-60(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L10
+.L11:
+	push	$5
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	print_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	$5
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	reset_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	lea	-60(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L13:
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$5, %eax
+	jge	.L14
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cltq
+	lea	-40(%rbp, %rax, 4), %rax
+	push	%rax
+	push	-48(%rbp)
+	mov	-60(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L15:
+	mov	-60(%rbp), %eax
+	push	%rax
+	lea	-60(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L13
+.L14:
+	push	$5
+	push	-56(%rbp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	print_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	$5
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	reset_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	$5
+	lea	-20(%rbp), %rax
+	push	%rax
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	16(%rax), %rdx
+	mov	$0, %eax
+	call	array_copy
+	add	$0, %rsp
+	pop	%rsp
+	add	$24, %rsp
+	push	$5
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	print_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	$5
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	reset_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	$5
+	push	-48(%rbp)
+	push	-56(%rbp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	16(%rax), %rdx
+	mov	$0, %eax
+	call	array_copy
+	add	$0, %rsp
+	pop	%rsp
+	add	$24, %rsp
+	push	$5
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	print_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	$5
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	reset_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	$5
+	lea	-20(%rbp), %rax
+	push	%rax
+	push	-56(%rbp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	16(%rax), %rdx
+	mov	$0, %eax
+	call	array_copy
+	add	$0, %rsp
+	pop	%rsp
+	add	$24, %rsp
+	push	$5
+	lea	-40(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	print_array
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$60, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	print_array
+print_array:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	lea	-20(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L16:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jge	.L17
+	push	-8(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+.L18:
+	mov	-20(%rbp), %eax
+	push	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L16
+.L17:
+.RLprint_array:
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	reset_array
+reset_array:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	lea	-20(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L19:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jge	.L20
+	push	-8(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L21:
+	mov	-20(%rbp), %eax
+	push	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L19
+.L20:
+.RLreset_array:
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
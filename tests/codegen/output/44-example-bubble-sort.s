@@ -0,0 +1,323 @@
+.data
+.text
+.globl	bubble_sort
+bubble_sort:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$28, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	lea	-28(%rbp), %rax
+	push	%rax
+	push	$1
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L1:
+	mov	-20(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jle	.L2
+	lea	-24(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L4:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jge	.L5
+	push	-8(%rbp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	push	-8(%rbp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jbe	.L7
+	push	-8(%rbp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	push	%rax
+	push	-8(%rbp)
+	mov	-24(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	swap
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	lea	-28(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	jmp	.L8
+.L7:
+.L8:
+.L6:
+	mov	-24(%rbp), %eax
+	push	%rax
+	lea	-24(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L4
+.L5:
+	mov	-28(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	je	.L9
+	jmp	.L2
+	jmp	.L10
+.L9:
+.L10:
+.L3:
+	mov	-20(%rbp), %eax
+	push	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	dec	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L1
+.L2:
+.RLbubble_sort:
+	add	$28, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$24, %rsp
+	lea	-20(%rbp), %rax
+	push	%rax
+	push	$1083388723
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-16(%rbp), %rax
+	push	%rax
+	push	$1102944666
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	push	$1085276160
+	fld	(%rsp)
+	fchs
+	fstp	(%rsp)
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$1089680179
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$1077516698
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	$5
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	bubble_sort
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	lea	-24(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L11:
+	mov	-24(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$5, %eax
+	jge	.L12
+	mov	-24(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cltq
+	mov	-20(%rbp, %rax, 4), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+.L13:
+	mov	-24(%rbp), %eax
+	push	%rax
+	lea	-24(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L11
+.L12:
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$24, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	swap
+swap:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	lea	-20(%rbp), %rax
+	push	%rax
+	push	-8(%rbp)
+	pop	%rax
+	mov	(%rax), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	pop	%rax
+	push	(%rax)
+	push	-16(%rbp)
+	pop	%rax
+	mov	(%rax), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-16(%rbp), %rax
+	push	%rax
+	pop	%rax
+	push	(%rax)
+	mov	-20(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.RLswap:
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
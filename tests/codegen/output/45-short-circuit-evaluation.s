@@ -0,0 +1,829 @@
+.data
+calls:
+	.long	0
+.text
+.globl	check
+check:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	calls(%rip), %eax
+	push	%rax
+	lea	calls(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	jmp	.RLcheck
+.RLcheck:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	checkf
+checkf:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	movss	%xmm0, -8(%rbp)
+	mov	calls(%rip), %eax
+	push	%rax
+	lea	calls(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	movd	%eax, %xmm0
+	jmp	.RLcheckf
+.RLcheckf:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$12, %rsp
+	lea	calls(%rip), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	je	.L1
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	je	.L1
+	mov	$1, %eax
+	jmp	.L2
+.L1:
+	mov	$0, %eax
+.L2:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	calls(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	calls(%rip), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L5
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	je	.L3
+.L5:
+	mov	$1, %eax
+	jmp	.L4
+.L3:
+	mov	$0, %eax
+.L4:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	calls(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	calls(%rip), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	je	.L9
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L8
+.L9:
+	push	$2
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	je	.L6
+.L8:
+	mov	$1, %eax
+	jmp	.L7
+.L6:
+	mov	$0, %eax
+.L7:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	calls(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	calls(%rip), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L10
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L10
+	push	$3
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	je	.L10
+	mov	$1, %eax
+	jmp	.L11
+.L10:
+	mov	$0, %eax
+.L11:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	calls(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	calls(%rip), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	checkf
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	movd	%xmm0, %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	je	.L12
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	je	.L12
+	mov	$1, %eax
+	jmp	.L13
+.L12:
+	mov	$0, %eax
+.L13:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$1069547520
+	fld	(%rsp)
+	fchs
+	fstp	(%rsp)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	checkf
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	movd	%xmm0, %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	jne	.L16
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	je	.L14
+.L16:
+	mov	$1, %eax
+	jmp	.L15
+.L14:
+	mov	$0, %eax
+.L15:
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	calls(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L17:
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$10, %eax
+	jge	.L18
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$7, %eax
+	je	.L18
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L17
+.L18:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-12(%rbp), %rax
+	push	%rax
+	push	$1075838976
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	push	$1073741824
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jbe	.L19
+	mov	-12(%rbp), %eax
+	push	%rax
+	push	$1077936128
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jae	.L19
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	jmp	.L20
+.L19:
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+.L20:
+	mov	-12(%rbp), %eax
+	push	%rax
+	fld	(%rsp)
+	add	$8, %rsp
+	ftst
+	fstsw	%ax
+	sahf
+	fstp	%st(0)
+	jne	.L21
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	jmp	.L22
+.L21:
+	mov	-12(%rbp), %eax
+	push	%rax
+	push	$1075838976
+	fld	(%rsp)
+	fld	8(%rsp)
+	add	$16, %rsp
+	fcompp
+	fstsw	%ax
+	sahf
+	jbe	.L25
+	push	$0
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	je	.L23
+.L25:
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	jmp	.L24
+.L23:
+.L24:
+.L22:
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$10
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L26:
+	mov	-8(%rbp), %eax
+	push	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	dec	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+.L28:
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$3, %eax
+	jle	.L29
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$5, %eax
+	jne	.L26
+.L29:
+.L27:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L30:
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$4, %eax
+	jge	.L31
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L31
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$2, %eax
+	jge	.L33
+	mov	-8(%rbp), %eax
+	push	%rax
+	jmp	.L34
+.L33:
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	neg	%eax
+	push	%rax
+.L34:
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+.L32:
+	mov	-8(%rbp), %eax
+	push	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L30
+.L31:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$5, %eax
+	jle	.L35
+	push	$10
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	jmp	.L36
+.L35:
+	push	$20
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+.L36:
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	calls(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	calls(%rip), %eax
+	push	%rax
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$12, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,1125 @@
+.data
+.comm	nodes,120
+.text
+.globl	conv
+conv:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	tofloat
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	movd	%xmm0, %eax
+	push	%rax
+	fld	(%rsp)
+	fisttpl	(%rsp)
+	pop	%rax
+	jmp	.RLconv
+.RLconv:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	count
+count:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$12, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L1
+	push	$0
+	pop	%rax
+	jmp	.RLcount
+	jmp	.L2
+.L1:
+.L2:
+	lea	-12(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L3:
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$3, %eax
+	jge	.L4
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$1, %eax
+	jne	.L6
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	count
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	jmp	.RLcount
+	jmp	.L7
+.L6:
+.L7:
+.L5:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L3
+.L4:
+	push	$1
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	jmp	.RLcount
+.RLcount:
+	add	$12, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	deref
+deref:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	lea	-20(%rbp), %rax
+	push	%rax
+	push	-8(%rbp)
+	pop	%rax
+	mov	(%rax), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L8
+	mov	-20(%rbp), %eax
+	push	%rax
+	pop	%rax
+	jmp	.RLderef
+	jmp	.L9
+.L8:
+.L9:
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	deref
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	pop	%rax
+	jmp	.RLderef
+.RLderef:
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	fields
+fields:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$32, %rsp
+	mov	%rdi, -8(%rbp)
+	lea	-12(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L10:
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$4, %eax
+	jge	.L11
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cltq
+	lea	-28(%rbp, %rax, 4), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	push	$10
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L12:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L10
+.L11:
+	push	$4
+	lea	-28(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	total
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	pop	%rax
+	jmp	.RLfields
+.RLfields:
+	add	$32, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	five
+five:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$40, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	mov	%rdx, -24(%rbp)
+	mov	%rcx, -32(%rbp)
+	mov	%r8, -40(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-32(%rbp), %eax
+	push	%rax
+	push	$4
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-40(%rbp), %eax
+	push	%rax
+	push	$5
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	jmp	.RLfive
+.RLfive:
+	add	$40, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	fsum
+fsum:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	movss	%xmm0, -16(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L13
+	mov	-16(%rbp), %eax
+	push	%rax
+	pop	%rax
+	movd	%eax, %xmm0
+	jmp	.RLfsum
+	jmp	.L14
+.L13:
+.L14:
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$1056964608
+	fld	(%rsp)
+	add	$8, %rsp
+	fadd	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	movss	8(%rax), %xmm0
+	mov	$1, %eax
+	call	fsum
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	movd	%xmm0, %eax
+	push	%rax
+	pop	%rax
+	movd	%eax, %xmm0
+	jmp	.RLfsum
+.RLfsum:
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	gcd
+gcd:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	mov	-16(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L15
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	jmp	.RLgcd
+	jmp	.L16
+.L15:
+.L16:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	gcd
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	pop	%rax
+	jmp	.RLgcd
+.RLgcd:
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	is_even
+is_even:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L17
+	push	$1
+	pop	%rax
+	jmp	.RLis_even
+	jmp	.L18
+.L17:
+.L18:
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	is_odd
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	jmp	.RLis_even
+.RLis_even:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	is_odd
+is_odd:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L19
+	push	$0
+	pop	%rax
+	jmp	.RLis_odd
+	jmp	.L20
+.L19:
+.L20:
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	is_even
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	pop	%rax
+	jmp	.RLis_odd
+.RLis_odd:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	length
+length:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	push	-8(%rbp)
+	pop	%rax
+	cmp	$0, %rax
+	jne	.L21
+	mov	-16(%rbp), %eax
+	push	%rax
+	pop	%rax
+	jmp	.RLlength
+	jmp	.L22
+.L21:
+.L22:
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	push	-8(%rbp)
+	pop	%rbx
+	push	4(%rbx)
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	length
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	pop	%rax
+	jmp	.RLlength
+.RLlength:
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$4, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L23:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$9, %eax
+	jge	.L24
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	nodes(%rip), %rbx
+	imul	$12, %eax
+	cltq
+	lea	4(%rbx, %rax, 1), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	lea	nodes(%rip), %rbx
+	imul	$12, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	push	%rax
+	pop	%rax
+.L25:
+	mov	-4(%rbp), %eax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L23
+.L24:
+	push	$462
+	push	$1071
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	gcd
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	push	$100000
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	sum
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	lea	nodes(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	length
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	push	$1000
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	movss	8(%rax), %xmm0
+	mov	$1, %eax
+	call	fsum
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	movd	%xmm0, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$100001
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	is_even
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$1
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	wide
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$5
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	deref
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$7
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	conv
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$100000
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	count
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$4
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	fields
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$18
+	push	$12
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	gcd
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$4, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	sum
+sum:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$24, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$0, %eax
+	jne	.L26
+	mov	-16(%rbp), %eax
+	push	%rax
+	pop	%rax
+	jmp	.RLsum
+	jmp	.L27
+.L26:
+.L27:
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	$0, %eax
+	call	sum
+	add	$0, %rsp
+	pop	%rsp
+	add	$16, %rsp
+	push	%rax
+	pop	%rax
+	jmp	.RLsum
+.RLsum:
+	add	$24, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	tofloat
+tofloat:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	movd	%eax, %xmm0
+	jmp	.RLtofloat
+.RLtofloat:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	total
+total:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$56, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	lea	-24(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L28:
+	mov	-20(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$8, %eax
+	jge	.L29
+	mov	-20(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cltq
+	lea	-56(%rbp, %rax, 4), %rax
+	push	%rax
+	push	$1
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L30:
+	mov	-20(%rbp), %eax
+	push	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L28
+.L29:
+	lea	-20(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L31:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jge	.L32
+	lea	-24(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %eax
+	push	%rax
+	push	-8(%rbp)
+	mov	-20(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cltq
+	mov	-56(%rbp, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L33:
+	mov	-20(%rbp), %eax
+	push	%rax
+	lea	-20(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L31
+.L32:
+	mov	-24(%rbp), %eax
+	push	%rax
+	pop	%rax
+	jmp	.RLtotal
+.RLtotal:
+	add	$56, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	wide
+wide:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	16(%rax), %rdx
+	mov	24(%rax), %rcx
+	mov	32(%rax), %r8
+	mov	$0, %eax
+	call	five
+	add	$0, %rsp
+	pop	%rsp
+	add	$40, %rsp
+	push	%rax
+	pop	%rax
+	jmp	.RLwide
+.RLwide:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
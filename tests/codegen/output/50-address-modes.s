@@ -0,0 +1,777 @@
+.data
+.comm	grid,80
+.comm	pairs,128
+.comm	points,96
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$100, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L1:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$8, %eax
+	jge	.L2
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	points(%rip), %rbx
+	imul	$12, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	points(%rip), %rbx
+	imul	$12, %eax
+	cltq
+	lea	4(%rbx, %rax, 1), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	points(%rip), %rbx
+	imul	$12, %eax
+	cltq
+	lea	8(%rbx, %rax, 1), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	fildl	(%rsp)
+	fstp	(%rsp)
+	push	$1073741824
+	fld	(%rsp)
+	add	$8, %rsp
+	fdivr	(%rsp)
+	fstp	(%rsp)
+	pop	%rax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L3:
+	mov	-4(%rbp), %eax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L1
+.L2:
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L4:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$4, %eax
+	jge	.L5
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L7:
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$5, %eax
+	jge	.L8
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	grid(%rip), %rbx
+	imul	$20, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$10
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L9:
+	mov	-8(%rbp), %eax
+	push	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L7
+.L8:
+.L6:
+	mov	-4(%rbp), %eax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L4
+.L5:
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L10:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$16, %eax
+	jge	.L11
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	pairs(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 8), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	pairs(%rip), %rbx
+	cltq
+	lea	4(%rbx, %rax, 8), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	pairs(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 8), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L12:
+	mov	-4(%rbp), %eax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L10
+.L11:
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L13:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$6, %eax
+	jge	.L14
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cltq
+	lea	-32(%rbp, %rax, 4), %rax
+	push	%rax
+	push	$100
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L15:
+	mov	-4(%rbp), %eax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L13
+.L14:
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L16:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$4, %eax
+	jge	.L17
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	imul	$12, %eax
+	cltq
+	lea	-80(%rbp, %rax, 1), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	imul	$12, %eax
+	cltq
+	lea	-76(%rbp, %rax, 1), %rax
+	push	%rax
+	push	$2
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L18:
+	mov	-4(%rbp), %eax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L16
+.L17:
+	lea	-92(%rbp), %rax
+	push	%rax
+	lea	points(%rip), %rax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-100(%rbp), %rax
+	push	%rax
+	lea	-32(%rbp), %rax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	points+64(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	points+44(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	movss	(%rax), %xmm0
+	mov	$1, %eax
+	call	__print_float
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	points+24(%rip), %eax
+	push	%rax
+	mov	points+88(%rip), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	grid+76(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	grid+44(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	pairs+120(%rip), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	pop	%rax
+	lea	pairs(%rip), %rbx
+	cltq
+	mov	4(%rbx, %rax, 8), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-32(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	-92(%rbp)
+	pop	%rbx
+	mov	76(%rbx), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	points+12(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rbx), %eax
+	push	%rax
+	push	-92(%rbp)
+	pop	%rbx
+	lea	48(%rbx), %rax
+	push	%rax
+	pop	%rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	-100(%rbp)
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-84(%rbp), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	sum_corners
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$3
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$2
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	grid(%rip), %rbx
+	imul	$20, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	pop	%rax
+	lea	grid(%rip), %rbx
+	imul	$20, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	mov	grid+28(%rip), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	grid+68(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$100, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	sum_corners
+sum_corners:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	mov	%rdi, -8(%rbp)
+	lea	-16(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L19:
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$4, %eax
+	jge	.L20
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	-8(%rbp)
+	pop	%rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	imul	$12, %eax
+	cltq
+	mov	(%rbx, %rax, 1), %eax
+	push	%rax
+	push	$10
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	push	-8(%rbp)
+	pop	%rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	imul	$12, %eax
+	cltq
+	mov	4(%rbx, %rax, 1), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L21:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L19
+.L20:
+	mov	-16(%rbp), %eax
+	push	%rax
+	push	-8(%rbp)
+	pop	%rbx
+	mov	40(%rbx), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	jmp	.RLsum_corners
+.RLsum_corners:
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
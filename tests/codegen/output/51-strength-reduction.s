@@ -0,0 +1,5476 @@
+.data
+checksum:
+	.long	0
+.comm	divisors,112
+errors:
+	.long	0
+.comm	factors,88
+.text
+.globl	check
+check:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$12, %rsp
+	mov	%rdi, -8(%rbp)
+	lea	-12(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L3
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L1
+.L3:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L2
+.L1:
+.L2:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2147483647
+	pop	%rax
+	neg	%eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L4
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L8
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L6
+.L8:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L7
+.L6:
+.L7:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	jmp	.L5
+.L4:
+.L5:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L11
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L9
+.L11:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L10
+.L9:
+.L10:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L14
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L12
+.L14:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L13
+.L12:
+.L13:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L17
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L15
+.L17:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L16
+.L15:
+.L16:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L20
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L18
+.L20:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L19
+.L18:
+.L19:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$4
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L23
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$4
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L21
+.L23:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L22
+.L21:
+.L22:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$4
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$4
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$5
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L26
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$5
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L24
+.L26:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L25
+.L24:
+.L25:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$5
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$5
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$6
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L29
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$6
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L27
+.L29:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L28
+.L27:
+.L28:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$6
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$6
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L32
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L30
+.L32:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L31
+.L30:
+.L31:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L35
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L33
+.L35:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L34
+.L33:
+.L34:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$8
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L38
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$8
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L36
+.L38:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L37
+.L36:
+.L37:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$8
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$8
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$10
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L41
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$10
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L39
+.L41:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L40
+.L39:
+.L40:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$10
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$10
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$12
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L44
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$12
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L42
+.L44:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L43
+.L42:
+.L43:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$12
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$12
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$16
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L47
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$16
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L45
+.L47:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L46
+.L45:
+.L46:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$16
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$16
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$16
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L50
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$16
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L48
+.L50:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L49
+.L48:
+.L49:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$16
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$16
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$25
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L53
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$25
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L51
+.L53:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L52
+.L51:
+.L52:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$25
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$25
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$100
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L56
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$100
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L54
+.L56:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L55
+.L54:
+.L55:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$100
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$100
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$125
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L59
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$125
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L57
+.L59:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L58
+.L57:
+.L58:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$125
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$125
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$641
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L62
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$641
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L60
+.L62:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L61
+.L60:
+.L61:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$641
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$641
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1000
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L65
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1000
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L63
+.L65:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L64
+.L63:
+.L64:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1000
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1000
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1024
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L68
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1024
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L66
+.L68:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L67
+.L66:
+.L67:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1024
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1024
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$65536
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L71
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$65536
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L69
+.L71:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L70
+.L69:
+.L70:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$65536
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$65536
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7777
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L74
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7777
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L72
+.L74:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L73
+.L72:
+.L73:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7777
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7777
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1000000007
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L77
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1000000007
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L75
+.L77:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L76
+.L75:
+.L76:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1000000007
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1000000007
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2147483647
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L80
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2147483647
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L78
+.L80:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L79
+.L78:
+.L79:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2147483647
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2147483647
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2147483647
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L83
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2147483647
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L81
+.L83:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L82
+.L81:
+.L82:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2147483647
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2147483647
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1073741824
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L86
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1073741824
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	divisors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L84
+.L86:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L85
+.L84:
+.L85:
+	lea	checksum(%rip), %rax
+	push	%rax
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1073741824
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1073741824
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$0
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L89
+	push	$0
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L87
+.L89:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L88
+.L87:
+.L88:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L92
+	push	$1
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L90
+.L92:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L91
+.L90:
+.L91:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L95
+	push	$1
+	pop	%rax
+	neg	%eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L93
+.L95:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L94
+.L93:
+.L94:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L98
+	push	$2
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L96
+.L98:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L97
+.L96:
+.L97:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L101
+	push	$3
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L99
+.L101:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L100
+.L99:
+.L100:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$5
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L104
+	push	$5
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L102
+.L104:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L103
+.L102:
+.L103:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$9
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L107
+	push	$9
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L105
+.L107:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L106
+.L105:
+.L106:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$10
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L110
+	push	$10
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L108
+.L110:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L109
+.L108:
+.L109:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$15
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L113
+	push	$15
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L111
+.L113:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L112
+.L111:
+.L112:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$17
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L116
+	push	$17
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L114
+.L116:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L115
+.L114:
+.L115:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$24
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L119
+	push	$24
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L117
+.L119:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L118
+.L117:
+.L118:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$31
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L122
+	push	$31
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L120
+.L122:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L121
+.L120:
+.L121:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$33
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L125
+	push	$33
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L123
+.L125:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L124
+.L123:
+.L124:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$40
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L128
+	push	$40
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L126
+.L128:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L127
+.L126:
+.L127:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$5
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L131
+	push	$5
+	pop	%rax
+	neg	%eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L129
+.L131:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L130
+.L129:
+.L130:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$12
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L134
+	push	$12
+	pop	%rax
+	neg	%eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L132
+.L134:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L133
+.L132:
+.L133:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$63
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L137
+	push	$63
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L135
+.L137:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L136
+.L135:
+.L136:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$65
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L140
+	push	$65
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L138
+.L140:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L139
+.L138:
+.L139:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$72
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L143
+	push	$72
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L141
+.L143:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L142
+.L141:
+.L142:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1000
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L146
+	push	$1000
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L144
+.L146:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L145
+.L144:
+.L145:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$65535
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L149
+	push	$65535
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L147
+.L149:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L148
+.L147:
+.L148:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$2147483647
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jne	.L152
+	push	$2147483647
+	mov	-8(%rbp), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	je	.L150
+.L152:
+	mov	errors(%rip), %eax
+	push	%rax
+	lea	errors(%rip), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L151
+.L150:
+.L151:
+	mov	-12(%rbp), %eax
+	push	%rax
+	lea	-12(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+.RLcheck:
+	add	$12, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	lea	divisors(%rip), %rax
+	push	%rax
+	push	$1
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+4(%rip), %rax
+	push	%rax
+	push	$1
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+8(%rip), %rax
+	push	%rax
+	push	$2
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+12(%rip), %rax
+	push	%rax
+	push	$2
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+16(%rip), %rax
+	push	%rax
+	push	$3
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+20(%rip), %rax
+	push	%rax
+	push	$3
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+24(%rip), %rax
+	push	%rax
+	push	$4
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+28(%rip), %rax
+	push	%rax
+	push	$5
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+32(%rip), %rax
+	push	%rax
+	push	$6
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+36(%rip), %rax
+	push	%rax
+	push	$7
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+40(%rip), %rax
+	push	%rax
+	push	$7
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+44(%rip), %rax
+	push	%rax
+	push	$8
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+48(%rip), %rax
+	push	%rax
+	push	$10
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+52(%rip), %rax
+	push	%rax
+	push	$12
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+56(%rip), %rax
+	push	%rax
+	push	$16
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+60(%rip), %rax
+	push	%rax
+	push	$16
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+64(%rip), %rax
+	push	%rax
+	push	$25
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+68(%rip), %rax
+	push	%rax
+	push	$100
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+72(%rip), %rax
+	push	%rax
+	push	$125
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+76(%rip), %rax
+	push	%rax
+	push	$641
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+80(%rip), %rax
+	push	%rax
+	push	$1000
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+84(%rip), %rax
+	push	%rax
+	push	$1024
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+88(%rip), %rax
+	push	%rax
+	push	$65536
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+92(%rip), %rax
+	push	%rax
+	push	$7777
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+96(%rip), %rax
+	push	%rax
+	push	$1000000007
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+100(%rip), %rax
+	push	%rax
+	push	$2147483647
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+104(%rip), %rax
+	push	%rax
+	push	$2147483647
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	divisors+108(%rip), %rax
+	push	%rax
+	push	$1073741824
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors(%rip), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+4(%rip), %rax
+	push	%rax
+	push	$1
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+8(%rip), %rax
+	push	%rax
+	push	$1
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+12(%rip), %rax
+	push	%rax
+	push	$2
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+16(%rip), %rax
+	push	%rax
+	push	$3
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+20(%rip), %rax
+	push	%rax
+	push	$5
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+24(%rip), %rax
+	push	%rax
+	push	$9
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+28(%rip), %rax
+	push	%rax
+	push	$10
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+32(%rip), %rax
+	push	%rax
+	push	$15
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+36(%rip), %rax
+	push	%rax
+	push	$17
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+40(%rip), %rax
+	push	%rax
+	push	$24
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+44(%rip), %rax
+	push	%rax
+	push	$31
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+48(%rip), %rax
+	push	%rax
+	push	$33
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+52(%rip), %rax
+	push	%rax
+	push	$40
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+56(%rip), %rax
+	push	%rax
+	push	$5
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+60(%rip), %rax
+	push	%rax
+	push	$12
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+64(%rip), %rax
+	push	%rax
+	push	$63
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+68(%rip), %rax
+	push	%rax
+	push	$65
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+72(%rip), %rax
+	push	%rax
+	push	$72
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+76(%rip), %rax
+	push	%rax
+	push	$1000
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+80(%rip), %rax
+	push	%rax
+	push	$65535
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	factors+84(%rip), %rax
+	push	%rax
+	push	$2147483647
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$70000
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L153:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$70000, %eax
+	jg	.L154
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+.L155:
+	mov	-4(%rbp), %eax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L153
+.L154:
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$1
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	push	$0
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+.L156:
+	mov	-4(%rbp), %eax
+	push	%rax
+	pop	%rax
+	cmp	$100000, %eax
+	jge	.L157
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$1103515245
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	push	%rax
+	push	$12345
+	pop	%rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+.L158:
+	mov	-4(%rbp), %eax
+	push	%rax
+	lea	-4(%rbp), %rax
+	push	%rax
+	pop	%rbx
+	mov	(%rsp), %eax
+	inc	%eax
+	mov	%eax, (%rbx)
+	pop	%rax
+	jmp	.L156
+.L157:
+	push	$2147483647
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$2147483646
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$2147483647
+	pop	%rax
+	neg	%eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$2147483647
+	pop	%rax
+	neg	%eax
+	push	%rax
+	push	$1
+	pop	%rbx
+	pop	%rax
+	sub	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$1073741824
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$1073741824
+	pop	%rax
+	neg	%eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	check
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	lea	-8(%rbp), %rax
+	push	%rax
+	push	$100
+	pop	%rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$7
+	pop	%rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$3
+	pop	%rax
+	neg	%eax
+	push	%rax
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	push	$16
+	pop	%rbx
+	pop	%rax
+	cdq
+	idiv	%ebx
+	mov	%edx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	push	%rax
+	pop	%rax
+	mov	errors(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	checksum(%rip), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	$0, %eax
+	call	__print_int
+	add	$0, %rsp
+	pop	%rsp
+	add	$8, %rsp
+	push	$0
+	pop	%rax
+	jmp	.RLmain
+.RLmain:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
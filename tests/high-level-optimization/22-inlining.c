@@ -0,0 +1,33 @@
+int sq(int x)
+{
+	return x * x;
+}
+
+int sign(int x)
+{
+	if (x < 0) {
+		return -1;
+	}
+
+	return x > 0;
+}
+
+void show(int a, float b)
+{
+	__print_int(a);
+	__print_float(b);
+}
+
+int main()
+{
+	int i;
+	int s = 0;
+
+	for (i = -2; i < 3; i++) {
+		s = sq(i) * sign(i) + s;
+	}
+
+	show(s, sq(3));
+
+	return sign(s) + 1;
+}
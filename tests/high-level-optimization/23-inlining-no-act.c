@@ -0,0 +1,40 @@
+int n;
+
+int fact(int x)
+{
+	if (x < 2) {
+		return 1;
+	}
+
+	return x * fact(x - 1);
+}
+
+int next()
+{
+	n++;
+	return n;
+}
+
+int odd(int x)
+{
+	return x % 2;
+}
+
+int main()
+{
+	int i;
+	int s = 0;
+
+	for (i = 0; i < 10; i++) {
+		if (odd(i)) {
+			continue;
+		}
+
+		s += next();
+	}
+
+	__print_int(s);
+	__print_int(fact(5));
+
+	return n;
+}
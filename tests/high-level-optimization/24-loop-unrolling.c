@@ -0,0 +1,31 @@
+int a[16];
+
+int sum(int n)
+{
+	int i;
+	int s = 0;
+
+	for (i = 0; i < n; i++) {
+		s = s + a[i];
+	}
+
+	return s;
+}
+
+int main()
+{
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		a[i] = i * 3;
+	}
+
+	for (i = 10; i > 4; i = i - 2) {
+		__print_int(i);
+	}
+
+	__print_int(sum(3));
+	__print_int(sum(4));
+
+	return i;
+}
@@ -0,0 +1,33 @@
+int a[10];
+int b[10];
+float x[10];
+
+int main()
+{
+	int i, n, s;
+	float k;
+
+	n = 10;
+	k = 0.5;
+
+	for (i = 0; i < n; i++) {
+		b[i] = i;
+		x[i] = i;
+	}
+
+	for (i = 0; i < n; i++) {
+		a[i] = b[i] + b[i] - 3;
+		x[i] *= k;
+	}
+
+	s = 0;
+	for (i = 2; i <= n - 1; i++) {
+		s = s + (a[i] & 7);
+	}
+
+	__print_int(s);
+	__print_float(x[3]);
+	__print_float(x[9]);
+
+	return a[9];
+}
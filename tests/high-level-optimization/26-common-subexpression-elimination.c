@@ -0,0 +1,42 @@
+struct point {
+	int x;
+	int y;
+};
+
+int m[16];
+
+int main()
+{
+	int i, j, n, s, t;
+	struct point pt;
+	struct point *p;
+
+	n = 4;
+	i = 1;
+	j = 2;
+	m[6] = 5;
+	m[7] = 9;
+
+	s = m[i * n + j] + m[i * n + j + 1];
+	m[i * n + j] = s * 2;
+	t = m[i * n + j];
+
+	__print_int(s);
+	__print_int(t);
+
+	p = &pt;
+	p->x = 3;
+	p->y = 4;
+
+	s = p->x * p->x + p->y * p->y;
+	if (s > 20) {
+		t = p->x * p->x - p->y;
+	} else {
+		t = p->y * p->y;
+	}
+
+	__print_int(s);
+	__print_int(t);
+
+	return (i * n + j) % 5;
+}
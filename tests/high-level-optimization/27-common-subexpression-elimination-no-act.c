@@ -0,0 +1,54 @@
+int g;
+int m[16];
+
+int bump(int v)
+{
+	g = g + v;
+	return g;
+}
+
+int main()
+{
+	int i, n, s, t;
+	int *p;
+
+	n = 4;
+	i = 1;
+	g = 3;
+	m[5] = 2;
+	m[6] = 7;
+
+	s = m[i * n + 1] * 3;
+	i = i + 1;
+	t = m[i * n + 1] * 3;
+	__print_int(s);
+	__print_int(t);
+
+	s = m[i * 3] * 2;
+	i++;
+	t = m[i * 3] * 2;
+	__print_int(s);
+	__print_int(t);
+
+	s = g * n;
+	bump(2);
+	t = g * n;
+	__print_int(s);
+	__print_int(t);
+
+	p = &m[5];
+	s = p[1] * n;
+	*p = 6;
+	p[1] = 1;
+	t = p[1] * n;
+	__print_int(s);
+	__print_int(t);
+
+	if (s > t) {
+		s = m[n + 2] * n;
+	}
+	t = m[n + 2] * n;
+	__print_int(t);
+
+	return s - t;
+}
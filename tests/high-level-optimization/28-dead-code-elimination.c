@@ -0,0 +1,74 @@
+int sum(int n)
+{
+	int s, i, t;
+
+	s = 0;
+	i = 0;
+	t = 5;
+	goto check;
+	s = 1000;
+body:
+	s = s + i;
+	i++;
+check:
+	if (i < n) goto body;
+	goto done;
+	t = t + 1;
+	__print_int(t);
+done:
+	return s + t;
+}
+
+int branches(int n)
+{
+	int r, k;
+
+	r = 0;
+	if (0) {
+		r = 100;
+	} else {
+		r = 1;
+	}
+	if (1) r = r + 10;
+	while (0) {
+		r = 999;
+	}
+	for (k = 7; 0; k++) {
+		r = 555;
+	}
+	r = r + k;
+	switch (2) {
+	case 1:
+		r = r + 50;
+		break;
+	case 2:
+		r = r + 20;
+		break;
+	default:
+		r = r + 70;
+	}
+	return r;
+}
+
+int stores(int a, int b)
+{
+	int x, y, z;
+
+	x = a * b;
+	y = x + 1;
+	x = 4;
+	a + b;
+	y = x;
+	y++;
+	z = 8;
+	return y + z;
+}
+
+int main()
+{
+	__print_int(sum(5));
+	__print_int(sum(0));
+	__print_int(branches(3));
+	__print_int(stores(3, 4));
+	return 0;
+}
@@ -0,0 +1,58 @@
+int g;
+int calls;
+
+int side(int x)
+{
+	calls = calls + 1;
+	return x * 2;
+}
+
+int jumps(int n)
+{
+	int r;
+
+	r = 0;
+	if (0) {
+inside:
+		r = r + 1000;
+		return r;
+	}
+	r = r + 1;
+	if (n > 5) goto inside;
+	return r;
+}
+
+int escapes(int a)
+{
+	int w, *p, x;
+
+	p = &w;
+	w = 3;
+	*p = *p + 1;
+	g = a;
+	x = side(a);
+	x = 1;
+	return w + x;
+}
+
+int loop(int n)
+{
+	int i, acc;
+
+	acc = 0;
+	for (i = 0; i < n; i++) {
+		acc = acc + i;
+	}
+	return acc;
+}
+
+int main()
+{
+	__print_int(jumps(3));
+	__print_int(jumps(8));
+	__print_int(escapes(3));
+	__print_int(calls);
+	__print_int(g);
+	__print_int(loop(10));
+	return 0;
+}
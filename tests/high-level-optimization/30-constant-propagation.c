@@ -0,0 +1,25 @@
+int main()
+{
+	int i, n, k, s, c;
+
+	n = 4;
+	s = 0;
+
+	for (i = 0; i < n; i++) {
+		s = s + i;
+	}
+
+	c = s > 5;
+
+	if (c) {
+		k = 3;
+	} else {
+		k = 3;
+		s = s - 1;
+	}
+
+	__print_int(s * k);
+	__print_int(n + k);
+
+	return k;
+}
@@ -0,0 +1,36 @@
+int g;
+
+void set(int *p)
+{
+	*p = 7;
+}
+
+int main()
+{
+	int i, k, n, s;
+
+	g = 2;
+	set(&g);
+
+	if (g > 5) {
+		k = 3;
+	} else {
+		k = 4;
+	}
+
+	n = 1;
+	set(&n);
+
+	s = 0;
+	for (i = 0; i < 3; i++) {
+		s = s + k;
+		k = 2;
+	}
+
+
+	__print_int(g + k);
+	__print_int(n);
+	__print_int(s);
+
+	return k;
+}
@@ -0,0 +1,31 @@
+int f(int a, int b, int c)
+{
+	int x, y, z;
+
+	x = 0;
+	y = 0;
+
+	if (c) {
+		x = a * b;
+	} else {
+		y = a * b + 1;
+	}
+
+	z = a * b + b * b;
+
+	while (c > 0) {
+		z = z + b * b * c;
+		c = c - 1;
+	}
+
+	return x + y + z + b * b * c;
+}
+
+int main()
+{
+	__print_int(f(3, 4, 1));
+	__print_int(f(3, 4, 0));
+	__print_int(f(2, 5, 3));
+
+	return f(1, 1, 0);
+}
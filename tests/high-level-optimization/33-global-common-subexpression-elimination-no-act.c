@@ -0,0 +1,44 @@
+int m[4];
+
+int g(int a)
+{
+	m[a] = m[a] + 1;
+	return a;
+}
+
+int f(int a, int b, int c)
+{
+	int x, y;
+
+	x = 0;
+
+	if (c) {
+		x = a * b;
+	}
+
+	y = a * b;
+
+	if (c > 1) {
+		x = m[a] + b;
+	} else {
+		x = x + m[a];
+	}
+
+	g(a);
+	y = y + m[a] + b;
+
+	if (c) {
+		a = a + 1;
+	}
+
+	return x + y + a * b;
+}
+
+int main()
+{
+	__print_int(f(1, 4, 1));
+	__print_int(f(2, 3, 0));
+	__print_int(f(3, 2, 2));
+
+	return 0;
+}
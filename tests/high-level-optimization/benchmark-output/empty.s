@@ -0,0 +1,7 @@
+.data
+.text
+.globl	main
+main:
+	xor	%rax, %rax
+	ret
+.end
@@ -0,0 +1,926 @@
+.data
+.comm	a,1024
+.comm	b,1024
+.comm	m,256
+.text
+.globl	dot
+dot:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$32, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L1
+.L43:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	4(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	8(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	12(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -12(%rbp)
+	mov	-24(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -24(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -32(%rbp)
+.L1:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L43
+	mov	-12(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -24(%rbp)
+	mov	-12(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L4
+.L44:
+	mov	-16(%rbp), %eax
+	push	%rax
+	mov	-24(%rbp), %rbx
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-32(%rbp), %rbx
+	mov	(%rbx), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	mov	-24(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -24(%rbp)
+	pop	%rax
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -32(%rbp)
+.L4:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L44
+	mov	-16(%rbp), %eax
+	add	$32, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$32, %rsp
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	mov	-4(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L7
+.L45:
+	mov	-20(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$5, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$5, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$5, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$5, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	mov	-20(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -20(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -28(%rbp)
+.L7:
+	mov	-4(%rbp), %eax
+	cmp	$253, %eax
+	jl	.L45
+	mov	-4(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -20(%rbp)
+	mov	-4(%rbp), %eax
+	lea	b(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L10
+.L46:
+	mov	-20(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$5, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-20(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -20(%rbp)
+	pop	%rax
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+.L10:
+	mov	-4(%rbp), %eax
+	cmp	$256, %eax
+	jl	.L46
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	m(%rip), %rbx
+	imul	$32, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	mov	%rax, -20(%rbp)
+	jmp	.L13
+.L47:
+	mov	-28(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -28(%rbp)
+.L16:
+	mov	-8(%rbp), %eax
+	cmp	$5, %eax
+	jl	.L47
+	mov	-20(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L19
+.L48:
+	mov	-28(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+	pop	%rax
+.L19:
+	mov	-8(%rbp), %eax
+	cmp	$8, %eax
+	jl	.L48
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-20(%rbp), %rbx
+	lea	32(%rbx), %rax
+	mov	%rax, -20(%rbp)
+	pop	%rax
+.L13:
+	mov	-4(%rbp), %eax
+	cmp	$8, %eax
+	jge	.L14
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	mov	-20(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	pop	%rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L16
+.L14:
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	jmp	.L22
+.L49:
+	mov	-32(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-32(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-32(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-24(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -32(%rbp)
+.L25:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L49
+	mov	-24(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -32(%rbp)
+	jmp	.L28
+.L50:
+	mov	-32(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-20(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-24(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -24(%rbp)
+	mov	-32(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -32(%rbp)
+.L28:
+	mov	-24(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L50
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	pop	%rax
+.L22:
+	mov	-8(%rbp), %eax
+	cmp	$100, %eax
+	jge	.L23
+	lea	-12(%rbp), %rax
+	push	%rax
+	mov	-12(%rbp), %eax
+	push	%rax
+	push	$255
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	dot
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	xor	%eax, %eax
+	call	trace
+	pop	%rsp
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-20(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-16(%rbp), %rax
+	push	%rax
+	mov	$256, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-24(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	lea	-32(%rbp), %rax
+	push	%rax
+	mov	-24(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	pop	%rbx
+	mov	%rax, (%rbx)
+	jmp	.L25
+.L23:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$32, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	scale
+scale:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$28, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	%rsi, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L31
+.L51:
+	mov	-28(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	push	%rax
+	mov	4(%rbx), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	8(%rbx), %rax
+	push	%rax
+	mov	8(%rbx), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-28(%rbp), %rbx
+	lea	12(%rbx), %rax
+	push	%rax
+	mov	12(%rbx), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	16(%rbx), %rax
+	mov	%rax, -28(%rbp)
+.L31:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	$3, %rbx
+	sub	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L51
+	mov	-20(%rbp), %eax
+	lea	a(%rip), %rbx
+	cltq
+	lea	(%rbx, %rax, 4), %rax
+	mov	%rax, -28(%rbp)
+	jmp	.L34
+.L52:
+	mov	-28(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	(%rbx), %eax
+	push	%rax
+	mov	-16(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	imul	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-20(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -20(%rbp)
+	mov	-28(%rbp), %rbx
+	lea	4(%rbx), %rax
+	mov	%rax, -28(%rbp)
+.L34:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	-8(%rbp), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	cmp	%ebx, %eax
+	jl	.L52
+	add	$28, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	trace
+trace:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$16, %rsp
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	lea	m(%rip), %rbx
+	imul	$32, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	mov	%rax, -16(%rbp)
+	jmp	.L37
+.L53:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	32(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	64(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$2, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	96(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	mov	$3, %rbx
+	add	%ebx, %eax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+	mov	-16(%rbp), %rbx
+	lea	128(%rbx), %rax
+	mov	%rax, -16(%rbp)
+.L37:
+	mov	-4(%rbp), %eax
+	cmp	$5, %eax
+	jl	.L53
+	mov	-4(%rbp), %eax
+	lea	m(%rip), %rbx
+	imul	$32, %eax
+	cltq
+	lea	(%rbx, %rax, 1), %rax
+	mov	%rax, -16(%rbp)
+	jmp	.L40
+.L54:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-16(%rbp), %rbx
+	lea	(%rbx), %rax
+	push	%rax
+	mov	-4(%rbp), %eax
+	pop	%rbx
+	cltq
+	mov	(%rbx, %rax, 4), %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	mov	-16(%rbp), %rbx
+	lea	32(%rbx), %rax
+	mov	%rax, -16(%rbp)
+	pop	%rax
+.L40:
+	mov	-4(%rbp), %eax
+	cmp	$8, %eax
+	jl	.L54
+	mov	-8(%rbp), %eax
+	add	$16, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,59 @@
+/*
+ * count-branches program [arguments] - runs the program single-stepping it
+ * and prints the number of conditional branches and of instructions executed
+ * outside shared libraries. x86-64 Linux only.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/ptrace.h>
+#include <sys/user.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+int main(int argc, char *argv[])
+{
+	unsigned long long Branches = 0, Instructions = 0;
+	int Status;
+	pid_t Child;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s program [arguments]\n", argv[0]);
+		return 1;
+	}
+
+	Child = fork();
+	if (Child == 0) {
+		ptrace(PTRACE_TRACEME, 0, 0, 0);
+		dup2(open("/dev/null", O_WRONLY), 1);
+		execv(argv[1], argv + 1);
+		return 1;
+	}
+
+	waitpid(Child, &Status, 0);
+
+	while (!WIFEXITED(Status)) {
+		struct user_regs_struct Regs;
+
+		ptrace(PTRACE_GETREGS, Child, 0, &Regs);
+
+		if (Regs.rip < 0x7f0000000000ULL) {
+			long Word = ptrace(PTRACE_PEEKTEXT, Child, (void *) Regs.rip, 0);
+			unsigned char First = Word & 0xFF, Second = (Word >> 8) & 0xFF;
+
+			Instructions++;
+
+			// jcc rel8 or jcc rel32
+			if ((First >= 0x70 && First <= 0x7F) || (First == 0x0F && Second >= 0x80 && Second <= 0x8F)) {
+				Branches++;
+			}
+		}
+
+		ptrace(PTRACE_SINGLESTEP, Child, 0, 0);
+		waitpid(Child, &Status, 0);
+	}
+
+	printf("%llu %llu\n", Branches, Instructions);
+
+	return 0;
+}
@@ -0,0 +1,62 @@
+int a[256];
+int b[256];
+int m[8][8];
+
+int dot(int n)
+{
+	int i, s;
+
+	s = 0;
+	for (i = 0; i < n; i++) {
+		s = s + a[i] * b[i];
+	}
+
+	return s;
+}
+
+void scale(int n, int k)
+{
+	int i;
+
+	for (i = 0; i < n; i = i + 1) {
+		a[i] = a[i] * k;
+	}
+}
+
+int trace()
+{
+	int i, s;
+
+	s = 0;
+	for (i = 0; i < 8; i++) {
+		s = s + m[i][i];
+	}
+
+	return s;
+}
+
+int main()
+{
+	int i, j, r;
+
+	for (i = 0; i < 256; i++) {
+		a[i] = i % 7;
+		b[i] = i % 5;
+	}
+
+	for (i = 0; i < 8; i++) {
+		for (j = 0; j < 8; j++) {
+			m[i][j] = i + j;
+		}
+	}
+
+	r = 0;
+	for (j = 0; j < 100; j++) {
+		r = r + dot(255) + trace();
+		scale(256, 1);
+	}
+
+	__print_int(r);
+
+	return 0;
+}
@@ -0,0 +1,54 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$20, %esp
+	xor	%eax, %eax
+	mov	%eax, -16(%ebp)
+	mov	$3, %eax
+	lea	(%eax, %eax, 4), %eax
+	push	%eax
+	mov	$3, %ebx
+	mov	$2, %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	pop	%eax
+	cdq
+	idiv	%ebx
+	push	%eax
+	mov	$4, %eax
+	sal	$1, %eax
+	mov	%eax, %ebx
+	pop	%eax
+	add	%ebx, %eax
+	mov	%eax, -8(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L1
+.L4:
+	mov	-4(%ebp), %eax
+	sal	$1, %eax
+	mov	%eax, -16(%ebp)
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+.L1:
+	mov	-4(%ebp), %eax
+	cmp	$5, %eax
+	jl	.L4
+	push	-8(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$20, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
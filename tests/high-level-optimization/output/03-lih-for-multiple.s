@@ -0,0 +1,34 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$16, %esp
+	mov	$10, %eax
+	sal	$2, %eax
+	mov	$10, %ebx
+	imul	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L1
+.L4:
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+.L1:
+	mov	-4(%ebp), %eax
+	cmp	$5, %eax
+	jl	.L4
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$16, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
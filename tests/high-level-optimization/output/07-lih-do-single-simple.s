@@ -0,0 +1,29 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$8, %esp
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	mov	$5, %eax
+	mov	%eax, -8(%ebp)
+.L1:
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+	mov	-4(%ebp), %eax
+	cmp	$5, %eax
+	jl	.L1
+	push	-8(%ebp)
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$8, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
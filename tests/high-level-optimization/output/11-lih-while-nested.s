@@ -0,0 +1,56 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$24, %esp
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	mov	$4, %eax
+	lea	(%eax, %eax, 4), %eax
+	mov	%eax, -12(%ebp)
+	jmp	.L1
+.L5:
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	mov	%ebx, %eax
+	add	$1, %eax
+	mov	%eax, -8(%ebp)
+.L3:
+	mov	-8(%ebp), %eax
+	cmp	$5, %eax
+	jl	.L5
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+.L1:
+	mov	-4(%ebp), %eax
+	cmp	$5, %eax
+	jge	.L2
+	xor	%eax, %eax
+	mov	%eax, -8(%ebp)
+	mov	-4(%ebp), %eax
+	lea	(%eax, %eax, 4), %eax
+	mov	%eax, -16(%ebp)
+	jmp	.L3
+.L2:
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-20(%ebp)
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$24, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
@@ -0,0 +1,51 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$24, %esp
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	mov	$4, %eax
+	lea	(%eax, %eax, 4), %eax
+	mov	%eax, -12(%ebp)
+.L1:
+	xor	%eax, %eax
+	mov	%eax, -8(%ebp)
+	mov	-4(%ebp), %eax
+	lea	(%eax, %eax, 4), %eax
+	mov	%eax, -16(%ebp)
+.L4:
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	mov	%ebx, %eax
+	add	$1, %eax
+	mov	%eax, -8(%ebp)
+	cmp	$5, %eax
+	jl	.L4
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+	mov	-4(%ebp), %eax
+	cmp	$5, %eax
+	jl	.L1
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-20(%ebp)
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$24, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
@@ -0,0 +1,143 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$24, %esp
+	mov	$4, %eax
+	mov	%eax, -24(%ebp)
+	lea	(%eax, %eax, 4), %eax
+	mov	%eax, -12(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L1
+.L17:
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+.L1:
+	mov	-4(%ebp), %eax
+	cmp	$5, %eax
+	jge	.L2
+	xor	%eax, %eax
+	mov	%eax, -8(%ebp)
+	mov	-4(%ebp), %eax
+	lea	(%eax, %eax, 4), %eax
+	mov	%eax, -16(%ebp)
+.L4:
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	mov	%ebx, %eax
+	add	$1, %eax
+	mov	%eax, -8(%ebp)
+	cmp	$5, %eax
+	jl	.L4
+	jmp	.L17
+.L2:
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-20(%ebp)
+	call	__print_int
+	add	$4, %esp
+	mov	-24(%ebp), %eax
+	lea	(%eax, %eax, 4), %eax
+	mov	%eax, -12(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L7
+.L18:
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	mov	%ebx, %eax
+	add	$1, %eax
+	mov	%eax, -8(%ebp)
+.L10:
+	mov	-8(%ebp), %eax
+	cmp	$5, %eax
+	jl	.L18
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+.L7:
+	mov	-4(%ebp), %eax
+	cmp	$5, %eax
+	jge	.L8
+	xor	%eax, %eax
+	mov	%eax, -8(%ebp)
+	mov	-4(%ebp), %eax
+	lea	(%eax, %eax, 4), %eax
+	mov	%eax, -16(%ebp)
+	jmp	.L10
+.L8:
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-20(%ebp)
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	mov	-24(%ebp), %eax
+	lea	(%eax, %eax, 4), %eax
+	mov	%eax, -12(%ebp)
+	jmp	.L12
+.L19:
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	mov	%ebx, %eax
+	add	$1, %eax
+	add	$1, %eax
+	mov	%eax, -8(%ebp)
+.L14:
+	mov	-8(%ebp), %eax
+	cmp	$5, %eax
+	jl	.L19
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+.L12:
+	mov	-4(%ebp), %eax
+	cmp	$5, %eax
+	jge	.L13
+	mov	-4(%ebp), %eax
+	lea	(%eax, %eax, 4), %eax
+	mov	%eax, -16(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -8(%ebp)
+	jmp	.L14
+.L13:
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-20(%ebp)
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$24, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
@@ -0,0 +1,32 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$8, %esp
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L1
+.L4:
+	mov	-4(%ebp), %eax
+	sal	$1, %eax
+	mov	%eax, -8(%ebp)
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+.L1:
+	mov	-4(%ebp), %eax
+	cmp	$5, %eax
+	jl	.L4
+	push	-8(%ebp)
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$8, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
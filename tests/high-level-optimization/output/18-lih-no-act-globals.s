@@ -0,0 +1,33 @@
+.data
+b:
+	.long	0
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$4, %esp
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L1
+.L4:
+	mov	$7, %eax
+	mov	%eax, b
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+.L1:
+	mov	-4(%ebp), %eax
+	cmp	$5, %eax
+	jl	.L4
+	push	b
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$4, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
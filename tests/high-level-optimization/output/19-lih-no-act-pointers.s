@@ -0,0 +1,37 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$12, %esp
+	mov	$2, %eax
+	mov	%eax, -8(%ebp)
+	lea	-8(%ebp), %eax
+	mov	%eax, -12(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L1
+.L4:
+	mov	-8(%ebp), %eax
+	lea	(%eax, %eax, 4), %eax
+	mov	-12(%ebp), %ebx
+	mov	%eax, (%ebx)
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+.L1:
+	mov	-4(%ebp), %eax
+	cmp	$5, %eax
+	jl	.L4
+	push	-8(%ebp)
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$12, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
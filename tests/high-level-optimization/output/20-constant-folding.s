@@ -0,0 +1,182 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$16, %esp
+	mov	$-1114678231, %eax
+	mov	%eax, -16(%ebp)
+	mov	$-27, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_float
+	add	$4, %esp
+	push	$0
+	fildl	(%esp)
+	fstp	(%esp)
+	pop	%eax
+	mov	%eax, -16(%ebp)
+	xor	%eax, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_float
+	add	$4, %esp
+	push	$1
+	fildl	(%esp)
+	fstp	(%esp)
+	pop	%eax
+	mov	%eax, -16(%ebp)
+	mov	$1, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_float
+	add	$4, %esp
+	mov	$-6, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	mov	$1091043328, %eax
+	mov	%eax, -16(%ebp)
+	mov	$8, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_float
+	add	$4, %esp
+	mov	$1079404134, %eax
+	mov	%eax, -16(%ebp)
+	mov	$3, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_float
+	add	$4, %esp
+	mov	$1099515822, %eax
+	mov	%eax, -16(%ebp)
+	mov	$15, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_float
+	add	$4, %esp
+	mov	$1075838976, %eax
+	mov	%eax, -16(%ebp)
+	mov	$2, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_float
+	add	$4, %esp
+	mov	$1, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	mov	$16, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	mov	$14, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	$1
+	call	__print_int
+	add	$4, %esp
+	push	$0
+	call	__print_int
+	add	$4, %esp
+	push	$0
+	call	__print_int
+	add	$4, %esp
+	push	$1
+	call	__print_int
+	add	$4, %esp
+	push	$1
+	call	__print_int
+	add	$4, %esp
+	push	$0
+	call	__print_int
+	add	$4, %esp
+	push	$1
+	call	__print_int
+	add	$4, %esp
+	push	$0
+	call	__print_int
+	add	$4, %esp
+	push	$1
+	call	__print_int
+	add	$4, %esp
+	push	$0
+	call	__print_int
+	add	$4, %esp
+	push	$1
+	call	__print_int
+	add	$4, %esp
+	push	$0
+	call	__print_int
+	add	$4, %esp
+	push	$7
+	call	__print_int
+	add	$4, %esp
+	push	$4
+	call	__print_int
+	add	$4, %esp
+	push	$3
+	call	__print_int
+	add	$4, %esp
+	mov	$1076677837, %eax
+	mov	%eax, -16(%ebp)
+	mov	$7, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_float
+	add	$4, %esp
+	mov	$1081291571, %eax
+	mov	%eax, -16(%ebp)
+	mov	$2, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_float
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$16, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	pr
+pr:
+	mov	4(%esp), %ecx
+	mov	8(%esp), %edx
+	call	.FCpr
+	ret
+.FCpr:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$8, %esp
+	mov	%edx, -8(%ebp)
+	push	%ecx
+	call	__print_int
+	add	$4, %esp
+	push	-8(%ebp)
+	call	__print_float
+	add	$4, %esp
+	add	$8, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
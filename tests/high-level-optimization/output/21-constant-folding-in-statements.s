@@ -0,0 +1,110 @@
+.data
+.text
+.globl	func
+func:
+	mov	$7, %eax
+	ret
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$16, %esp
+	mov	$1093538939, %eax
+	mov	%eax, -16(%ebp)
+	mov	$12, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_float
+	add	$4, %esp
+	push	$1
+	call	__print_int
+	add	$4, %esp
+	mov	$4, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L1
+.L13:
+	push	-4(%ebp)
+	call	__print_int
+	add	$4, %esp
+	mov	-4(%ebp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+.L1:
+	mov	-4(%ebp), %eax
+	cmp	$10, %eax
+	jl	.L13
+	mov	$10, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L4
+.L14:
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	sub	$1, %eax
+	mov	%eax, -4(%ebp)
+	call	__print_int
+	add	$4, %esp
+.L4:
+	mov	-4(%ebp), %eax
+	cmp	$6, %eax
+	jg	.L14
+	mov	$3, %eax
+	mov	%eax, -4(%ebp)
+.L6:
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	call	__print_int
+	add	$4, %esp
+	mov	-4(%ebp), %eax
+	cmp	$7, %eax
+	jl	.L6
+	mov	$7, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	mov	$12, %edx
+	xor	%eax, %eax
+	cmp	%eax, %edx
+	je	.L9
+	mov	$1, %eax
+	cmp	%eax, %edx
+	je	.L10
+	mov	$12, %eax
+	cmp	%eax, %edx
+	jne	.L12
+	push	$1
+	call	__print_int
+	add	$4, %esp
+.L10:
+.L9:
+.L12:
+	xor	%eax, %eax
+	add	$16, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	pr
+pr:
+	mov	4(%esp), %ecx
+	mov	8(%esp), %edx
+	call	.FCpr
+	ret
+.FCpr:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$8, %esp
+	mov	%edx, -8(%ebp)
+	push	%ecx
+	call	__print_int
+	add	$4, %esp
+	push	-8(%ebp)
+	call	__print_float
+	add	$4, %esp
+	add	$8, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
@@ -0,0 +1,166 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$24, %esp
+	xor	%eax, %eax
+	mov	%eax, -8(%ebp)
+	mov	$-2, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L1
+.L4:
+	lea	-20(%ebp), %eax
+	push	%eax
+	mov	-24(%ebp), %eax
+	cmp	$0, %eax
+	jle	.L6
+	mov	$1, %eax
+	jmp	.L7
+.L6:
+	xor	%eax, %eax
+.L7:
+	pop	%ebx
+	mov	%eax, (%ebx)
+.CLmain_sign.end2:
+	mov	-20(%ebp), %ebx
+	mov	-12(%ebp), %eax
+	imul	%ebx, %eax
+	mov	-8(%ebp), %ebx
+	add	%ebx, %eax
+	mov	%eax, -8(%ebp)
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+.L1:
+	mov	-4(%ebp), %eax
+	cmp	$3, %eax
+	jge	.L2
+	mov	-4(%ebp), %eax
+	mov	%eax, -16(%ebp)
+	mov	%eax, %ebx
+	imul	%eax, %eax
+	mov	%eax, -12(%ebp)
+	mov	%ebx, %eax
+	mov	%ebx, -24(%ebp)
+	cmp	$0, %eax
+	jge	.L4
+	mov	$-1, %eax
+	mov	%eax, -20(%ebp)
+	jmp	.CLmain_sign.end2
+.L2:
+	mov	$3, %eax
+	mov	%eax, -16(%ebp)
+	mov	$3, %ebx
+	imul	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	push	%eax
+	fildl	(%esp)
+	fstp	(%esp)
+	pop	%eax
+	mov	%eax, -24(%ebp)
+	mov	-8(%ebp), %eax
+	mov	%eax, -20(%ebp)
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-24(%ebp)
+	call	__print_float
+	add	$4, %esp
+	mov	-8(%ebp), %eax
+	mov	%eax, -16(%ebp)
+	cmp	$0, %eax
+	jge	.L8
+	mov	$-1, %eax
+	mov	%eax, -12(%ebp)
+	jmp	.CLmain_sign.end5
+.L8:
+	lea	-12(%ebp), %eax
+	push	%eax
+	mov	-16(%ebp), %eax
+	cmp	$0, %eax
+	jle	.L10
+	mov	$1, %eax
+	jmp	.L11
+.L10:
+	xor	%eax, %eax
+.L11:
+	pop	%ebx
+	mov	%eax, (%ebx)
+.CLmain_sign.end5:
+	mov	$1, %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	add	$24, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	show
+show:
+	mov	4(%esp), %ecx
+	mov	8(%esp), %edx
+	call	.FCshow
+	ret
+.FCshow:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$8, %esp
+	mov	%edx, -8(%ebp)
+	push	%ecx
+	call	__print_int
+	add	$4, %esp
+	push	-8(%ebp)
+	call	__print_float
+	add	$4, %esp
+	add	$8, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	sign
+sign:
+	mov	4(%esp), %ecx
+	call	.FCsign
+	ret
+.FCsign:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$4, %esp
+	mov	%ecx, -4(%ebp)
+	mov	%ecx, %eax
+	cmp	$0, %eax
+	jge	.L12
+	mov	$-1, %eax
+	jmp	.RLsign
+.L12:
+	mov	-4(%ebp), %eax
+	cmp	$0, %eax
+	jle	.L14
+	mov	$1, %eax
+	jmp	.L15
+.L14:
+	xor	%eax, %eax
+.L15:
+.RLsign:
+	add	$4, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	sq
+sq:
+	mov	4(%esp), %ecx
+	call	.FCsq
+	ret
+.FCsq:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$4, %esp
+	mov	%ecx, %eax
+	imul	%ecx, %eax
+	add	$4, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
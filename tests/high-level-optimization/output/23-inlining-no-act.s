@@ -0,0 +1,132 @@
+.data
+n:
+	.long	0
+.text
+.globl	fact
+fact:
+	mov	4(%esp), %ecx
+	call	.FCfact
+	ret
+.FCfact:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$4, %esp
+	mov	%ecx, -4(%ebp)
+	mov	%ecx, %eax
+	cmp	$2, %eax
+	jge	.L1
+	mov	$1, %eax
+	jmp	.RLfact
+.L1:
+	push	-4(%ebp)
+	mov	$1, %ebx
+	mov	-4(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, %ecx
+	call	.FCfact
+	mov	%eax, %ebx
+	pop	%eax
+	imul	%ebx, %eax
+.RLfact:
+	add	$4, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$16, %esp
+	xor	%eax, %eax
+	mov	%eax, -8(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	jmp	.L3
+.L10:
+	mov	-4(%ebp), %ecx
+	call	.FCodd
+	cmp	$0, %eax
+	jne	.L5
+	lea	-8(%ebp), %eax
+	push	%eax
+	push	-8(%ebp)
+	call	next
+	mov	%eax, %ebx
+	pop	%eax
+	add	%ebx, %eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+.L5:
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+.L3:
+	mov	-4(%ebp), %eax
+	cmp	$10, %eax
+	jl	.L10
+	push	-8(%ebp)
+	call	__print_int
+	add	$4, %esp
+	mov	$5, %eax
+	mov	%eax, -16(%ebp)
+	cmp	$2, %eax
+	jge	.L8
+	mov	$1, %eax
+	mov	%eax, -12(%ebp)
+	jmp	.CLmain_fact.end1
+.L8:
+	lea	-12(%ebp), %eax
+	push	%eax
+	push	-16(%ebp)
+	mov	$1, %ebx
+	mov	-16(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, %ecx
+	call	.FCfact
+	mov	%eax, %ebx
+	pop	%eax
+	imul	%ebx, %eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+.CLmain_fact.end1:
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	mov	n, %eax
+	add	$16, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	next
+next:
+	push	n
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, n
+	pop	%eax
+	mov	n, %eax
+	ret
+.globl	odd
+odd:
+	mov	4(%esp), %ecx
+	call	.FCodd
+	ret
+.FCodd:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$4, %esp
+	mov	%ecx, %eax
+	mov	%ecx, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ecx, %eax
+	and	$-2, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	add	$4, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
@@ -0,0 +1,243 @@
+.data
+.comm	a,64
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$24, %esp
+	xor	%eax, %eax
+	mov	%eax, a
+	mov	$3, %eax
+	mov	%eax, a+4
+	mov	$6, %eax
+	mov	%eax, a+8
+	mov	$9, %eax
+	mov	%eax, a+12
+	push	$10
+	call	__print_int
+	add	$4, %esp
+	push	$8
+	call	__print_int
+	add	$4, %esp
+	push	$6
+	call	__print_int
+	add	$4, %esp
+	mov	$4, %eax
+	mov	%eax, -4(%ebp)
+	mov	$3, %eax
+	mov	%eax, -12(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -20(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -16(%ebp)
+	xor	%eax, %eax
+	lea	a(, %eax, 4), %eax
+	mov	%eax, -24(%ebp)
+	jmp	.L1
+.L19:
+	mov	-24(%ebp), %ebx
+	mov	(%ebx), %ebx
+	mov	-20(%ebp), %eax
+	add	%ebx, %eax
+	mov	-24(%ebp), %ebx
+	mov	4(%ebx), %ebx
+	add	%ebx, %eax
+	mov	-24(%ebp), %ebx
+	mov	8(%ebx), %ebx
+	add	%ebx, %eax
+	mov	-24(%ebp), %ebx
+	mov	12(%ebx), %ebx
+	add	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	mov	$4, %ebx
+	mov	-16(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	mov	-24(%ebp), %ebx
+	lea	16(%ebx), %eax
+	mov	%eax, -24(%ebp)
+.L1:
+	mov	$3, %ebx
+	mov	-12(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-16(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L19
+	mov	-16(%ebp), %eax
+	lea	a(, %eax, 4), %eax
+	mov	%eax, -24(%ebp)
+	jmp	.L4
+.L20:
+	mov	-24(%ebp), %ebx
+	mov	(%ebx), %ebx
+	mov	-20(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	push	-16(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -16(%ebp)
+	mov	-24(%ebp), %ebx
+	lea	4(%ebx), %eax
+	mov	%eax, -24(%ebp)
+	pop	%eax
+.L4:
+	mov	-12(%ebp), %ebx
+	mov	-16(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L20
+	mov	-20(%ebp), %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	mov	$4, %eax
+	mov	%eax, -12(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -20(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -16(%ebp)
+	xor	%eax, %eax
+	lea	a(, %eax, 4), %eax
+	mov	%eax, -24(%ebp)
+	jmp	.L7
+.L21:
+	mov	-24(%ebp), %ebx
+	mov	(%ebx), %ebx
+	mov	-20(%ebp), %eax
+	add	%ebx, %eax
+	mov	-24(%ebp), %ebx
+	mov	4(%ebx), %ebx
+	add	%ebx, %eax
+	mov	-24(%ebp), %ebx
+	mov	8(%ebx), %ebx
+	add	%ebx, %eax
+	mov	-24(%ebp), %ebx
+	mov	12(%ebx), %ebx
+	add	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	mov	$4, %ebx
+	mov	-16(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	mov	-24(%ebp), %ebx
+	lea	16(%ebx), %eax
+	mov	%eax, -24(%ebp)
+.L7:
+	mov	$3, %ebx
+	mov	-12(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-16(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L21
+	mov	-16(%ebp), %eax
+	lea	a(, %eax, 4), %eax
+	mov	%eax, -24(%ebp)
+	jmp	.L10
+.L22:
+	mov	-24(%ebp), %ebx
+	mov	(%ebx), %ebx
+	mov	-20(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	push	-16(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -16(%ebp)
+	mov	-24(%ebp), %ebx
+	lea	4(%ebx), %eax
+	mov	%eax, -24(%ebp)
+	pop	%eax
+.L10:
+	mov	-12(%ebp), %ebx
+	mov	-16(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L22
+	mov	-20(%ebp), %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	mov	-4(%ebp), %eax
+	add	$24, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	sum
+sum:
+	mov	4(%esp), %ecx
+	call	.FCsum
+	ret
+.FCsum:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$16, %esp
+	mov	%ecx, -4(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -12(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -8(%ebp)
+	xor	%eax, %eax
+	lea	a(, %eax, 4), %eax
+	mov	%eax, -16(%ebp)
+	jmp	.L13
+.L23:
+	mov	-16(%ebp), %ebx
+	mov	(%ebx), %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	-16(%ebp), %ebx
+	mov	4(%ebx), %ebx
+	add	%ebx, %eax
+	mov	-16(%ebp), %ebx
+	mov	8(%ebx), %ebx
+	add	%ebx, %eax
+	mov	-16(%ebp), %ebx
+	mov	12(%ebx), %ebx
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	$4, %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -8(%ebp)
+	mov	-16(%ebp), %ebx
+	lea	16(%ebx), %eax
+	mov	%eax, -16(%ebp)
+.L13:
+	mov	$3, %ebx
+	mov	-4(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-8(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L23
+	mov	-8(%ebp), %eax
+	lea	a(, %eax, 4), %eax
+	mov	%eax, -16(%ebp)
+	jmp	.L16
+.L24:
+	mov	-16(%ebp), %ebx
+	mov	(%ebx), %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	push	-8(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%ebp)
+	mov	-16(%ebp), %ebx
+	lea	4(%ebx), %eax
+	mov	%eax, -16(%ebp)
+	pop	%eax
+.L16:
+	mov	-4(%ebp), %ebx
+	mov	-8(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L24
+	mov	-12(%ebp), %eax
+	add	$16, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
@@ -0,0 +1,326 @@
+.data
+.comm	a,40
+.comm	b,40
+.comm	x,40
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$32, %esp
+	mov	$10, %eax
+	mov	%eax, -8(%ebp)
+	mov	$1056964608, %eax
+	mov	%eax, -16(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	xor	%eax, %eax
+	lea	b(, %eax, 4), %eax
+	mov	%eax, -20(%ebp)
+	xor	%eax, %eax
+	lea	x(, %eax, 4), %eax
+	mov	%eax, -24(%ebp)
+	jmp	.L1
+.L17:
+	mov	-20(%ebp), %ebx
+	lea	(%ebx), %eax
+	push	%eax
+	mov	-4(%ebp), %eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-24(%ebp), %ebx
+	lea	(%ebx), %eax
+	push	%eax
+	push	-4(%ebp)
+	fildl	(%esp)
+	fstp	(%esp)
+	pop	%eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-20(%ebp), %ebx
+	lea	4(%ebx), %eax
+	push	%eax
+	mov	$1, %ebx
+	mov	-4(%ebp), %eax
+	add	%ebx, %eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-24(%ebp), %ebx
+	lea	4(%ebx), %eax
+	push	%eax
+	mov	$1, %ebx
+	mov	-4(%ebp), %eax
+	add	%ebx, %eax
+	push	%eax
+	fildl	(%esp)
+	fstp	(%esp)
+	pop	%eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-20(%ebp), %ebx
+	lea	8(%ebx), %eax
+	push	%eax
+	mov	$2, %ebx
+	mov	-4(%ebp), %eax
+	add	%ebx, %eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-24(%ebp), %ebx
+	lea	8(%ebx), %eax
+	push	%eax
+	mov	$2, %ebx
+	mov	-4(%ebp), %eax
+	add	%ebx, %eax
+	push	%eax
+	fildl	(%esp)
+	fstp	(%esp)
+	pop	%eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-20(%ebp), %ebx
+	lea	12(%ebx), %eax
+	push	%eax
+	mov	$3, %ebx
+	mov	-4(%ebp), %eax
+	add	%ebx, %eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-24(%ebp), %ebx
+	lea	12(%ebx), %eax
+	push	%eax
+	mov	$3, %ebx
+	mov	-4(%ebp), %eax
+	add	%ebx, %eax
+	push	%eax
+	fildl	(%esp)
+	fstp	(%esp)
+	pop	%eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	$4, %ebx
+	mov	-4(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -4(%ebp)
+	mov	-20(%ebp), %ebx
+	lea	16(%ebx), %eax
+	mov	%eax, -20(%ebp)
+	mov	-24(%ebp), %ebx
+	lea	16(%ebx), %eax
+	mov	%eax, -24(%ebp)
+.L1:
+	mov	$3, %ebx
+	mov	-8(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-4(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L17
+	mov	-4(%ebp), %eax
+	lea	b(, %eax, 4), %eax
+	mov	%eax, -20(%ebp)
+	mov	-4(%ebp), %eax
+	lea	x(, %eax, 4), %eax
+	mov	%eax, -24(%ebp)
+	jmp	.L4
+.L18:
+	mov	-20(%ebp), %ebx
+	lea	(%ebx), %eax
+	push	%eax
+	mov	-4(%ebp), %eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-24(%ebp), %ebx
+	lea	(%ebx), %eax
+	push	%eax
+	push	-4(%ebp)
+	fildl	(%esp)
+	fstp	(%esp)
+	pop	%eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	mov	-20(%ebp), %ebx
+	lea	4(%ebx), %eax
+	mov	%eax, -20(%ebp)
+	pop	%eax
+	mov	-24(%ebp), %ebx
+	lea	4(%ebx), %eax
+	mov	%eax, -24(%ebp)
+.L4:
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L18
+	xor	%eax, %eax
+	mov	%eax, -4(%ebp)
+	mov	$3, %eax
+	movd	%eax, %xmm0
+	punpckldq	%xmm0, %xmm0
+	punpcklqdq	%xmm0, %xmm0
+	mov	-16(%ebp), %eax
+	movd	%eax, %xmm1
+	punpckldq	%xmm1, %xmm1
+	punpcklqdq	%xmm1, %xmm1
+	jmp	.L7
+.L19:
+	mov	-4(%ebp), %eax
+	movdqu	b(, %eax, 4), %xmm2
+	movdqu	b(, %eax, 4), %xmm3
+	paddd	%xmm3, %xmm2
+	psubd	%xmm0, %xmm2
+	movdqu	%xmm2, a(, %eax, 4)
+	mov	-4(%ebp), %eax
+	movups	x(, %eax, 4), %xmm2
+	mulps	%xmm1, %xmm2
+	movups	%xmm2, x(, %eax, 4)
+	mov	$4, %ebx
+	mov	-4(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -4(%ebp)
+.L7:
+	mov	$3, %ebx
+	mov	-8(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-4(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L19
+	mov	-4(%ebp), %eax
+	lea	b(, %eax, 4), %eax
+	mov	%eax, -20(%ebp)
+	mov	-4(%ebp), %eax
+	lea	a(, %eax, 4), %eax
+	mov	%eax, -24(%ebp)
+	mov	-4(%ebp), %eax
+	lea	x(, %eax, 4), %eax
+	mov	%eax, -28(%ebp)
+	jmp	.L9
+.L20:
+	mov	-20(%ebp), %ebx
+	mov	(%ebx), %eax
+	mov	%eax, -32(%ebp)
+	mov	-24(%ebp), %ebx
+	lea	(%ebx), %eax
+	push	%eax
+	mov	-32(%ebp), %ebx
+	mov	%ebx, %eax
+	add	%ebx, %eax
+	mov	$3, %ebx
+	sub	%ebx, %eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-28(%ebp), %ebx
+	lea	(%ebx), %eax
+	push	%eax
+	push	(%ebx)
+	push	-16(%ebp)
+	fld	(%esp)
+	add	$4, %esp
+	fmul	(%esp)
+	fstp	(%esp)
+	pop	%eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	mov	-20(%ebp), %ebx
+	lea	4(%ebx), %eax
+	mov	%eax, -20(%ebp)
+	pop	%eax
+	mov	-24(%ebp), %ebx
+	lea	4(%ebx), %eax
+	mov	%eax, -24(%ebp)
+	mov	-28(%ebp), %ebx
+	lea	4(%ebx), %eax
+	mov	%eax, -28(%ebp)
+.L9:
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L20
+	xor	%eax, %eax
+	mov	%eax, -12(%ebp)
+	mov	$2, %eax
+	mov	%eax, -4(%ebp)
+	pxor	%xmm0, %xmm0
+	mov	$7, %eax
+	movd	%eax, %xmm1
+	punpckldq	%xmm1, %xmm1
+	punpcklqdq	%xmm1, %xmm1
+	jmp	.L12
+.L21:
+	mov	-4(%ebp), %eax
+	movdqu	a(, %eax, 4), %xmm2
+	pand	%xmm1, %xmm2
+	paddd	%xmm2, %xmm0
+	mov	$4, %ebx
+	add	%ebx, %eax
+	mov	%eax, -4(%ebp)
+.L12:
+	mov	$1, %ebx
+	mov	-8(%ebp), %eax
+	sub	%ebx, %eax
+	mov	$3, %ebx
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-4(%ebp), %eax
+	cmp	%ebx, %eax
+	jle	.L21
+	movdqa	%xmm0, %xmm2
+	psrldq	$8, %xmm2
+	paddd	%xmm2, %xmm0
+	movdqa	%xmm0, %xmm2
+	psrlq	$32, %xmm2
+	paddd	%xmm2, %xmm0
+	movd	%xmm0, %eax
+	add	%eax, -12(%ebp)
+	mov	-4(%ebp), %eax
+	lea	a(, %eax, 4), %eax
+	mov	%eax, -20(%ebp)
+	jmp	.L14
+.L22:
+	mov	-20(%ebp), %ebx
+	push	(%ebx)
+	mov	$7, %ebx
+	pop	%eax
+	and	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	mov	-20(%ebp), %ebx
+	lea	4(%ebx), %eax
+	mov	%eax, -20(%ebp)
+	pop	%eax
+.L14:
+	mov	$1, %ebx
+	mov	-8(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-4(%ebp), %eax
+	cmp	%ebx, %eax
+	jle	.L22
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	x+12
+	call	__print_float
+	add	$4, %esp
+	push	x+36
+	call	__print_float
+	add	$4, %esp
+	mov	a+36, %eax
+	add	$32, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
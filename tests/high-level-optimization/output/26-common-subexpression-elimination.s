@@ -0,0 +1,100 @@
+.data
+.comm	m,64
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$52, %esp
+	mov	$4, %eax
+	mov	%eax, -12(%ebp)
+	mov	$1, %eax
+	mov	%eax, -4(%ebp)
+	mov	$2, %eax
+	mov	%eax, -8(%ebp)
+	mov	$5, %eax
+	mov	%eax, m+24
+	mov	$9, %eax
+	mov	%eax, m+28
+	mov	$4, %ebx
+	mov	$1, %eax
+	imul	%ebx, %eax
+	mov	$2, %ebx
+	add	%ebx, %eax
+	mov	%eax, -36(%ebp)
+	push	m(, %eax, 4)
+	mov	$1, %ebx
+	add	%ebx, %eax
+	mov	m(, %eax, 4), %ebx
+	pop	%eax
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	mov	-36(%ebp), %eax
+	lea	m(, %eax, 4), %eax
+	push	%eax
+	mov	-16(%ebp), %eax
+	sal	$1, %eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-36(%ebp), %eax
+	mov	m(, %eax, 4), %eax
+	mov	%eax, -20(%ebp)
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-20(%ebp)
+	call	__print_int
+	add	$4, %esp
+	lea	-28(%ebp), %eax
+	mov	%eax, -32(%ebp)
+	mov	$3, %eax
+	mov	%eax, -28(%ebp)
+	mov	$4, %eax
+	mov	%eax, -24(%ebp)
+	mov	$3, %eax
+	mov	%eax, -40(%ebp)
+	mov	$3, %ebx
+	imul	%ebx, %eax
+	mov	%eax, -44(%ebp)
+	mov	$4, %eax
+	mov	%eax, -48(%ebp)
+	mov	$4, %ebx
+	imul	%ebx, %eax
+	mov	%eax, -52(%ebp)
+	mov	%eax, %ebx
+	mov	-44(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	cmp	$20, %eax
+	jle	.L1
+	mov	-48(%ebp), %ebx
+	mov	-44(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	jmp	.L2
+.L1:
+	mov	-52(%ebp), %eax
+	mov	%eax, -20(%ebp)
+.L2:
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-20(%ebp)
+	call	__print_int
+	add	$4, %esp
+	mov	-36(%ebp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$1, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$5, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	add	$52, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
@@ -0,0 +1,143 @@
+.data
+g:
+	.long	0
+.comm	m,64
+.text
+.globl	bump
+bump:
+	mov	4(%esp), %ecx
+	call	.FCbump
+	ret
+.FCbump:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$4, %esp
+	mov	g, %eax
+	add	%ecx, %eax
+	mov	%eax, g
+	add	$4, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$24, %esp
+	mov	$4, %eax
+	mov	%eax, -8(%ebp)
+	mov	$3, %eax
+	mov	%eax, g
+	mov	$2, %eax
+	mov	%eax, m+20
+	mov	$7, %eax
+	mov	%eax, m+24
+	mov	$4, %ebx
+	mov	$1, %eax
+	imul	%ebx, %eax
+	mov	$1, %ebx
+	add	%ebx, %eax
+	mov	m(, %eax, 4), %eax
+	lea	(%eax, %eax, 2), %eax
+	mov	%eax, -12(%ebp)
+	mov	$1, %eax
+	add	%ebx, %eax
+	mov	%eax, -4(%ebp)
+	mov	$4, %ebx
+	imul	%ebx, %eax
+	mov	$1, %ebx
+	add	%ebx, %eax
+	mov	m(, %eax, 4), %eax
+	lea	(%eax, %eax, 2), %eax
+	mov	%eax, -16(%ebp)
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	mov	-4(%ebp), %eax
+	lea	(%eax, %eax, 2), %eax
+	mov	m(, %eax, 4), %eax
+	sal	$1, %eax
+	mov	%eax, -12(%ebp)
+	push	-4(%ebp)
+	mov	(%esp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%ebp)
+	pop	%eax
+	mov	-4(%ebp), %eax
+	lea	(%eax, %eax, 2), %eax
+	mov	m(, %eax, 4), %eax
+	sal	$1, %eax
+	mov	%eax, -16(%ebp)
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	mov	-8(%ebp), %ebx
+	mov	g, %eax
+	imul	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	$2, %eax
+	mov	%eax, %ebx
+	mov	g, %eax
+	add	%ebx, %eax
+	mov	%eax, g
+	mov	-8(%ebp), %ebx
+	imul	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	mov	-8(%ebp), %ebx
+	mov	m+24, %eax
+	imul	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	$6, %eax
+	mov	%eax, m+20
+	mov	$1, %eax
+	mov	%eax, m+24
+	imul	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	mov	-16(%ebp), %ebx
+	mov	-12(%ebp), %eax
+	cmp	%ebx, %eax
+	jle	.L1
+	mov	$2, %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	mov	-8(%ebp), %ebx
+	mov	m(, %eax, 4), %eax
+	imul	%ebx, %eax
+	mov	%eax, -12(%ebp)
+.L1:
+	mov	$2, %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	mov	-8(%ebp), %ebx
+	mov	m(, %eax, 4), %eax
+	imul	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	mov	-16(%ebp), %ebx
+	mov	-12(%ebp), %eax
+	sub	%ebx, %eax
+	add	$24, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
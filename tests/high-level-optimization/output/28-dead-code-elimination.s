@@ -0,0 +1,126 @@
+.data
+.text
+.globl	branches
+branches:
+	mov	4(%esp), %ecx
+	call	.FCbranches
+	ret
+.FCbranches:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$12, %esp
+	mov	$1, %eax
+	mov	$10, %ebx
+	add	%ebx, %eax
+	mov	$7, %ebx
+	add	%ebx, %eax
+	mov	%eax, -8(%ebp)
+	mov	$2, %edx
+	mov	$1, %eax
+	cmp	%eax, %edx
+	je	.L1
+	mov	$2, %eax
+	cmp	%eax, %edx
+	jne	.L3
+.L1:
+	mov	$20, %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -8(%ebp)
+.L3:
+	mov	-8(%ebp), %eax
+	add	$12, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$24, %esp
+	mov	$5, %ecx
+	call	.FCsum
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	xor	%ecx, %ecx
+	call	.FCsum
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	mov	$3, %ecx
+	call	.FCbranches
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	mov	$4, %eax
+	add	$1, %eax
+	mov	$8, %ebx
+	add	%ebx, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$24, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	stores
+stores:
+	mov	4(%esp), %ecx
+	mov	8(%esp), %edx
+	call	.FCstores
+	ret
+.FCstores:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$20, %esp
+	mov	$4, %eax
+	add	$1, %eax
+	mov	%eax, -16(%ebp)
+	mov	$8, %eax
+	mov	%eax, %ebx
+	mov	-16(%ebp), %eax
+	add	%ebx, %eax
+	add	$20, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	sum
+sum:
+	mov	4(%esp), %ecx
+	call	.FCsum
+	ret
+.FCsum:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$16, %esp
+	mov	%ecx, -4(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -8(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -12(%ebp)
+	mov	$5, %eax
+	mov	%eax, -16(%ebp)
+	jmp	.CLsum_check
+.CLsum_body:
+	mov	-12(%ebp), %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -8(%ebp)
+	mov	%ebx, %eax
+	add	$1, %eax
+	mov	%eax, -12(%ebp)
+.CLsum_check:
+	mov	-4(%ebp), %ebx
+	mov	-12(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.CLsum_body
+	mov	-16(%ebp), %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	add	$16, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
@@ -0,0 +1,266 @@
+.data
+calls:
+	.long	0
+g:
+	.long	0
+.text
+.globl	escapes
+escapes:
+	mov	4(%esp), %ecx
+	call	.FCescapes
+	ret
+.FCescapes:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$24, %esp
+	mov	%ecx, -4(%ebp)
+	lea	-8(%ebp), %eax
+	mov	%eax, -12(%ebp)
+	mov	$3, %eax
+	mov	%eax, -8(%ebp)
+	mov	$1, %ebx
+	add	%ebx, %eax
+	mov	%eax, -8(%ebp)
+	mov	%ecx, g
+	mov	calls, %eax
+	add	%ebx, %eax
+	mov	%eax, calls
+	mov	$1, %eax
+	mov	%eax, -16(%ebp)
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	add	$24, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	jumps
+jumps:
+	mov	4(%esp), %ecx
+	call	.FCjumps
+	ret
+.FCjumps:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$8, %esp
+	xor	%eax, %eax
+	mov	$1, %ebx
+	add	%ebx, %eax
+	mov	%eax, -8(%ebp)
+	mov	%ecx, %eax
+	cmp	$5, %eax
+	jg	.CLjumps_inside
+	mov	-8(%ebp), %eax
+.RLjumps:
+	add	$8, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.CLjumps_inside:
+	mov	$1000, %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	jmp	.RLjumps
+.globl	loop
+loop:
+	mov	4(%esp), %ecx
+	call	.FCloop
+	ret
+.FCloop:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$12, %esp
+	mov	%ecx, -4(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -12(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -8(%ebp)
+	jmp	.L5
+.L17:
+	mov	-8(%ebp), %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	$1, %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	$2, %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	$3, %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	$4, %ebx
+	mov	-8(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -8(%ebp)
+.L5:
+	mov	$3, %ebx
+	mov	-4(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-8(%ebp), %eax
+	cmp	%ebx, %eax
+	jge	.L6
+	jmp	.L17
+.L18:
+	mov	-8(%ebp), %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	%ebx, %eax
+	add	$1, %eax
+	mov	%eax, -8(%ebp)
+.L6:
+	mov	-4(%ebp), %ebx
+	mov	-8(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L18
+	mov	-12(%ebp), %eax
+	add	$12, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$28, %esp
+	mov	$3, %ecx
+	call	.FCjumps
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	mov	$8, %ecx
+	call	.FCjumps
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	mov	$3, %eax
+	mov	%eax, -8(%ebp)
+	lea	-16(%ebp), %eax
+	mov	%eax, -12(%ebp)
+	mov	$3, %eax
+	mov	%eax, -16(%ebp)
+	mov	$1, %ebx
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	mov	$3, %eax
+	mov	%eax, g
+	mov	calls, %eax
+	add	%ebx, %eax
+	mov	%eax, calls
+	mov	$1, %eax
+	mov	%eax, -20(%ebp)
+	mov	-16(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -4(%ebp)
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	calls
+	call	__print_int
+	add	$4, %esp
+	push	g
+	call	__print_int
+	add	$4, %esp
+	mov	$10, %eax
+	mov	%eax, -8(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -12(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -16(%ebp)
+	jmp	.L11
+.L19:
+	mov	-16(%ebp), %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	$1, %ebx
+	mov	-16(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	$2, %ebx
+	mov	-16(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	$3, %ebx
+	mov	-16(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	$4, %ebx
+	mov	-16(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+.L11:
+	mov	$3, %ebx
+	mov	-8(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-16(%ebp), %eax
+	cmp	%ebx, %eax
+	jge	.L12
+	jmp	.L19
+.L20:
+	mov	-16(%ebp), %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	mov	%ebx, %eax
+	add	$1, %eax
+	mov	%eax, -16(%ebp)
+.L12:
+	mov	-8(%ebp), %ebx
+	mov	-16(%ebp), %eax
+	cmp	%ebx, %eax
+	jl	.L20
+	mov	-12(%ebp), %eax
+	mov	%eax, -4(%ebp)
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	add	$28, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	side
+side:
+	mov	4(%esp), %ecx
+	call	.FCside
+	ret
+.FCside:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$4, %esp
+	mov	$1, %ebx
+	mov	calls, %eax
+	add	%ebx, %eax
+	mov	%eax, calls
+	mov	%ecx, %eax
+	sal	$1, %eax
+	add	$4, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
@@ -0,0 +1,56 @@
+.data
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$20, %esp
+	xor	%eax, %eax
+	mov	%eax, -16(%ebp)
+	xor	%ebx, %ebx
+	xor	%eax, %eax
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	mov	$1, %ebx
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	mov	$2, %ebx
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	mov	$3, %ebx
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	lea	-20(%ebp), %eax
+	push	%eax
+	mov	-16(%ebp), %eax
+	cmp	$5, %eax
+	jle	.L1
+	mov	$1, %eax
+	jmp	.L2
+.L1:
+	xor	%eax, %eax
+.L2:
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-20(%ebp), %eax
+	cmp	$0, %eax
+	jne	.L4
+	mov	$1, %ebx
+	mov	-16(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, -16(%ebp)
+.L4:
+	mov	-16(%ebp), %eax
+	lea	(%eax, %eax, 2), %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	$7
+	call	__print_int
+	add	$4, %esp
+	mov	$3, %eax
+	add	$20, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
@@ -0,0 +1,76 @@
+.data
+g:
+	.long	0
+.text
+.globl	main
+main:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$20, %esp
+	mov	$2, %eax
+	mov	%eax, g
+	mov	$g, %eax
+	mov	%eax, -20(%ebp)
+	mov	$7, %eax
+	mov	%eax, g
+	cmp	$5, %eax
+	jle	.L1
+	mov	$3, %eax
+	mov	%eax, -8(%ebp)
+	jmp	.L2
+.L1:
+	mov	$4, %eax
+	mov	%eax, -8(%ebp)
+.L2:
+	mov	$1, %eax
+	mov	%eax, -12(%ebp)
+	lea	-12(%ebp), %eax
+	mov	%eax, -20(%ebp)
+	mov	$7, %eax
+	mov	%eax, -12(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -16(%ebp)
+	mov	-8(%ebp), %ebx
+	xor	%eax, %eax
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	mov	$2, %eax
+	mov	%eax, -8(%ebp)
+	mov	$2, %ebx
+	mov	-16(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	mov	g, %eax
+	add	%ebx, %eax
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	-12(%ebp)
+	call	__print_int
+	add	$4, %esp
+	push	-16(%ebp)
+	call	__print_int
+	add	$4, %esp
+	mov	-8(%ebp), %eax
+	add	$20, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	set
+set:
+	mov	4(%esp), %ecx
+	call	.FCset
+	ret
+.FCset:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$4, %esp
+	mov	$7, %eax
+	mov	%eax, (%ecx)
+	add	$4, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.end
@@ -0,0 +1,112 @@
+.data
+.text
+.globl	f
+f:
+	mov	4(%esp), %ecx
+	mov	8(%esp), %edx
+	push	12(%esp)
+	call	.FCf
+	add	$4, %esp
+	ret
+.FCf:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$28, %esp
+	mov	%ecx, -4(%ebp)
+	mov	%edx, -8(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -12(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -16(%ebp)
+	mov	8(%ebp), %eax
+	cmp	$0, %eax
+	je	.L1
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, -28(%ebp)
+	mov	%eax, -12(%ebp)
+	jmp	.L2
+.L1:
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, -28(%ebp)
+	mov	$1, %ebx
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+.L2:
+	mov	-8(%ebp), %ebx
+	mov	%ebx, %eax
+	imul	%ebx, %eax
+	mov	%eax, -24(%ebp)
+	mov	%eax, %ebx
+	mov	-28(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	jmp	.L3
+.L5:
+	mov	8(%ebp), %ebx
+	mov	-24(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, %ebx
+	mov	-20(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -20(%ebp)
+	mov	$1, %ebx
+	mov	8(%ebp), %eax
+	sub	%ebx, %eax
+	mov	%eax, 8(%ebp)
+.L3:
+	mov	8(%ebp), %eax
+	cmp	$0, %eax
+	jg	.L5
+	mov	-16(%ebp), %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	-20(%ebp), %ebx
+	add	%ebx, %eax
+	push	%eax
+	mov	8(%ebp), %ebx
+	mov	-24(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, %ebx
+	pop	%eax
+	add	%ebx, %eax
+	add	$28, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	main
+main:
+	push	$1
+	mov	$3, %ecx
+	mov	$4, %edx
+	call	.FCf
+	add	$4, %esp
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	$0
+	mov	$3, %ecx
+	mov	$4, %edx
+	call	.FCf
+	add	$4, %esp
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	$3
+	mov	$2, %ecx
+	mov	$5, %edx
+	call	.FCf
+	add	$4, %esp
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	$0
+	mov	$1, %ecx
+	mov	$1, %edx
+	call	.FCf
+	add	$4, %esp
+	ret
+.end
@@ -0,0 +1,137 @@
+.data
+.comm	m,16
+.text
+.globl	f
+f:
+	mov	4(%esp), %ecx
+	mov	8(%esp), %edx
+	push	12(%esp)
+	call	.FCf
+	add	$4, %esp
+	ret
+.FCf:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$20, %esp
+	mov	%ecx, -4(%ebp)
+	mov	%edx, -8(%ebp)
+	xor	%eax, %eax
+	mov	%eax, -12(%ebp)
+	mov	8(%ebp), %eax
+	cmp	$0, %eax
+	je	.L1
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, -12(%ebp)
+.L1:
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	mov	8(%ebp), %eax
+	cmp	$1, %eax
+	jle	.L3
+	mov	-4(%ebp), %eax
+	mov	-8(%ebp), %ebx
+	mov	m(, %eax, 4), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+	jmp	.L4
+.L3:
+	mov	-4(%ebp), %eax
+	mov	m(, %eax, 4), %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -12(%ebp)
+.L4:
+	mov	-4(%ebp), %eax
+	mov	%eax, -20(%ebp)
+	lea	m(, %eax, 4), %eax
+	push	%eax
+	mov	-20(%ebp), %eax
+	mov	$1, %ebx
+	mov	m(, %eax, 4), %eax
+	add	%ebx, %eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-4(%ebp), %eax
+	mov	m(, %eax, 4), %ebx
+	mov	-16(%ebp), %eax
+	add	%ebx, %eax
+	mov	-8(%ebp), %ebx
+	add	%ebx, %eax
+	mov	%eax, -16(%ebp)
+	mov	8(%ebp), %eax
+	cmp	$0, %eax
+	je	.L5
+	mov	$1, %ebx
+	mov	-4(%ebp), %eax
+	add	%ebx, %eax
+	mov	%eax, -4(%ebp)
+.L5:
+	mov	-16(%ebp), %ebx
+	mov	-12(%ebp), %eax
+	add	%ebx, %eax
+	push	%eax
+	mov	-8(%ebp), %ebx
+	mov	-4(%ebp), %eax
+	imul	%ebx, %eax
+	mov	%eax, %ebx
+	pop	%eax
+	add	%ebx, %eax
+	add	$20, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	g
+g:
+	mov	4(%esp), %ecx
+	call	.FCg
+	ret
+.FCg:
+	push	%ebp
+	mov	%esp, %ebp
+	sub	$4, %esp
+	mov	%ecx, -4(%ebp)
+	lea	m(, %ecx, 4), %eax
+	push	%eax
+	mov	$1, %ebx
+	mov	m(, %ecx, 4), %eax
+	add	%ebx, %eax
+	pop	%ebx
+	mov	%eax, (%ebx)
+	mov	-4(%ebp), %eax
+	add	$4, %esp
+	mov	%ebp, %esp
+	pop	%ebp
+	ret
+.globl	main
+main:
+	push	$1
+	mov	$1, %ecx
+	mov	$4, %edx
+	call	.FCf
+	add	$4, %esp
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	$0
+	mov	$2, %ecx
+	mov	$3, %edx
+	call	.FCf
+	add	$4, %esp
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	push	$2
+	mov	$3, %ecx
+	mov	$2, %edx
+	call	.FCf
+	add	$4, %esp
+	push	%eax
+	call	__print_int
+	add	$4, %esp
+	xor	%eax, %eax
+	ret
+.end
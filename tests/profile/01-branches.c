@@ -0,0 +1,48 @@
+int classify(int n)
+{
+	switch (n % 4) {
+	case 0:
+		return 10;
+	case 1:
+		return 20;
+	default:
+		return 30;
+	}
+}
+
+int collatz(int n)
+{
+	int steps;
+
+	steps = 0;
+
+	while (n != 1) {
+		if (n % 2 == 0) {
+			n = n / 2;
+		} else {
+			n = 3 * n + 1;
+		}
+		steps++;
+	}
+
+	return steps;
+}
+
+int main()
+{
+	int i, sum;
+
+	sum = 0;
+
+	for (i = 1; i <= 100; i++) {
+		sum = sum + classify(i);
+
+		if (i % 10 == 0) {
+			__print_int(collatz(i));
+		}
+	}
+
+	__print_int(sum);
+
+	return sum % 7;
+}
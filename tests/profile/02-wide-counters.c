@@ -0,0 +1,13 @@
+int main()
+{
+	int i, j;
+
+	for (i = 0; i < 65537; i++) {
+		for (j = 0; j < 65536; j++) {
+		}
+	}
+
+	__print_int(i);
+
+	return 0;
+}
@@ -0,0 +1,274 @@
+.data
+.SL1:
+	.string	"output/01-branches.profile"
+.comm	__profile_counts,128
+.text
+.globl	classify
+classify:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	__profile_counts(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts(%rip)
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$30, %eax
+	add	%ebx, %eax
+	and	$-4, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rdx
+	xor	%eax, %eax
+	cmp	%eax, %edx
+	je	.L1
+	mov	$1, %eax
+	cmp	%eax, %edx
+	je	.L2
+	mov	__profile_counts+24(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+24(%rip)
+	mov	$30, %rax
+.RLclassify:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.L1:
+	mov	__profile_counts+8(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+8(%rip)
+	mov	$10, %rax
+	jmp	.RLclassify
+.L2:
+	mov	__profile_counts+16(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+16(%rip)
+	mov	$20, %rax
+	jmp	.RLclassify
+.globl	collatz
+collatz:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$12, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	__profile_counts+32(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+32(%rip)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	mov	__profile_counts+40(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+40(%rip)
+	jmp	.L5
+.L7:
+	mov	__profile_counts+64(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+64(%rip)
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+.L8:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L5:
+	mov	-8(%rbp), %eax
+	cmp	$1, %eax
+	je	.L6
+	mov	__profile_counts+48(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+48(%rip)
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	and	$-2, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	cmp	$0, %eax
+	jne	.L7
+	mov	__profile_counts+56(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+56(%rip)
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	sar	$1, %eax
+	mov	%eax, -8(%rbp)
+	jmp	.L8
+.L6:
+	mov	-12(%rbp), %eax
+	add	$12, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	lea	.SL1(%rip), %rax
+	push	%rax
+	push	$16
+	lea	__profile_counts(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	16(%rax), %rdx
+	xor	%eax, %eax
+	call	__profile_init
+	pop	%rsp
+	add	$24, %rsp
+	mov	__profile_counts+72(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+72(%rip)
+	lea	-8(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	__profile_counts+80(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+80(%rip)
+	lea	-4(%rbp), %rax
+	push	%rax
+	mov	$1, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L9
+.L12:
+	mov	__profile_counts+120(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+120(%rip)
+.L13:
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+.L9:
+	mov	-4(%rbp), %eax
+	cmp	$100, %eax
+	jg	.L10
+	mov	__profile_counts+88(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+88(%rip)
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	__profile_counts+96(%rip), %eax
+	push	%rax
+	mov	__profile_counts+96(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+96(%rip)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	classify
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	mov	%ebx, %eax
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$10, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	cmp	$0, %eax
+	jne	.L12
+	mov	__profile_counts+104(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+104(%rip)
+	mov	__profile_counts+112(%rip), %eax
+	push	%rax
+	mov	__profile_counts+112(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+112(%rip)
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	collatz
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	mov	%ebx, %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	jmp	.L13
+.L10:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,221 @@
+.data
+.text
+.globl	classify
+classify:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	mov	%rdi, -8(%rbp)
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$30, %eax
+	add	%ebx, %eax
+	and	$-4, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	mov	%rax, %rdx
+	xor	%eax, %eax
+	cmp	%eax, %edx
+	je	.L1
+	mov	$1, %eax
+	cmp	%eax, %edx
+	je	.L2
+	mov	$30, %rax
+.RLclassify:
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.L1:
+	mov	$10, %rax
+	jmp	.RLclassify
+.L2:
+	mov	$20, %rax
+	jmp	.RLclassify
+.globl	collatz
+collatz:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$12, %rsp
+	mov	%rdi, -8(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -12(%rbp)
+	jmp	.L5
+.L7:
+	mov	-8(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+.L8:
+	mov	-12(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -12(%rbp)
+	pop	%rax
+.L5:
+	mov	-8(%rbp), %eax
+	cmp	$1, %eax
+	je	.L6
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	and	$-2, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	cmp	$0, %eax
+	jne	.L7
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	sar	$1, %eax
+	mov	%eax, -8(%rbp)
+	jmp	.L8
+.L6:
+	mov	-12(%rbp), %eax
+	add	$12, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$20, %rsp
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	mov	$1, %rax
+	mov	%eax, -4(%rbp)
+	jmp	.L9
+.L16:
+	mov	-16(%rbp), %eax
+	lea	(%rax, %rax, 2), %rax
+	mov	$1, %rbx
+	add	%ebx, %eax
+	mov	%eax, -16(%rbp)
+.L17:
+	mov	-20(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -20(%rbp)
+	pop	%rax
+.L14:
+	mov	-16(%rbp), %eax
+	cmp	$1, %eax
+	je	.L15
+	mov	-16(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	and	$-2, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	cmp	$0, %eax
+	jne	.L16
+	mov	-16(%rbp), %eax
+	mov	%eax, %ebx
+	sar	$31, %eax
+	shr	$31, %eax
+	add	%ebx, %eax
+	sar	$1, %eax
+	mov	%eax, -16(%rbp)
+	jmp	.L17
+.L15:
+	mov	-20(%rbp), %eax
+	mov	%eax, -12(%rbp)
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+.L12:
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+.L9:
+	mov	-4(%rbp), %eax
+	cmp	$100, %eax
+	jg	.L10
+	lea	-8(%rbp), %rax
+	push	%rax
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	classify
+	pop	%rsp
+	add	$8, %rsp
+	mov	%rax, %rbx
+	pop	%rax
+	add	%ebx, %eax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	mov	-4(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$1717986919, %eax
+	imul	%ebx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$10, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	cmp	$0, %eax
+	jne	.L12
+	mov	-4(%rbp), %eax
+	mov	%eax, -16(%rbp)
+	xor	%rax, %rax
+	mov	%eax, -20(%rbp)
+	jmp	.L14
+.L10:
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	mov	-8(%rbp), %eax
+	mov	%eax, %ebx
+	mov	$-1840700269, %eax
+	imul	%ebx
+	add	%ebx, %edx
+	sar	$2, %edx
+	mov	%edx, %eax
+	shr	$31, %eax
+	add	%edx, %eax
+	imul	$7, %eax
+	sub	%eax, %ebx
+	mov	%ebx, %eax
+	add	$20, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
@@ -0,0 +1,17 @@
+16
+100
+25
+25
+50
+10
+10
+147
+112
+35
+1
+1
+100
+100
+10
+10
+90
@@ -0,0 +1,108 @@
+.data
+.SL1:
+	.string	"output/02-wide-counters.profile"
+.comm	__profile_counts,40
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	lea	.SL1(%rip), %rax
+	push	%rax
+	push	$5
+	lea	__profile_counts(%rip), %rax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	mov	8(%rax), %rsi
+	mov	16(%rax), %rdx
+	xor	%eax, %eax
+	call	__profile_init
+	pop	%rsp
+	add	$24, %rsp
+	mov	__profile_counts(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts(%rip)
+	mov	__profile_counts+8(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+8(%rip)
+	lea	-4(%rbp), %rax
+	push	%rax
+	xor	%rax, %rax
+	pop	%rbx
+	mov	%eax, (%rbx)
+	jmp	.L1
+.L10:
+	mov	__profile_counts+32(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+32(%rip)
+	add	$1, %rax
+	mov	%rax, __profile_counts+32(%rip)
+	add	$1, %rax
+	mov	%rax, __profile_counts+32(%rip)
+	add	$1, %rax
+	mov	%rax, __profile_counts+32(%rip)
+	mov	-8(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -8(%rbp)
+.L4:
+	mov	-8(%rbp), %eax
+	cmp	$65533, %eax
+	jge	.L5
+	jmp	.L10
+.L11:
+	mov	__profile_counts+32(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+32(%rip)
+	mov	-8(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -8(%rbp)
+	pop	%rax
+.L5:
+	mov	-8(%rbp), %eax
+	cmp	$65536, %eax
+	jl	.L11
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+.L1:
+	mov	-4(%rbp), %eax
+	cmp	$65537, %eax
+	jge	.L2
+	mov	__profile_counts+16(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+16(%rip)
+	mov	__profile_counts+24(%rip), %rax
+	add	$1, %rax
+	mov	%rax, __profile_counts+24(%rip)
+	xor	%rax, %rax
+	mov	%eax, -8(%rbp)
+	jmp	.L4
+.L2:
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
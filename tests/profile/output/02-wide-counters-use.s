@@ -0,0 +1,48 @@
+.data
+.text
+.globl	main
+main:
+	push	%rbp
+	mov	%rsp, %rbp
+	sub	$8, %rsp
+	xor	%rax, %rax
+	mov	%eax, -4(%rbp)
+	jmp	.L1
+.L7:
+	mov	-4(%rbp), %eax
+	mov	$4, %rbx
+	add	%ebx, %eax
+	mov	%eax, -4(%rbp)
+.L1:
+	mov	-4(%rbp), %eax
+	cmp	$65534, %eax
+	jge	.L2
+	jmp	.L7
+.L8:
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	(%rsp), %eax
+	add	$1, %eax
+	mov	%eax, -4(%rbp)
+	pop	%rax
+.L2:
+	mov	-4(%rbp), %eax
+	cmp	$65537, %eax
+	jl	.L8
+	mov	-4(%rbp), %eax
+	push	%rax
+	mov	%rsp, %rax
+	and	$-16, %rsp
+	sub	$8, %rsp
+	push	%rax
+	mov	(%rax), %rdi
+	xor	%eax, %eax
+	call	__print_int
+	pop	%rsp
+	add	$8, %rsp
+	xor	%rax, %rax
+	add	$8, %rsp
+	mov	%rbp, %rsp
+	pop	%rbp
+	ret
+.end
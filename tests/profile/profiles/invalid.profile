@@ -0,0 +1,5 @@
+16
+100
+25
+25
+lots
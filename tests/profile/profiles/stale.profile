@@ -0,0 +1,4 @@
+3
+1
+2
+3
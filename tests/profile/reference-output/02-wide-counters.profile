@@ -0,0 +1,6 @@
+5
+1
+1
+65537
+65537
+4295032832